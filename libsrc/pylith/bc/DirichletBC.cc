@@ -36,6 +36,9 @@
 // Default constructor.
 pylith::bc::DirichletBC::DirichletBC(void)
 { // constructor
+  _constraintMap.section = NULL;
+  _constraintMap.sectionState = 0;
+  _constraintMap.storageSize = -1;
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -55,6 +58,16 @@ pylith::bc::DirichletBC::deallocate(void)
   TimeDependentPoints::deallocate();
   feassemble::Constraint::deallocate();
 
+  _constraintMap.offsets.resize(0);
+  _constraintMap.changeGroup.resize(0);
+  _constraintMap.initial.resize(0);
+  _constraintMap.rate.resize(0);
+  _constraintMap.rateTime.resize(0);
+  _constraintMap.change.resize(0);
+  PetscErrorCode err = PetscSectionDestroy(&_constraintMap.section);PYLITH_CHECK_ERROR(err);
+  _constraintMap.sectionState = 0;
+  _constraintMap.storageSize = -1;
+
   PYLITH_METHOD_END;
 } // deallocate
   
@@ -74,6 +87,7 @@ pylith::bc::DirichletBC::initialize(const topology::Mesh& mesh,
   assert(_normalizer);
   const PylithScalar lengthScale = _normalizer->lengthScale();
   _queryDatabases(mesh, lengthScale, "displacement");
+  _constraintMap.storageSize = -1;
 
   PYLITH_METHOD_END;
 } // initialize
@@ -201,31 +215,31 @@ pylith::bc::DirichletBC::setField(const PylithScalar t,
   if (0 == numFixedDOF)
     PYLITH_METHOD_END;
 
-  // Calculate spatial and temporal variation of value for BC.
-  _calculateValue(t);
-
-  // Get sections
-  assert(_parameters);
-  topology::Field& valueField = _parameters->get("value");
-  topology::VecVisitorMesh valueVisitor(valueField);
-  PetscScalar* valueArray = valueVisitor.localArray();
+  _setupConstraintMap(field);
 
   topology::VecVisitorMesh fieldVisitor(field);
   PetscScalar* fieldArray = fieldVisitor.localArray();
 
-  const int numPoints = _points.size();
-  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
-    PetscInt p_bc = _points[iPoint];
-
-    const PetscInt off = fieldVisitor.sectionOffset(p_bc);
-    const PetscInt voff = valueVisitor.sectionOffset(p_bc);
-    assert(numFixedDOF == valueVisitor.sectionDof(p_bc));
+  // Initial value and rate of change of value.
+  const int numConstrained = _constraintMap.offsets.size();
+  const int* offsets = (numConstrained > 0) ? &_constraintMap.offsets[0] : 0;
+  const PylithScalar* initial = (numConstrained > 0) ? &_constraintMap.initial[0] : 0;
+  const PylithScalar* rate = (numConstrained > 0) ? &_constraintMap.rate[0] : 0;
+  const PylithScalar* rateTime = (numConstrained > 0) ? &_constraintMap.rateTime[0] : 0;
+  for (int i=0; i < numConstrained; ++i) {
+    const PylithScalar tRel = t - rateTime[i];
+    fieldArray[offsets[i]] = initial[i] + ((tRel > 0.0) ? rate[i]*tRel : 0.0);
+  } // for
 
-    for(PetscInt iDOF = 0; iDOF < numFixedDOF; ++iDOF) {
-      assert(_bcDOF[iDOF] < fieldVisitor.sectionDof(p_bc));
-      fieldArray[_bcDOF[iDOF]+off] = valueArray[voff+iDOF];
+  // Change in value (zero before change starts).
+  if (_dbChange) {
+    _changeBatch.evaluate(&_changeScale, _dbTimeHistory, t, _getNormalizer().timeScale());
+    const PylithScalar* change = (numConstrained > 0) ? &_constraintMap.change[0] : 0;
+    const int* changeGroup = (numConstrained > 0) ? &_constraintMap.changeGroup[0] : 0;
+    for (int i=0; i < numConstrained; ++i) {
+      fieldArray[offsets[i]] += change[i]*_changeScale[changeGroup[i]];
     } // for
-  } // for
+  } // if
 
   PYLITH_METHOD_END;
 } // setField
@@ -243,30 +257,37 @@ pylith::bc::DirichletBC::setFieldIncr(const PylithScalar t0,
   if (0 == numFixedDOF)
     PYLITH_METHOD_END;
 
-  // Calculate spatial and temporal variation of value for BC.
-  _calculateValueIncr(t0, t1);
-
-  // Get sections
-  assert(_parameters);
-  topology::Field& valueField = _parameters->get("value");
-  topology::VecVisitorMesh valueVisitor(valueField);
-  PetscScalar* valueArray = valueVisitor.localArray();
+  _setupConstraintMap(field);
 
   topology::VecVisitorMesh fieldVisitor(field);
   PetscScalar* fieldArray = fieldVisitor.localArray();
 
-  const int numPoints = _points.size();
-  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
-    PetscInt p_bc = _points[iPoint];
+  // No contribution from initial value; rate of change integrated
+  // over portion of increment after rate dependence begins.
+  const int numConstrained = _constraintMap.offsets.size();
+  const int* offsets = (numConstrained > 0) ? &_constraintMap.offsets[0] : 0;
+  const PylithScalar* rate = (numConstrained > 0) ? &_constraintMap.rate[0] : 0;
+  const PylithScalar* rateTime = (numConstrained > 0) ? &_constraintMap.rateTime[0] : 0;
+  for (int i=0; i < numConstrained; ++i) {
+    const PylithScalar tRel0 = t0 - rateTime[i];
+    const PylithScalar tRel1 = t1 - rateTime[i];
+    const PylithScalar tIncr = ((tRel1 > 0.0) ? tRel1 : 0.0) - ((tRel0 > 0.0) ? tRel0 : 0.0);
+    fieldArray[offsets[i]] = rate[i]*tIncr;
+  } // for
 
-    const PetscInt off = fieldVisitor.sectionOffset(p_bc);
-    const PetscInt voff = valueVisitor.sectionOffset(p_bc);
-    assert(numFixedDOF == valueVisitor.sectionDof(p_bc));
-    for(PetscInt iDOF=0; iDOF < numFixedDOF; ++iDOF) {
-      assert(_bcDOF[iDOF] < fieldVisitor.sectionDof(p_bc));
-      fieldArray[_bcDOF[iDOF]+off] = valueArray[voff+iDOF];
+  // Change in value (zero before change starts).
+  if (_dbChange) {
+    const PylithScalar timeScale = _getNormalizer().timeScale();
+    _changeBatch.evaluate(&_changeScale, _dbTimeHistory, t0, timeScale);
+    _changeBatch.evaluate(&_changeScaleIncr, _dbTimeHistory, t1, timeScale);
+    _changeScaleIncr -= _changeScale;
+
+    const PylithScalar* change = (numConstrained > 0) ? &_constraintMap.change[0] : 0;
+    const int* changeGroup = (numConstrained > 0) ? &_constraintMap.changeGroup[0] : 0;
+    for (int i=0; i < numConstrained; ++i) {
+      fieldArray[offsets[i]] += change[i]*_changeScaleIncr[changeGroup[i]];
     } // for
-  } // for
+  } // if
 
   PYLITH_METHOD_END;
 } // setFieldIncr
@@ -284,5 +305,107 @@ pylith::bc::DirichletBC::verifyConfiguration(const topology::Mesh& mesh) const
   PYLITH_METHOD_END;
 } // verifyConfiguration
 
+// ----------------------------------------------------------------------
+// Setup map from constrained degrees of freedom to offsets in field.
+void
+pylith::bc::DirichletBC::_setupConstraintMap(const topology::Field& field)
+{ // _setupConstraintMap
+  PYLITH_METHOD_BEGIN;
+
+  // Offsets are only valid for the section used to build the map, so
+  // rebuild the map whenever the field has a different or modified
+  // section.
+  PetscErrorCode err = 0;
+  PetscSection section = field.localSection();assert(section);
+  PetscObjectState sectionState = 0;
+  err = PetscObjectStateGet((PetscObject) section, &sectionState);PYLITH_CHECK_ERROR(err);
+  const int storageSize = field.sectionSize();
+  if (section == _constraintMap.section &&
+      sectionState == _constraintMap.sectionState &&
+      storageSize == _constraintMap.storageSize)
+    PYLITH_METHOD_END;
+
+  assert(_parameters);
+
+  const int numFixedDOF = _bcDOF.size();
+  const int numPoints = _points.size();
+  const int numConstrained = numPoints * numFixedDOF;
+
+  _constraintMap.offsets.resize(numConstrained);
+  _constraintMap.changeGroup.resize(numConstrained);
+  _constraintMap.initial.resize(numConstrained);
+  _constraintMap.rate.resize(numConstrained);
+  _constraintMap.rateTime.resize(numConstrained);
+  _constraintMap.change.resize(numConstrained);
+  _constraintMap.changeGroup = 0;
+  _constraintMap.initial = 0.0;
+  _constraintMap.rate = 0.0;
+  _constraintMap.rateTime = 0.0;
+  _constraintMap.change = 0.0;
+
+  topology::VecVisitorMesh fieldVisitor(field);
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    const PetscInt p_bc = _points[iPoint];
+    const PetscInt off = fieldVisitor.sectionOffset(p_bc);
+    for (int iDOF=0; iDOF < numFixedDOF; ++iDOF) {
+      assert(_bcDOF[iDOF] < fieldVisitor.sectionDof(p_bc));
+      _constraintMap.offsets[iPoint*numFixedDOF+iDOF] = off + _bcDOF[iDOF];
+    } // for
+  } // for
+
+  if (_dbInitial) {
+    topology::VecVisitorMesh initialVisitor(_parameters->get("initial"));
+    const PetscScalar* initialArray = initialVisitor.localArray();
+    for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+      const PetscInt ioff = initialVisitor.sectionOffset(_points[iPoint]);
+      assert(numFixedDOF == initialVisitor.sectionDof(_points[iPoint]));
+      for (int iDOF=0; iDOF < numFixedDOF; ++iDOF) {
+	_constraintMap.initial[iPoint*numFixedDOF+iDOF] = initialArray[ioff+iDOF];
+      } // for
+    } // for
+  } // if
+
+  if (_dbRate) {
+    topology::VecVisitorMesh rateVisitor(_parameters->get("rate"));
+    const PetscScalar* rateArray = rateVisitor.localArray();
+    topology::VecVisitorMesh rateTimeVisitor(_parameters->get("rate time"));
+    const PetscScalar* rateTimeArray = rateTimeVisitor.localArray();
+    for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+      const PetscInt roff = rateVisitor.sectionOffset(_points[iPoint]);
+      assert(numFixedDOF == rateVisitor.sectionDof(_points[iPoint]));
+      const PetscInt rtoff = rateTimeVisitor.sectionOffset(_points[iPoint]);
+      assert(1 == rateTimeVisitor.sectionDof(_points[iPoint]));
+      for (int iDOF=0; iDOF < numFixedDOF; ++iDOF) {
+	_constraintMap.rate[iPoint*numFixedDOF+iDOF] = rateArray[roff+iDOF];
+	_constraintMap.rateTime[iPoint*numFixedDOF+iDOF] = rateTimeArray[rtoff];
+      } // for
+    } // for
+  } // if
+
+  if (_dbChange) {
+    topology::VecVisitorMesh changeVisitor(_parameters->get("change"));
+    const PetscScalar* changeArray = changeVisitor.localArray();
+    for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+      const PetscInt coff = changeVisitor.sectionOffset(_points[iPoint]);
+      assert(numFixedDOF == changeVisitor.sectionDof(_points[iPoint]));
+      const int group = _changeBatch.group(iPoint);
+      for (int iDOF=0; iDOF < numFixedDOF; ++iDOF) {
+	_constraintMap.change[iPoint*numFixedDOF+iDOF] = changeArray[coff+iDOF];
+	_constraintMap.changeGroup[iPoint*numFixedDOF+iDOF] = group;
+      } // for
+    } // for
+  } // if
+
+  // Hold reference, so the section cannot be destroyed and its address
+  // reused by another section.
+  err = PetscObjectReference((PetscObject) section);PYLITH_CHECK_ERROR(err);
+  err = PetscSectionDestroy(&_constraintMap.section);PYLITH_CHECK_ERROR(err);
+  _constraintMap.section = section;
+  _constraintMap.sectionState = sectionState;
+  _constraintMap.storageSize = storageSize;
+
+  PYLITH_METHOD_END;
+} // _setupConstraintMap
+
 
 // End of file 
@@ -29,7 +29,8 @@
 #include "TimeDependentPoints.hh" // ISA TimeDependentPoints
 #include "pylith/feassemble/Constraint.hh" // ISA Constraint
 
-#include "pylith/utils/array.hh" // HASA int_array
+#include "pylith/utils/array.hh" // HASA int_array, scalar_array
+#include "pylith/utils/types.hh" // HASA PetscSection, PetscObjectState
 
 // DirichletBC ------------------------------------------------------
 /// @brief Dirichlet (prescribed values at degrees of freedom) boundary
@@ -112,6 +113,18 @@ protected :
    */
   const spatialdata::units::Nondimensional& _getNormalizer(void) const;
 
+  /** Setup map from constrained degrees of freedom to offsets in
+   * field along with coefficients for the temporal variation of values.
+   *
+   * All fields passed to setField() and setFieldIncr() share the
+   * layout of the solution field. The map is rebuilt only if the local
+   * section of the field differs from the one used to build it (section
+   * pointer, PETSc object state of the section, or storage size).
+   *
+   * @param field Solution field.
+   */
+  void _setupConstraintMap(const topology::Field& field);
+
   // PROTECTED MEMBERS //////////////////////////////////////////////////
 protected :
 
@@ -119,6 +132,20 @@ protected :
   /// associated with this DirichletBC boundary condition.
   int_array _offsetLocal;
 
+  /// Constrained degrees of freedom in local field (structure of arrays).
+  struct ConstraintMap {
+    int_array offsets; ///< Offset of constrained DOF in local field.
+    int_array changeGroup; ///< Index of change start time for DOF.
+    scalar_array initial; ///< Initial value.
+    scalar_array rate; ///< Rate of change of value.
+    scalar_array rateTime; ///< Time when rate of change begins.
+    scalar_array change; ///< Change in value.
+    PetscSection section; ///< Local section of field used to build map (holds reference).
+    PetscObjectState sectionState; ///< State of section when map was built.
+    int storageSize; ///< Storage size of field used to build map.
+  }; // ConstraintMap
+  ConstraintMap _constraintMap; ///< Map of constrained DOF.
+
   // NOT IMPLEMENTED ////////////////////////////////////////////////////
 private :
 
@@ -56,6 +56,7 @@ pylith::bc::TimeDependentPoints::deallocate(void)
 
   BoundaryConditionPoints::deallocate();
   TimeDependent::deallocate();
+  _changeBatch.deallocate();
 
   PYLITH_METHOD_END;
 } // deallocate
@@ -205,6 +206,19 @@ pylith::bc::TimeDependentPoints::_queryDatabases(const topology::Mesh& mesh,
     
     if (_dbTimeHistory)
       _dbTimeHistory->open();
+
+    // Group points by change start time, so the time history is
+    // queried once per distinct start time.
+    topology::VecVisitorMesh changeTimeVisitor(_parameters->get("change time"));
+    const PetscScalar* changeTimeArray = changeTimeVisitor.localArray();
+    const int numPoints = _points.size();
+    scalar_array changeTimes(numPoints);
+    for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+      const PetscInt ctoff = changeTimeVisitor.sectionOffset(_points[iPoint]);
+      assert(1 == changeTimeVisitor.sectionDof(_points[iPoint]));
+      changeTimes[iPoint] = changeTimeArray[ctoff];
+    } // for
+    _changeBatch.initialize((numPoints > 0) ? &changeTimes[0] : 0, numPoints);
   } // if
   
   // Dellocate memory
@@ -295,26 +309,6 @@ pylith::bc::TimeDependentPoints::_calculateValue(const PylithScalar t)
   topology::Field& valueField = _parameters->get("value");
   topology::VecVisitorMesh valueVisitor(valueField);
   PetscScalar* valueArray = valueVisitor.localArray();
-  
-  topology::Field* initialField = (_dbInitial) ? &_parameters->get("initial") : 0;
-  topology::VecVisitorMesh* initialVisitor = (initialField) ? new topology::VecVisitorMesh(*initialField) : 0;
-  PetscScalar* initialArray = (initialVisitor) ? initialVisitor->localArray() : NULL;
-
-  topology::Field* rateField = (_dbRate) ? &_parameters->get("rate") : 0;
-  topology::VecVisitorMesh* rateVisitor = (rateField) ? new topology::VecVisitorMesh(*rateField) : 0;
-  PetscScalar* rateArray = (rateVisitor) ? rateVisitor->localArray() : NULL;
-
-  topology::Field* rateTimeField = (_dbRate) ? &_parameters->get("rate time") : 0;
-  topology::VecVisitorMesh* rateTimeVisitor = (rateTimeField) ? new topology::VecVisitorMesh(*rateTimeField) : 0;
-  PetscScalar* rateTimeArray = (rateTimeVisitor) ? rateTimeVisitor->localArray() : NULL;
-
-  topology::Field* changeField = (_dbChange) ? &_parameters->get("change") : 0;
-  topology::VecVisitorMesh* changeVisitor = (changeField) ? new topology::VecVisitorMesh(*changeField) : 0;
-  PetscScalar* changeArray = (changeVisitor) ? changeVisitor->localArray() : NULL;
-
-  topology::Field* changeTimeField = (_dbChange) ? &_parameters->get("change time") : 0;
-  topology::VecVisitorMesh* changeTimeVisitor = (changeTimeField) ? new topology::VecVisitorMesh(*changeTimeField) : 0;
-  PetscScalar* changeTimeArray = (changeTimeVisitor) ? changeTimeVisitor->localArray() : NULL;
 
   const int numPoints = _points.size();
   const int numBCDOF = _bcDOF.size();
@@ -326,68 +320,70 @@ pylith::bc::TimeDependentPoints::_calculateValue(const PylithScalar t)
     for (PetscInt d = 0; d < numBCDOF; ++d) {
       valueArray[voff+d] = 0.0;
     } // for
+  } // for
+
+  // Contribution from initial value
+  if (_dbInitial) {
+    topology::VecVisitorMesh initialVisitor(_parameters->get("initial"));
+    const PetscScalar* initialArray = initialVisitor.localArray();
+
+    for(int iPoint=0; iPoint < numPoints; ++iPoint) {
+      const int p_bc = _points[iPoint]; // Get point label
 
-    // Contribution from initial value
-    if (_dbInitial) {
-      assert(initialVisitor);
-      const PetscInt ioff = initialVisitor->sectionOffset(p_bc);
-      assert(numBCDOF == initialVisitor->sectionDof(p_bc));
+      const PetscInt voff = valueVisitor.sectionOffset(p_bc);
+      const PetscInt ioff = initialVisitor.sectionOffset(p_bc);
+      assert(numBCDOF == initialVisitor.sectionDof(p_bc));
       for (PetscInt d = 0; d < numBCDOF; ++d) {
         valueArray[voff+d] += initialArray[ioff+d];
       } // for
-    } // if
+    } // for
+  } // if
     
-    // Contribution from rate of change of value
-    if (_dbRate) {
-      assert(rateVisitor);
-      const PetscInt roff = rateVisitor->sectionOffset(p_bc);
-      assert(numBCDOF == rateVisitor->sectionDof(p_bc));
-      assert(rateTimeVisitor);
-      const PetscInt rtoff = rateTimeVisitor->sectionOffset(p_bc);
-      assert(1 == rateTimeVisitor->sectionDof(p_bc));
+  // Contribution from rate of change of value
+  if (_dbRate) {
+    topology::VecVisitorMesh rateVisitor(_parameters->get("rate"));
+    const PetscScalar* rateArray = rateVisitor.localArray();
+
+    topology::VecVisitorMesh rateTimeVisitor(_parameters->get("rate time"));
+    const PetscScalar* rateTimeArray = rateTimeVisitor.localArray();
+
+    for(int iPoint=0; iPoint < numPoints; ++iPoint) {
+      const int p_bc = _points[iPoint]; // Get point label
+
+      const PetscInt voff = valueVisitor.sectionOffset(p_bc);
+      const PetscInt roff = rateVisitor.sectionOffset(p_bc);
+      assert(numBCDOF == rateVisitor.sectionDof(p_bc));
+      const PetscInt rtoff = rateTimeVisitor.sectionOffset(p_bc);
+      assert(1 == rateTimeVisitor.sectionDof(p_bc));
 
       const PylithScalar tRel = t - rateTimeArray[rtoff];
       if (tRel > 0.0)  // rate of change integrated over time
 	for(int iDim = 0; iDim < numBCDOF; ++iDim) {
 	  valueArray[voff+iDim] += rateArray[roff+iDim] * tRel;
 	} // for
-    } // if
+    } // for
+  } // if
 
-    // Contribution from change of value
-    if (_dbChange) {
-      assert(changeVisitor);
-      const PetscInt coff = changeVisitor->sectionOffset(p_bc);
-      assert(numBCDOF == changeVisitor->sectionDof(p_bc));
-      const PetscInt ctoff = changeTimeVisitor->sectionOffset(p_bc);
-      assert(1 == changeTimeVisitor->sectionDof(p_bc));
-
-      const PylithScalar tRel = t - changeTimeArray[ctoff];
-      if (tRel >= 0) { // change in value over time
-	PylithScalar scale = 1.0;
-	if (_dbTimeHistory) {
-	  PylithScalar tDim = tRel;
-	  _getNormalizer().dimensionalize(&tDim, 1, timeScale);
-	  const int err = _dbTimeHistory->query(&scale, tDim);
-	  if (err) {
-	    std::ostringstream msg;
-	    msg << "Error querying for time '" << tDim 
-		<< "' in time history database '"
-		<< _dbTimeHistory->label() << "'.";
-	    throw std::runtime_error(msg.str());
-	  } // if
-	} // if
-	for (int iDim = 0; iDim < numBCDOF; ++iDim) {
-	  valueArray[voff+iDim] += changeArray[coff+iDim]*scale;
-	} // for
-      } // if
-    } // if
-  } // for
+  // Contribution from change of value (zero before change starts)
+  if (_dbChange) {
+    _changeBatch.evaluate(&_changeScale, _dbTimeHistory, t, timeScale);
+
+    topology::VecVisitorMesh changeVisitor(_parameters->get("change"));
+    const PetscScalar* changeArray = changeVisitor.localArray();
+
+    for(int iPoint=0; iPoint < numPoints; ++iPoint) {
+      const int p_bc = _points[iPoint]; // Get point label
 
-  delete initialVisitor; initialVisitor = 0;
-  delete rateVisitor; rateVisitor = 0;
-  delete rateTimeVisitor; rateTimeVisitor = 0;
-  delete changeVisitor; changeVisitor = 0;
-  delete changeTimeVisitor; changeTimeVisitor = 0;
+      const PetscInt voff = valueVisitor.sectionOffset(p_bc);
+      const PetscInt coff = changeVisitor.sectionOffset(p_bc);
+      assert(numBCDOF == changeVisitor.sectionDof(p_bc));
+
+      const PylithScalar scale = _changeScale[_changeBatch.group(iPoint)];
+      for (int iDim = 0; iDim < numBCDOF; ++iDim) {
+	valueArray[voff+iDim] += changeArray[coff+iDim]*scale;
+      } // for
+    } // for
+  } // if
 
   PYLITH_METHOD_END;
 }  // _calculateValue
@@ -408,25 +404,6 @@ pylith::bc::TimeDependentPoints::_calculateValueIncr(const PylithScalar t0,
   topology::Field& valueField = _parameters->get("value");
   topology::VecVisitorMesh valueVisitor(valueField);
   PetscScalar* valueArray = valueVisitor.localArray();
-  
-  topology::Field* initialField = (_dbInitial) ? &_parameters->get("initial") : 0;
-  topology::VecVisitorMesh* initialVisitor = (initialField) ? new topology::VecVisitorMesh(*initialField) : 0;
-
-  topology::Field* rateField = (_dbRate) ? &_parameters->get("rate") : 0;
-  topology::VecVisitorMesh* rateVisitor = (rateField) ? new topology::VecVisitorMesh(*rateField) : 0;
-  PetscScalar* rateArray = (rateVisitor) ? rateVisitor->localArray() : NULL;
-
-  topology::Field* rateTimeField = (_dbRate) ? &_parameters->get("rate time") : 0;
-  topology::VecVisitorMesh* rateTimeVisitor = (rateTimeField) ? new topology::VecVisitorMesh(*rateTimeField) : 0;
-  PetscScalar* rateTimeArray = (rateTimeVisitor) ? rateTimeVisitor->localArray() : NULL;
-
-  topology::Field* changeField = (_dbChange) ? &_parameters->get("change") : 0;
-  topology::VecVisitorMesh* changeVisitor = (changeField) ? new topology::VecVisitorMesh(*changeField) : 0;
-  PetscScalar* changeArray = (changeVisitor) ? changeVisitor->localArray() : NULL;
-
-  topology::Field* changeTimeField = (_dbChange) ? &_parameters->get("change time") : 0;
-  topology::VecVisitorMesh* changeTimeVisitor = (changeTimeField) ? new topology::VecVisitorMesh(*changeTimeField) : 0;
-  PetscScalar* changeTimeArray = (changeTimeVisitor) ? changeTimeVisitor->localArray() : NULL;
 
   const int numPoints = _points.size();
   const int numBCDOF = _bcDOF.size();
@@ -438,16 +415,26 @@ pylith::bc::TimeDependentPoints::_calculateValueIncr(const PylithScalar t0,
     for (PetscInt d = 0; d < numBCDOF; ++d) {
       valueArray[voff+d] = 0.0;
     } // for
+  } // for
 
-    // No contribution from initial value
+  // No contribution from initial value
     
-    // Contribution from rate of change of value
-    if (_dbRate) {
-      const PetscInt roff = rateVisitor->sectionOffset(p_bc);
-      assert(numBCDOF == rateVisitor->sectionDof(p_bc));
-      assert(rateTimeVisitor);
-      const PetscInt rtoff = rateTimeVisitor->sectionOffset(p_bc);
-      assert(1 == rateTimeVisitor->sectionDof(p_bc));
+  // Contribution from rate of change of value
+  if (_dbRate) {
+    topology::VecVisitorMesh rateVisitor(_parameters->get("rate"));
+    const PetscScalar* rateArray = rateVisitor.localArray();
+
+    topology::VecVisitorMesh rateTimeVisitor(_parameters->get("rate time"));
+    const PetscScalar* rateTimeArray = rateTimeVisitor.localArray();
+
+    for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+      const int p_bc = _points[iPoint]; // Get point label
+
+      const PetscInt voff = valueVisitor.sectionOffset(p_bc);
+      const PetscInt roff = rateVisitor.sectionOffset(p_bc);
+      assert(numBCDOF == rateVisitor.sectionDof(p_bc));
+      const PetscInt rtoff = rateTimeVisitor.sectionOffset(p_bc);
+      assert(1 == rateTimeVisitor.sectionDof(p_bc));
 
       // Account for when rate dependence begins.
       const PylithScalar tRate = rateTimeArray[rtoff];
@@ -462,69 +449,32 @@ pylith::bc::TimeDependentPoints::_calculateValueIncr(const PylithScalar t0,
       if (tIncr > 0.0)  // rate of change integrated over time
         for(PetscInt d = 0; d < numBCDOF; ++d)
           valueArray[voff+d] += rateArray[roff+d] * tIncr;
-    } // if
+    } // for
+  } // if
     
-    // Contribution from change of value
-    if (_dbChange) {
-      assert(changeVisitor);
-      const PetscInt coff = changeVisitor->sectionOffset(p_bc);
-      assert(numBCDOF == changeVisitor->sectionDof(p_bc));
-      const PetscInt ctoff = changeTimeVisitor->sectionOffset(p_bc);
-      assert(1 == changeTimeVisitor->sectionDof(p_bc));
-
-      const PylithScalar tChange = changeTimeArray[ctoff];
-      if (t0 >= tChange) { // increment is after change starts
-        PylithScalar scale0 = 1.0;
-        PylithScalar scale1 = 1.0;
-        if (_dbTimeHistory) {
-          PylithScalar tDim = t0 - tChange;
-          _getNormalizer().dimensionalize(&tDim, 1, timeScale);
-          int err = _dbTimeHistory->query(&scale0, tDim);
-          if (err) {
-            std::ostringstream msg;
-            msg << "Error querying for time '" << tDim 
-                << "' in time history database '"
-                << _dbTimeHistory->label() << "'.";
-            throw std::runtime_error(msg.str());
-          } // if
-          tDim = t1 - tChange;
-          _getNormalizer().dimensionalize(&tDim, 1, timeScale);
-          err = _dbTimeHistory->query(&scale1, tDim);
-          if (err) {
-            std::ostringstream msg;
-            msg << "Error querying for time '" << tDim 
-                << "' in time history database '"
-                << _dbTimeHistory->label() << "'.";
-            throw std::runtime_error(msg.str());
-          } // if
-        } // if
-        for(PetscInt d = 0; d < numBCDOF; ++d)
-          valueArray[voff+d] += changeArray[coff+d] * (scale1 - scale0);
-      } else if (t1 >= tChange) { // increment spans when change starts
-        PylithScalar scale1 = 1.0;
-        if (_dbTimeHistory) {
-          PylithScalar tDim = t1 - tChange;
-          _getNormalizer().dimensionalize(&tDim, 1, timeScale);
-          int err = _dbTimeHistory->query(&scale1, tDim);
-          if (err) {
-            std::ostringstream msg;
-            msg << "Error querying for time '" << tDim 
-                << "' in time history database "
-                << _dbTimeHistory->label() << ".";
-            throw std::runtime_error(msg.str());
-          } // if
-        } // if
-        for(PetscInt d = 0; d < numBCDOF; ++d)
-          valueArray[voff+d] += changeArray[coff+d] * scale1;
-      } // if/else
-    } // if
-  } // for
+  // Contribution from change of value
+  if (_dbChange) {
+    // Amplitude is zero before change starts, so the increment is
+    // A(t1) - A(t0) for all points.
+    _changeBatch.evaluate(&_changeScale, _dbTimeHistory, t0, timeScale);
+    _changeBatch.evaluate(&_changeScaleIncr, _dbTimeHistory, t1, timeScale);
+    _changeScaleIncr -= _changeScale;
+
+    topology::VecVisitorMesh changeVisitor(_parameters->get("change"));
+    const PetscScalar* changeArray = changeVisitor.localArray();
+
+    for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+      const int p_bc = _points[iPoint]; // Get point label
 
-  delete initialVisitor; initialVisitor = 0;
-  delete rateVisitor; rateVisitor = 0;
-  delete rateTimeVisitor; rateTimeVisitor = 0;
-  delete changeVisitor; changeVisitor = 0;
-  delete changeTimeVisitor; changeTimeVisitor = 0;
+      const PetscInt voff = valueVisitor.sectionOffset(p_bc);
+      const PetscInt coff = changeVisitor.sectionOffset(p_bc);
+      assert(numBCDOF == changeVisitor.sectionDof(p_bc));
+
+      const PylithScalar scaleIncr = _changeScaleIncr[_changeBatch.group(iPoint)];
+      for(PetscInt d = 0; d < numBCDOF; ++d)
+        valueArray[voff+d] += changeArray[coff+d] * scaleIncr;
+    } // for
+  } // if
 
   PYLITH_METHOD_END;
 }  // _calculateValueIncr
@@ -28,8 +28,9 @@
 // Include directives ---------------------------------------------------
 #include "BoundaryConditionPoints.hh" // ISA BoundaryConditionPoints
 #include "TimeDependent.hh" // ISA TimeDependent
+#include "TimeHistoryBatch.hh" // HASA TimeHistoryBatch
 
-#include "pylith/utils/array.hh" // HASA int_array
+#include "pylith/utils/array.hh" // HASA int_array, scalar_array
 
 // TimeDependentPoints ------------------------------------------------------
 /// Time dependent boundary conditions applied to a set of vertices.
@@ -123,6 +124,10 @@ protected :
 
   int_array _bcDOF; ///< Degrees of freedom associated with BC.
 
+  TimeHistoryBatch _changeBatch; ///< Points grouped by change start time.
+  scalar_array _changeScale; ///< Time history amplitude for each group.
+  scalar_array _changeScaleIncr; ///< Increment in amplitude for each group.
+
   // NOT IMPLEMENTED ////////////////////////////////////////////////////
 private :
 
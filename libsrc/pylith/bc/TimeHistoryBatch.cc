@@ -0,0 +1,128 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TimeHistoryBatch.hh" // implementation of object methods
+
+#include "spatialdata/spatialdb/TimeHistory.hh" // USES TimeHistory
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <vector> // USES std::vector
+#include <algorithm> // USES std::sort(), std::unique(), std::lower_bound()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+// Default constructor.
+pylith::bc::TimeHistoryBatch::TimeHistoryBatch(void)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor.
+pylith::bc::TimeHistoryBatch::~TimeHistoryBatch(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate data structures.
+void
+pylith::bc::TimeHistoryBatch::deallocate(void)
+{ // deallocate
+  _onsetTimes.resize(0);
+  _groups.resize(0);
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Group points by onset time.
+void
+pylith::bc::TimeHistoryBatch::initialize(const PylithScalar* onsetTimes,
+					 const int numPoints)
+{ // initialize
+  PYLITH_METHOD_BEGIN;
+
+  assert( (!onsetTimes && 0 == numPoints) || (onsetTimes && 0 < numPoints) );
+
+  std::vector<PylithScalar> distinct(onsetTimes, onsetTimes+numPoints);
+  std::sort(distinct.begin(), distinct.end());
+  distinct.erase(std::unique(distinct.begin(), distinct.end()), distinct.end());
+
+  const int numGroups = distinct.size();
+  _onsetTimes.resize(numGroups);
+  for (int i=0; i < numGroups; ++i) {
+    _onsetTimes[i] = distinct[i];
+  } // for
+
+  _groups.resize(numPoints);
+  for (int iPoint=0; iPoint < numPoints; ++iPoint) {
+    _groups[iPoint] = std::lower_bound(distinct.begin(), distinct.end(), onsetTimes[iPoint]) - distinct.begin();
+    assert(distinct[_groups[iPoint]] == onsetTimes[iPoint]);
+  } // for
+
+  PYLITH_METHOD_END;
+} // initialize
+
+// ----------------------------------------------------------------------
+// Evaluate amplitude of time history for each group of points.
+void
+pylith::bc::TimeHistoryBatch::evaluate(scalar_array* amplitudes,
+				       spatialdata::spatialdb::TimeHistory* const th,
+				       const PylithScalar t,
+				       const PylithScalar timeScale) const
+{ // evaluate
+  PYLITH_METHOD_BEGIN;
+
+  assert(amplitudes);
+
+  const int numGroups = _onsetTimes.size();
+  if (int(amplitudes->size()) != numGroups) {
+    amplitudes->resize(numGroups);
+  } // if
+
+  // Onset times are sorted, so stop at the first group that has not started.
+  int iGroup = 0;
+  for (; iGroup < numGroups && _onsetTimes[iGroup] <= t; ++iGroup) {
+    if (th) {
+      const PylithScalar tDim = (t - _onsetTimes[iGroup]) * timeScale;
+      PylithScalar amplitude = 0.0;
+      const int err = th->query(&amplitude, tDim);
+      if (err) {
+	std::ostringstream msg;
+	msg << "Error querying for time '" << tDim
+	    << "' in time history database '"
+	    << th->label() << "'.";
+	throw std::runtime_error(msg.str());
+      } // if
+      (*amplitudes)[iGroup] = amplitude;
+    } else {
+      (*amplitudes)[iGroup] = 1.0;
+    } // if/else
+  } // for
+  for (; iGroup < numGroups; ++iGroup) {
+    (*amplitudes)[iGroup] = 0.0;
+  } // for
+
+  PYLITH_METHOD_END;
+} // evaluate
+
+
+// End of file 
@@ -0,0 +1,120 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/** @file libsrc/bc/TimeHistoryBatch.hh
+ *
+ * @brief C++ object for evaluating a time history at a set of points
+ * that share onset times.
+ */
+
+#if !defined(pylith_bc_timehistorybatch_hh)
+#define pylith_bc_timehistorybatch_hh
+
+// Include directives ---------------------------------------------------
+#include "bcfwd.hh" // forward declarations
+
+#include "spatialdata/spatialdb/spatialdbfwd.hh" // USES TimeHistory
+
+#include "pylith/utils/array.hh" // HASA int_array, scalar_array
+
+// TimeHistoryBatch -----------------------------------------------------
+/** @brief Evaluate a time history at a set of points.
+ *
+ * Points are grouped by their onset time, so the time history is
+ * queried once per distinct onset time rather than once per
+ * point. The groups are sorted by onset time, so groups that have not
+ * started are skipped without evaluating the relative time.
+ */
+class pylith::bc::TimeHistoryBatch
+{ // class TimeHistoryBatch
+  friend class TestTimeHistoryBatch; // unit testing
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Default constructor.
+  TimeHistoryBatch(void);
+
+  /// Destructor.
+  ~TimeHistoryBatch(void);
+
+  /// Deallocate data structures.
+  void deallocate(void);
+
+  /** Group points by onset time.
+   *
+   * @param onsetTimes Array of onset times (nondimensional) for points.
+   * @param numPoints Number of points.
+   */
+  void initialize(const PylithScalar* onsetTimes,
+		  const int numPoints);
+
+  /** Get number of points.
+   *
+   * @returns Number of points.
+   */
+  int numPoints(void) const;
+
+  /** Get number of distinct onset times.
+   *
+   * @returns Number of groups of points.
+   */
+  int numGroups(void) const;
+
+  /** Get group (distinct onset time) for point.
+   *
+   * @param iPoint Index of point.
+   * @returns Index of group.
+   */
+  int group(const int iPoint) const;
+
+  /** Evaluate amplitude of time history for each group of points.
+   *
+   * The amplitude is zero before the onset time. If the time history
+   * is NULL, the amplitude is one after the onset time.
+   *
+   * @param amplitudes Array of amplitudes for groups [numGroups].
+   * @param th Time history (may be NULL).
+   * @param t Time (nondimensional).
+   * @param timeScale Time scale for dimensionalizing relative time.
+   */
+  void evaluate(scalar_array* amplitudes,
+		spatialdata::spatialdb::TimeHistory* const th,
+		const PylithScalar t,
+		const PylithScalar timeScale) const;
+
+  // PRIVATE MEMBERS ////////////////////////////////////////////////////
+private :
+
+  scalar_array _onsetTimes; ///< Sorted, distinct onset times.
+  int_array _groups; ///< Index of onset time for each point.
+
+  // NOT IMPLEMENTED ////////////////////////////////////////////////////
+private :
+
+  TimeHistoryBatch(const TimeHistoryBatch&); ///< Not implemented.
+  const TimeHistoryBatch& operator=(const TimeHistoryBatch&); ///< Not implemented.
+
+}; // class TimeHistoryBatch
+
+#include "TimeHistoryBatch.icc" // inline methods
+
+#endif // pylith_bc_timehistorybatch_hh
+
+
+// End of file 
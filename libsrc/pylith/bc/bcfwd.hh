@@ -35,6 +35,7 @@ namespace pylith {
     class BCIntegratorSubMesh;
     class TimeDependent;
     class TimeDependentPoints;
+    class TimeHistoryBatch;
     class TimeDependentSubMesh;
     class DirichletBC;
     class DirichletBoundary;
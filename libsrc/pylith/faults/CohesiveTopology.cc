@@ -24,6 +24,10 @@
 #include "pylith/topology/Mesh.hh" // USES Mesh
 
 #include <cassert> // USES assert()
+#include <cstdlib> // USES abs()
+#include <stdexcept> // USES std::runtime_error, std::logic_error
+#include <sstream> // USES std::ostringstream
+#include <utility> // USES std::pair
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 
@@ -85,6 +89,7 @@ pylith::faults::CohesiveTopology::createFault(topology::Mesh* faultMesh,
     err = ISDestroy(&subpointIS);PYLITH_CHECK_ERROR(err);
   } // if
   err = DMPlexOrient(subdm);PYLITH_CHECK_ERROR(err);
+  _orientFaultParallel(subdm, dmMesh);
 
   std::string submeshLabel = "fault_" + std::string(groupName);
   faultMesh->dmMesh(subdm, submeshLabel.c_str());
@@ -117,27 +122,86 @@ pylith::faults::CohesiveTopology::create(topology::Mesh* mesh,
   err = DMPlexGetSubpointMap(faultMesh.dmMesh(), &subpointMap);PYLITH_CHECK_ERROR(err);
   err = DMLabelDuplicate(subpointMap, &label);PYLITH_CHECK_ERROR(err);
   err = DMLabelClearStratum(label, mesh->dimension());PYLITH_CHECK_ERROR(err);
-  // Fix over-aggressive completion of boundary label
+  // Fix over-aggressive completion of boundary label. The number of
+  // fault edges on the boundary attached to each vertex is counted in
+  // bulk (and summed across processes if the mesh is distributed)
+  // rather than querying the labels for every face.
   err = DMGetDimension(dm, &dim);PYLITH_CHECK_ERROR(err);
-  if (faultBdLabel && (dim > 2)) {
-    PetscIS         bdIS;
-    const PetscInt *bd;
-    PetscInt        fStart, fEnd, n, i;
-
+  PetscInt hasBdLocal = faultBdLabel ? 1 : 0;
+  PetscInt hasBd = 0;
+  err = MPI_Allreduce(&hasBdLocal, &hasBd, 1, MPIU_INT, MPI_MAX, PetscObjectComm((PetscObject) dm));PYLITH_CHECK_ERROR(err);
+  if (hasBd && (dim > 2)) {
+    PetscInt pStart, pEnd, vStart, vEnd, eStart, eEnd, fStart, fEnd;
+
+    err = DMPlexGetChart(dm, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetDepthStratum(dm, 0, &vStart, &vEnd);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetDepthStratum(dm, 1, &eStart, &eEnd);PYLITH_CHECK_ERROR(err);
     err = DMPlexGetHeightStratum(dm, 1, &fStart, &fEnd);PYLITH_CHECK_ERROR(err);
-    err = DMLabelGetStratumIS(faultBdLabel, 1, &bdIS);PYLITH_CHECK_ERROR(err);
-    err = ISGetLocalSize(bdIS, &n);PYLITH_CHECK_ERROR(err);
-    err = ISGetIndices(bdIS, &bd);PYLITH_CHECK_ERROR(err);
-    for (i = 0; i < n; ++i) {
+
+    std::vector<bool> inFault(pEnd-pStart, false);
+    std::vector<bool> onBd(pEnd-pStart, false);
+    std::vector<bool> cleared(pEnd-pStart, false);
+    _markPoints(&inFault, label, pStart);
+    if (faultBdLabel) {
+      _markPoints(&onBd, faultBdLabel, pStart);
+    } // if
+
+    // Edges shared across processes are counted only by their owner.
+    PetscSF sfPoint = NULL;
+    PetscInt nroots = -1, nleaves = 0;
+    const PetscInt* leaves = NULL;
+    err = DMGetPointSF(dm, &sfPoint);PYLITH_CHECK_ERROR(err);
+    err = PetscSFGetGraph(sfPoint, &nroots, &nleaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+    std::vector<bool> isGhost(pEnd-pStart, false);
+    for (PetscInt l = 0; l < nleaves && nroots >= 0; ++l) {
+      const PetscInt p = leaves ? leaves[l] : l;
+      isGhost[p-pStart] = true;
+    } // for
+
+    std::vector<PetscInt> bdCount(pEnd-pStart, 0);
+    for (PetscInt e = eStart; e < eEnd; ++e) {
+      if (!inFault[e-pStart] || !onBd[e-pStart] || isGhost[e-pStart]) continue;
+      const PetscInt *verts = NULL;
+      err = DMPlexGetCone(dm, e, &verts);PYLITH_CHECK_ERROR(err);
+      ++bdCount[verts[0]-pStart];
+      ++bdCount[verts[1]-pStart];
+    } // for
+    if (nroots >= 0) {
+      std::vector<PetscInt> rootCount(bdCount);
+      err = PetscSFReduceBegin(sfPoint, MPIU_INT, &bdCount[0], &rootCount[0], MPI_SUM);PYLITH_CHECK_ERROR(err);
+      err = PetscSFReduceEnd(sfPoint, MPIU_INT, &bdCount[0], &rootCount[0], MPI_SUM);PYLITH_CHECK_ERROR(err);
+      err = PetscSFBcastBegin(sfPoint, MPIU_INT, &rootCount[0], &bdCount[0]);PYLITH_CHECK_ERROR(err);
+      err = PetscSFBcastEnd(sfPoint, MPIU_INT, &rootCount[0], &bdCount[0]);PYLITH_CHECK_ERROR(err);
+      for (PetscInt p = pStart; p < pEnd; ++p) {
+	if (!isGhost[p-pStart]) {
+	  bdCount[p-pStart] = rootCount[p-pStart];
+	} // if
+      } // for
+    } // if
+
+    PetscIS         bdIS = NULL;
+    const PetscInt *bd = NULL;
+    PetscInt        n = 0;
+
+    if (faultBdLabel) {
+      err = DMLabelGetStratumIS(faultBdLabel, 1, &bdIS);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (bdIS) {
+      err = ISGetLocalSize(bdIS, &n);PYLITH_CHECK_ERROR(err);
+      err = ISGetIndices(bdIS, &bd);PYLITH_CHECK_ERROR(err);
+    } // if
+    for (PetscInt i = 0; i < n; ++i) {
       const PetscInt p = bd[i];
 
       // Remove faces
       if ((p >= fStart) && (p < fEnd)) {
-        const PetscInt *edges,   *verts, *supportA, *supportB;
-        PetscInt        numEdges, numVerts, supportSizeA, sA, supportSizeB, sB, val, bval, e, s;
+        const PetscInt *edges, *verts;
+        PetscInt        numEdges, numVerts, e;
         PetscBool       found = PETSC_FALSE;
 
         err = DMLabelClearValue(faultBdLabel, p, 1);PYLITH_CHECK_ERROR(err);
+        onBd[p-pStart] = false;
+        cleared[p-pStart] = true;
         // Remove the cross edge
         err = DMPlexGetCone(dm, p, &edges);PYLITH_CHECK_ERROR(err);
         err = DMPlexGetConeSize(dm, p, &numEdges);PYLITH_CHECK_ERROR(err);
@@ -154,22 +218,14 @@ pylith::faults::CohesiveTopology::create(topology::Mesh* mesh,
             msg << "Internal error while creating fault mesh. Edge "<<edges[e]<<" has "<<numVerts<<" vertices != 2.";
             throw std::logic_error(msg.str());
           }
-          err = DMPlexGetSupportSize(dm, verts[0], &supportSizeA);PYLITH_CHECK_ERROR(err);
-          err = DMPlexGetSupport(dm, verts[0], &supportA);PYLITH_CHECK_ERROR(err);
-          for (s = 0, sA = 0; s < supportSizeA; ++s) {
-            err = DMLabelGetValue(label, supportA[s], &val);PYLITH_CHECK_ERROR(err);
-            err = DMLabelGetValue(faultBdLabel, supportA[s], &bval);PYLITH_CHECK_ERROR(err);
-            if (val >= 0 && bval >= 0) ++sA;
-          }
-          err = DMPlexGetSupportSize(dm, verts[1], &supportSizeB);PYLITH_CHECK_ERROR(err);
-          err = DMPlexGetSupport(dm, verts[1], &supportB);PYLITH_CHECK_ERROR(err);
-          for (s = 0, sB = 0; s < supportSizeB; ++s) {
-            err = DMLabelGetValue(label, supportB[s], &val);PYLITH_CHECK_ERROR(err);
-            err = DMLabelGetValue(faultBdLabel, supportB[s], &bval);PYLITH_CHECK_ERROR(err);
-            if (val >= 0 && bval >= 0) ++sB;
-          }
-          if ((sA > 2) && (sB > 2)) {
+          if ((bdCount[verts[0]-pStart] > 2) && (bdCount[verts[1]-pStart] > 2)) {
             err = DMLabelClearValue(faultBdLabel, edges[e], 1);PYLITH_CHECK_ERROR(err);
+            if (inFault[edges[e]-pStart] && onBd[edges[e]-pStart]) {
+              --bdCount[verts[0]-pStart];
+              --bdCount[verts[1]-pStart];
+            }
+            onBd[edges[e]-pStart] = false;
+            cleared[edges[e]-pStart] = true;
             found = PETSC_TRUE;
             break;
           }
@@ -181,11 +237,17 @@ pylith::faults::CohesiveTopology::create(topology::Mesh* mesh,
         }
       }
     }
-    err = ISRestoreIndices(bdIS, &bd);PYLITH_CHECK_ERROR(err);
-    err = ISDestroy(&bdIS);PYLITH_CHECK_ERROR(err);
+    if (bdIS) {
+      err = ISRestoreIndices(bdIS, &bd);PYLITH_CHECK_ERROR(err);
+      err = ISDestroy(&bdIS);PYLITH_CHECK_ERROR(err);
+    } // if
+    _syncLabel(dm, faultBdLabel, &cleared);
   }
   // Completes the set of cells scheduled to be replaced
   err = DMPlexLabelCohesiveComplete(dm, label, faultBdLabel, PETSC_FALSE, faultMesh.dmMesh());PYLITH_CHECK_ERROR(err);
+  // Points on partition boundaries must be split the same way on
+  // every process.
+  _syncLabel(dm, label, NULL);
   err = DMPlexConstructCohesiveCells(dm, label, &sdm);PYLITH_CHECK_ERROR(err);
 
   err = DMGetLabel(sdm, "material-id", &mlabel);PYLITH_CHECK_ERROR(err);
@@ -246,5 +308,368 @@ pylith::faults::CohesiveTopology::createFaultParallel(topology::Mesh* faultMesh,
   PYLITH_METHOD_END;
 } // createFaultParallel
 
+// ----------------------------------------------------------------------
+// Orient fault mesh consistently across processes.
+void
+pylith::faults::CohesiveTopology::_orientFaultParallel(PetscDM dmFault,
+						       PetscDM dmMesh)
+{ // _orientFaultParallel
+  PYLITH_METHOD_BEGIN;
+
+  assert(dmFault);
+  assert(dmMesh);
+  PetscErrorCode err;
+
+  MPI_Comm comm = PetscObjectComm((PetscObject) dmMesh);
+  PetscMPIInt commSize = 1, commRank = 0;
+  err = MPI_Comm_size(comm, &commSize);PYLITH_CHECK_ERROR(err);
+  err = MPI_Comm_rank(comm, &commRank);PYLITH_CHECK_ERROR(err);
+
+  PetscSF sfPoint = NULL;
+  PetscInt nroots = -1;
+  err = DMGetPointSF(dmMesh, &sfPoint);PYLITH_CHECK_ERROR(err);
+  err = PetscSFGetGraph(sfPoint, &nroots, NULL, NULL, NULL);PYLITH_CHECK_ERROR(err);
+  PetscInt faultDim = 0;
+  err = DMGetDimension(dmFault, &faultDim);PYLITH_CHECK_ERROR(err);
+  // Nothing is shared until the mesh has been distributed.
+  if (commSize < 2 || nroots < 0 || faultDim < 1) {
+    PYLITH_METHOD_END;
+  } // if
+
+  PetscInt pStart, pEnd, cStart, cEnd;
+  err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHeightStratum(dmFault, 0, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+
+  PetscIS subpointIS = NULL;
+  const PetscInt* subpoints = NULL;
+  err = DMPlexCreateSubpointIS(dmFault, &subpointIS);PYLITH_CHECK_ERROR(err);
+  if (subpointIS) {
+    err = ISGetIndices(subpointIS, &subpoints);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  // Find connected pieces of the local fault.
+  std::vector<PetscInt> component(cEnd-cStart, -1);
+  PetscInt numComponents = 0;
+  std::vector<PetscInt> queue;
+  for (PetscInt c = cStart; c < cEnd; ++c) {
+    if (component[c-cStart] >= 0) continue;
+    component[c-cStart] = numComponents;
+    queue.clear();
+    queue.push_back(c);
+    for (size_t q = 0; q < queue.size(); ++q) {
+      const PetscInt *cone = NULL;
+      PetscInt coneSize = 0;
+      err = DMPlexGetConeSize(dmFault, queue[q], &coneSize);PYLITH_CHECK_ERROR(err);
+      err = DMPlexGetCone(dmFault, queue[q], &cone);PYLITH_CHECK_ERROR(err);
+      for (PetscInt k = 0; k < coneSize; ++k) {
+	const PetscInt *support = NULL;
+	PetscInt supportSize = 0;
+	err = DMPlexGetSupportSize(dmFault, cone[k], &supportSize);PYLITH_CHECK_ERROR(err);
+	err = DMPlexGetSupport(dmFault, cone[k], &support);PYLITH_CHECK_ERROR(err);
+	for (PetscInt s = 0; s < supportSize; ++s) {
+	  if (support[s] >= cStart && support[s] < cEnd && component[support[s]-cStart] < 0) {
+	    component[support[s]-cStart] = numComponents;
+	    queue.push_back(support[s]);
+	  } // if
+	} // for
+      } // for
+    } // for
+    ++numComponents;
+  } // for
+  PetscInt componentOffset = 0;
+  PetscInt numComponentsGlobal = 0;
+  err = MPI_Scan(&numComponents, &componentOffset, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+  componentOffset -= numComponents;
+  err = MPI_Allreduce(&numComponents, &numComponentsGlobal, 1, MPIU_INT, MPI_SUM, comm);PYLITH_CHECK_ERROR(err);
+
+  // Orientation of each fault cell relative to its face in the domain
+  // mesh and of each facet of the fault relative to the fault cell
+  // using it. A facet used by two local fault cells is interior to
+  // the local fault and does not constrain the orientation. Values
+  // are stored as (component, sign), with |sign| = 2 for facets.
+  std::vector<PetscInt> pointInfo(2*(pEnd-pStart)+2, -1);
+  std::vector<PetscInt> facetCount(pEnd-pStart, 0);
+  for (PetscInt c = cStart; c < cEnd; ++c) {
+    const PetscInt *faultCone = NULL, *faultOrnt = NULL, *meshCone = NULL;
+    PetscInt coneSize = 0;
+    err = DMPlexGetConeSize(dmFault, c, &coneSize);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetCone(dmFault, c, &faultCone);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetConeOrientation(dmFault, c, &faultOrnt);PYLITH_CHECK_ERROR(err);
+    const PetscInt face = subpoints[c];
+    err = DMPlexGetCone(dmMesh, face, &meshCone);PYLITH_CHECK_ERROR(err);
+    assert(coneSize >= 2);
+
+    PetscInt sign = 1;
+    if (2 == coneSize) {
+      sign = (subpoints[faultCone[0]] == meshCone[0]) ? 1 : -1;
+    } else {
+      PetscInt i = 0;
+      while (i < coneSize && meshCone[i] != subpoints[faultCone[0]]) ++i;
+      assert(i < coneSize);
+      sign = (subpoints[faultCone[1]] == meshCone[(i+1) % coneSize]) ? 1 : -1;
+    } // if/else
+    const PetscInt comp = componentOffset + component[c-cStart];
+    pointInfo[2*(face-pStart)  ] = comp;
+    pointInfo[2*(face-pStart)+1] = sign;
+
+    for (PetscInt k = 0; k < coneSize; ++k) {
+      const PetscInt facet = subpoints[faultCone[k]];
+      const PetscInt facetSign = (1 == faultDim) ? (1 == k ? 1 : -1) : (faultOrnt[k] >= 0 ? 1 : -1);
+      if (++facetCount[facet-pStart] == 1) {
+	pointInfo[2*(facet-pStart)  ] = comp;
+	pointInfo[2*(facet-pStart)+1] = 2*facetSign;
+      } else {
+	pointInfo[2*(facet-pStart)  ] = -1;
+	pointInfo[2*(facet-pStart)+1] = -1;
+      } // if/else
+    } // for
+  } // for
+  if (subpointIS) {
+    err = ISRestoreIndices(subpointIS, &subpoints);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&subpointIS);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  // Gather orientation of shared points at their owners.
+  const PetscInt* degree = NULL;
+  err = PetscSFComputeDegreeBegin(sfPoint, &degree);PYLITH_CHECK_ERROR(err);
+  err = PetscSFComputeDegreeEnd(sfPoint, &degree);PYLITH_CHECK_ERROR(err);
+  PetscInt numGathered = 0;
+  for (PetscInt p = 0; p < nroots; ++p) {
+    numGathered += degree[p];
+  } // for
+  std::vector<PetscInt> gathered(2*numGathered+2, -1);
+  err = PetscSFGatherBegin(sfPoint, MPIU_2INT, &pointInfo[0], &gathered[0]);PYLITH_CHECK_ERROR(err);
+  err = PetscSFGatherEnd(sfPoint, MPIU_2INT, &pointInfo[0], &gathered[0]);PYLITH_CHECK_ERROR(err);
+
+  // Each constraint is (component A, component B, parity), where
+  // parity is the product of the flips required for A and B.
+  std::vector<PetscInt> constraints;
+  for (PetscInt p = 0, iGathered = 0; p < nroots; iGathered += degree[p], ++p) {
+    if (!degree[p]) continue;
+    std::vector<PetscInt> entries;
+    if (pointInfo[2*p] >= 0) {
+      entries.push_back(pointInfo[2*p]);
+      entries.push_back(pointInfo[2*p+1]);
+    } // if
+    for (PetscInt i = 0; i < degree[p]; ++i) {
+      if (gathered[2*(iGathered+i)] >= 0) {
+	entries.push_back(gathered[2*(iGathered+i)]);
+	entries.push_back(gathered[2*(iGathered+i)+1]);
+      } // if
+    } // for
+    const size_t numEntries = entries.size() / 2;
+    if (numEntries < 2) continue;
+    const bool isFacet = (2 == abs(entries[1]));
+    if (isFacet) {
+      // Neighboring fault cells traverse a shared facet in opposite directions.
+      if (2 != numEntries) continue;
+      constraints.push_back(entries[0]);
+      constraints.push_back(entries[2]);
+      constraints.push_back(-(entries[1]/2)*(entries[3]/2));
+    } else {
+      // Copies of the same fault cell have the same orientation.
+      for (size_t i = 1; i < numEntries; ++i) {
+	constraints.push_back(entries[0]);
+	constraints.push_back(entries[2*i]);
+	constraints.push_back(entries[1]*entries[2*i+1]);
+      } // for
+    } // if/else
+  } // for
+
+  // Resolve the flips for all pieces of the fault on one process.
+  PetscMPIInt numConstraintsLocal = constraints.size();
+  std::vector<PetscMPIInt> numConstraints(commSize, 0);
+  err = MPI_Gather(&numConstraintsLocal, 1, MPI_INT, &numConstraints[0], 1, MPI_INT, 0, comm);PYLITH_CHECK_ERROR(err);
+  std::vector<PetscMPIInt> constraintsOffset(commSize, 0);
+  for (PetscMPIInt i = 1; i < commSize; ++i) {
+    constraintsOffset[i] = constraintsOffset[i-1] + numConstraints[i-1];
+  } // for
+  const PetscMPIInt numConstraintsGlobal = constraintsOffset[commSize-1] + numConstraints[commSize-1];
+  std::vector<PetscInt> constraintsGlobal(commRank ? 1 : numConstraintsGlobal+1);
+  constraints.push_back(0); // Avoid empty buffer.
+  err = MPI_Gatherv(&constraints[0], numConstraintsLocal, MPIU_INT, &constraintsGlobal[0], &numConstraints[0], &constraintsOffset[0], MPIU_INT, 0, comm);PYLITH_CHECK_ERROR(err);
+
+  std::vector<PetscInt> flip(numComponentsGlobal+1, 0);
+  if (!commRank) {
+    std::vector<std::vector<std::pair<PetscInt,PetscInt> > > graph(numComponentsGlobal);
+    for (PetscMPIInt i = 0; i < numConstraintsGlobal; i += 3) {
+      const PetscInt a = constraintsGlobal[i];
+      const PetscInt b = constraintsGlobal[i+1];
+      graph[a].push_back(std::make_pair(b, constraintsGlobal[i+2]));
+      graph[b].push_back(std::make_pair(a, constraintsGlobal[i+2]));
+    } // for
+    PetscInt isConsistent = 1;
+    for (PetscInt iComp = 0; iComp < numComponentsGlobal; ++iComp) {
+      if (flip[iComp]) continue;
+      flip[iComp] = 1;
+      queue.clear();
+      queue.push_back(iComp);
+      for (size_t q = 0; q < queue.size(); ++q) {
+	const PetscInt a = queue[q];
+	for (size_t j = 0; j < graph[a].size(); ++j) {
+	  const PetscInt b = graph[a][j].first;
+	  const PetscInt flipB = flip[a]*graph[a][j].second;
+	  if (!flip[b]) {
+	    flip[b] = flipB;
+	    queue.push_back(b);
+	  } else if (flip[b] != flipB) {
+	    isConsistent = 0;
+	  } // if/else
+	} // for
+      } // for
+    } // for
+    flip[numComponentsGlobal] = isConsistent;
+  } // if
+  err = MPI_Bcast(&flip[0], numComponentsGlobal+1, MPIU_INT, 0, comm);PYLITH_CHECK_ERROR(err);
+  if (!flip[numComponentsGlobal]) {
+    throw std::runtime_error("Could not orient fault consistently across processes. Fault surface may not be orientable.");
+  } // if
+
+  for (PetscInt c = cStart; c < cEnd; ++c) {
+    if (flip[componentOffset + component[c-cStart]] < 0) {
+      err = DMPlexReverseCell(dmFault, c);PYLITH_CHECK_ERROR(err);
+    } // if
+  } // for
+
+  PYLITH_METHOD_END;
+} // _orientFaultParallel
+
+// ----------------------------------------------------------------------
+// Make label values of points shared across processes consistent.
+void
+pylith::faults::CohesiveTopology::_syncLabel(PetscDM dmMesh,
+					     PetscDMLabel label,
+					     const std::vector<bool>* cleared)
+{ // _syncLabel
+  PYLITH_METHOD_BEGIN;
+
+  assert(dmMesh);
+  PetscErrorCode err;
+
+  PetscSF sfPoint = NULL;
+  PetscInt nroots = -1, nleaves = 0;
+  const PetscInt* leaves = NULL;
+  err = DMGetPointSF(dmMesh, &sfPoint);PYLITH_CHECK_ERROR(err);
+  err = PetscSFGetGraph(sfPoint, &nroots, &nleaves, &leaves, NULL);PYLITH_CHECK_ERROR(err);
+  if (nroots < 0) {
+    PYLITH_METHOD_END;
+  } // if
+
+  const PetscInt* degree = NULL;
+  err = PetscSFComputeDegreeBegin(sfPoint, &degree);PYLITH_CHECK_ERROR(err);
+  err = PetscSFComputeDegreeEnd(sfPoint, &degree);PYLITH_CHECK_ERROR(err);
+
+  // Gather shared points (owned points with copies and copies of
+  // points owned by other processes).
+  std::vector<PetscInt> shared;
+  for (PetscInt p = 0; p < nroots; ++p) {
+    if (degree[p] > 0) shared.push_back(p);
+  } // for
+  for (PetscInt l = 0; l < nleaves; ++l) {
+    shared.push_back(leaves ? leaves[l] : l);
+  } // for
+
+  // Encoding of the state of a point in the label.
+  const PetscInt absent = PETSC_MIN_INT;
+  const PetscInt clear = PETSC_MIN_INT+1;
+
+  PetscInt pStart = 0, pEnd = 0;
+  err = DMPlexGetChart(dmMesh, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  assert(!cleared || cleared->size() == size_t(pEnd-pStart));
+
+  PetscInt defaultValue = -1;
+  if (label) {
+    err = DMLabelGetDefaultValue(label, &defaultValue);PYLITH_CHECK_ERROR(err);
+  } // if
+  std::vector<PetscInt> localValues(nroots+1, absent);
+  for (size_t i = 0; i < shared.size() && label; ++i) {
+    const PetscInt p = shared[i];
+    PetscInt value = defaultValue;
+    err = DMLabelGetValue(label, p, &value);PYLITH_CHECK_ERROR(err);
+    if (value != defaultValue) {
+      localValues[p] = value;
+    } else if (cleared && (*cleared)[p-pStart]) {
+      localValues[p] = clear;
+    } // if/else
+  } // for
+
+  // Reduce values set on copies to the owners.
+  std::vector<PetscInt> leafValues(localValues);
+  for (PetscInt p = 0; p < nroots; ++p) {
+    if (leafValues[p] == clear) leafValues[p] = absent;
+  } // for
+  std::vector<PetscInt> copyValues(nroots+1, absent);
+  err = PetscSFReduceBegin(sfPoint, MPIU_INT, &leafValues[0], &copyValues[0], MPI_MAX);PYLITH_CHECK_ERROR(err);
+  err = PetscSFReduceEnd(sfPoint, MPIU_INT, &leafValues[0], &copyValues[0], MPI_MAX);PYLITH_CHECK_ERROR(err);
+
+  // Owner's state wins; copies only fill in points the owner lacks.
+  std::vector<PetscInt> rootValues(nroots+1, absent);
+  for (PetscInt p = 0; p < nroots; ++p) {
+    if (!degree[p]) continue;
+    rootValues[p] = (localValues[p] != absent) ? localValues[p] : copyValues[p];
+  } // for
+  std::vector<PetscInt> values(rootValues);
+  err = PetscSFBcastBegin(sfPoint, MPIU_INT, &rootValues[0], &values[0]);PYLITH_CHECK_ERROR(err);
+  err = PetscSFBcastEnd(sfPoint, MPIU_INT, &rootValues[0], &values[0]);PYLITH_CHECK_ERROR(err);
+
+  for (size_t i = 0; i < shared.size() && label; ++i) {
+    const PetscInt p = shared[i];
+    const PetscInt current = (localValues[p] == clear) ? absent : localValues[p];
+    const PetscInt target = (values[p] == clear) ? absent : values[p];
+    if (target == current) continue;
+    if (current != absent) {
+      err = DMLabelClearValue(label, p, current);PYLITH_CHECK_ERROR(err);
+    } // if
+    if (target != absent) {
+      err = DMLabelSetValue(label, p, target);PYLITH_CHECK_ERROR(err);
+    } // if
+  } // for
+
+  PYLITH_METHOD_END;
+} // _syncLabel
+
+// ----------------------------------------------------------------------
+// Flag points with a nonnegative value in a label.
+void
+pylith::faults::CohesiveTopology::_markPoints(std::vector<bool>* marked,
+					      PetscDMLabel label,
+					      const PetscInt pStart)
+{ // _markPoints
+  PYLITH_METHOD_BEGIN;
+
+  assert(marked);
+  assert(label);
+  PetscErrorCode err;
+
+  const PetscInt pEnd = pStart + marked->size();
+  PetscIS valueIS = NULL;
+  const PetscInt* values = NULL;
+  PetscInt numValues = 0;
+  err = DMLabelGetValueIS(label, &valueIS);PYLITH_CHECK_ERROR(err);
+  err = ISGetLocalSize(valueIS, &numValues);PYLITH_CHECK_ERROR(err);
+  err = ISGetIndices(valueIS, &values);PYLITH_CHECK_ERROR(err);
+  for (PetscInt v = 0; v < numValues; ++v) {
+    if (values[v] < 0) continue;
+    PetscIS pointIS = NULL;
+    const PetscInt* points = NULL;
+    PetscInt numPoints = 0;
+    err = DMLabelGetStratumIS(label, values[v], &pointIS);PYLITH_CHECK_ERROR(err);
+    if (!pointIS) continue;
+    err = ISGetLocalSize(pointIS, &numPoints);PYLITH_CHECK_ERROR(err);
+    err = ISGetIndices(pointIS, &points);PYLITH_CHECK_ERROR(err);
+    for (PetscInt i = 0; i < numPoints; ++i) {
+      if (points[i] >= pStart && points[i] < pEnd) {
+	(*marked)[points[i]-pStart] = true;
+      } // if
+    } // for
+    err = ISRestoreIndices(pointIS, &points);PYLITH_CHECK_ERROR(err);
+    err = ISDestroy(&pointIS);PYLITH_CHECK_ERROR(err);
+  } // for
+  err = ISRestoreIndices(valueIS, &values);PYLITH_CHECK_ERROR(err);
+  err = ISDestroy(&valueIS);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _markPoints
+
 
 // End of file
@@ -30,6 +30,7 @@
 #include "pylith/topology/Mesh.hh" // USES Mesh::IntSection
 
 #include <map>
+#include <vector> // USES std::vector
 
 // CohesiveTopology -----------------------------------------------------
 /// Creation of cohesive cells.
@@ -94,6 +95,55 @@ public :
 			   const char* label,
 			   const bool constraintCell =false);
 
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Orient fault mesh consistently across processes.
+   *
+   * DMPlexOrient() only orients the local portion of the fault, so
+   * after distribution fault cells on different processes may have
+   * opposite orientations and the two sides of the split would not
+   * match across partition boundaries. The orientation of shared
+   * fault cells and facets is exchanged through the point SF of the
+   * domain mesh and connected pieces of the fault are flipped as
+   * needed.
+   *
+   * @param dmFault DM for fault mesh (submesh of domain mesh).
+   * @param dmMesh DM for domain mesh.
+   */
+  static
+  void _orientFaultParallel(PetscDM dmFault,
+			    PetscDM dmMesh);
+
+  /** Make label values of points shared across processes consistent.
+   *
+   * The owner of a shared point is authoritative: if the owner sets
+   * the point or explicitly clears it, every copy gets the owner's
+   * state. Values set on copies are reduced to the owner (largest
+   * value wins) and only used if the owner has no entry for the
+   * point. The final state is broadcast back to the copies.
+   *
+   * @param dmMesh DM for domain mesh.
+   * @param label Label to synchronize (may be NULL on some processes).
+   * @param cleared Flags over the chart of the mesh for points
+   *   explicitly cleared from the label on this process (may be NULL).
+   */
+  static
+  void _syncLabel(PetscDM dmMesh,
+		  PetscDMLabel label,
+		  const std::vector<bool>* cleared);
+
+  /** Flag points with a nonnegative value in a label.
+   *
+   * @param marked Array of flags over the chart of the mesh (output).
+   * @param label Label with points to flag.
+   * @param pStart First point in chart of mesh.
+   */
+  static
+  void _markPoints(std::vector<bool>* marked,
+		   PetscDMLabel label,
+		   const PetscInt pStart);
+
 }; // class CohesiveTopology
 
 #endif // pylith_faults_cohesivetopology_hh
@@ -147,9 +147,9 @@ pylith::faults::FaultCohesive::adjustTopology(topology::Mesh* const mesh,
       PetscDMLabel faultBdLabel = NULL;
 
       // We do not have labels on all ranks until after distribution
-      if (strlen(edge()) > 0 && !rank) {
+      if (strlen(edge()) > 0) {
 	err = DMGetLabel(dmMesh, edge(), &faultBdLabel);PYLITH_CHECK_ERROR(err);
-	if (!faultBdLabel) {
+	if (!faultBdLabel && !rank) {
 	  std::ostringstream msg;
 	  msg << "Could not find nodeset/pset '" << edge() << "' marking buried edges for fault '" << label() << "'.";
 	  throw std::runtime_error(msg.str());
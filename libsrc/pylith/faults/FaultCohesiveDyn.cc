@@ -507,6 +507,8 @@ pylith::faults::FaultCohesiveDyn::updateStateVars(const PylithScalar t,
         } // switch
     } // for
 
+    FaultCohesiveLagrange::updateStateVars(t, fields);
+
     PYLITH_METHOD_END;
 } // updateStateVars
 
@@ -1429,6 +1431,9 @@ pylith::faults::FaultCohesiveDyn::vertexField(const char* name,
     } else if (_friction->hasPropStateVar(name)) {
         PYLITH_METHOD_RETURN(_friction->getField(name));
 
+    } else if (_sourceStatsField(name)) {
+        PYLITH_METHOD_RETURN(*_sourceStatsField(name));
+
     } else if (_tractPerturbation && _tractPerturbation->hasParameter(name)) {
         const topology::Field& param = _tractPerturbation->vertexField(name, fields);
         if (param.vectorFieldType() == topology::FieldBase::VECTOR) {
@@ -28,6 +28,7 @@
 #include "pylith/topology/Fields.hh" // USES Fields
 #include "pylith/topology/Jacobian.hh" // USES Jacobian
 #include "pylith/topology/SolutionFields.hh" // USES SolutionFields
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 #include "pylith/feassemble/CellGeometry.hh" // USES CellGeometry
@@ -158,6 +159,68 @@ pylith::faults::FaultCohesiveKin::integrateResidual(const topology::Field& resid
   PYLITH_METHOD_END;
 } // integrateResidual
 
+// ----------------------------------------------------------------------
+// Project initial guess for the increment in the solution onto the
+// prescribed slip.
+void
+pylith::faults::FaultCohesiveKin::projectSolnIncr(topology::SolutionFields* const fields)
+{ // projectSolnIncr
+  PYLITH_METHOD_BEGIN;
+
+  assert(fields);
+  assert(_fields);
+  assert(_quadrature);
+
+  const int spaceDim = _quadrature->spaceDim();
+
+  topology::VecVisitorMesh dispTVisitor(fields->get("disp(t)"));
+  const PetscScalar* dispTArray = dispTVisitor.localArray();
+
+  topology::VecVisitorMesh dispTIncrVisitor(fields->get("dispIncr(t->t+dt)"));
+  PetscScalar* dispTIncrArray = dispTIncrVisitor.localArray();
+
+  // Slip (global coordinate system) at the end of the time step.
+  topology::VecVisitorMesh dispRelVisitor(_fields->get("relative disp"));
+  const PetscScalar* dispRelArray = dispRelVisitor.localArray();
+
+  // Values at vertices that are not local are computed the same way on
+  // every process, so there is no need to skip them.
+  const int numVertices = _cohesiveVertices.size();
+  for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+    const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
+    const int v_fault = _cohesiveVertices[iVertex].fault;
+    const int v_negative = _cohesiveVertices[iVertex].negative;
+    const int v_positive = _cohesiveVertices[iVertex].positive;
+
+    if (e_lagrange < 0) { // Skip clamped edges.
+      continue;
+    } // if
+
+    const PetscInt droff = dispRelVisitor.sectionOffset(v_fault);
+    assert(spaceDim == dispRelVisitor.sectionDof(v_fault));
+
+    const PetscInt dtnoff = dispTVisitor.sectionOffset(v_negative);
+    assert(spaceDim == dispTVisitor.sectionDof(v_negative));
+    const PetscInt dtpoff = dispTVisitor.sectionOffset(v_positive);
+    assert(spaceDim == dispTVisitor.sectionDof(v_positive));
+
+    const PetscInt dinoff = dispTIncrVisitor.sectionOffset(v_negative);
+    assert(spaceDim == dispTIncrVisitor.sectionDof(v_negative));
+    const PetscInt dipoff = dispTIncrVisitor.sectionOffset(v_positive);
+    assert(spaceDim == dispTIncrVisitor.sectionDof(v_positive));
+
+    for (PetscInt d = 0; d < spaceDim; ++d) {
+      const PylithScalar dispRelGuess = dispTArray[dtpoff+d] + dispTIncrArray[dipoff+d] - dispTArray[dtnoff+d] - dispTIncrArray[dinoff+d];
+      const PylithScalar mismatch = dispRelArray[droff+d] - dispRelGuess;
+      dispTIncrArray[dipoff+d] += 0.5*mismatch;
+      dispTIncrArray[dinoff+d] -= 0.5*mismatch;
+    } // for
+  } // for
+  PetscLogFlops(numVertices*spaceDim*8);
+
+  PYLITH_METHOD_END;
+} // projectSolnIncr
+
 // ----------------------------------------------------------------------
 // Get vertex field associated with integrator.
 const pylith::topology::Field&
@@ -247,6 +310,9 @@ pylith::faults::FaultCohesiveKin::vertexField(const char* name,
     _calcTractionsChange(&buffer, dispT);
     PYLITH_METHOD_RETURN(buffer);
 
+  } else if (_sourceStatsField(name)) {
+    PYLITH_METHOD_RETURN(*_sourceStatsField(name));
+
   } else {
     std::ostringstream msg;
     msg << "Request for unknown vertex field '" << name << "' for fault '"
@@ -86,6 +86,19 @@ public :
 			 const PylithScalar t,
 			 topology::SolutionFields* const fields);
 
+  /** Project initial guess for the increment in the solution onto the
+   * prescribed slip.
+   *
+   * The mismatch between the relative displacement and the slip
+   * computed in the most recent call to integrateResidual() is split
+   * equally between the two sides of the fault, which is the smallest
+   * change that satisfies the constraint. The Lagrange multipliers
+   * are not changed.
+   *
+   * @param fields Solution fields.
+   */
+  void projectSolnIncr(topology::SolutionFields* const fields);
+
   /** Get vertex field associated with integrator.
    *
    * @param name Name of cell field.
@@ -34,15 +34,18 @@
 #include "pylith/topology/VisitorSubMesh.hh" // USES SubMeshIS
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/materials/Material.hh" // USES Material
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
 #include "pylith/utils/macrodefs.h" // USES CALL_MEMBER_FN
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include <cmath> // USES pow(), sqrt()
+#include <algorithm> // USES std::max()
 #include <strings.h> // USES strcasecmp()
 #include <cstring> // USES strlen()
 #include <cstdlib> // USES atoi()
@@ -54,10 +57,28 @@
 
 //#define DETAILED_EVENT_LOGGING
 
+// ----------------------------------------------------------------------
+namespace pylith {
+    namespace faults {
+        namespace _FaultCohesiveLagrange {
+
+            // Number of values in each source statistics record.
+            const int numSourceStatsValues = 6;
+
+            // Names of values in each source statistics record.
+            const char* sourceStatsNames[numSourceStatsValues] = {
+                "t", "rupture_area", "potency", "moment", "max_slip", "max_slip_rate",
+            };
+
+        } // _FaultCohesiveLagrange
+    } // faults
+} // pylith
+
 // ----------------------------------------------------------------------
 // Default constructor.
 pylith::faults::FaultCohesiveLagrange::FaultCohesiveLagrange(void) :
-    _cohesiveIS(0)
+    _cohesiveIS(0),
+    _sourceStats(0)
 { // constructor
     _useLagrangeConstraints = true;
 } // constructor
@@ -78,6 +99,7 @@ pylith::faults::FaultCohesiveLagrange::deallocate(void)
 
     FaultCohesive::deallocate();
     delete _cohesiveIS; _cohesiveIS = 0;
+    delete _sourceStats; _sourceStats = 0;
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -594,6 +616,26 @@ pylith::faults::FaultCohesiveLagrange::integrateJacobian(topology::Field* jacobi
     PYLITH_METHOD_END;
 } // integrateJacobian
 
+// ----------------------------------------------------------------------
+// Update state variables as needed.
+void
+pylith::faults::FaultCohesiveLagrange::updateStateVars(const PylithScalar t,
+                                                       topology::SolutionFields* const fields)
+{ // updateStateVars
+    PYLITH_METHOD_BEGIN;
+
+    assert(fields);
+
+    FaultCohesive::updateStateVars(t, fields);
+
+    // Solution corresponds to end of time step.
+    if (_sourceStats) {
+        _updateSourceStats(t+_dt, *fields);
+    } // if
+
+    PYLITH_METHOD_END;
+} // updateStateVars
+
 // ----------------------------------------------------------------------
 // Integrate contributions to Jacobian matrix (A) associated with
 // operator.
@@ -1377,6 +1419,427 @@ pylith::faults::FaultCohesiveLagrange::isClampedVertex(PetscDMLabel clamped,
     PYLITH_METHOD_RETURN(isClamped);
 } // _isClampedVertex
 
+// ----------------------------------------------------------------------
+// Enable computation of earthquake source statistics.
+void
+pylith::faults::FaultCohesiveLagrange::initializeSourceStats(const PylithScalar slipThreshold,
+                                                             const PylithScalar slipRateThreshold)
+{ // initializeSourceStats
+    PYLITH_METHOD_BEGIN;
+
+    assert(_faultMesh);
+    assert(_fields);
+    assert(_normalizer);
+
+    if (slipThreshold < 0.0) {
+        std::ostringstream msg;
+        msg << "Slip threshold (" << slipThreshold << ") for source statistics of fault '"
+            << label() << "' must be nonnegative.";
+        throw std::runtime_error(msg.str());
+    } // if
+    if (slipRateThreshold < 0.0) {
+        std::ostringstream msg;
+        msg << "Slip rate threshold (" << slipRateThreshold << ") for source statistics of fault '"
+            << label() << "' must be nonnegative.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    const int spaceDim = _quadrature->spaceDim();
+    const PylithScalar lengthScale = _normalizer->lengthScale();
+    const PylithScalar timeScale = _normalizer->timeScale();
+    const PylithScalar pressureScale = _normalizer->pressureScale();
+
+    delete _sourceStats; _sourceStats = new SourceStats; assert(_sourceStats);
+    _sourceStats->slipThreshold = slipThreshold / lengthScale;
+    _sourceStats->slipRateThreshold = slipRateThreshold / (lengthScale / timeScale);
+    _sourceStats->noRuptureTime = pylith::PYLITH_MAXSCALAR / timeScale;
+
+    // Allocate vertex fields.
+    const topology::Field& dispRel = _fields->get("relative disp");
+    const char* names[4] = {
+        "rupture time", "peak slip rate", "shear modulus", "shear modulus count",
+    };
+    const char* labels[4] = {
+        "rupture_time", "peak_slip_rate", "shear_modulus", "shear_modulus_count",
+    };
+    const PylithScalar scales[4] = {
+        timeScale, lengthScale / timeScale, pressureScale, 1.0,
+    };
+    for (int i=0; i < 4; ++i) {
+        if (!_fields->hasField(names[i])) {
+            _fields->add(names[i], labels[i]);
+        } // if
+        topology::Field& field = _fields->get(names[i]);
+        field.newSection(dispRel, 1);
+        field.allocate();
+        field.vectorFieldType(topology::FieldBase::SCALAR);
+        field.scale(scales[i]);
+        field.zeroAll();
+    } // for
+
+    topology::VecVisitorMesh ruptureTimeVisitor(_fields->get("rupture time"));
+    PetscScalar* ruptureTimeArray = ruptureTimeVisitor.localArray();
+
+    topology::VecVisitorMesh dispRelVisitor(dispRel);
+    const PetscScalar* dispRelArray = dispRelVisitor.localArray();
+
+    const int numVertices = _cohesiveVertices.size();
+    _sourceStats->slipPrev.resize(numVertices*spaceDim);
+    _sourceStats->slipPrev = 0.0;
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+        const int v_fault = _cohesiveVertices[iVertex].fault;
+
+        const PetscInt rtoff = ruptureTimeVisitor.sectionOffset(v_fault);
+        assert(1 == ruptureTimeVisitor.sectionDof(v_fault));
+        ruptureTimeArray[rtoff] = _sourceStats->noRuptureTime;
+
+        const PetscInt droff = dispRelVisitor.sectionOffset(v_fault);
+        assert(spaceDim == dispRelVisitor.sectionDof(v_fault));
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+            _sourceStats->slipPrev[iVertex*spaceDim+iDim] = dispRelArray[droff+iDim];
+        } // for
+    } // for
+
+    PYLITH_METHOD_END;
+} // initializeSourceStats
+
+// ----------------------------------------------------------------------
+// Add shear modulus from cells of material adjacent to the fault.
+void
+pylith::faults::FaultCohesiveLagrange::addShearModulus(const topology::Mesh& mesh,
+                                                       materials::Material* material)
+{ // addShearModulus
+    PYLITH_METHOD_BEGIN;
+
+    assert(material);
+    assert(_fields);
+    assert(_normalizer);
+
+    if (!_sourceStats) {
+        throw std::logic_error("Source statistics must be initialized before adding shear modulus.");
+    } // if
+    if (!material->hasProperty("mu")) {
+        PYLITH_METHOD_END;
+    } // if
+
+    // Shear modulus at quadrature points of cells in material (dimensional).
+    topology::Field muField(mesh);
+    material->getField(&muField, "mu");
+    PetscSection muSection = muField.localSection(); assert(muSection);
+    PetscInt pStart = 0, pEnd = 0;
+    PetscErrorCode err = PetscSectionGetChart(muSection, &pStart, &pEnd); PYLITH_CHECK_ERROR(err);
+    topology::VecVisitorMesh muVisitor(muField);
+    const PetscScalar* muArray = muVisitor.localArray();
+
+    topology::VecVisitorMesh shearModulusVisitor(_fields->get("shear modulus"));
+    PetscScalar* shearModulusArray = shearModulusVisitor.localArray();
+
+    topology::VecVisitorMesh countVisitor(_fields->get("shear modulus count"));
+    PetscScalar* countArray = countVisitor.localArray();
+
+    const PylithScalar pressureScale = _normalizer->pressureScale();
+
+    PetscDM dmMesh = mesh.dmMesh(); assert(dmMesh);
+    const int numVertices = _cohesiveVertices.size();
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+        const PetscInt sides[2] = {
+            _cohesiveVertices[iVertex].negative,
+            _cohesiveVertices[iVertex].positive,
+        };
+        const int v_fault = _cohesiveVertices[iVertex].fault;
+
+        // Average over quadrature points of each cell in material
+        // adjacent to the vertices on either side of the fault.
+        PylithScalar muSum = 0.0;
+        int muCount = 0;
+        for (int iSide=0; iSide < 2; ++iSide) {
+            PetscInt* star = NULL;
+            PetscInt starSize = 0;
+            err = DMPlexGetTransitiveClosure(dmMesh, sides[iSide], PETSC_FALSE, &starSize, &star); PYLITH_CHECK_ERROR(err);
+            for (PetscInt s=0; s < starSize*2; s += 2) {
+                const PetscInt point = star[s];
+                if (point < pStart || point >= pEnd) {
+                    continue;
+                } // if
+                const PetscInt mudof = muVisitor.sectionDof(point);
+                if (mudof <= 0) {
+                    continue;
+                } // if
+                const PetscInt muoff = muVisitor.sectionOffset(point);
+                PylithScalar muCell = 0.0;
+                for (PetscInt iQuad=0; iQuad < mudof; ++iQuad) {
+                    muCell += muArray[muoff+iQuad];
+                } // for
+                muSum += muCell / mudof;
+                ++muCount;
+            } // for
+            err = DMPlexRestoreTransitiveClosure(dmMesh, sides[iSide], PETSC_FALSE, &starSize, &star); PYLITH_CHECK_ERROR(err);
+        } // for
+
+        const PetscInt smoff = shearModulusVisitor.sectionOffset(v_fault);
+        assert(1 == shearModulusVisitor.sectionDof(v_fault));
+        shearModulusArray[smoff] += muSum / pressureScale;
+
+        const PetscInt coff = countVisitor.sectionOffset(v_fault);
+        assert(1 == countVisitor.sectionDof(v_fault));
+        countArray[coff] += muCount;
+    } // for
+
+    PYLITH_METHOD_END;
+} // addShearModulus
+
+// ----------------------------------------------------------------------
+// Average shear modulus at fault vertices over adjacent cells.
+void
+pylith::faults::FaultCohesiveLagrange::averageShearModulus(void)
+{ // averageShearModulus
+    PYLITH_METHOD_BEGIN;
+
+    assert(_faultMesh);
+    assert(_fields);
+
+    if (!_sourceStats) {
+        throw std::logic_error("Source statistics must be initialized before averaging shear modulus.");
+    } // if
+
+    // Sum contributions from cells on other processes.
+    topology::Field& shearModulus = _fields->get("shear modulus");
+    topology::Field& count = _fields->get("shear modulus count");
+    shearModulus.complete();
+    count.complete();
+
+    topology::VecVisitorMesh shearModulusVisitor(shearModulus);
+    PetscScalar* shearModulusArray = shearModulusVisitor.localArray();
+
+    topology::VecVisitorMesh countVisitor(count);
+    const PetscScalar* countArray = countVisitor.localArray();
+
+    PetscDM faultDMMesh = _faultMesh->dmMesh(); assert(faultDMMesh);
+    topology::Stratum verticesStratum(faultDMMesh, topology::Stratum::DEPTH, 0);
+    const PetscInt vStart = verticesStratum.begin();
+    const PetscInt vEnd = verticesStratum.end();
+    for (PetscInt v = vStart; v < vEnd; ++v) {
+        const PetscInt coff = countVisitor.sectionOffset(v);
+        if (countVisitor.sectionDof(v) > 0 && countArray[coff] > 0.0) {
+            shearModulusArray[shearModulusVisitor.sectionOffset(v)] /= countArray[coff];
+        } // if
+    } // for
+    PetscLogFlops(vEnd - vStart);
+
+    _fields->del("shear modulus count");
+
+#if 0 // DEBUGGING
+    shearModulus.view("SHEAR MODULUS");
+#endif
+
+    PYLITH_METHOD_END;
+} // averageShearModulus
+
+// ----------------------------------------------------------------------
+// Get number of source statistics records not yet retrieved.
+int
+pylith::faults::FaultCohesiveLagrange::numSourceStats(void) const
+{ // numSourceStats
+    const int numValues = _FaultCohesiveLagrange::numSourceStatsValues;
+    return (_sourceStats) ? _sourceStats->records.size() / numValues : 0;
+} // numSourceStats
+
+// ----------------------------------------------------------------------
+// Get value in source statistics record.
+PylithScalar
+pylith::faults::FaultCohesiveLagrange::sourceStat(const int index,
+                                                  const char* name) const
+{ // sourceStat
+    PYLITH_METHOD_BEGIN;
+
+    assert(name);
+
+    const int numRecords = numSourceStats();
+    if (index < 0 || index >= numRecords) {
+        std::ostringstream msg;
+        msg << "Index (" << index << ") of source statistics record for fault '"
+            << label() << "' must be in [0, " << numRecords << ").";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    const int numValues = _FaultCohesiveLagrange::numSourceStatsValues;
+    int iValue = -1;
+    for (int i=0; i < numValues; ++i) {
+        if (0 == strcasecmp(_FaultCohesiveLagrange::sourceStatsNames[i], name)) {
+            iValue = i;
+            break;
+        } // if
+    } // for
+    if (iValue < 0) {
+        std::ostringstream msg;
+        msg << "Unknown source statistic '" << name << "' for fault '" << label() << "'.";
+        throw std::runtime_error(msg.str());
+    } // if
+
+    assert(_sourceStats);
+    PYLITH_METHOD_RETURN(_sourceStats->records[index*numValues+iValue]);
+} // sourceStat
+
+// ----------------------------------------------------------------------
+// Clear source statistics records.
+void
+pylith::faults::FaultCohesiveLagrange::clearSourceStats(void)
+{ // clearSourceStats
+    if (_sourceStats) {
+        _sourceStats->records.clear();
+    } // if
+} // clearSourceStats
+
+// ----------------------------------------------------------------------
+// Get source statistics vertex field.
+const pylith::topology::Field*
+pylith::faults::FaultCohesiveLagrange::_sourceStatsField(const char* name)
+{ // _sourceStatsField
+    PYLITH_METHOD_BEGIN;
+
+    assert(name);
+
+    const topology::Field* field = 0;
+    if (_sourceStats) {
+        assert(_fields);
+        if (0 == strcasecmp("rupture_time", name)) {
+            field = &_fields->get("rupture time");
+        } else if (0 == strcasecmp("peak_slip_rate", name)) {
+            field = &_fields->get("peak slip rate");
+        } else if (0 == strcasecmp("shear_modulus", name)) {
+            field = &_fields->get("shear modulus");
+        } // if/else
+    } // if
+
+    PYLITH_METHOD_RETURN(field);
+} // _sourceStatsField
+
+// ----------------------------------------------------------------------
+// Update source statistics using current relative displacement.
+void
+pylith::faults::FaultCohesiveLagrange::_updateSourceStats(const PylithScalar t,
+                                                          const topology::SolutionFields& fields)
+{ // _updateSourceStats
+    PYLITH_METHOD_BEGIN;
+
+    assert(_sourceStats);
+    assert(_faultMesh);
+    assert(_fields);
+    assert(_normalizer);
+    assert(_dt > 0.0);
+
+    const int spaceDim = _quadrature->spaceDim();
+
+    // Get fields.
+    topology::VecVisitorMesh dispRelVisitor(_fields->get("relative disp"));
+    const PetscScalar* dispRelArray = dispRelVisitor.localArray();
+
+    topology::VecVisitorMesh areaVisitor(_fields->get("area"));
+    const PetscScalar* areaArray = areaVisitor.localArray();
+
+    topology::VecVisitorMesh shearModulusVisitor(_fields->get("shear modulus"));
+    const PetscScalar* shearModulusArray = shearModulusVisitor.localArray();
+
+    topology::VecVisitorMesh ruptureTimeVisitor(_fields->get("rupture time"));
+    PetscScalar* ruptureTimeArray = ruptureTimeVisitor.localArray();
+
+    topology::VecVisitorMesh peakSlipRateVisitor(_fields->get("peak slip rate"));
+    PetscScalar* peakSlipRateArray = peakSlipRateVisitor.localArray();
+
+    PetscSection solnGlobalSection = fields.solution().globalSection(); assert(solnGlobalSection);
+
+    scalar_array& slipPrev = _sourceStats->slipPrev;
+    const int numVertices = _cohesiveVertices.size();
+    assert(slipPrev.size() == size_t(numVertices*spaceDim));
+
+    // Sums (rupture area, potency, moment) and maxima (slip, slip
+    // rate) over vertices owned by this process.
+    PylithScalar sumsLocal[3] = { 0.0, 0.0, 0.0 };
+    PylithScalar maximaLocal[2] = { 0.0, 0.0 };
+    for (int iVertex=0; iVertex < numVertices; ++iVertex) {
+        const int e_lagrange = _cohesiveVertices[iVertex].lagrange;
+        const int v_fault = _cohesiveVertices[iVertex].fault;
+
+        if (e_lagrange < 0) { // skip clamped edges
+            continue;
+        } // if
+
+        const PetscInt droff = dispRelVisitor.sectionOffset(v_fault);
+        assert(spaceDim == dispRelVisitor.sectionDof(v_fault));
+
+        // Magnitude of slip and slip rate over time step.
+        PylithScalar slipMag = 0.0;
+        PylithScalar slipIncrMag = 0.0;
+        for (int iDim=0; iDim < spaceDim; ++iDim) {
+            const PylithScalar slip = dispRelArray[droff+iDim];
+            const PylithScalar slipIncr = slip - slipPrev[iVertex*spaceDim+iDim];
+            slipMag += slip*slip;
+            slipIncrMag += slipIncr*slipIncr;
+            slipPrev[iVertex*spaceDim+iDim] = slip;
+        } // for
+        slipMag = sqrt(slipMag);
+        const PylithScalar slipRateMag = sqrt(slipIncrMag) / _dt;
+
+        const PetscInt psroff = peakSlipRateVisitor.sectionOffset(v_fault);
+        assert(1 == peakSlipRateVisitor.sectionDof(v_fault));
+        if (slipRateMag > peakSlipRateArray[psroff]) {
+            peakSlipRateArray[psroff] = slipRateMag;
+        } // if
+
+        const PetscInt rtoff = ruptureTimeVisitor.sectionOffset(v_fault);
+        assert(1 == ruptureTimeVisitor.sectionDof(v_fault));
+        if (ruptureTimeArray[rtoff] >= _sourceStats->noRuptureTime &&
+            slipRateMag > 0.0 && slipRateMag >= _sourceStats->slipRateThreshold) {
+            ruptureTimeArray[rtoff] = t;
+        } // if
+
+        // Only vertices owned by this process contribute to the sums.
+        PetscInt goff = 0;
+        PetscErrorCode err = PetscSectionGetOffset(solnGlobalSection, e_lagrange, &goff); PYLITH_CHECK_ERROR(err);
+        if (goff < 0) {
+            continue;
+        } // if
+
+        maximaLocal[0] = std::max(maximaLocal[0], slipMag);
+        maximaLocal[1] = std::max(maximaLocal[1], slipRateMag);
+
+        if (slipMag > _sourceStats->slipThreshold) {
+            const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
+            assert(1 == areaVisitor.sectionDof(v_fault));
+            const PetscInt smoff = shearModulusVisitor.sectionOffset(v_fault);
+            assert(1 == shearModulusVisitor.sectionDof(v_fault));
+
+            const PylithScalar potency = slipMag * areaArray[aoff];
+            sumsLocal[0] += areaArray[aoff];
+            sumsLocal[1] += potency;
+            sumsLocal[2] += potency * shearModulusArray[smoff];
+        } // if
+    } // for
+    PetscLogFlops(numVertices * (spaceDim*5 + 12));
+
+    PylithScalar sums[3];
+    PylithScalar maxima[2];
+    MPI_Allreduce(sumsLocal, sums, 3, MPIU_SCALAR, MPI_SUM, _faultMesh->comm());
+    MPI_Allreduce(maximaLocal, maxima, 2, MPIU_SCALAR, MPI_MAX, _faultMesh->comm());
+
+    // Store dimensional values.
+    const PylithScalar lengthScale = _normalizer->lengthScale();
+    const PylithScalar timeScale = _normalizer->timeScale();
+    const PylithScalar pressureScale = _normalizer->pressureScale();
+    const PylithScalar areaScale = pow(lengthScale, spaceDim-1);
+
+    std::vector<PylithScalar>& records = _sourceStats->records;
+    records.push_back(t * timeScale);
+    records.push_back(sums[0] * areaScale);
+    records.push_back(sums[1] * areaScale * lengthScale);
+    records.push_back(sums[2] * areaScale * lengthScale * pressureScale);
+    records.push_back(maxima[0] * lengthScale);
+    records.push_back(maxima[1] * lengthScale / timeScale);
+    assert(0 == records.size() % _FaultCohesiveLagrange::numSourceStatsValues);
+
+    PYLITH_METHOD_END;
+} // _updateSourceStats
+
 
 // ----------------------------------------------------------------------
 // Calculate orientation at fault vertices.
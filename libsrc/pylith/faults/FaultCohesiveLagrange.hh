@@ -28,6 +28,8 @@
 // Include directives ---------------------------------------------------
 #include "FaultCohesive.hh" // ISA FaultCohesive
 
+#include "pylith/materials/materialsfwd.hh" // USES Material
+
 // FaultCohesiveLagrange -----------------------------------------------------
 /**
  * @brief C++ abstract base class for implementing falt slip using
@@ -155,6 +157,18 @@ public :
 			 const PylithScalar t,
 			 topology::SolutionFields* const fields);
 
+  /** Update state variables as needed.
+   *
+   * Updates the source statistics (if enabled) using the slip at the
+   * end of the time step.
+   *
+   * @param t Current time
+   * @param fields Solution fields
+   */
+  virtual
+  void updateStateVars(const PylithScalar t,
+		       topology::SolutionFields* const fields);
+
   /** Compute custom fault precoditioner using Schur complement.
    *
    * We have J = [A C^T]
@@ -236,6 +250,52 @@ public :
   bool isClampedVertex(PetscDMLabel clamped,
 		       PetscInt vertex);
 
+  /** Enable computation of earthquake source statistics.
+   *
+   * Creates the rupture time, peak slip rate, and shear modulus
+   * fields. The shear modulus must be set using addShearModulus()
+   * and averageShearModulus() before the first time step.
+   *
+   * @param slipThreshold Minimum slip for a vertex to contribute to
+   *   the rupture area (dimensional).
+   * @param slipRateThreshold Slip rate at which the rupture front
+   *   arrives at a vertex (dimensional).
+   */
+  void initializeSourceStats(const PylithScalar slipThreshold,
+			     const PylithScalar slipRateThreshold);
+
+  /** Add shear modulus from cells of material adjacent to the fault.
+   *
+   * @param mesh Finite-element mesh of the domain.
+   * @param material Material (ignored if it lacks a shear modulus).
+   */
+  void addShearModulus(const topology::Mesh& mesh,
+		       materials::Material* material);
+
+  /// Average shear modulus at fault vertices over adjacent cells.
+  void averageShearModulus(void);
+
+  /** Get number of source statistics records not yet retrieved.
+   *
+   * @returns Number of records.
+   */
+  int numSourceStats(void) const;
+
+  /** Get value in source statistics record.
+   *
+   * Values are dimensional. Names are t, rupture_area, potency,
+   * moment, max_slip, and max_slip_rate.
+   *
+   * @param index Index of record.
+   * @param name Name of value.
+   * @returns Value.
+   */
+  PylithScalar sourceStat(const int index,
+			  const char* name) const;
+
+  /// Clear source statistics records.
+  void clearSourceStats(void);
+
   // PROTECTED STRUCTS //////////////////////////////////////////////////
 protected :
 
@@ -250,9 +310,34 @@ protected :
     int fault; ///< Point (vertex) in fault mesh.
   };
 
+  /// Earthquake source statistics accumulated during the run.
+  struct SourceStats {
+    PylithScalar slipThreshold; ///< Minimum slip for rupture area (nondimensional).
+    PylithScalar slipRateThreshold; ///< Slip rate for rupture time (nondimensional).
+    PylithScalar noRuptureTime; ///< Rupture time of vertices that have not ruptured.
+    scalar_array slipPrev; ///< Relative displacement at previous time step.
+    std::vector<PylithScalar> records; ///< Records (t, area, potency, moment, max slip, max slip rate).
+  };
+
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
 
+  /** Get source statistics vertex field.
+   *
+   * @param name Name of field (rupture_time, peak_slip_rate, or shear_modulus).
+   * @returns Field or NULL if source statistics are not enabled or
+   *   name does not match a source statistics field.
+   */
+  const topology::Field* _sourceStatsField(const char* name);
+
+  /** Update source statistics using current relative displacement.
+   *
+   * @param t Time at end of time step.
+   * @param fields Solution fields.
+   */
+  void _updateSourceStats(const PylithScalar t,
+			  const topology::SolutionFields& fields);
+
   /** Initialize auxiliary cohesive cell information.
    *
    * @param mesh Finite-element mesh of the domain.
@@ -317,6 +402,8 @@ protected :
 
   topology::StratumIS* _cohesiveIS; ///< Index set of cohesive cells.
 
+  SourceStats* _sourceStats; ///< Source statistics (NULL if not enabled).
+
   // NOT IMPLEMENTED ////////////////////////////////////////////////////
 private :
 
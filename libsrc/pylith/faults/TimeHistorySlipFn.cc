@@ -63,6 +63,7 @@ pylith::faults::TimeHistorySlipFn::deallocate(void)
   PYLITH_METHOD_BEGIN;
 
   SlipTimeFn::deallocate();
+  _slipTimeBatch.deallocate();
 
   _dbAmplitude = 0; // :TODO: Use shared pointer
   _dbSlipTime = 0; // :TODO: Use shared pointer
@@ -210,6 +211,14 @@ pylith::faults::TimeHistorySlipFn::initialize(const topology::Mesh& faultMesh,
   _dbAmplitude->close();
   _dbSlipTime->close();
 
+  // Group vertices by slip time, so the time history is queried once
+  // per distinct slip time.
+  scalar_array slipTimes(vEnd-vStart);
+  for(PetscInt v = vStart; v < vEnd; ++v) {
+    slipTimes[v-vStart] = slipTimeArray[slipTimeVisitor.sectionOffset(v)];
+  } // for
+  _slipTimeBatch.initialize((vEnd > vStart) ? &slipTimes[0] : 0, vEnd-vStart);
+
   // Open time history database.
   _dbTimeHistory->open();
   _timeScale = timeScale;
@@ -240,40 +249,28 @@ pylith::faults::TimeHistorySlipFn::slip(topology::Field* slip,
   topology::VecVisitorMesh slipAmplitudeVisitor(slipAmplitude);
   const PetscScalar* slipAmplitudeArray = slipAmplitudeVisitor.localArray();
 
-  const topology::Field& slipTime = _parameters->get("slip time");
-  topology::VecVisitorMesh slipTimeVisitor(slipTime);
-  const PetscScalar* slipTimeArray = slipTimeVisitor.localArray();
-
   topology::VecVisitorMesh slipVisitor(*slip);
   PetscScalar* slipArray = slipVisitor.localArray();
 
+  assert(vEnd-vStart == _slipTimeBatch.numPoints());
+  _slipTimeBatch.evaluate(&_amplitudes, _dbTimeHistory, t, _timeScale);
+
   const int spaceDim = _slipVertex.size();
-  PylithScalar amplitude = 0.0;
   for(PetscInt v = vStart; v < vEnd; ++v) {
+    const PylithScalar amplitude = _amplitudes[_slipTimeBatch.group(v-vStart)];
+    if (0.0 == amplitude) {
+      continue;
+    } // if
+
     const PetscInt saoff = slipAmplitudeVisitor.sectionOffset(v);
-    const PetscInt stoff = slipTimeVisitor.sectionOffset(v);
     const PetscInt soff = slipVisitor.sectionOffset(v);
 
     assert(spaceDim == slipAmplitudeVisitor.sectionDof(v));
-    assert(1 == slipTimeVisitor.sectionDof(v));
     assert(spaceDim == slipVisitor.sectionDof(v));
 
-    PylithScalar relTime = t - slipTimeArray[stoff];
-    if (relTime >= 0.0) {
-      relTime *= _timeScale;
-      const int err = _dbTimeHistory->query(&amplitude, relTime);
-      if (err) {
-        std::ostringstream msg;
-        msg << "Error querying for time '" << relTime
-            << "' in time history database '"
-            << _dbTimeHistory->label() << "'.";
-        throw std::runtime_error(msg.str());
-      } // if
-
-      for(PetscInt d = 0; d < spaceDim; ++d) {
-        slipArray[soff+d] += slipAmplitudeArray[saoff+d] * amplitude;
-      } // for
-    } // else
+    for(PetscInt d = 0; d < spaceDim; ++d) {
+      slipArray[soff+d] += slipAmplitudeArray[saoff+d] * amplitude;
+    } // for
   } // for
 
   PetscLogFlops((vEnd-vStart) * 3);
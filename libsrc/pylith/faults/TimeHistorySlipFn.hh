@@ -28,6 +28,8 @@
 // Include directives ---------------------------------------------------
 #include "SlipTimeFn.hh"
 
+#include "pylith/bc/TimeHistoryBatch.hh" // HASA TimeHistoryBatch
+
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // USES SpatialDB
 
 #include "pylith/utils/array.hh" // HASA scalar_array
@@ -119,6 +121,10 @@ private :
   PylithScalar _slipTimeVertex; ///< Slip time at a vertex.
   PylithScalar _timeScale; ///< Time scale.
   scalar_array _slipVertex; ///< Final slip at a vertex.
+  scalar_array _amplitudes; ///< Time history amplitude for each slip time.
+
+  /// Vertices grouped by slip time.
+  pylith::bc::TimeHistoryBatch _slipTimeBatch;
 
   /// Spatial database for amplitude of slip time history.
   spatialdata::spatialdb::SpatialDB* _dbAmplitude;
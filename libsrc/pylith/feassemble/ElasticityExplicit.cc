@@ -194,6 +194,9 @@ pylith::feassemble::ElasticityExplicit::integrateResidual(const topology::Field&
     assert(0);
     throw std::runtime_error("Error unknown cell dimension.");
   } // if/else
+  if (_totalStrainKernel) {
+    calcTotalStrainFn = _totalStrainKernel;
+  } // if
 
   // Allocate vectors for cell values.
   scalar_array strainCell(numQuadPts*tensorSize);
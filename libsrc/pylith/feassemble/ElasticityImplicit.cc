@@ -29,6 +29,7 @@
 #include "pylith/topology/Jacobian.hh" // USES Jacobian
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/topology/MatAssemblyPlan.hh" // USES MatAssemblyPlan
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
@@ -47,6 +48,7 @@
 
 #include <cassert> // USES assert()
 #include <stdexcept> // USES std::runtime_error
+#include <sstream> // USES std::ostringstream
 
 // ----------------------------------------------------------------------
 // Constructor
@@ -158,6 +160,9 @@ pylith::feassemble::ElasticityImplicit::integrateResidual(const topology::Field&
     assert(false);
     throw std::logic_error("Unsupported cell dimension in ElasticityImplicit::integrateResidual().");
   } // if/else		   
+  if (_totalStrainKernel) {
+    calcTotalStrainFn = _totalStrainKernel;
+  } // if
 
   // Allocate vectors for cell values.
   scalar_array dispTpdtCell(numBasis*spaceDim);
@@ -287,7 +292,7 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
 
   /// Member prototype for _elasticityJacobianXD()
   typedef void (pylith::feassemble::ElasticityImplicit::*elasticityJacobian_fn_type)
-    (const scalar_array&);
+    (const scalar_array&, const bool);
 
   assert(_quadrature);
   assert(_material);
@@ -330,6 +335,9 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
     assert(false);
     throw std::logic_error("Unsupported cell dimension in ElasticityImplicit::integrateJacobian().");
   } // if/else
+  if (_totalStrainKernel) {
+    calcTotalStrainFn = _totalStrainKernel;
+  } // if
 
   // Allocate vector for total strain
   scalar_array dispTpdtCell(numBasis*spaceDim);
@@ -356,9 +364,27 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
 
   _material->createPropsAndVarsVisitors();
 
-  // Get sparse matrix
+  // Get sparse matrix and insertion pattern for material cells.
   const PetscMat jacobianMat = jacobian->matrix();assert(jacobianMat);
-  topology::MatVisitorMesh jacobianVisitor(jacobianMat, fields->get("disp(t)"));
+  if (!_jacobianPlan) {
+    _jacobianPlan = new topology::MatAssemblyPlan();
+  } // if
+  _jacobianPlan->begin(jacobianMat, fields->get("disp(t)"), cells, numCells);
+
+  // For symmetric cell matrices only compute the blocks on and above
+  // the diagonal; the plan fills in the rest only if the matrix
+  // format needs it. Keep the full cell matrix when checking the
+  // conditioning.
+  const bool isSymmetric = _material->isJacobianSymmetric();
+  if (!isSymmetric && _jacobianPlan->isSymmetricStorage()) {
+    _jacobianPlan->end();
+    std::ostringstream msg;
+    msg << "Jacobian for material '" << _material->label() << "' is not symmetric, "
+	<< "but the Jacobian sparse matrix only stores the upper triangle. "
+	<< "Use a nonsymmetric matrix type, such as 'aij' or 'baij'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  const bool upperOnly = isSymmetric && !_quadrature->checkConditioning();
 
   // Get parameters used in integration.
   const PylithScalar dt = _dt;
@@ -399,7 +425,7 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
     // Get "elasticity" matrix at quadrature points for this cell
     const scalar_array& elasticConsts = _material->calcDerivElastic(strainCell);
 
-    CALL_MEMBER_FN(*this, elasticityJacobianFn)(elasticConsts);
+    CALL_MEMBER_FN(*this, elasticityJacobianFn)(elasticConsts, upperOnly);
 
     if (_quadrature->checkConditioning()) {
       int n = numBasis*spaceDim;
@@ -438,8 +464,13 @@ pylith::feassemble::ElasticityImplicit::integrateJacobian(topology::Jacobian* ja
 
     // Assemble cell contribution into PETSc matrix.
     //   Notice that we are using the default sections
-    jacobianVisitor.setClosure(&_cellMatrix[0], _cellMatrix.size(), cell, ADD_VALUES);
+    if (isSymmetric) {
+      _jacobianPlan->addClosureSymmetric(&_cellMatrix[0], _cellMatrix.size(), spaceDim, c);
+    } else {
+      _jacobianPlan->addClosure(&_cellMatrix[0], _cellMatrix.size(), c);
+    } // if/else
   } // for
+  _jacobianPlan->end();
   _material->destroyPropsAndVarsVisitors();
 
   _needNewJacobian = false;
@@ -29,6 +29,7 @@
 #include "pylith/topology/Jacobian.hh" // USES Jacobian
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/topology/MatAssemblyPlan.hh" // USES MatAssemblyPlan
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
@@ -352,9 +353,12 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateJacobian(topology::Jaco
   scalar_array coordsCell(numBasis*spaceDim); // :KLUDGE: numBasis to numCorners after switching to higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
 
-  // Get sparse matrix
+  // Get sparse matrix and insertion pattern for material cells.
   const PetscMat jacobianMat = jacobian->matrix();assert(jacobianMat);
-  topology::MatVisitorMesh jacobianVisitor(jacobianMat, fields->get("disp(t)"));
+  if (!_jacobianPlan) {
+    _jacobianPlan = new topology::MatAssemblyPlan();
+  } // if
+  _jacobianPlan->begin(jacobianMat, fields->get("disp(t)"), cells, numCells);
 
   _material->createPropsAndVarsVisitors();
 
@@ -440,8 +444,9 @@ pylith::feassemble::ElasticityImplicitLgDeform::integrateJacobian(topology::Jaco
     } // if
 
     // Assemble cell contribution into PETSc matrix.
-    jacobianVisitor.setClosure(&_cellMatrix[0], _cellMatrix.size(), cell, ADD_VALUES);
+    _jacobianPlan->addClosure(&_cellMatrix[0], _cellMatrix.size(), c);
   } // for
+  _jacobianPlan->end();
   _material->destroyPropsAndVarsVisitors();
 
   _needNewJacobian = false;
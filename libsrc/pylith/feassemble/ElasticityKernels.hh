@@ -0,0 +1,148 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/feassemble/ElasticityKernels.hh
+ *
+ * @brief Small strain elasticity kernels for a cell with the number
+ * of basis functions and quadrature points fixed at compile time.
+ */
+
+#if !defined(pylith_feassemble_elasticitykernels_hh)
+#define pylith_feassemble_elasticitykernels_hh
+
+// Include directives ---------------------------------------------------
+#include "feassemblefwd.hh" // forward declarations
+
+#include "pylith/utils/array.hh" // USES scalar_array
+
+// ElasticityKernels ----------------------------------------------------
+/** @brief Small strain elasticity kernels for a cell with the number
+ * of basis functions and quadrature points fixed at compile time.
+ *
+ * The kernels compute the same quantities as
+ * IntegratorElasticity::_calcTotalStrainXD(),
+ * IntegratorElasticity::_elasticityResidualXD(), and
+ * IntegratorElasticity::_elasticityJacobianXD(), but all loops have
+ * compile-time trip counts so the compiler can unroll them
+ * completely. IntegratorElasticity selects the kernels in
+ * initialize() for Tri3, Quad4, Tet4, and Hex8 cells with 1- or
+ * 2-point Gauss rules.
+ *
+ * Arrays use the same layout as the corresponding Quadrature and
+ * ElasticMaterial arrays.
+ */
+template<int dim, int numBasis, int numQuadPts>
+class pylith::feassemble::ElasticityKernels
+{ // ElasticityKernels
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /** Compute total strain at quadrature points of a cell.
+   *
+   * Signature matches IntegratorElasticity::totalStrain_fn_type.
+   *
+   * @param strain Strain tensor at quadrature points.
+   * @param basisDeriv Derivatives of basis functions at quadrature points.
+   * @param disp Displacement at vertices of cell.
+   * @param numBasisCell Number of basis functions for cell (must match numBasis).
+   * @param spaceDim Spatial dimension (must match dim).
+   * @param numQuadPtsCell Number of quadrature points (must match numQuadPts).
+   */
+  static
+  void calcTotalStrain(scalar_array* strain,
+		       const scalar_array& basisDeriv,
+		       const PylithScalar* disp,
+		       const int numBasisCell,
+		       const int spaceDim,
+		       const int numQuadPtsCell);
+
+  /** Integrate elasticity term in residual for a cell.
+   *
+   * @param cellVector Residual vector for cell.
+   * @param stress Stress tensor at quadrature points.
+   * @param quadWts Weights of quadrature points.
+   * @param jacobianDet Determinant of Jacobian at quadrature points.
+   * @param basisDeriv Derivatives of basis functions at quadrature points.
+   */
+  static
+  void residual(PylithScalar* cellVector,
+		const PylithScalar* stress,
+		const PylithScalar* quadWts,
+		const PylithScalar* jacobianDet,
+		const PylithScalar* basisDeriv);
+
+  /** Integrate elasticity term in Jacobian for a cell.
+   *
+   * @param cellMatrix Jacobian matrix for cell.
+   * @param elasticConsts Elastic constants at quadrature points.
+   * @param quadWts Weights of quadrature points.
+   * @param jacobianDet Determinant of Jacobian at quadrature points.
+   * @param basisDeriv Derivatives of basis functions at quadrature points.
+   */
+  static
+  void jacobian(PylithScalar* cellMatrix,
+		const PylithScalar* elasticConsts,
+		const PylithScalar* quadWts,
+		const PylithScalar* jacobianDet,
+		const PylithScalar* basisDeriv);
+
+  /** Integrate elasticity term in Jacobian for a cell, computing only
+   * the dim x dim blocks (iBasis, jBasis) with jBasis >= iBasis.
+   *
+   * Blocks below the diagonal are left untouched; they are the
+   * transpose of the blocks above the diagonal when the elastic
+   * constants have major symmetry.
+   *
+   * @param cellMatrix Jacobian matrix for cell.
+   * @param elasticConsts Elastic constants at quadrature points.
+   * @param quadWts Weights of quadrature points.
+   * @param jacobianDet Determinant of Jacobian at quadrature points.
+   * @param basisDeriv Derivatives of basis functions at quadrature points.
+   */
+  static
+  void jacobianUpper(PylithScalar* cellMatrix,
+		     const PylithScalar* elasticConsts,
+		     const PylithScalar* quadWts,
+		     const PylithScalar* jacobianDet,
+		     const PylithScalar* basisDeriv);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Integrate elasticity term in Jacobian for a cell.
+   *
+   * @tparam upperOnly If true, compute only blocks on and above the diagonal.
+   */
+  template<bool upperOnly>
+  static
+  void _jacobian(PylithScalar* cellMatrix,
+		 const PylithScalar* elasticConsts,
+		 const PylithScalar* quadWts,
+		 const PylithScalar* jacobianDet,
+		 const PylithScalar* basisDeriv);
+
+}; // ElasticityKernels
+
+#include "ElasticityKernels.icc" // template methods
+
+#endif // pylith_feassemble_elasticitykernels_hh
+
+
+// End of file
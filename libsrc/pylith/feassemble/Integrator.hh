@@ -226,6 +226,14 @@ public :
 			const PylithScalar t,
 			const topology::Field& jacobian);
 
+  /** Project initial guess for the increment in the solution onto the
+   * constraints of the integrator.
+   *
+   * @param fields Solution fields.
+   */
+  virtual
+  void projectSolnIncr(topology::SolutionFields* const fields);
+
   /** Verify configuration is acceptable.
    *
    * @param mesh Finite-element mesh
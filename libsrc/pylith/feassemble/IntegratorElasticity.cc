@@ -22,6 +22,7 @@
 
 #include "Quadrature.hh" // USES Quadrature
 #include "CellGeometry.hh" // USES CellGeometry
+#include "ElasticityKernels.hh" // USES ElasticityKernels
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Field.hh" // USES Field
@@ -29,6 +30,7 @@
 #include "pylith/topology/SolutionFields.hh" // USES SolutionFields
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+#include "pylith/topology/MatAssemblyPlan.hh" // USES MatAssemblyPlan
 #include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
 #include "pylith/materials/ElasticMaterial.hh" // USES ElasticMaterial
 
@@ -49,8 +51,17 @@
 pylith::feassemble::IntegratorElasticity::IntegratorElasticity(void) :
     _material(0),
     _materialIS(0),
-    _outputFields(0)
+    _outputFields(0),
+    _totalStrainKernel(0),
+    _residualKernel(0),
+    _jacobianKernel(0),
+    _jacobianUpperKernel(0),
+    _jacobianPlan(0)
 { // constructor
+    _outputCache.strainCurrent = false;
+    _outputCache.stressCurrent = false;
+    _outputCache.strainCaptured = false;
+    _outputCache.outputDue = false;
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -72,6 +83,7 @@ pylith::feassemble::IntegratorElasticity::deallocate(void)
     _material = 0; // :TODO: Use shared pointer.
     delete _materialIS; _materialIS = 0;
     delete _outputFields; _outputFields = 0;
+    delete _jacobianPlan; _jacobianPlan = 0;
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -121,6 +133,7 @@ pylith::feassemble::IntegratorElasticity::initialize(const topology::Mesh& mesh)
 
     // Compute geometry for quadrature operations.
     _quadrature->initializeGeometry();
+    _setupKernels();
 
     // Optimize coordinate retrieval in closure
     topology::CoordsVisitor::optimizeClosure(dmMesh);
@@ -156,6 +169,13 @@ pylith::feassemble::IntegratorElasticity::updateStateVars(const PylithScalar t,
     assert(_material);
     assert(fields);
 
+    // Solution has changed, so derived output fields are out of date.
+    _outputCache.strainCurrent = false;
+    _outputCache.stressCurrent = false;
+    _outputCache.strainCaptured = false;
+    const bool keepStrain = !_outputCache.stressName.empty() && _outputCache.outputDue;
+    _outputCache.outputDue = false;
+
     // No need to update state vars if material doesn't have any.
     if (!_material->hasStateVars())
         PYLITH_METHOD_END;
@@ -177,6 +197,9 @@ pylith::feassemble::IntegratorElasticity::updateStateVars(const PylithScalar t,
         assert(0);
         throw std::logic_error("Bad cell dimension in IntegratorElasticity::updateStateVars().");
     } // else
+    if (_totalStrainKernel) {
+        calcTotalStrainFn = _totalStrainKernel;
+    } // if
 
     // Allocate arrays for cell data.
     scalar_array strainCell(numQuadPts*tensorSize);
@@ -196,6 +219,19 @@ pylith::feassemble::IntegratorElasticity::updateStateVars(const PylithScalar t,
     scalar_array coordsCell(numCorners*spaceDim);
     topology::CoordsVisitor coordsVisitor(dmMesh);
 
+    // Keep total strain for output when it is computed together with
+    // stress and output may be written for this time step.
+    topology::VecVisitorMesh* strainOutputVisitor = 0;
+    if (keepStrain) {
+        if (!_outputFields) {
+            _outputFields = new topology::Fields(fields->mesh()); assert(_outputFields);
+        } // if
+        _allocateTensorField(fields->mesh(), "buffer (total_strain)");
+        strainOutputVisitor = new topology::VecVisitorMesh(_outputFields->get("buffer (total_strain)")); assert(strainOutputVisitor);
+    } // if
+    PetscScalar* strainOutputArray = (strainOutputVisitor) ? strainOutputVisitor->localArray() : NULL;
+    const int strainCellSize = numQuadPts*tensorSize;
+
     _material->createPropsAndVarsVisitors();
 
     // Loop over cells
@@ -218,9 +254,23 @@ pylith::feassemble::IntegratorElasticity::updateStateVars(const PylithScalar t,
 
         // Update material state
         _material->updateStateVars(strainCell, cell);
+
+        if (strainOutputArray) {
+            const PetscInt off = strainOutputVisitor->sectionOffset(cell);
+            assert(strainCellSize == strainOutputVisitor->sectionDof(cell));
+            for (int i=0; i < strainCellSize; ++i) {
+                strainOutputArray[off+i] = strainCell[i];
+            } // for
+        } // if
     } // for
     _material->destroyPropsAndVarsVisitors();
 
+    if (strainOutputVisitor) {
+        _outputCache.strainCurrent = true;
+        _outputCache.strainCaptured = true;
+    } // if
+    delete strainOutputVisitor; strainOutputVisitor = 0;
+
     PYLITH_METHOD_END;
 } // updateStateVars
 
@@ -324,12 +374,7 @@ pylith::feassemble::IntegratorElasticity::cellField(const char* name,
 
         } else { // must calculate total strain
             assert(fields);
-            _allocateTensorField(mesh);
-            topology::Field& buffer = _outputFields->get("buffer (tensor)");
-            buffer.label("total_strain");
-            buffer.scale(1.0);
-            buffer.dimensionalizeOkay(true);
-            _calcStrainStressField(&buffer, namelower.c_str(), fields);
+            topology::Field& buffer = _derivedTensorField(namelower.c_str(), mesh, fields);
             PYLITH_METHOD_RETURN(buffer);
 
         } // if/else
@@ -347,12 +392,7 @@ pylith::feassemble::IntegratorElasticity::cellField(const char* name,
 
         } else { // calculate strain and then stress
             assert(fields);
-            _allocateTensorField(mesh);
-            topology::Field& buffer = _outputFields->get("buffer (tensor)");
-            buffer.label(namelower.c_str());
-            buffer.scale(_normalizer->pressureScale());
-            buffer.dimensionalizeOkay(true);
-            _calcStrainStressField(&buffer, namelower.c_str(), fields);
+            topology::Field& buffer = _derivedTensorField(namelower.c_str(), mesh, fields);
             PYLITH_METHOD_RETURN(buffer);
 
         } // else
@@ -392,6 +432,50 @@ pylith::feassemble::IntegratorElasticity::cellField(const char* name,
     PYLITH_METHOD_RETURN(buffer);
 } // cellField
 
+// ----------------------------------------------------------------------
+// Set names of cell fields requested for output.
+void
+pylith::feassemble::IntegratorElasticity::cellFieldsRequested(const char* const* names,
+                                                              const int numNames)
+{ // cellFieldsRequested
+    PYLITH_METHOD_BEGIN;
+
+    assert(_material);
+    assert( (!names && 0 == numNames) || (names && 0 < numNames) );
+
+    // Compute total strain and stress together only if neither is
+    // available as a state variable.
+    bool hasStrain = false;
+    std::string stressName;
+    for (int i=0; i < numNames; ++i) {
+        if (0 == strcasecmp(names[i], "total_strain")) {
+            hasStrain = !_material->hasStateVar("total_strain");
+        } else if (stressName.empty() && (0 == strcasecmp(names[i], "stress") || 0 == strcasecmp(names[i], "cauchy_stress"))) {
+            stressName = names[i];
+            std::transform(stressName.begin(), stressName.end(), stressName.begin(), ::tolower);
+            if (_material->hasStateVar(stressName.c_str())) {
+                stressName = "";
+            } // if
+        } // if/else
+    } // for
+    _outputCache.stressName = (hasStrain) ? stressName : "";
+    _outputCache.strainCurrent = false;
+    _outputCache.stressCurrent = false;
+    _outputCache.strainCaptured = false;
+    _outputCache.outputDue = false;
+
+    PYLITH_METHOD_END;
+} // cellFieldsRequested
+
+// ----------------------------------------------------------------------
+// Set whether output may be written after the next update of the
+// state variables.
+void
+pylith::feassemble::IntegratorElasticity::outputDue(const bool value)
+{ // outputDue
+    _outputCache.outputDue = value;
+} // outputDue
+
 // ----------------------------------------------------------------------
 // Get output fields.
 const pylith::topology::Fields*
@@ -429,10 +513,67 @@ pylith::feassemble::IntegratorElasticity::_initializeLogger(void)
     PYLITH_METHOD_END;
 } // initializeLogger
 
+// ----------------------------------------------------------------------
+// Use kernels for given cell and quadrature sizes.
+template<int dim, int numBasis, int numQuadPts>
+void
+pylith::feassemble::IntegratorElasticity::_useKernels(void)
+{ // _useKernels
+    _totalStrainKernel = &ElasticityKernels<dim, numBasis, numQuadPts>::calcTotalStrain;
+    _residualKernel = &ElasticityKernels<dim, numBasis, numQuadPts>::residual;
+    _jacobianKernel = &ElasticityKernels<dim, numBasis, numQuadPts>::jacobian;
+    _jacobianUpperKernel = &ElasticityKernels<dim, numBasis, numQuadPts>::jacobianUpper;
+} // _useKernels
+
+// ----------------------------------------------------------------------
+// Select kernels with sizes fixed at compile time.
+void
+pylith::feassemble::IntegratorElasticity::_setupKernels(void)
+{ // _setupKernels
+    assert(_quadrature);
+
+    _totalStrainKernel = 0;
+    _residualKernel = 0;
+    _jacobianKernel = 0;
+    _jacobianUpperKernel = 0;
+
+    const int cellDim = _quadrature->cellDim();
+    const int spaceDim = _quadrature->spaceDim();
+    const int numBasis = _quadrature->numBasis();
+    const int numQuadPts = _quadrature->numQuadPts();
+    if (cellDim != spaceDim) {
+        return;
+    } // if
+
+    // Tri3, Quad4, Tet4, and Hex8 cells with 1- or 2-point Gauss rules.
+    if (2 == cellDim) {
+        if (3 == numBasis && 1 == numQuadPts) {
+            _useKernels<2,3,1>();
+        } else if (3 == numBasis && 4 == numQuadPts) {
+            _useKernels<2,3,4>();
+        } else if (4 == numBasis && 1 == numQuadPts) {
+            _useKernels<2,4,1>();
+        } else if (4 == numBasis && 4 == numQuadPts) {
+            _useKernels<2,4,4>();
+        } // if/else
+    } else if (3 == cellDim) {
+        if (4 == numBasis && 1 == numQuadPts) {
+            _useKernels<3,4,1>();
+        } else if (4 == numBasis && 8 == numQuadPts) {
+            _useKernels<3,4,8>();
+        } else if (8 == numBasis && 1 == numQuadPts) {
+            _useKernels<3,8,1>();
+        } else if (8 == numBasis && 8 == numQuadPts) {
+            _useKernels<3,8,8>();
+        } // if/else
+    } // if/else
+} // _setupKernels
+
 // ----------------------------------------------------------------------
 // Allocate buffer for tensor field at quadrature points.
 void
-pylith::feassemble::IntegratorElasticity::_allocateTensorField(const topology::Mesh& mesh)
+pylith::feassemble::IntegratorElasticity::_allocateTensorField(const topology::Mesh& mesh,
+                                                               const char* name)
 { // _allocateTensorField
     PYLITH_METHOD_BEGIN;
 
@@ -451,9 +592,9 @@ pylith::feassemble::IntegratorElasticity::_allocateTensorField(const topology::M
     const int numQuadPts = _quadrature->numQuadPts();
     const int tensorSize = _material->tensorSize();
 
-    if (!_outputFields->hasField("buffer (tensor)")) {
-        _outputFields->add("buffer (tensor)", "buffer");
-        topology::Field& buffer = _outputFields->get("buffer (tensor)");
+    if (!_outputFields->hasField(name)) {
+        _outputFields->add(name, "buffer");
+        topology::Field& buffer = _outputFields->get(name);
         buffer.newSection(cellsTmp, numQuadPts*tensorSize);
         buffer.allocate();
         buffer.vectorFieldType(topology::FieldBase::MULTI_TENSOR);
@@ -464,19 +605,80 @@ pylith::feassemble::IntegratorElasticity::_allocateTensorField(const topology::M
 } // _allocateTensorField
 
 // ----------------------------------------------------------------------
+// Get total strain or stress field computed from the solution.
+pylith::topology::Field&
+pylith::feassemble::IntegratorElasticity::_derivedTensorField(const char* name,
+                                                              const topology::Mesh& mesh,
+                                                              topology::SolutionFields* const fields)
+{ // _derivedTensorField
+    PYLITH_METHOD_BEGIN;
+
+    assert(_normalizer);
+    assert(_outputFields);
+
+    const bool isStrain = 0 == strcasecmp(name, "total_strain");
+    const bool isFused = !_outputCache.stressName.empty() && (isStrain || _outputCache.stressName == name);
+
+    if (!isFused) {
+        _allocateTensorField(mesh);
+        topology::Field& buffer = _outputFields->get("buffer (tensor)");
+        buffer.label(name);
+        buffer.scale((isStrain) ? 1.0 : _normalizer->pressureScale());
+        buffer.dimensionalizeOkay(true);
+        if (isStrain) {
+            _calcStrainStressFields(&buffer, NULL, NULL, fields);
+        } else {
+            _calcStrainStressFields(NULL, &buffer, name, fields);
+        } // if/else
+        PYLITH_METHOD_RETURN(buffer);
+    } // if
+
+    _allocateTensorField(mesh, "buffer (total_strain)");
+    _allocateTensorField(mesh, "buffer (stress)");
+    topology::Field& strainBuffer = _outputFields->get("buffer (total_strain)");
+    topology::Field& stressBuffer = _outputFields->get("buffer (stress)");
+
+    if ((isStrain && !_outputCache.strainCurrent) || (!isStrain && !_outputCache.stressCurrent)) {
+        stressBuffer.label(_outputCache.stressName.c_str());
+        stressBuffer.scale(_normalizer->pressureScale());
+        stressBuffer.dimensionalizeOkay(true);
+        if (_outputCache.strainCaptured) {
+            // Total strain is up to date from updateStateVars().
+            _calcStressFromStrain(&stressBuffer, strainBuffer);
+        } else {
+            _calcStrainStressFields(&strainBuffer, &stressBuffer, _outputCache.stressName.c_str(), fields);
+        } // if/else
+        _outputCache.strainCurrent = true;
+        _outputCache.stressCurrent = true;
+        _outputCache.strainCaptured = false;
+    } // if
+
+    if (isStrain) {
+        strainBuffer.label("total_strain");
+        strainBuffer.scale(1.0);
+        strainBuffer.dimensionalizeOkay(true);
+        PYLITH_METHOD_RETURN(strainBuffer);
+    } // if
+
+    // Stress is dimensionalized in place when it is written.
+    _outputCache.stressCurrent = false;
+    PYLITH_METHOD_RETURN(stressBuffer);
+} // _derivedTensorField
+
+// ----------------------------------------------------------------------
+// Calculate strain and/or stress fields from solution field.
 void
-pylith::feassemble::IntegratorElasticity::_calcStrainStressField(topology::Field* field,
-                                                                 const char* name,
-                                                                 topology::SolutionFields* const fields)
-{ // _calcStrainStressField
+pylith::feassemble::IntegratorElasticity::_calcStrainStressFields(topology::Field* strainField,
+                                                                  topology::Field* stressField,
+                                                                  const char* stressName,
+                                                                  topology::SolutionFields* const fields)
+{ // _calcStrainStressFields
     PYLITH_METHOD_BEGIN;
 
-    assert(field);
+    assert(strainField || stressField);
     assert(_quadrature);
     assert(_material);
 
-    const bool calcStress = (0 == strcasecmp(name, "stress") || 0 == strcasecmp(name, "cauchy_stress")) ? true : false;
-
     // Get cell information that doesn't depend on particular cell
     const int cellDim = _quadrature->cellDim();
     const int numQuadPts = _quadrature->numQuadPts();
@@ -493,9 +695,11 @@ pylith::feassemble::IntegratorElasticity::_calcStrainStressField(topology::Field
         assert(0);
         throw std::logic_error("Bad cell dimension in IntegratorElasticity.");
     } // else
+    if (_totalStrainKernel) {
+        calcTotalStrainFn = _totalStrainKernel;
+    } // if
 
     // Allocate arrays for cell data.
-    scalar_array dispCellTmp(numBasis*spaceDim);
     const int tensorCellSize = numQuadPts*tensorSize;
     scalar_array strainCell(tensorCellSize);
     strainCell = 0.0;
@@ -513,13 +717,25 @@ pylith::feassemble::IntegratorElasticity::_calcStrainStressField(topology::Field
     topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
     dispVisitor.optimizeClosure();
 
-    topology::VecVisitorMesh fieldVisitor(*field);
-    PetscScalar* fieldArray = fieldVisitor.localArray();
+    // Both output fields use the same layout.
+    topology::VecVisitorMesh fieldVisitor((strainField) ? *strainField : *stressField);
+    PetscScalar* strainArray = (strainField) ? fieldVisitor.localArray() : NULL;
+    PetscScalar* stressArray = NULL;
+    PetscVec stressVec = NULL;
+    PetscErrorCode err = 0;
+    if (stressField && strainField) {
+        stressVec = stressField->localVector(); assert(stressVec);
+        err = VecGetArray(stressVec, &stressArray); PYLITH_CHECK_ERROR(err);
+    } else if (stressField) {
+        stressArray = fieldVisitor.localArray();
+    } // if/else
 
     scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
     topology::CoordsVisitor coordsVisitor(dmMesh);
 
-    _material->createPropsAndVarsVisitors();
+    if (stressField) {
+        _material->createPropsAndVarsVisitors();
+    } // if
 
     // Loop over cells
     for(PetscInt c = 0; c < numCells; ++c) {
@@ -538,23 +754,83 @@ pylith::feassemble::IntegratorElasticity::_calcStrainStressField(topology::Field
 
         const PetscInt off = fieldVisitor.sectionOffset(cell);
         assert(tensorCellSize == fieldVisitor.sectionDof(cell));
-        if (!calcStress) {
+        if (strainArray) {
             for (int i=0; i < tensorCellSize; ++i) {
-                fieldArray[off+i] = strainCell[i];
+                strainArray[off+i] = strainCell[i];
             } // for
-        } else {
+        } // if
+        if (stressArray) {
             _material->retrievePropsAndVars(cell);
             stressCell = _material->calcStress(strainCell);
 
             for (int i=0; i < tensorCellSize; ++i) {
-                fieldArray[off+i] = stressCell[i];
+                stressArray[off+i] = stressCell[i];
             } // for
-        } // else
+        } // if
+    } // for
+    if (stressField) {
+        _material->destroyPropsAndVarsVisitors();
+    } // if
+    if (stressVec) {
+        err = VecRestoreArray(stressVec, &stressArray); PYLITH_CHECK_ERROR(err);
+    } // if
+
+    PYLITH_METHOD_END;
+} // _calcStrainStressFields
+
+// ----------------------------------------------------------------------
+// Calculate stress field from total strain field.
+void
+pylith::feassemble::IntegratorElasticity::_calcStressFromStrain(topology::Field* stressField,
+                                                                const topology::Field& strainField)
+{ // _calcStressFromStrain
+    PYLITH_METHOD_BEGIN;
+
+    assert(stressField);
+    assert(_quadrature);
+    assert(_material);
+
+    const int numQuadPts = _quadrature->numQuadPts();
+    const int tensorSize = _material->tensorSize();
+    const int tensorCellSize = numQuadPts*tensorSize;
+    scalar_array strainCell(tensorCellSize);
+    scalar_array stressCell(tensorCellSize);
+
+    assert(_materialIS);
+    const PetscInt* cells = _materialIS->points();
+    const PetscInt numCells = _materialIS->size();
+
+    topology::VecVisitorMesh strainVisitor(strainField);
+    const PetscScalar* strainArray = strainVisitor.localArray();
+
+    topology::VecVisitorMesh stressVisitor(*stressField);
+    PetscScalar* stressArray = stressVisitor.localArray();
+
+    _material->createPropsAndVarsVisitors();
+
+    // Loop over cells
+    for(PetscInt c = 0; c < numCells; ++c) {
+        const PetscInt cell = cells[c];
+
+        const PetscInt soff = strainVisitor.sectionOffset(cell);
+        assert(tensorCellSize == strainVisitor.sectionDof(cell));
+        for (int i=0; i < tensorCellSize; ++i) {
+            strainCell[i] = strainArray[soff+i];
+        } // for
+
+        _material->retrievePropsAndVars(cell);
+        stressCell = _material->calcStress(strainCell);
+
+        const PetscInt off = stressVisitor.sectionOffset(cell);
+        assert(tensorCellSize == stressVisitor.sectionDof(cell));
+        for (int i=0; i < tensorCellSize; ++i) {
+            stressArray[off+i] = stressCell[i];
+        } // for
     } // for
     _material->destroyPropsAndVarsVisitors();
 
     PYLITH_METHOD_END;
-} // _calcStrainStressField
+} // _calcStressFromStrain
 
 // ----------------------------------------------------------------------
 // Integrate elasticity term in residual for 2-D cells.
@@ -575,6 +851,11 @@ pylith::feassemble::IntegratorElasticity::_elasticityResidual2D(const scalar_arr
     assert(_quadrature->cellDim() == cellDim);
     assert(quadWts.size() == size_t(numQuadPts));
 
+    if (_residualKernel) {
+        _residualKernel(&_cellVector[0], &stress[0], &quadWts[0], &jacobianDet[0], &basisDeriv[0]);
+        return;
+    } // if
+
     for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
         const int iQs = iQuad*stressSize;
         const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad];
@@ -612,6 +893,11 @@ pylith::feassemble::IntegratorElasticity::_elasticityResidual3D(const scalar_arr
     assert(_quadrature->cellDim() == cellDim);
     assert(quadWts.size() == size_t(numQuadPts));
 
+    if (_residualKernel) {
+        _residualKernel(&_cellVector[0], &stress[0], &quadWts[0], &jacobianDet[0], &basisDeriv[0]);
+        return;
+    } // if
+
     for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
         const int iQs = iQuad * stressSize;
         const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad];
@@ -641,7 +927,8 @@ pylith::feassemble::IntegratorElasticity::_elasticityResidual3D(const scalar_arr
 // ----------------------------------------------------------------------
 // Integrate elasticity term in Jacobian for 2-D cells.
 void
-pylith::feassemble::IntegratorElasticity::_elasticityJacobian2D(const scalar_array& elasticConsts)
+pylith::feassemble::IntegratorElasticity::_elasticityJacobian2D(const scalar_array& elasticConsts,
+								 const bool upperOnly)
 { // _elasticityJacobian2D
     const int spaceDim = 2;
     const int cellDim = 2;
@@ -657,6 +944,12 @@ pylith::feassemble::IntegratorElasticity::_elasticityJacobian2D(const scalar_arr
     assert(_quadrature->cellDim() == cellDim);
     assert(quadWts.size() == size_t(numQuadPts));
 
+    const elasticityKernel_fn_type kernel = (upperOnly) ? _jacobianUpperKernel : _jacobianKernel;
+    if (kernel) {
+        kernel(&_cellMatrix[0], &elasticConsts[0], &quadWts[0], &jacobianDet[0], &basisDeriv[0]);
+        return;
+    } // if
+
     for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
         const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad];
         // tau_ij = C_ijkl * e_kl
@@ -678,7 +971,7 @@ pylith::feassemble::IntegratorElasticity::_elasticityJacobian2D(const scalar_arr
             const PylithScalar Ni2 = wt*basisDeriv[iQ+iBasis*spaceDim+1];
             const int iBlock = (iBasis*spaceDim  ) * (numBasis*spaceDim);
             const int iBlock1 = (iBasis*spaceDim+1) * (numBasis*spaceDim);
-            for (int jBasis=0; jBasis < numBasis; ++jBasis) {
+            for (int jBasis=(upperOnly) ? iBasis : 0; jBasis < numBasis; ++jBasis) {
                 const PylithScalar Nj1 = basisDeriv[iQ+jBasis*spaceDim  ];
                 const PylithScalar Nj2 = basisDeriv[iQ+jBasis*spaceDim+1];
                 const PylithScalar ki0j0 =
@@ -702,13 +995,15 @@ pylith::feassemble::IntegratorElasticity::_elasticityJacobian2D(const scalar_arr
             } // for
         } // for
     } // for
-    PetscLogFlops(numQuadPts*(1+numBasis*(2+numBasis*(3*11+4))));
+    const int numBlocks = (upperOnly) ? numBasis*(numBasis+1)/2 : numBasis*numBasis;
+    PetscLogFlops(numQuadPts*(1+numBasis*2+numBlocks*(3*11+4)));
 } // _elasticityJacobian2D
 
 // ----------------------------------------------------------------------
 // Integrate elasticity term in Jacobian for 3-D cells.
 void
-pylith::feassemble::IntegratorElasticity::_elasticityJacobian3D(const scalar_array& elasticConsts)
+pylith::feassemble::IntegratorElasticity::_elasticityJacobian3D(const scalar_array& elasticConsts,
+								 const bool upperOnly)
 { // _elasticityJacobian3D
     const int spaceDim = 3;
     const int cellDim = 3;
@@ -724,6 +1019,12 @@ pylith::feassemble::IntegratorElasticity::_elasticityJacobian3D(const scalar_arr
     assert(_quadrature->cellDim() == cellDim);
     assert(quadWts.size() == size_t(numQuadPts));
 
+    const elasticityKernel_fn_type kernel = (upperOnly) ? _jacobianUpperKernel : _jacobianKernel;
+    if (kernel) {
+        kernel(&_cellMatrix[0], &elasticConsts[0], &quadWts[0], &jacobianDet[0], &basisDeriv[0]);
+        return;
+    } // if
+
     // Compute Jacobian for consistent tangent matrix
     for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
         const PylithScalar wt = quadWts[iQuad] * jacobianDet[iQuad];
@@ -773,7 +1074,7 @@ pylith::feassemble::IntegratorElasticity::_elasticityJacobian3D(const scalar_arr
             const PylithScalar Ni1 = wt*basisDeriv[iQ+iBasis*spaceDim+0];
             const PylithScalar Ni2 = wt*basisDeriv[iQ+iBasis*spaceDim+1];
             const PylithScalar Ni3 = wt*basisDeriv[iQ+iBasis*spaceDim+2];
-            for (int jBasis=0; jBasis < numBasis; ++jBasis) {
+            for (int jBasis=(upperOnly) ? iBasis : 0; jBasis < numBasis; ++jBasis) {
                 const PylithScalar Nj1 = basisDeriv[iQ+jBasis*spaceDim+0];
                 const PylithScalar Nj2 = basisDeriv[iQ+jBasis*spaceDim+1];
                 const PylithScalar Nj3 = basisDeriv[iQ+jBasis*spaceDim+2];
@@ -831,7 +1132,8 @@ pylith::feassemble::IntegratorElasticity::_elasticityJacobian3D(const scalar_arr
             } // for
         } // for
     } // for
-    PetscLogFlops(numQuadPts*(1+numBasis*(3+numBasis*(6*26+9))));
+    const int numBlocks = (upperOnly) ? numBasis*(numBasis+1)/2 : numBasis*numBasis;
+    PetscLogFlops(numQuadPts*(1+numBasis*3+numBlocks*(6*26+9)));
 } // _elasticityJacobian3D
 
 // ----------------------------------------------------------------------
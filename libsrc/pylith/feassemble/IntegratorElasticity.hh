@@ -36,6 +36,8 @@
 
 #include "pylith/utils/arrayfwd.hh" // USES std::vector, scalar_array
 
+#include <string> // HASA std::string
+
 // IntegratorElasticity -------------------------------------------------
 /** @brief General elasticity operations for implicit and explicit
  * time integration of the elasticity equation.
@@ -53,6 +55,13 @@ public :
 				      const int,
 				      const int,
 				      const int);
+
+  /// Prototype for kernels integrating the elasticity term for a cell.
+  typedef void (*elasticityKernel_fn_type)(PylithScalar*,
+					   const PylithScalar*,
+					   const PylithScalar*,
+					   const PylithScalar*,
+					   const PylithScalar*);
   
 
 // PUBLIC MEMBERS ///////////////////////////////////////////////////////
@@ -122,28 +131,83 @@ public :
 				   const topology::Mesh& mesh,
 				   topology::SolutionFields* const fields =0);
 
+  /** Set names of cell fields requested for output.
+   *
+   * When both the total strain and the stress must be computed from
+   * the displacement field, they are computed together in a single
+   * pass over the cells.
+   *
+   * @param names Array of names of cell fields.
+   * @param numNames Number of names.
+   */
+  void cellFieldsRequested(const char* const* names,
+			   const int numNames);
+
+  /** Set whether output may be written after the next update of the
+   * state variables. If so, updateStateVars() keeps the total strain
+   * it computes for output of total strain and stress computed
+   * together. Applies only to the next call to updateStateVars().
+   *
+   * @param value True if output may be written, false otherwise.
+   */
+  void outputDue(const bool value);
+
 // PROTECTED METHODS ////////////////////////////////////////////////////
 protected :
 
   /// Initialize logger.
   void _initializeLogger(void);
 
+  /** Select kernels with sizes fixed at compile time (see
+   * ElasticityKernels) if they match the cell type and quadrature.
+   */
+  void _setupKernels(void);
+
+  /// Use kernels for given cell and quadrature sizes.
+  template<int dim, int numBasis, int numQuadPts>
+  void _useKernels(void);
+
   /** Allocate buffer for tensor field at quadrature points.
    *
    * @param mesh Finite-element mesh.
+   * @param name Name of buffer in output fields.
+   */
+  void _allocateTensorField(const topology::Mesh& mesh,
+			    const char* name ="buffer (tensor)");
+
+  /** Get total strain or stress field computed from the solution,
+   * using fields computed together for output when available.
+   *
+   * @param name Name of field ['total_strain', 'stress', 'cauchy_stress'].
+   * @param mesh Finite-element mesh.
+   * @param fields Manager for solution fields.
+   * @returns Buffer with field.
    */
-  void _allocateTensorField(const topology::Mesh& mesh);
+  topology::Field& _derivedTensorField(const char* name,
+				       const topology::Mesh& mesh,
+				       topology::SolutionFields* const fields);
 
-  /** Calculate stress or strain field from solution field.
+  /** Calculate strain and/or stress fields from solution field in a
+   * single pass over the cells.
    *
-   * @param field Field in which to store stress or strain.
-   * @param name Name of field to compute ['total_strain', 'stress', 'cauchy_stress'].
+   * @param strainField Field in which to store total strain (NULL if not needed).
+   * @param stressField Field in which to store stress (NULL if not needed).
+   * @param stressName Name of stress field ['stress', 'cauchy_stress'].
    * @param fields Manager for solution fields.
    */
   virtual
-  void _calcStrainStressField(topology::Field* field,
-			      const char* name,
-			      topology::SolutionFields* const fields);
+  void _calcStrainStressFields(topology::Field* strainField,
+			       topology::Field* stressField,
+			       const char* stressName,
+			       topology::SolutionFields* const fields);
+
+  /** Calculate stress field from total strain field.
+   *
+   * @param stressField Field in which to store stress.
+   * @param strainField Field with total strain.
+   */
+  void _calcStressFromStrain(topology::Field* stressField,
+			     const topology::Field& strainField);
 
   /** Integrate elasticity term in residual for 2-D cells.
    *
@@ -162,16 +226,22 @@ protected :
   /** Integrate elasticity term in Jacobian for 2-D cells.
    *
    * @param elasticConsts Matrix of elasticity constants at quadrature points.
+   * @param upperOnly If true, only compute blocks (iBasis, jBasis)
+   *   with jBasis >= iBasis (requires symmetric elastic constants).
    */
   virtual
-  void _elasticityJacobian2D(const scalar_array& elasticConsts);
+  void _elasticityJacobian2D(const scalar_array& elasticConsts,
+			     const bool upperOnly =false);
 
   /** Integrate elasticity term in Jacobian for 3-D cells.
    *
    * @param elasticConsts Matrix of elasticity constants at quadrature points.
+   * @param upperOnly If true, only compute blocks (iBasis, jBasis)
+   *   with jBasis >= iBasis (requires symmetric elastic constants).
    */
   virtual
-  void _elasticityJacobian3D(const scalar_array& elasticConsts);
+  void _elasticityJacobian3D(const scalar_array& elasticConsts,
+			     const bool upperOnly =false);
 
   /** Compute total strain in at quadrature points of a cell.
    *
@@ -217,6 +287,24 @@ protected :
   
   topology::Fields* _outputFields; ///< Buffers for output.
 
+  /// State of derived tensor fields computed together for output.
+  struct OutputCache {
+    std::string stressName; ///< Stress field computed with total strain (empty if not computed together).
+    bool strainCurrent; ///< Total strain buffer is consistent with current solution.
+    bool stressCurrent; ///< Stress buffer is consistent with current solution.
+    bool strainCaptured; ///< Total strain buffer was filled in updateStateVars().
+    bool outputDue; ///< Output may be written after next updateStateVars().
+  }; // OutputCache
+  OutputCache _outputCache; ///< Derived tensor fields for output.
+
+  /// Kernels specialized for cell type and quadrature (NULL if not available).
+  totalStrain_fn_type _totalStrainKernel; ///< Kernel for total strain.
+  elasticityKernel_fn_type _residualKernel; ///< Kernel for elasticity term in residual.
+  elasticityKernel_fn_type _jacobianKernel; ///< Kernel for elasticity term in Jacobian.
+  elasticityKernel_fn_type _jacobianUpperKernel; ///< Kernel for upper triangle of elasticity term in Jacobian.
+
+  topology::MatAssemblyPlan* _jacobianPlan; ///< Insertion pattern for cell matrices in Jacobian.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
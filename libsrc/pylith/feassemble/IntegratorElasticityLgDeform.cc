@@ -76,6 +76,12 @@ pylith::feassemble::IntegratorElasticityLgDeform::updateStateVars(const PylithSc
   assert(_material);
   assert(fields);
 
+  // Solution has changed, so derived output fields are out of date.
+  _outputCache.strainCurrent = false;
+  _outputCache.stressCurrent = false;
+  _outputCache.strainCaptured = false;
+  _outputCache.outputDue = false;
+
   // No need to update state vars if material doesn't have any.
   if (!_material->hasStateVars())
     PYLITH_METHOD_END;
@@ -148,21 +154,21 @@ pylith::feassemble::IntegratorElasticityLgDeform::updateStateVars(const PylithSc
 } // updateStateVars
 
 // ----------------------------------------------------------------------
+// Calculate strain and/or stress fields from solution field.
 void
-pylith::feassemble::IntegratorElasticityLgDeform::_calcStrainStressField(topology::Field* field,
-									 const char* name,
-									 topology::SolutionFields* const fields)
-{ // _calcStrainStressField
+pylith::feassemble::IntegratorElasticityLgDeform::_calcStrainStressFields(topology::Field* strainField,
+									  topology::Field* stressField,
+									  const char* stressName,
+									  topology::SolutionFields* const fields)
+{ // _calcStrainStressFields
   PYLITH_METHOD_BEGIN;
 
-  assert(field);
+  assert(strainField || stressField);
   assert(_quadrature);
   assert(_material);
 
-  const bool calcStress = (0 == strcasecmp(name, "stress") || 0 == strcasecmp(name, "cauchy_stress")) ? true : false;
-  const bool calcCauchyStress = (0 == strcasecmp(name, "cauchy_stress")) ? true : false;
+  const bool calcCauchyStress = (stressField && 0 == strcasecmp(stressName, "cauchy_stress")) ? true : false;
 
-    
   // Get cell information that doesn't depend on particular cell
   const int cellDim = _quadrature->cellDim();
   const int numQuadPts = _quadrature->numQuadPts();
@@ -176,7 +182,7 @@ pylith::feassemble::IntegratorElasticityLgDeform::_calcStrainStressField(topolog
     calcTotalStrainFn = &pylith::feassemble::IntegratorElasticityLgDeform::_calcTotalStrain3D;
   } else {
     std::ostringstream msg;
-    msg << "Bad cell dimension '" << cellDim << " in IntegratorElasticityLgDeform::_calcStrainStressField()'." << std::endl;
+    msg << "Bad cell dimension '" << cellDim << " in IntegratorElasticityLgDeform::_calcStrainStressFields()'." << std::endl;
     throw std::logic_error(msg.str());
   } // else
   
@@ -202,13 +208,25 @@ pylith::feassemble::IntegratorElasticityLgDeform::_calcStrainStressField(topolog
   topology::VecVisitorMesh dispVisitor(fields->get("disp(t)"), "displacement");
   dispVisitor.optimizeClosure();
 
-  topology::VecVisitorMesh fieldVisitor(*field);
-  PetscScalar* fieldArray = fieldVisitor.localArray();
+  // Both output fields use the same layout.
+  topology::VecVisitorMesh fieldVisitor((strainField) ? *strainField : *stressField);
+  PetscScalar* strainArray = (strainField) ? fieldVisitor.localArray() : NULL;
+  PetscScalar* stressArray = NULL;
+  PetscVec stressVec = NULL;
+  PetscErrorCode err = 0;
+  if (stressField && strainField) {
+    stressVec = stressField->localVector();assert(stressVec);
+    err = VecGetArray(stressVec, &stressArray);PYLITH_CHECK_ERROR(err);
+  } else if (stressField) {
+    stressArray = fieldVisitor.localArray();
+  } // if/else
 
   scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
 
-  _material->createPropsAndVarsVisitors();
+  if (stressField) {
+    _material->createPropsAndVarsVisitors();
+  } // if
 
   // Loop over cells
   for (PetscInt c = 0; c < numCells; ++c) {
@@ -230,11 +248,12 @@ pylith::feassemble::IntegratorElasticityLgDeform::_calcStrainStressField(topolog
 
     const PetscInt off = fieldVisitor.sectionOffset(cell);
     assert(tensorCellSize == fieldVisitor.sectionDof(cell));
-    if (!calcStress) {
+    if (strainArray) {
       for (int i=0; i < tensorCellSize; ++i) {
-	fieldArray[off+i] = strainCell[i];
+	strainArray[off+i] = strainCell[i];
       } // for
-    } else {
+    } // if
+    if (stressArray) {
       _material->retrievePropsAndVars(cell);
       stressCell = _material->calcStress(strainCell);
 
@@ -245,19 +264,24 @@ pylith::feassemble::IntegratorElasticityLgDeform::_calcStrainStressField(topolog
 	  _calcCauchyStress3D(&stressCauchyCell, stressCell, deformCell, numQuadPts);
 	} // if/else
 	for (int i=0; i < tensorCellSize; ++i) {
-	  fieldArray[off+i] = stressCauchyCell[i];
+	  stressArray[off+i] = stressCauchyCell[i];
 	} // for
       } else {
 	for (int i=0; i < tensorCellSize; ++i) {
-	  fieldArray[off+i] = stressCell[i];
+	  stressArray[off+i] = stressCell[i];
 	} // for
       } // if/else
-    } // else
+    } // if
   } // for
-  _material->destroyPropsAndVarsVisitors();
+  if (stressField) {
+    _material->destroyPropsAndVarsVisitors();
+  } // if
+  if (stressVec) {
+    err = VecRestoreArray(stressVec, &stressArray);PYLITH_CHECK_ERROR(err);
+  } // if
 
   PYLITH_METHOD_END;
-} // _calcStrainStressField
+} // _calcStrainStressFields
 
 // ----------------------------------------------------------------------
 // Integrate elasticity term in residual for 2-D cells.
@@ -75,15 +75,18 @@ public :
 // PROTECTED METHODS ////////////////////////////////////////////////////
 protected :
 
-  /** Calculate stress or strain field from solution field.
+  /** Calculate strain and/or stress fields from solution field in a
+   * single pass over the cells.
    *
-   * @param field Field in which to store stress or strain.
-   * @param name Name of field to compute ['total_strain', 'stress', 'cauchy_stress'].
+   * @param strainField Field in which to store total strain (NULL if not needed).
+   * @param stressField Field in which to store stress (NULL if not needed).
+   * @param stressName Name of stress field ['stress', 'cauchy_stress'].
    * @param fields Manager for solution fields.
    */
-  void _calcStrainStressField(topology::Field* field,
-			      const char* name,
-			      topology::SolutionFields* const fields);
+  void _calcStrainStressFields(topology::Field* strainField,
+			       topology::Field* stressField,
+			       const char* stressName,
+			       topology::SolutionFields* const fields);
 
   /** Integrate elasticity term in residual for 2-D cells.
    *
@@ -28,6 +28,7 @@
 #include "Quadrature2D.hh"
 #include "Quadrature2Din3D.hh"
 #include "Quadrature3D.hh"
+#include "QuadratureFixed.hh" // USES QuadratureFixedFactory
 
 #include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
 
@@ -93,36 +94,41 @@ pylith::feassemble::Quadrature::initializeGeometry(void)
   const int cellDim = _cellDim;
   const int spaceDim = _spaceDim;
 
-  if (2 == spaceDim)
-    if (2 == cellDim)
-      _engine = new Quadrature2D(*this);
-    else if (1 == cellDim)
-      _engine = new Quadrature1Din2D(*this);
-    else {
-      std::cerr << "Unknown quadrature case with cellDim '" 
+  // Use engine with sizes fixed at compile time if available.
+  _engine = QuadratureFixedFactory::create(*this);
+
+  if (!_engine) {
+    if (2 == spaceDim)
+      if (2 == cellDim)
+        _engine = new Quadrature2D(*this);
+      else if (1 == cellDim)
+        _engine = new Quadrature1Din2D(*this);
+      else {
+        std::cerr << "Unknown quadrature case with cellDim '" 
 		<< cellDim << "' and spaceDim '" << spaceDim << "'" 
 		<< std::endl;
-      assert(0);
-    } // if/else
-  else if (3 == spaceDim)
-    if (3 == cellDim)
-      _engine = new Quadrature3D(*this);
-    else if (2 == cellDim)
-      _engine = new Quadrature2Din3D(*this);
-    else if (1 == cellDim)
-      _engine = new Quadrature1Din3D(*this);
-    else {
-      std::cerr << "Unknown quadrature case with cellDim '" 
+        assert(0);
+      } // if/else
+    else if (3 == spaceDim)
+      if (3 == cellDim)
+        _engine = new Quadrature3D(*this);
+      else if (2 == cellDim)
+        _engine = new Quadrature2Din3D(*this);
+      else if (1 == cellDim)
+        _engine = new Quadrature1Din3D(*this);
+      else {
+        std::cerr << "Unknown quadrature case with cellDim '" 
 		<< cellDim << "' and spaceDim '" << spaceDim << "'" 
 		<< std::endl;
-      assert(0);
-    } // if/else
-  else {
-    std::cerr << "Unknown quadrature case with cellDim '" 
+        assert(0);
+      } // if/else
+    else {
+      std::cerr << "Unknown quadrature case with cellDim '" 
 	      << cellDim << "' and spaceDim '" << spaceDim << "'" 
 	      << std::endl;
-    assert(0);
-  } // if/else
+      assert(0);
+    } // if/else
+  } // if
 
   assert(_engine);
   _engine->initialize();
@@ -0,0 +1,68 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "QuadratureFixed.hh" // implementation of class methods
+
+#include "QuadratureRefCell.hh" // USES QuadratureRefCell
+
+// ----------------------------------------------------------------------
+// Create quadrature engine with sizes fixed at compile time.
+pylith::feassemble::QuadratureEngine*
+pylith::feassemble::QuadratureFixedFactory::create(const QuadratureRefCell& q)
+{ // create
+  const int cellDim = q.cellDim();
+  const int spaceDim = q.spaceDim();
+  const int numBasis = q.numBasis();
+  const int numQuadPts = q.numQuadPts();
+
+  if (cellDim != spaceDim)
+    return 0;
+
+  if (2 == cellDim) {
+    if (3 == numBasis) { // Tri3
+      if (1 == numQuadPts)
+	return new QuadratureFixed<2,3,1>(q);
+      else if (4 == numQuadPts)
+	return new QuadratureFixed<2,3,4>(q);
+    } else if (4 == numBasis) { // Quad4
+      if (1 == numQuadPts)
+	return new QuadratureFixed<2,4,1>(q);
+      else if (4 == numQuadPts)
+	return new QuadratureFixed<2,4,4>(q);
+    } // if/else
+  } else if (3 == cellDim) {
+    if (4 == numBasis) { // Tet4
+      if (1 == numQuadPts)
+	return new QuadratureFixed<3,4,1>(q);
+      else if (8 == numQuadPts)
+	return new QuadratureFixed<3,4,8>(q);
+    } else if (8 == numBasis) { // Hex8
+      if (1 == numQuadPts)
+	return new QuadratureFixed<3,8,1>(q);
+      else if (8 == numQuadPts)
+	return new QuadratureFixed<3,8,8>(q);
+    } // if/else
+  } // if/else
+
+  return 0;
+} // create
+
+
+// End of file 
@@ -0,0 +1,114 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/feassemble/QuadratureFixed.hh
+ *
+ * @brief Quadrature for linear cells with the number of basis
+ * functions and quadrature points fixed at compile time.
+ */
+
+#if !defined(pylith_feassemble_quadraturefixed_hh)
+#define pylith_feassemble_quadraturefixed_hh
+
+// Include directives ---------------------------------------------------
+#include "QuadratureEngine.hh"
+
+// QuadratureFixed ------------------------------------------------------
+/** @brief Quadrature for cells with the same dimension as the domain
+ * with the number of basis functions and quadrature points fixed at
+ * compile time.
+ *
+ * Computes the same quantities as Quadrature2D and Quadrature3D, but
+ * all loops have compile-time trip counts and intermediate values are
+ * held in fixed-size arrays on the stack, so the compiler can unroll
+ * the loops completely. Use create() to get an engine for Tri3, Quad4,
+ * Tet4, or Hex8 cells with 1- or 2-point Gauss rules.
+ */
+template<int dim, int numBasis, int numQuadPts>
+class pylith::feassemble::QuadratureFixed : public QuadratureEngine
+{ // QuadratureFixed
+  friend class TestQuadratureFixed; // unit testing
+
+// PUBLIC MEMBERS ///////////////////////////////////////////////////////
+public :
+
+  /** Constructor.
+   *
+   * @param q Quadrature information for reference cell.
+   */
+  QuadratureFixed(const QuadratureRefCell& q);
+
+  /// Destructor
+  ~QuadratureFixed(void);
+
+  /// Create a copy of this object.
+  QuadratureEngine* clone(void) const;
+
+  /** Compute geometric quantities for a cell at quadrature points.
+   *
+   * @param coordinatesCell Array of coordinates of cell's vertices.
+   * @param coordinatesSize Size of coordinates array.
+   * @param cell Finite-element cell
+   */
+  void computeGeometry(const PylithScalar* coordinatesCell,
+		       const int coordinatesSize,
+		       const int cell);
+
+// PROTECTED METHODS ////////////////////////////////////////////////////
+protected :
+
+  /** Copy constructor.
+   *
+   * @param q Quadrature to copy
+   */
+  QuadratureFixed(const QuadratureFixed& q);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /// Not implemented
+  const QuadratureFixed& operator=(const QuadratureFixed&);
+
+}; // QuadratureFixed
+
+// QuadratureFixedFactory -----------------------------------------------
+/// Factory for quadrature engines with fixed sizes.
+class pylith::feassemble::QuadratureFixedFactory
+{ // QuadratureFixedFactory
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /** Create quadrature engine with sizes fixed at compile time.
+   *
+   * @param q Quadrature information for reference cell.
+   * @returns Quadrature engine or NULL if there is no engine matching
+   * the cell and quadrature.
+   */
+  static
+  QuadratureEngine* create(const QuadratureRefCell& q);
+
+}; // QuadratureFixedFactory
+
+#include "QuadratureFixed.icc" // template methods
+
+#endif // pylith_feassemble_quadraturefixed_hh
+
+
+// End of file
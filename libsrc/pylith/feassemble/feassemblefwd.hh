@@ -48,11 +48,14 @@ namespace pylith {
     class Quadrature2D;
     class Quadrature2Din3D;
     class Quadrature3D;
+    template<int dim, int numBasis, int numQuadPts> class QuadratureFixed;
+    class QuadratureFixedFactory;
 
     class Constraint;
     class Integrator;
 
     class IntegratorElasticity;
+    template<int dim, int numBasis, int numQuadPts> class ElasticityKernels;
     class ElasticityImplicit;
     class ElasticityExplicit;
 
@@ -50,6 +50,9 @@ pylith::friction::FrictionModel::FrictionModel(const materials::Metadata& metada
   _dbProperties(0),
   _dbInitialState(0),
   _fieldsPropsStateVars(0),
+  _packedVStart(0),
+  _packedVEnd(0),
+  _fieldsCurrent(true),
   _propsFiberDim(0),
   _varsFiberDim(0)
 { // constructor
@@ -71,6 +74,10 @@ pylith::friction::FrictionModel::deallocate(void)
 
   delete _normalizer; _normalizer = 0;
   delete _fieldsPropsStateVars; _fieldsPropsStateVars = 0;
+  _propsStateVarsPacked.resize(0);
+  _packedVStart = 0;
+  _packedVEnd = 0;
+  _fieldsCurrent = true;
   _propsFiberDim = 0;
   _varsFiberDim = 0;
 
@@ -242,6 +249,7 @@ pylith::friction::FrictionModel::initialize(const topology::Mesh& faultMesh,
 
   // Setup buffers for restrict/update of properties and state variables.
   _propsStateVarsVertex.resize(_propsFiberDim+_varsFiberDim);
+  _packPropsStateVars(vStart, vEnd);
 
   PYLITH_METHOD_END;
 } // initialize
@@ -254,6 +262,7 @@ pylith::friction::FrictionModel::fieldsPropsStateVars(void) const
   PYLITH_METHOD_BEGIN;
 
   assert(_fieldsPropsStateVars);
+  _syncFields();
   PYLITH_METHOD_RETURN(*_fieldsPropsStateVars);
 } // fieldsPropsStateVars
 
@@ -298,6 +307,7 @@ pylith::friction::FrictionModel::getField(const char* name)
 
   assert(name);
   assert(_fieldsPropsStateVars);
+  _syncFields();
 
   PYLITH_METHOD_RETURN(_fieldsPropsStateVars->get(name));
 } // getField
@@ -309,34 +319,13 @@ pylith::friction::FrictionModel::retrievePropsStateVars(const int point)
 { // retrievePropsStateVars
   PYLITH_METHOD_BEGIN;
 
-  assert(_fieldsPropsStateVars);
-  PetscInt iOff = 0;
-
-  for (int i=0; i < _metadata.numProperties(); ++i) {
-    const materials::Metadata::ParamDescription& property = _metadata.getProperty(i);
-    // TODO This needs to be an integer instead of a string
-    topology::Field& propertyField = _fieldsPropsStateVars->get(property.name.c_str());
-    topology::VecVisitorMesh propertyVisitor(propertyField);
-    PetscScalar* propertyArray = propertyVisitor.localArray();
-    const PetscInt off = propertyVisitor.sectionOffset(point);
-    const PetscInt dof = propertyVisitor.sectionDof(point);
-    for(PetscInt d = 0; d < dof; ++d, ++iOff) {
-      _propsStateVarsVertex[iOff] = propertyArray[off+d];
-    } // for
-  } // for
-  for (int i=0; i < _metadata.numStateVars(); ++i) {
-    const materials::Metadata::ParamDescription& stateVar = _metadata.getStateVar(i);
-    // TODO This needs to be an integer instead of a string
-    topology::Field& stateVarField = _fieldsPropsStateVars->get(stateVar.name.c_str());
-    topology::VecVisitorMesh stateVarVisitor(stateVarField);
-    PetscScalar* stateVarArray = stateVarVisitor.localArray();
-    const PetscInt off = stateVarVisitor.sectionOffset(point);
-    const PetscInt dof = stateVarVisitor.sectionDof(point);
-    for(PetscInt d = 0; d < dof; ++d, ++iOff) {
-      _propsStateVarsVertex[iOff] = stateVarArray[off+d];
-    } // for
+  assert(_packedVStart <= point && point < _packedVEnd);
+  const int numValues = _propsFiberDim + _varsFiberDim;
+  assert(_propsStateVarsVertex.size() == size_t(numValues));
+  const PylithScalar* packedVertex = &_propsStateVarsPacked[(point-_packedVStart)*numValues];
+  for (int i=0; i < numValues; ++i) {
+    _propsStateVarsVertex[i] = packedVertex[i];
   } // for
-  assert(_propsStateVarsVertex.size() == size_t(iOff));
 
   PYLITH_METHOD_END;
 } // retrievePropsStateVars
@@ -411,33 +400,14 @@ pylith::friction::FrictionModel::updateStateVars(const PylithScalar t,
 		   &stateVarsVertex[0], _varsFiberDim,
 		   &propertiesVertex[0], _propsFiberDim);
 
-  PetscInt iOff = 0;
-
-  for (int i=0; i < _metadata.numProperties(); ++i) {
-    const materials::Metadata::ParamDescription& property = _metadata.getProperty(i);
-    // TODO This needs to be an integer instead of a string
-    topology::Field& propertyField = _fieldsPropsStateVars->get(property.name.c_str());
-    topology::VecVisitorMesh propertyVisitor(propertyField);
-    PetscScalar* propertyArray = propertyVisitor.localArray();
-    const PetscInt off = propertyVisitor.sectionOffset(vertex);
-    const PetscInt dof = propertyVisitor.sectionDof(vertex);
-    for(PetscInt d = 0; d < dof; ++d, ++iOff) {
-      propertyArray[off+d] = _propsStateVarsVertex[iOff];
-    } // for
+  // Fields are updated from packed array when they are requested.
+  assert(_packedVStart <= vertex && vertex < _packedVEnd);
+  const int numValues = _propsFiberDim + _varsFiberDim;
+  PylithScalar* packedStateVars = &_propsStateVarsPacked[(vertex-_packedVStart)*numValues+_propsFiberDim];
+  for (int i=0; i < _varsFiberDim; ++i) {
+    packedStateVars[i] = stateVarsVertex[i];
   } // for
-  for (int i=0; i < _metadata.numStateVars(); ++i) {
-    const materials::Metadata::ParamDescription& stateVar = _metadata.getStateVar(i);
-    // TODO This needs to be an integer instead of a string
-    topology::Field& stateVarField = _fieldsPropsStateVars->get(stateVar.name.c_str());
-    topology::VecVisitorMesh stateVarVisitor(stateVarField);
-    PetscScalar* stateVarArray = stateVarVisitor.localArray();
-    const PetscInt off = stateVarVisitor.sectionOffset(vertex);
-    const PetscInt dof = stateVarVisitor.sectionDof(vertex);
-    for(PetscInt d = 0; d < dof; ++d, ++iOff) {
-      stateVarArray[off+d] = _propsStateVarsVertex[iOff];
-    } // for
-  } // for
-  assert(_propsStateVarsVertex.size() == size_t(iOff));
+  _fieldsCurrent = false;
 
   PYLITH_METHOD_END;
 } // updateStateVars
@@ -523,5 +493,92 @@ pylith::friction::FrictionModel::_setupPropsStateVars(void)
   PYLITH_METHOD_END;
 } // _setupPropsStateVars
 
+// ----------------------------------------------------------------------
+// Pack properties and state variables from fields into vertex-major array.
+void
+pylith::friction::FrictionModel::_packPropsStateVars(const PetscInt vStart,
+						     const PetscInt vEnd)
+{ // _packPropsStateVars
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fieldsPropsStateVars);
+
+  const int numValues = _propsFiberDim + _varsFiberDim;
+  _packedVStart = vStart;
+  _packedVEnd = vEnd;
+  _propsStateVarsPacked.resize((vEnd-vStart)*numValues);
+  _propsStateVarsPacked = 0.0;
+
+  PetscInt iOff = 0;
+  const int numProperties = _metadata.numProperties();
+  for (int i=0; i < numProperties; ++i) {
+    const materials::Metadata::ParamDescription& property = _metadata.getProperty(i);
+    topology::VecVisitorMesh propertyVisitor(_fieldsPropsStateVars->get(property.name.c_str()));
+    const PetscScalar* propertyArray = propertyVisitor.localArray();
+    for (PetscInt v = vStart; v < vEnd; ++v) {
+      const PetscInt off = propertyVisitor.sectionOffset(v);
+      assert(property.fiberDim == propertyVisitor.sectionDof(v));
+      for (int d = 0; d < property.fiberDim; ++d) {
+	_propsStateVarsPacked[(v-vStart)*numValues+iOff+d] = propertyArray[off+d];
+      } // for
+    } // for
+    iOff += property.fiberDim;
+  } // for
+
+  const int numStateVars = _metadata.numStateVars();
+  for (int i=0; i < numStateVars; ++i) {
+    const materials::Metadata::ParamDescription& stateVar = _metadata.getStateVar(i);
+    topology::VecVisitorMesh stateVarVisitor(_fieldsPropsStateVars->get(stateVar.name.c_str()));
+    const PetscScalar* stateVarArray = stateVarVisitor.localArray();
+    for (PetscInt v = vStart; v < vEnd; ++v) {
+      const PetscInt off = stateVarVisitor.sectionOffset(v);
+      assert(stateVar.fiberDim == stateVarVisitor.sectionDof(v));
+      for (int d = 0; d < stateVar.fiberDim; ++d) {
+	_propsStateVarsPacked[(v-vStart)*numValues+iOff+d] = stateVarArray[off+d];
+      } // for
+    } // for
+    iOff += stateVar.fiberDim;
+  } // for
+  assert(numValues == iOff);
+
+  _fieldsCurrent = true;
+
+  PYLITH_METHOD_END;
+} // _packPropsStateVars
+
+// ----------------------------------------------------------------------
+// Copy state variables from packed array into fields, if necessary.
+void
+pylith::friction::FrictionModel::_syncFields(void) const
+{ // _syncFields
+  PYLITH_METHOD_BEGIN;
+
+  if (_fieldsCurrent)
+    PYLITH_METHOD_END;
+
+  assert(_fieldsPropsStateVars);
+
+  const int numValues = _propsFiberDim + _varsFiberDim;
+  PetscInt iOff = _propsFiberDim;
+  const int numStateVars = _metadata.numStateVars();
+  for (int i=0; i < numStateVars; ++i) {
+    const materials::Metadata::ParamDescription& stateVar = _metadata.getStateVar(i);
+    topology::VecVisitorMesh stateVarVisitor(_fieldsPropsStateVars->get(stateVar.name.c_str()));
+    PetscScalar* stateVarArray = stateVarVisitor.localArray();
+    for (PetscInt v = _packedVStart; v < _packedVEnd; ++v) {
+      const PetscInt off = stateVarVisitor.sectionOffset(v);
+      assert(stateVar.fiberDim == stateVarVisitor.sectionDof(v));
+      for (int d = 0; d < stateVar.fiberDim; ++d) {
+	stateVarArray[off+d] = _propsStateVarsPacked[(v-_packedVStart)*numValues+iOff+d];
+      } // for
+    } // for
+    iOff += stateVar.fiberDim;
+  } // for
+
+  _fieldsCurrent = true;
+
+  PYLITH_METHOD_END;
+} // _syncFields
+
 
 // End of file 
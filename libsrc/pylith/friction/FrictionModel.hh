@@ -341,6 +341,18 @@ private :
   /// Setup fields for physical properties and state variables.
   void _setupPropsStateVars(void);
 
+  /** Pack properties and state variables from fields into
+   * vertex-major array.
+   *
+   * @param vStart First vertex in fault mesh.
+   * @param vEnd One past last vertex in fault mesh.
+   */
+  void _packPropsStateVars(const PetscInt vStart,
+			   const PetscInt vEnd);
+
+  /// Copy state variables from packed array into fields, if necessary.
+  void _syncFields(void) const;
+
   // PROTECTED MEMBERS //////////////////////////////////////////////////
 protected :
 
@@ -369,6 +381,16 @@ private :
   /// Buffer for properties and state variables at vertex.
   scalar_array _propsStateVarsVertex;
 
+  /// Properties and state variables for all vertices, packed
+  /// vertex-major with properties followed by state variables.
+  scalar_array _propsStateVarsPacked;
+
+  PetscInt _packedVStart; ///< First vertex in packed array.
+  PetscInt _packedVEnd; ///< One past last vertex in packed array.
+
+  /// True if state variable fields match packed array.
+  mutable bool _fieldsCurrent;
+
   int _propsFiberDim; ///< Number of properties per point.
   int _varsFiberDim; ///< Number of state variables per point.
 
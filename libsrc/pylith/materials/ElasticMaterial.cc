@@ -46,9 +46,14 @@ pylith::materials::ElasticMaterial::ElasticMaterial(const int dimension,
 						    const int numElasticConsts,
 						    const Metadata& metadata) :
   Material(dimension, tensorSize, metadata),
+  _numCoefsQuadPt(0),
   _dbInitialStress(0),
   _dbInitialStrain(0),
   _initialFields(0),
+  _coefsQuadPt(0),
+  _coefsDt(-1.0),
+  _dtStableImplicitCurrent(false),
+  _dtStableExplicitCurrent(false),
   _numQuadPts(0),
   _numElasticConsts(numElasticConsts),
   _propertiesVisitor(0),
@@ -83,6 +88,12 @@ pylith::materials::ElasticMaterial::deallocate(void)
   _dbInitialStress = 0; // :TODO: Use shared pointer.
   _dbInitialStrain = 0; // :TODO: Use shared pointer.
 
+  _dtStableImplicit.resize(0);
+  _dtStableExplicit.resize(0);
+  _minCellWidth.resize(0);
+  _dtStableImplicitCurrent = false;
+  _dtStableExplicitCurrent = false;
+
   PYLITH_METHOD_END;
 } // deallocate
   
@@ -107,6 +118,10 @@ pylith::materials::ElasticMaterial::initialize(const topology::Mesh& mesh,
   _initializeInitialStress(mesh, quadrature);
   _initializeInitialStrain(mesh, quadrature);
   _allocateCellArrays();
+  _coefsDt = -1.0;
+  _minCellWidth.resize(0);
+  _dtStableImplicitCurrent = false;
+  _dtStableExplicitCurrent = false;
 
   PYLITH_METHOD_END;
 } // initialize
@@ -175,11 +190,31 @@ pylith::materials::ElasticMaterial::retrievePropsAndVars(const int cell)
   assert(_propertiesVisitor);
   PetscScalar* propertiesArray = _propertiesVisitor->localArray();
   const PetscInt poff = _propertiesVisitor->sectionOffset(cell);
-  assert(propertiesSize == _propertiesVisitor->sectionDof(cell));
-  for(PetscInt d = 0; d < propertiesSize; ++d) {
-    _propertiesCell[d] = propertiesArray[poff+d];
+  int stride = 0;
+  const PylithScalar* propsCell = _propsCell(&stride, propertiesArray, poff);
+  for (int iQuad=0; iQuad < _numQuadPts; ++iQuad) {
+    for (int i=0; i < _numPropsQuadPt; ++i) {
+      _propertiesCell[iQuad*_numPropsQuadPt+i] = propsCell[iQuad*stride+i];
+    } // for
   } // for
 
+  if (_numCoefsQuadPt > 0) {
+    if (_dt != _coefsDt) {
+      _updateTimeStepCoefs();
+    } // if
+    // Coefficients are stored at the same points as the properties.
+    const int coefsSize = _numQuadPts*_numCoefsQuadPt;
+    assert(_coefsCell.size() == size_t(coefsSize));
+    const PetscInt coff = (PROPS_UNIFORM == _propsStorage) ? 0 : (poff / _numPropsQuadPt) * _numCoefsQuadPt;
+    const int coefsStride = (stride / _numPropsQuadPt) * _numCoefsQuadPt;
+    for (int iQuad=0; iQuad < _numQuadPts; ++iQuad) {
+      for (int i=0; i < _numCoefsQuadPt; ++i) {
+	assert(size_t(coff+iQuad*coefsStride+i) < _coefs.size());
+	_coefsCell[iQuad*_numCoefsQuadPt+i] = _coefs[coff+iQuad*coefsStride+i];
+      } // for
+    } // for
+  } // if
+
   if (hasStateVars()) {
     assert(_stateVarsVisitor);
     PetscScalar* stateVarsArray = _stateVarsVisitor->localArray();
@@ -238,7 +273,8 @@ pylith::materials::ElasticMaterial::calcStress(const scalar_array& totalStrain,
   assert(_initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
   assert(totalStrain.size() == size_t(numQuadPts*_tensorSize));
 
-  for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
+  for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+    _coefsQuadPt = (_numCoefsQuadPt > 0) ? &_coefsCell[iQuad*_numCoefsQuadPt] : 0;
     _calcStress(&_stressCell[iQuad*_tensorSize], _tensorSize,
 		&_propertiesCell[iQuad*numPropsQuadPt], numPropsQuadPt,
 		&_stateVarsCell[iQuad*numVarsQuadPt], numVarsQuadPt,
@@ -246,6 +282,8 @@ pylith::materials::ElasticMaterial::calcStress(const scalar_array& totalStrain,
 		&_initialStressCell[iQuad*_tensorSize], _tensorSize,
 		&_initialStrainCell[iQuad*_tensorSize], _tensorSize,
 		computeStateVars);
+  } // for
+  _coefsQuadPt = 0;
 
   PYLITH_METHOD_RETURN(_stressCell);
 } // calcStress
@@ -267,7 +305,8 @@ pylith::materials::ElasticMaterial::calcDerivElastic(const scalar_array& totalSt
   assert(_initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
   assert(totalStrain.size() == size_t(numQuadPts*_tensorSize));
 
-  for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
+  for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+    _coefsQuadPt = (_numCoefsQuadPt > 0) ? &_coefsCell[iQuad*_numCoefsQuadPt] : 0;
     _calcElasticConsts(&_elasticConstsCell[iQuad*_numElasticConsts], 
 		       _numElasticConsts,
 		       &_propertiesCell[iQuad*numPropsQuadPt], 
@@ -276,6 +315,8 @@ pylith::materials::ElasticMaterial::calcDerivElastic(const scalar_array& totalSt
 		       &totalStrain[iQuad*_tensorSize], _tensorSize,
 		       &_initialStressCell[iQuad*_tensorSize], _tensorSize,
 		       &_initialStrainCell[iQuad*_tensorSize], _tensorSize);
+  } // for
+  _coefsQuadPt = 0;
 
   PYLITH_METHOD_RETURN(_elasticConstsCell);
 } // calcDerivElastic
@@ -297,22 +338,31 @@ pylith::materials::ElasticMaterial::updateStateVars(const scalar_array& totalStr
   assert(_initialStrainCell.size() == size_t(numQuadPts*_tensorSize));
   assert(totalStrain.size() == size_t(numQuadPts*_tensorSize));
 
-  for (int iQuad=0; iQuad < numQuadPts; ++iQuad)
+  for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+    _coefsQuadPt = (_numCoefsQuadPt > 0) ? &_coefsCell[iQuad*_numCoefsQuadPt] : 0;
     _updateStateVars(&_stateVarsCell[iQuad*numVarsQuadPt], numVarsQuadPt,
 		     &_propertiesCell[iQuad*numPropsQuadPt], 
 		     numPropsQuadPt,
 		     &totalStrain[iQuad*_tensorSize], _tensorSize,
 		     &_initialStressCell[iQuad*_tensorSize], _tensorSize,
 		     &_initialStrainCell[iQuad*_tensorSize], _tensorSize);
+  } // for
+  _coefsQuadPt = 0;
   
   topology::VecVisitorMesh stateVarsVisitor(*_stateVars);
   PetscScalar* stateVarsArray = stateVarsVisitor.localArray();
   const PetscInt soff = stateVarsVisitor.sectionOffset(cell);
   const int stateVarsSize = numQuadPts*numVarsQuadPt;
   assert(stateVarsSize == stateVarsVisitor.sectionDof(cell));
+  bool isChanged = false;
   for (PetscInt d = 0; d < stateVarsSize; ++d) {
+    isChanged = isChanged || stateVarsArray[soff+d] != _stateVarsCell[d];
     stateVarsArray[soff+d] = _stateVarsCell[d];
   } // for
+  if (isChanged && _stableTimeStepUsesStateVars()) {
+    _dtStableImplicitCurrent = false;
+    _dtStableExplicitCurrent = false;
+  } // if
 
   PYLITH_METHOD_END;
 } // updateStateVars
@@ -372,34 +422,30 @@ pylith::materials::ElasticMaterial::stableTimeStepImplicit(const topology::Mesh&
     fieldVisitor = new topology::VecVisitorMesh(*field);assert(fieldVisitor);
     fieldArray = fieldVisitor->localArray();
   } // if
-  createPropsAndVarsVisitors();
 
+  if (!_dtStableImplicitCurrent) {
+    _updateStableTimeStepsImplicit();
+  } // if
+  assert(_dtStableImplicit.size() == size_t(numCells*numQuadPts));
+
+  // Minimum over contiguous array of cached values.
   PylithScalar dtStable = pylith::PYLITH_MAXSCALAR;
-  scalar_array dtStableCell(numQuadPts);
-  for (PetscInt c = 0; c < numCells; ++c) {
-    const PetscInt cell = cells[c];
+  const size_t numPoints = _dtStableImplicit.size();
+  for (size_t i=0; i < numPoints; ++i) {
+    if (_dtStableImplicit[i] < dtStable) {
+      dtStable = _dtStableImplicit[i];
+    } // if
+  } // for
 
-    retrievePropsAndVars(cell);
-    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
-      const PylithScalar dt = 
-        _stableTimeStepImplicit(&_propertiesCell[iQuad*numPropsQuadPt],
-                                numPropsQuadPt,
-                                &_stateVarsCell[iQuad*numVarsQuadPt],
-                                numVarsQuadPt);
-      dtStableCell[iQuad] = dt;
-      if (dt < dtStable) {
-        dtStable = dt;
-      } // if
-    } // for
-    if (field) {
-      assert(fieldVisitor);
-      const PetscInt off = fieldVisitor->sectionOffset(cell);
+  if (field) {
+    assert(fieldVisitor);
+    for (PetscInt c = 0; c < numCells; ++c) {
+      const PetscInt off = fieldVisitor->sectionOffset(cells[c]);
       for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
-	fieldArray[off+iQuad] = dtStableCell[iQuad];
+	fieldArray[off+iQuad] = _dtStableImplicit[c*numQuadPts+iQuad];
       } // for
-    } // if
-  } // for
-  destroyPropsAndVarsVisitors();
+    } // for
+  } // if
   delete fieldVisitor; fieldVisitor = 0;
 
   assert(dtStable > 0.0);
@@ -462,47 +508,31 @@ pylith::materials::ElasticMaterial::stableTimeStepExplicit(const topology::Mesh&
     fieldVisitor = new topology::VecVisitorMesh(*field);assert(fieldVisitor);
     fieldArray = fieldVisitor->localArray();
   } // if
-  createPropsAndVarsVisitors();
 
-  const int spaceDim = quadrature->spaceDim();
-  const int numBasis = quadrature->numBasis();
-
-  scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
-  topology::CoordsVisitor coordsVisitor(dmMesh);
+  if (!_dtStableExplicitCurrent) {
+    _updateStableTimeStepsExplicit(mesh, quadrature);
+  } // if
+  assert(_dtStableExplicit.size() == size_t(numCells*numQuadPts));
 
+  // Minimum over contiguous array of cached values.
   PylithScalar dtStable = pylith::PYLITH_MAXSCALAR;
-  scalar_array dtStableCell(numQuadPts);
-  for (PetscInt c = 0; c < numCells; ++c) {
-    const PetscInt cell = cells[c];
-
-    retrievePropsAndVars(cell);
-
-    coordsVisitor.getClosure(&coordsCell, cell);
-    const PylithScalar minCellWidth = quadrature->minCellWidth(&coordsCell[0], numBasis, spaceDim);
-    assert(minCellWidth > 0.0);
+  const size_t numPoints = _dtStableExplicit.size();
+  for (size_t i=0; i < numPoints; ++i) {
+    if (_dtStableExplicit[i] < dtStable) {
+      dtStable = _dtStableExplicit[i];
+    } // if
+  } // for
 
-    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
-      const PylithScalar dt = 
-	_stableTimeStepExplicit(&_propertiesCell[iQuad*numPropsQuadPt],
-				numPropsQuadPt,
-				&_stateVarsCell[iQuad*numVarsQuadPt],
-				numVarsQuadPt,
-				minCellWidth);
-      dtStableCell[iQuad] = dt;
-      if (dt < dtStable) {
-        dtStable = dt;
-      } // if
-    } // for
-    if (field) {
-      assert(fieldVisitor);
-      const PetscInt off = fieldVisitor->sectionOffset(cell);
-      assert(numQuadPts == fieldVisitor->sectionDof(cell));
+  if (field) {
+    assert(fieldVisitor);
+    for (PetscInt c = 0; c < numCells; ++c) {
+      const PetscInt off = fieldVisitor->sectionOffset(cells[c]);
+      assert(numQuadPts == fieldVisitor->sectionDof(cells[c]));
       for (PetscInt d = 0; d < numQuadPts; ++d) {
-        fieldArray[off+d] = dtStableCell[d];
+        fieldArray[off+d] = _dtStableExplicit[c*numQuadPts+d];
       } // for
-    } // if
-  } // for
-  destroyPropsAndVarsVisitors();
+    } // for
+  } // if
   delete fieldVisitor; fieldVisitor = 0;
 
   assert(dtStable > 0.0);
@@ -572,6 +602,42 @@ pylith::materials::ElasticMaterial::_stableTimeStepImplicitMax(const topology::M
   PYLITH_METHOD_RETURN(dtStable);
 } // _stableTimeStepImplicitMax
 
+// ----------------------------------------------------------------------
+// Compute coefficients that depend only on the time step and properties.
+void
+pylith::materials::ElasticMaterial::_calcTimeStepCoefs(PylithScalar* const coefs,
+						       const int numCoefs,
+						       const PylithScalar* properties,
+						       const int numProperties)
+{ // _calcTimeStepCoefs
+  assert(0 == numCoefs);
+} // _calcTimeStepCoefs
+
+// ----------------------------------------------------------------------
+// Get time step coefficients for current quadrature point.
+const PylithScalar*
+pylith::materials::ElasticMaterial::_timeStepCoefs(PylithScalar* const coefsWork,
+						   const PylithScalar* properties,
+						   const int numProperties)
+{ // _timeStepCoefs
+  if (_coefsQuadPt) {
+    return _coefsQuadPt;
+  } // if
+
+  assert(coefsWork);
+  _calcTimeStepCoefs(coefsWork, _numCoefsQuadPt, properties, numProperties);
+  return coefsWork;
+} // _timeStepCoefs
+
+// ----------------------------------------------------------------------
+// Get flag indicating whether the stable time step depends on the
+// state variables.
+bool
+pylith::materials::ElasticMaterial::_stableTimeStepUsesStateVars(void) const
+{ // _stableTimeStepUsesStateVars
+  return false;
+} // _stableTimeStepUsesStateVars
+
 // ----------------------------------------------------------------------
 // Allocate cell arrays.
 void
@@ -592,10 +658,149 @@ pylith::materials::ElasticMaterial::_allocateCellArrays(void)
   _densityCell.resize(numQuadPts);
   _stressCell.resize(numQuadPts * tensorSize);
   _elasticConstsCell.resize(numQuadPts * numElasticConsts);
+  _coefsCell.resize(numQuadPts * _numCoefsQuadPt);
 
   PYLITH_METHOD_END;
 } // _allocateCellArrays
 
+// ----------------------------------------------------------------------
+// Compute time step coefficients at all quadrature points.
+void
+pylith::materials::ElasticMaterial::_updateTimeStepCoefs(void)
+{ // _updateTimeStepCoefs
+  PYLITH_METHOD_BEGIN;
+
+  assert(_properties);
+  assert(_propertiesVisitor);
+  assert(_materialIS);
+
+  const int numPropsQuadPt = _numPropsQuadPt;
+  const int numCoefsQuadPt = _numCoefsQuadPt;
+
+  // Coefficients use the same layout as the properties storage, so
+  // they are only computed where properties are stored and the
+  // offset of a cell's coefficients follows from its properties
+  // offset.
+  if (PROPS_UNIFORM == _propsStorage) {
+    assert(_propsUniform.size() == size_t(numPropsQuadPt));
+    _coefs.resize(numCoefsQuadPt);
+    _calcTimeStepCoefs(&_coefs[0], numCoefsQuadPt, &_propsUniform[0], numPropsQuadPt);
+  } else {
+    const PetscScalar* propertiesArray = _propertiesVisitor->localArray();
+    const int propertiesSize = _properties->sectionSize();
+    assert(0 == propertiesSize % numPropsQuadPt);
+    _coefs.resize((propertiesSize / numPropsQuadPt) * numCoefsQuadPt);
+
+    const PetscInt* cells = _materialIS->points();
+    const PetscInt numCells = _materialIS->size();
+    for (PetscInt c=0; c < numCells; ++c) {
+      const PetscInt poff = _propertiesVisitor->sectionOffset(cells[c]);
+      const PetscInt numPts = _propertiesVisitor->sectionDof(cells[c]) / numPropsQuadPt;
+      const PetscInt coff = (poff / numPropsQuadPt) * numCoefsQuadPt;
+      for (int iPt=0; iPt < numPts; ++iPt) {
+	_calcTimeStepCoefs(&_coefs[coff+iPt*numCoefsQuadPt], numCoefsQuadPt,
+			   &propertiesArray[poff+iPt*numPropsQuadPt], numPropsQuadPt);
+      } // for
+    } // for
+  } // if/else
+  _coefsDt = _dt;
+
+  PYLITH_METHOD_END;
+} // _updateTimeStepCoefs
+
+// ----------------------------------------------------------------------
+// Compute stable time step for implicit time integration at all
+// quadrature points.
+void
+pylith::materials::ElasticMaterial::_updateStableTimeStepsImplicit(void)
+{ // _updateStableTimeStepsImplicit
+  PYLITH_METHOD_BEGIN;
+
+  assert(_materialIS);
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+
+  const int numQuadPts = _numQuadPts;
+  const int numPropsQuadPt = _numPropsQuadPt;
+  const int numVarsQuadPt = _numVarsQuadPt;
+
+  if (_dtStableImplicit.size() != size_t(numCells*numQuadPts)) {
+    _dtStableImplicit.resize(numCells*numQuadPts);
+  } // if
+  createPropsAndVarsVisitors();
+  for (PetscInt c = 0; c < numCells; ++c) {
+    retrievePropsAndVars(cells[c]);
+    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+      _dtStableImplicit[c*numQuadPts+iQuad] = 
+        _stableTimeStepImplicit(&_propertiesCell[iQuad*numPropsQuadPt],
+                                numPropsQuadPt,
+                                &_stateVarsCell[iQuad*numVarsQuadPt],
+                                numVarsQuadPt);
+    } // for
+  } // for
+  destroyPropsAndVarsVisitors();
+  _dtStableImplicitCurrent = true;
+
+  PYLITH_METHOD_END;
+} // _updateStableTimeStepsImplicit
+
+// ----------------------------------------------------------------------
+// Compute stable time step for explicit time integration at all
+// quadrature points.
+void
+pylith::materials::ElasticMaterial::_updateStableTimeStepsExplicit(const topology::Mesh& mesh,
+								   feassemble::Quadrature* quadrature)
+{ // _updateStableTimeStepsExplicit
+  PYLITH_METHOD_BEGIN;
+
+  assert(quadrature);
+  assert(_materialIS);
+  const PetscInt* cells = _materialIS->points();
+  const PetscInt numCells = _materialIS->size();
+
+  const int numQuadPts = _numQuadPts;
+  const int numPropsQuadPt = _numPropsQuadPt;
+  const int numVarsQuadPt = _numVarsQuadPt;
+
+  // Cell widths are computed from the mesh coordinates, which do not
+  // change, so they only need to be computed once.
+  if (_minCellWidth.size() != size_t(numCells)) {
+    PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+    const int spaceDim = quadrature->spaceDim();
+    const int numBasis = quadrature->numBasis();
+
+    scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
+    topology::CoordsVisitor coordsVisitor(dmMesh);
+
+    _minCellWidth.resize(numCells);
+    for (PetscInt c = 0; c < numCells; ++c) {
+      coordsVisitor.getClosure(&coordsCell, cells[c]);
+      _minCellWidth[c] = quadrature->minCellWidth(&coordsCell[0], numBasis, spaceDim);
+      assert(_minCellWidth[c] > 0.0);
+    } // for
+  } // if
+
+  if (_dtStableExplicit.size() != size_t(numCells*numQuadPts)) {
+    _dtStableExplicit.resize(numCells*numQuadPts);
+  } // if
+  createPropsAndVarsVisitors();
+  for (PetscInt c = 0; c < numCells; ++c) {
+    retrievePropsAndVars(cells[c]);
+    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+      _dtStableExplicit[c*numQuadPts+iQuad] = 
+	_stableTimeStepExplicit(&_propertiesCell[iQuad*numPropsQuadPt],
+				numPropsQuadPt,
+				&_stateVarsCell[iQuad*numVarsQuadPt],
+				numVarsQuadPt,
+				_minCellWidth[c]);
+    } // for
+  } // for
+  destroyPropsAndVarsVisitors();
+  _dtStableExplicitCurrent = true;
+
+  PYLITH_METHOD_END;
+} // _updateStableTimeStepsExplicit
+
 // ----------------------------------------------------------------------
 // Initialize initial stress field.
 void
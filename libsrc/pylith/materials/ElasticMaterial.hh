@@ -180,6 +180,10 @@ public :
    *
    * Default is MAXFLOAT (or 1.0e+30 if MAXFLOAT is not defined in math.h).
    *
+   * The stable time step at each quadrature point is cached and only
+   * recomputed after state variables that it depends upon change
+   * (see _stableTimeStepUsesStateVars()).
+   *
    * @param mesh Finite-element mesh.
    * @param field Field for storing min stable time step for each cell.
    *
@@ -193,6 +197,12 @@ public :
    *
    * Default is MAXFLOAT (or 1.0e+30 if MAXFLOAT is not defined in math.h).
    *
+   * The minimum width of each cell and the stable time step at each
+   * quadrature point are cached. The cell widths are computed from
+   * the mesh coordinates, which do not change, so only the stable
+   * time steps are recomputed after state variables that they depend
+   * upon change.
+   *
    * @param mesh Finite-element mesh.
    * @param quadrature Quadrature for finite-element integration
    * @param field Field for storing min stable time step for each cell.
@@ -357,9 +367,52 @@ protected :
 				       const int numStateVars,
 				       const double minCellWidth) const = 0;
   
+  /** Compute coefficients that depend only on the time step and the
+   * properties (for example, viscoelastic relaxation factors). The
+   * coefficients are cached at every quadrature point and recomputed
+   * only when the time step changes. Default is to do nothing.
+   *
+   * @param coefs Array for coefficients.
+   * @param numCoefs Number of coefficients.
+   * @param properties Properties at location.
+   * @param numProperties Number of properties.
+   */
+  virtual
+  void _calcTimeStepCoefs(PylithScalar* const coefs,
+			  const int numCoefs,
+			  const PylithScalar* properties,
+			  const int numProperties);
+
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
 
+  /** Get time step coefficients for current quadrature point.
+   *
+   * Returns the cached coefficients when called from calcStress(),
+   * calcDerivElastic(), or updateStateVars(); otherwise the
+   * coefficients are computed into the work array.
+   *
+   * @param coefsWork Work array for coefficients [_numCoefsQuadPt].
+   * @param properties Properties at location.
+   * @param numProperties Number of properties.
+   *
+   * @returns Coefficients at location.
+   */
+  const PylithScalar* _timeStepCoefs(PylithScalar* const coefsWork,
+				     const PylithScalar* properties,
+				     const int numProperties);
+
+  /** Get flag indicating whether the stable time step depends on the
+   * state variables. If true, the cached stable time steps are
+   * recomputed after updateStateVars() changes the state variables.
+   *
+   * Default is false (stable time step depends only on properties).
+   *
+   * @returns True if stable time step depends on state variables.
+   */
+  virtual
+  bool _stableTimeStepUsesStateVars(void) const;
+
   /** Get stable time step for implicit time integration for a
    * material where the stable time step is infinite.
    *
@@ -432,9 +485,31 @@ protected :
   PylithScalar scalarProduct3D(const PylithScalar* tensor1,
 			       const PylithScalar* tensor2);
   
+  // PROTECTED MEMBERS //////////////////////////////////////////////////
+protected :
+
+  /// Number of time step coefficients per quadrature point.
+  int _numCoefsQuadPt;
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
+  /// Compute time step coefficients at all quadrature points.
+  void _updateTimeStepCoefs(void);
+
+  /// Compute stable time step for implicit time integration at all
+  /// quadrature points.
+  void _updateStableTimeStepsImplicit(void);
+
+  /** Compute stable time step for explicit time integration at all
+   * quadrature points.
+   *
+   * @param mesh Finite-element mesh.
+   * @param quadrature Quadrature for finite-element integration
+   */
+  void _updateStableTimeStepsExplicit(const topology::Mesh& mesh,
+				      feassemble::Quadrature* quadrature);
+
   /** Allocate cell arrays.
    *
    * @param numQuadPts Number of quadrature points.
@@ -497,6 +572,53 @@ private :
    */
   scalar_array _initialStrainCell;
 
+  /** Time step coefficients at quadrature points for all cells. Layout
+   * matches the properties storage.
+   *
+   * size = numPoints * numCoefsQuadPt
+   * index = iPoint * numCoefsQuadPt + iCoef
+   */
+  scalar_array _coefs;
+
+  /** Time step coefficients at quadrature points for current cell.
+   *
+   * size = numQuadPts * numCoefsQuadPt
+   * index = iQuadPt * numCoefsQuadPt + iCoef
+   */
+  scalar_array _coefsCell;
+
+  /// Time step coefficients at current quadrature point (NULL if not
+  /// evaluating a cell).
+  const PylithScalar* _coefsQuadPt;
+
+  PylithScalar _coefsDt; ///< Time step used in computing _coefs.
+
+  /** Stable time step for implicit time integration at quadrature
+   * points for all cells in the material.
+   *
+   * size = numCells * numQuadPts
+   * index = iCell * numQuadPts + iQuadPt
+   */
+  scalar_array _dtStableImplicit;
+
+  /** Stable time step for explicit time integration at quadrature
+   * points for all cells in the material.
+   *
+   * size = numCells * numQuadPts
+   * index = iCell * numQuadPts + iQuadPt
+   */
+  scalar_array _dtStableExplicit;
+
+  /** Minimum width of cells in the material.
+   *
+   * size = numCells
+   * index = iCell
+   */
+  scalar_array _minCellWidth;
+
+  bool _dtStableImplicitCurrent; ///< True if _dtStableImplicit is current.
+  bool _dtStableExplicitCurrent; ///< True if _dtStableExplicit is current.
+
   /** Density value at quadrature points for current cell.
    *
    * size = numQuadPts
@@ -75,6 +75,13 @@ namespace pylith {
 	"viscosity-3",
       };
       
+      /// Number of time step coefficients.
+      const int numCoefs = 2*numMaxwellModels;
+
+      /// Indices of time step coefficients.
+      const int c_viscousStrainParam = 0;
+      const int c_expFac = numMaxwellModels;
+
       /// Number of state variables.
       const int numStateVars = 1 + numMaxwellModels;
       
@@ -198,6 +205,7 @@ pylith::materials::GenMaxwellIsotropic3D::GenMaxwellIsotropic3D(void) :
   _calcStressFn(0),
   _updateStateVarsFn(0)  
 { // constructor
+  _numCoefsQuadPt = _GenMaxwellIsotropic3D::numCoefs;
   useElasticBehavior(false);
   _viscousStrain.resize(_GenMaxwellIsotropic3D::numMaxwellModels*_tensorSize);
 } // constructor
@@ -685,18 +693,17 @@ pylith::materials::GenMaxwellIsotropic3D::_calcElasticConstsViscoelastic(
   const PylithScalar bulkModulus = lambda + mu2 / 3.0;
 
   // Compute viscous contribution.
+  PylithScalar coefsWork[_GenMaxwellIsotropic3D::numCoefs];
+  const PylithScalar* coefs = _timeStepCoefs(coefsWork, properties, numProperties);
+  const PylithScalar* dq = &coefs[_GenMaxwellIsotropic3D::c_viscousStrainParam];
+
   PylithScalar visFac = 0.0;
   PylithScalar visFrac = 0.0;
   PylithScalar shearRatio = 0.0;
   for (int imodel = 0; imodel < numMaxwellModels; ++imodel) {
     shearRatio = properties[p_shearRatio + imodel];
-    PylithScalar maxwellTime = pylith::PYLITH_MAXSCALAR;
     visFrac += shearRatio;
-    if (shearRatio != 0.0) {
-      maxwellTime = properties[p_maxwellTime + imodel];
-      visFac +=
-	shearRatio*ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
-    } // if
+    visFac += shearRatio * dq[imodel];
   } // for
   PylithScalar elasFrac = 1.0 - visFrac;
   PylithScalar shearFac = elasFrac + visFac;
@@ -911,6 +918,36 @@ pylith::materials::GenMaxwellIsotropic3D::_stableTimeStepExplicit(const PylithSc
 } // _stableTimeStepExplicit
 
 
+// ----------------------------------------------------------------------
+// Compute viscoelastic coefficients that depend only on the time step.
+void
+pylith::materials::GenMaxwellIsotropic3D::_calcTimeStepCoefs(PylithScalar* const coefs,
+                                                             const int numCoefs,
+                                                             const PylithScalar* properties,
+                                                             const int numProperties)
+{ // _calcTimeStepCoefs
+  assert(coefs);
+  assert(_GenMaxwellIsotropic3D::numCoefs == numCoefs);
+  assert(properties);
+  assert(_numPropsQuadPt == numProperties);
+
+  const int numMaxwellModels = _GenMaxwellIsotropic3D::numMaxwellModels;
+
+  // Coefficients for models with zero shear ratio are zero.
+  for (int imodel=0; imodel < numMaxwellModels; ++imodel) {
+    PylithScalar dq = 0.0;
+    PylithScalar expFac = 0.0;
+    if (0.0 != properties[p_shearRatio + imodel]) {
+      const PylithScalar maxwellTime = properties[p_maxwellTime + imodel];
+      dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+      expFac = exp(-_dt/maxwellTime);
+      PetscLogFlops(2);
+    } // if
+    coefs[_GenMaxwellIsotropic3D::c_viscousStrainParam + imodel] = dq;
+    coefs[_GenMaxwellIsotropic3D::c_expFac + imodel] = expFac;
+  } // for
+} // _calcTimeStepCoefs
+
 // ----------------------------------------------------------------------
 // Compute viscous strain for current time step.
 void
@@ -945,11 +982,6 @@ pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
     properties[p_shearRatio+1],
     properties[p_shearRatio+2]
   };
-  const PylithScalar maxwellTime[numMaxwellModels] = {
-    properties[p_maxwellTime  ],
-    properties[p_maxwellTime+1],
-    properties[p_maxwellTime+2]
-  };
 
   // :TODO: Need to account for initial values for state variables
   const PylithScalar meanStrainTpdt =
@@ -963,12 +995,11 @@ pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
   
   PetscLogFlops(6);
 
-  // Compute Prony series terms
-  scalar_array dq(numMaxwellModels);
-  dq = 0.0;
-  for (int i=0; i < numMaxwellModels; ++i)
-    if (muRatio[i] != 0.0)
-      dq[i] = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime[i]);
+  // Prony series terms
+  PylithScalar coefsWork[_GenMaxwellIsotropic3D::numCoefs];
+  const PylithScalar* coefs = _timeStepCoefs(coefsWork, properties, numProperties);
+  const PylithScalar* dq = &coefs[_GenMaxwellIsotropic3D::c_viscousStrainParam];
+  const PylithScalar* expFac = &coefs[_GenMaxwellIsotropic3D::c_expFac];
 
   // Compute new viscous strains
   PylithScalar devStrainTpdt = 0.0;
@@ -984,7 +1015,7 @@ pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
     int imodel = 0;
     if (0.0 != muRatio[imodel]) {
       _viscousStrain[imodel * tensorSize+iComp] = 
-	exp(-_dt/maxwellTime[imodel]) *
+	expFac[imodel] *
 	stateVars[s_viscousStrain1 + iComp] + dq[imodel] * deltaStrain;
       PetscLogFlops(6);
     } // if
@@ -993,7 +1024,7 @@ pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
     imodel = 1;
     if (0.0 != muRatio[imodel]) {
       _viscousStrain[imodel*tensorSize+iComp] =
-	exp(-_dt/maxwellTime[imodel]) *
+	expFac[imodel] *
 	stateVars[s_viscousStrain2 + iComp] + dq[imodel] * deltaStrain;
       PetscLogFlops(6);
     } // if
@@ -1002,7 +1033,7 @@ pylith::materials::GenMaxwellIsotropic3D::_computeStateVars(
     imodel = 2;
     if (0.0 != muRatio[imodel]) {
       _viscousStrain[imodel*tensorSize+iComp] =
-	exp(-_dt/maxwellTime[imodel]) *
+	expFac[imodel] *
 	stateVars[s_viscousStrain3 + iComp] + dq[imodel] * deltaStrain;
       PetscLogFlops(6);
     } // if
@@ -75,6 +75,13 @@ namespace pylith {
 	"viscosity-3",
       };
       
+      /// Number of time step coefficients.
+      const int numCoefs = 2*numMaxwellModels;
+
+      /// Indices of time step coefficients.
+      const int c_viscousStrainParam = 0;
+      const int c_expFac = numMaxwellModels;
+
       /// Number of state variables.
       const int numStateVars = 2 + numMaxwellModels;
       
@@ -193,6 +200,7 @@ pylith::materials::GenMaxwellPlaneStrain::GenMaxwellPlaneStrain(void) :
   _calcStressFn(0),
   _updateStateVarsFn(0)  
 { // constructor
+  _numCoefsQuadPt = _GenMaxwellPlaneStrain::numCoefs;
   useElasticBehavior(false);
   _viscousStrain.resize(_GenMaxwellPlaneStrain::numMaxwellModels * 4);
 } // constructor
@@ -676,18 +684,17 @@ pylith::materials::GenMaxwellPlaneStrain::_calcElasticConstsViscoelastic(
   const PylithScalar bulkModulus = lambda + mu2 / 3.0;
 
   // Compute viscous contribution.
+  PylithScalar coefsWork[_GenMaxwellPlaneStrain::numCoefs];
+  const PylithScalar* coefs = _timeStepCoefs(coefsWork, properties, numProperties);
+  const PylithScalar* dq = &coefs[_GenMaxwellPlaneStrain::c_viscousStrainParam];
+
   PylithScalar visFac = 0.0;
   PylithScalar visFrac = 0.0;
   PylithScalar shearRatio = 0.0;
   for (int imodel = 0; imodel < numMaxwellModels; ++imodel) {
     shearRatio = properties[p_shearRatio + imodel];
-    PylithScalar maxwellTime = pylith::PYLITH_MAXSCALAR;
     visFrac += shearRatio;
-    if (shearRatio != 0.0) {
-      maxwellTime = properties[p_maxwellTime + imodel];
-      visFac +=
-	shearRatio * ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
-    } // if
+    visFac += shearRatio * dq[imodel];
   } // for
   PylithScalar elasFrac = 1.0 - visFrac;
   PylithScalar shearFac = elasFrac + visFac;
@@ -863,6 +870,36 @@ pylith::materials::GenMaxwellPlaneStrain::_stableTimeStepExplicit(const PylithSc
 } // _stableTimeStepExplicit
 
 
+// ----------------------------------------------------------------------
+// Compute viscoelastic coefficients that depend only on the time step.
+void
+pylith::materials::GenMaxwellPlaneStrain::_calcTimeStepCoefs(PylithScalar* const coefs,
+                                                             const int numCoefs,
+                                                             const PylithScalar* properties,
+                                                             const int numProperties)
+{ // _calcTimeStepCoefs
+  assert(coefs);
+  assert(_GenMaxwellPlaneStrain::numCoefs == numCoefs);
+  assert(properties);
+  assert(_numPropsQuadPt == numProperties);
+
+  const int numMaxwellModels = _GenMaxwellPlaneStrain::numMaxwellModels;
+
+  // Coefficients for models with zero shear ratio are zero.
+  for (int imodel=0; imodel < numMaxwellModels; ++imodel) {
+    PylithScalar dq = 0.0;
+    PylithScalar expFac = 0.0;
+    if (0.0 != properties[p_shearRatio + imodel]) {
+      const PylithScalar maxwellTime = properties[p_maxwellTime + imodel];
+      dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+      expFac = exp(-_dt/maxwellTime);
+      PetscLogFlops(2);
+    } // if
+    coefs[_GenMaxwellPlaneStrain::c_viscousStrainParam + imodel] = dq;
+    coefs[_GenMaxwellPlaneStrain::c_expFac + imodel] = expFac;
+  } // for
+} // _calcTimeStepCoefs
+
 // ----------------------------------------------------------------------
 // Compute viscous strain for current time step.
 void
@@ -896,11 +933,6 @@ pylith::materials::GenMaxwellPlaneStrain::_computeStateVars(
     properties[p_shearRatio+1],
     properties[p_shearRatio+2]
   };
-  const PylithScalar maxwellTime[numMaxwellModels] = {
-    properties[p_maxwellTime  ],
-    properties[p_maxwellTime+1],
-    properties[p_maxwellTime+2]
-  };
 
   const PylithScalar strainTpdt[] = {totalStrain[0],
 			       totalStrain[1],
@@ -918,12 +950,11 @@ pylith::materials::GenMaxwellPlaneStrain::_computeStateVars(
 
   PetscLogFlops(4);
 
-  // Compute Prony series terms
-  scalar_array dq(numMaxwellModels);
-  dq = 0.0;
-  for (int i=0; i < numMaxwellModels; ++i)
-    if (muRatio[i] != 0.0)
-      dq[i] = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime[i]);
+  // Prony series terms
+  PylithScalar coefsWork[_GenMaxwellPlaneStrain::numCoefs];
+  const PylithScalar* coefs = _timeStepCoefs(coefsWork, properties, numProperties);
+  const PylithScalar* dq = &coefs[_GenMaxwellPlaneStrain::c_viscousStrainParam];
+  const PylithScalar* expFac = &coefs[_GenMaxwellPlaneStrain::c_expFac];
 
   // Compute new viscous strains
   PylithScalar devStrainTpdt = 0.0;
@@ -938,7 +969,7 @@ pylith::materials::GenMaxwellPlaneStrain::_computeStateVars(
     // Maxwell model 1
     int imodel = 0;
     if (0.0 != muRatio[imodel]) {
-      _viscousStrain[imodel * 4 + iComp] = exp(-_dt / maxwellTime[imodel]) *
+      _viscousStrain[imodel * 4 + iComp] = expFac[imodel] *
 	stateVars[s_viscousStrain1 + iComp] + dq[imodel] * deltaStrain;
       PetscLogFlops(6);
     } // if
@@ -946,7 +977,7 @@ pylith::materials::GenMaxwellPlaneStrain::_computeStateVars(
     // Maxwell model 2
     imodel = 1;
     if (0.0 != muRatio[imodel]) {
-      _viscousStrain[imodel * 4 + iComp] = exp(-_dt / maxwellTime[imodel]) *
+      _viscousStrain[imodel * 4 + iComp] = expFac[imodel] *
 	stateVars[s_viscousStrain2 + iComp] + dq[imodel] * deltaStrain;
       PetscLogFlops(6);
     } // if
@@ -954,7 +985,7 @@ pylith::materials::GenMaxwellPlaneStrain::_computeStateVars(
     // Maxwell model 3
     imodel = 2;
     if (0.0 != muRatio[imodel]) {
-      _viscousStrain[imodel * 4 + iComp] = exp(-_dt / maxwellTime[imodel]) *
+      _viscousStrain[imodel * 4 + iComp] = expFac[imodel] *
 	stateVars[s_viscousStrain3 + iComp] + dq[imodel] * deltaStrain;
       PetscLogFlops(6);
     } // if
@@ -87,6 +87,15 @@ namespace pylith {
 	"bulk-viscosity-3",
       };
       
+      /// Number of time step coefficients.
+      const int numCoefs = 4*numMaxwellModels;
+
+      /// Indices of time step coefficients.
+      const int c_viscousStrainParamShear = 0;
+      const int c_expFacShear = numMaxwellModels;
+      const int c_viscousStrainParamBulk = 2*numMaxwellModels;
+      const int c_expFacBulk = 3*numMaxwellModels;
+
       /// Number of state variables.
       const int numStateVars = 3;
       
@@ -238,6 +247,7 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::GenMaxwellQpQsIsotropic3D(void) :
   _calcStressFn(0),
   _updateStateVarsFn(0)  
 { // constructor
+  _numCoefsQuadPt = _GenMaxwellQpQsIsotropic3D::numCoefs;
   useElasticBehavior(false);
   _viscousDevStrain.resize(_GenMaxwellQpQsIsotropic3D::numMaxwellModels*_tensorSize);
   _viscousMeanStrain.resize(_GenMaxwellQpQsIsotropic3D::numMaxwellModels);
@@ -745,6 +755,9 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_calcElasticConstsViscoelastic(
   const PylithScalar mu = properties[p_muEff];
   const PylithScalar bulkModulus = properties[p_kEff];
 
+  PylithScalar coefsWork[_GenMaxwellQpQsIsotropic3D::numCoefs];
+  const PylithScalar* coefs = _timeStepCoefs(coefsWork, properties, numProperties);
+
   // Compute viscous contribution. (deviatoric + mean)
   PylithScalar elasFracShear = 1.0;  // deviatoric (shear) component
   PylithScalar visFactorDev = 0.0;
@@ -756,12 +769,10 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_calcElasticConstsViscoelastic(
     elasFracShear -= shearRatio;
     elasFracBulk -= bulkRatio;
 
-    const PylithScalar maxwellTimeShear = properties[p_maxwellTimeShear+iModel];
     visFactorDev +=
-      shearRatio*ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTimeShear);
-    const PylithScalar maxwellTimeBulk = properties[p_maxwellTimeBulk+iModel];
+      shearRatio*coefs[_GenMaxwellQpQsIsotropic3D::c_viscousStrainParamShear+iModel];
     visFactorBulk +=
-      bulkRatio*ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTimeBulk);
+      bulkRatio*coefs[_GenMaxwellQpQsIsotropic3D::c_viscousStrainParamBulk+iModel];
   } // for
   const PylithScalar tolerance = 1.0e-6;
   assert(elasFracShear >= -tolerance);
@@ -995,6 +1006,36 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_stableTimeStepExplicit(const Pyli
 } // _stableTimeStepExplicit
 
 
+// ----------------------------------------------------------------------
+// Compute viscoelastic coefficients that depend only on the time step.
+void
+pylith::materials::GenMaxwellQpQsIsotropic3D::_calcTimeStepCoefs(PylithScalar* const coefs,
+                                                                 const int numCoefs,
+                                                                 const PylithScalar* properties,
+                                                                 const int numProperties)
+{ // _calcTimeStepCoefs
+  assert(coefs);
+  assert(_GenMaxwellQpQsIsotropic3D::numCoefs == numCoefs);
+  assert(properties);
+  assert(_numPropsQuadPt == numProperties);
+
+  const int numMaxwellModels = _GenMaxwellQpQsIsotropic3D::numMaxwellModels;
+
+  for (int iModel=0; iModel < numMaxwellModels; ++iModel) {
+    const PylithScalar maxwellTimeShear = properties[p_maxwellTimeShear+iModel];
+    coefs[_GenMaxwellQpQsIsotropic3D::c_viscousStrainParamShear+iModel] =
+      ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTimeShear);
+    coefs[_GenMaxwellQpQsIsotropic3D::c_expFacShear+iModel] = exp(-_dt/maxwellTimeShear);
+
+    const PylithScalar maxwellTimeBulk = properties[p_maxwellTimeBulk+iModel];
+    coefs[_GenMaxwellQpQsIsotropic3D::c_viscousStrainParamBulk+iModel] =
+      ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTimeBulk);
+    coefs[_GenMaxwellQpQsIsotropic3D::c_expFacBulk+iModel] = exp(-_dt/maxwellTimeBulk);
+  } // for
+
+  PetscLogFlops(numMaxwellModels*4);
+} // _calcTimeStepCoefs
+
 // ----------------------------------------------------------------------
 // Compute viscous strain for current time step.
 void
@@ -1039,14 +1080,17 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_computeStateVars(
   
   PetscLogFlops(6);
 
+  PylithScalar coefsWork[_GenMaxwellQpQsIsotropic3D::numCoefs];
+  const PylithScalar* coefs = _timeStepCoefs(coefsWork, properties, numProperties);
+
   // Deviatoric viscous strains.
 
   assert(6 == tensorSize);
   const PylithScalar diag[6] = { 1.0, 1.0, 1.0, 0.0, 0.0, 0.0 };
   for (int iModel=0; iModel < numMaxwellModels; ++iModel) {
 
-    const PylithScalar dq = 
-      ViscoelasticMaxwell::viscousStrainParam(_dt, properties[p_maxwellTimeShear+iModel]);
+    const PylithScalar dq = coefs[_GenMaxwellQpQsIsotropic3D::c_viscousStrainParamShear+iModel];
+    const PylithScalar expFac = coefs[_GenMaxwellQpQsIsotropic3D::c_expFacShear+iModel];
 
     for (int i=0; i < tensorSize; ++i) {
       const PylithScalar devStrainTpdt = totalStrain[i] - diag[i]*meanStrainTpdt;
@@ -1054,7 +1098,7 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_computeStateVars(
       const PylithScalar deltaStrain = devStrainTpdt - devStrainT;
       
       _viscousDevStrain[iModel*tensorSize+i] = 
-	exp(-_dt/properties[p_maxwellTimeShear+iModel]) * 
+	expFac * 
 	stateVars[s_viscousDevStrain+iModel*tensorSize+i] + 
 	properties[p_shearRatio+iModel] * dq * deltaStrain;
     } // for
@@ -1066,13 +1110,13 @@ pylith::materials::GenMaxwellQpQsIsotropic3D::_computeStateVars(
   // Compute Prony series terms
   for (int iModel=0; iModel < numMaxwellModels; ++iModel) {
 
-    const PylithScalar dq = 
-      ViscoelasticMaxwell::viscousStrainParam(_dt, properties[p_maxwellTimeBulk+iModel]);
+    const PylithScalar dq = coefs[_GenMaxwellQpQsIsotropic3D::c_viscousStrainParamBulk+iModel];
+    const PylithScalar expFac = coefs[_GenMaxwellQpQsIsotropic3D::c_expFacBulk+iModel];
 
     const PylithScalar deltaStrain = meanStrainTpdt - meanStrainT;
 
     _viscousMeanStrain[iModel] =  
-      exp(-_dt/properties[p_maxwellTimeBulk+iModel]) * 
+      expFac * 
       stateVars[s_viscousMeanStrain+iModel] + 
       properties[p_bulkRatio+iModel] * dq * deltaStrain;
   } // for
@@ -27,13 +27,16 @@
 #include "pylith/topology/Stratum.hh" // USES StratumIS
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 #include "pylith/utils/array.hh" // USES scalar_array, std::vector
+#include "pylith/utils/NodeSharedArray.hh" // USES NodeSharedArray
 
 #include "spatialdata/spatialdb/SpatialDB.hh" // USES SpatialDB
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include <petscsys.h> // USES PetscMemoryGetCurrentUsage()
+
 #include <strings.h> // USES strcasecmp()
 #include <cassert> // USES assert()
-#include <stdexcept> // USES std::runtime_error
+#include <stdexcept> // USES std::runtime_error, std::logic_error
 #include <sstream> // USES std::ostringstream
 
 // ----------------------------------------------------------------------
@@ -47,6 +50,8 @@ pylith::materials::Material::Material(const int dimension,
   _normalizer(new spatialdata::units::Nondimensional),
   _materialIS(0),
   _numPropsQuadPt(0),
+  _numPropsQuadPts(0),
+  _propsStorage(PROPS_QUADPTS),
   _numVarsQuadPt(0),
   _dimension(dimension),
   _tensorSize(tensorSize),
@@ -56,7 +61,9 @@ pylith::materials::Material::Material(const int dimension,
   _dbInitialState(0),
   _id(0),
   _label(""),
-  _metadata(metadata)
+  _metadata(metadata),
+  _nodeSharedQuery(false),
+  _nodeSharedMemory(0.0)
 { // constructor
   const int numProperties = metadata.numProperties();
   for (int i=0; i < numProperties; ++i) 
@@ -133,18 +140,14 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
   const PetscInt* cells = _materialIS->points();
 
   const spatialdata::geocoords::CoordSys* cs = mesh.coordsys();assert(cs);
+  _nodeSharedMemory = 0.0;
 
-  // Create field to hold physical properties.
-  delete _properties; _properties = new topology::Field(mesh);assert(_properties);
-  _properties->label("properties");
+  // Physical properties are queried into a temporary buffer so we can
+  // detect properties that are uniform over the material or constant
+  // over each cell before creating the properties field.
   const int propsFiberDim = numQuadPts * _numPropsQuadPt;
   int_array cellsTmp(cells, numCells);
-
-  _properties->newSection(cellsTmp, propsFiberDim);
-  _properties->allocate();
-  _properties->zeroAll();
-  topology::VecVisitorMesh propertiesVisitor(*_properties);
-  PetscScalar* propertiesArray = propertiesVisitor.localArray();
+  scalar_array propertiesAll(numCells * propsFiberDim);
 
   scalar_array coordsCell(numBasis*spaceDim); // :KULDGE: Update numBasis to numCorners after implementing higher order
   topology::CoordsVisitor coordsVisitor(dmMesh);
@@ -152,18 +155,6 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
   // Optimize coordinate retrieval in closure  
   topology::CoordsVisitor::optimizeClosure(dmMesh);
 
-  // Create arrays for querying.
-  const int numDBProperties = _metadata.numDBProperties();
-  scalar_array quadPtsGlobal(numQuadPts*spaceDim);
-  scalar_array propertiesQuery(numDBProperties);
-  scalar_array propertiesCell(propsFiberDim);
-
-  // Setup database for quering for physical properties
-  assert(_dbProperties);
-  _dbProperties->open();
-  _dbProperties->queryVals(_metadata.dbProperties(),
-			   _metadata.numDBProperties());
-
   // Create field to hold state variables. We create the field even
   // if there is no initial state, because this we will use this field
   // to hold the state variables.
@@ -174,99 +165,263 @@ pylith::materials::Material::initialize(const topology::Mesh& mesh,
   PetscScalar* stateVarsArray = NULL;
   if (stateVarsFiberDim > 0) {
     assert(_stateVars);
-    assert(_properties);
-    _stateVars->newSection(*_properties, stateVarsFiberDim);
+    _stateVars->newSection(cellsTmp, stateVarsFiberDim);
     _stateVars->allocate();
     _stateVars->zeroAll();
     stateVarsVisitor = new topology::VecVisitorMesh(*_stateVars);
     stateVarsArray = stateVarsVisitor->localArray();
   } // if
 
+  assert(_normalizer);
+  const PylithScalar lengthScale = _normalizer->lengthScale();
 
-  // Create arrays for querying
+  const int numDBProperties = _metadata.numDBProperties();
   const int numDBStateVars = _metadata.numDBStateVars();
-  scalar_array stateVarsQuery;
-  scalar_array stateVarsCell;
   if (_dbInitialState) {
     assert(numDBStateVars > 0);
     assert(_numVarsQuadPt > 0);
-    stateVarsQuery.resize(numDBStateVars);
-    stateVarsCell.resize(stateVarsFiberDim);
-    
-    // Setup database for querying for initial state variables
-    _dbInitialState->open();
-    _dbInitialState->queryVals(_metadata.dbStateVars(), _metadata.numDBStateVars());
   } // if
 
-  assert(_normalizer);
-  const PylithScalar lengthScale = _normalizer->lengthScale();
+  if (!_nodeSharedQuery) {
+    // Create arrays for querying.
+    scalar_array quadPtsGlobal(numQuadPts*spaceDim);
+    scalar_array propertiesQuery(numDBProperties);
+    scalar_array propertiesCell(propsFiberDim);
+    scalar_array stateVarsQuery;
+    scalar_array stateVarsCell;
+
+    // Setup databases for querying
+    _dbProperties->open();
+    _dbProperties->queryVals(_metadata.dbProperties(), numDBProperties);
+    if (_dbInitialState) {
+      stateVarsQuery.resize(numDBStateVars);
+      stateVarsCell.resize(stateVarsFiberDim);
+      _dbInitialState->open();
+      _dbInitialState->queryVals(_metadata.dbStateVars(), numDBStateVars);
+    } // if
 
-  for(PetscInt c = 0; c < numCells; ++c) {
-    const PetscInt cell = cells[c];
-
-    // Compute geometry information for current cell
-    coordsVisitor.getClosure(&coordsCell, cell);
-    quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
-
-    const scalar_array& quadPtsNonDim = quadrature->quadPts();
-    quadPtsGlobal = quadPtsNonDim;
-    _normalizer->dimensionalize(&quadPtsGlobal[0], quadPtsGlobal.size(), lengthScale);
-
-    // Loop over quadrature points in cell and query database
-    for (int iQuadPt=0, index=0; iQuadPt < numQuadPts; ++iQuadPt, index+=spaceDim) {
-      int err = _dbProperties->query(&propertiesQuery[0], numDBProperties, &quadPtsGlobal[index], spaceDim, cs);
-      if (err) {
-	std::ostringstream msg;
-	msg << "Could not find parameters for physical properties at " << "(";
-	for (int i=0; i < spaceDim; ++i)
-	  msg << "  " << quadPtsGlobal[index+i];
-	msg << ") in material '" << _label << "' using spatial database '" << _dbProperties->label() << "'.";
-	throw std::runtime_error(msg.str());
-      } // if
-      _dbToProperties(&propertiesCell[iQuadPt*_numPropsQuadPt], propertiesQuery);
-      _nondimProperties(&propertiesCell[iQuadPt*_numPropsQuadPt], _numPropsQuadPt);
+    for(PetscInt c = 0; c < numCells; ++c) {
+      const PetscInt cell = cells[c];
 
-      if (_dbInitialState) {
-	err = _dbInitialState->query(&stateVarsQuery[0], numDBStateVars, &quadPtsGlobal[index], spaceDim, cs);
+      // Compute geometry information for current cell
+      coordsVisitor.getClosure(&coordsCell, cell);
+      quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
+
+      const scalar_array& quadPtsNonDim = quadrature->quadPts();
+      quadPtsGlobal = quadPtsNonDim;
+      _normalizer->dimensionalize(&quadPtsGlobal[0], quadPtsGlobal.size(), lengthScale);
+
+      // Loop over quadrature points in cell and query database
+      for (int iQuadPt=0, index=0; iQuadPt < numQuadPts; ++iQuadPt, index+=spaceDim) {
+	int err = _dbProperties->query(&propertiesQuery[0], numDBProperties, &quadPtsGlobal[index], spaceDim, cs);
 	if (err) {
 	  std::ostringstream msg;
-	  msg << "Could not find initial state variables at \n" << "(";
+	  msg << "Could not find parameters for physical properties at " << "(";
 	  for (int i=0; i < spaceDim; ++i)
 	    msg << "  " << quadPtsGlobal[index+i];
-	  msg << ") in material '" << _label << "' using spatial database '" << _dbInitialState->label() << "'.";
+	  msg << ") in material '" << _label << "' using spatial database '" << _dbProperties->label() << "'.";
 	  throw std::runtime_error(msg.str());
 	} // if
-	_dbToStateVars(&stateVarsCell[iQuadPt*_numVarsQuadPt], stateVarsQuery);
-	_nondimStateVars(&stateVarsCell[iQuadPt*_numVarsQuadPt], _numVarsQuadPt);
+	_dbToProperties(&propertiesCell[iQuadPt*_numPropsQuadPt], propertiesQuery);
+	_nondimProperties(&propertiesCell[iQuadPt*_numPropsQuadPt], _numPropsQuadPt);
+
+	if (_dbInitialState) {
+	  err = _dbInitialState->query(&stateVarsQuery[0], numDBStateVars, &quadPtsGlobal[index], spaceDim, cs);
+	  if (err) {
+	    std::ostringstream msg;
+	    msg << "Could not find initial state variables at \n" << "(";
+	    for (int i=0; i < spaceDim; ++i)
+	      msg << "  " << quadPtsGlobal[index+i];
+	    msg << ") in material '" << _label << "' using spatial database '" << _dbInitialState->label() << "'.";
+	    throw std::runtime_error(msg.str());
+	  } // if
+	  _dbToStateVars(&stateVarsCell[iQuadPt*_numVarsQuadPt], stateVarsQuery);
+	  _nondimStateVars(&stateVarsCell[iQuadPt*_numVarsQuadPt], _numVarsQuadPt);
+	} // if
+      } // for
+
+      // Insert cell contribution into buffer and state variables field
+      for(PetscInt d = 0; d < propsFiberDim; ++d) {
+	propertiesAll[c*propsFiberDim+d] = propertiesCell[d];
+      } // for
+      if (_dbInitialState) {
+	assert(stateVarsVisitor);
+	assert(stateVarsArray);
+	const PetscInt off = stateVarsVisitor->sectionOffset(cell);
+	assert(stateVarsFiberDim == stateVarsVisitor->sectionDof(cell));
+	for(PetscInt d = 0; d < stateVarsFiberDim; ++d) {
+	  stateVarsArray[off+d] = stateVarsCell[d];
+	} // for
       } // if
+    } // for
+
+    // Close databases
+    _dbProperties->close();
+    if (_dbInitialState) {
+      _dbInitialState->close();
+    } // if
+  } else {
+    // The leader on each node queries the databases for the points of
+    // all of the processes on the node, so the quadrature points and
+    // query results for the whole material are buffered.
+    scalar_array quadPtsGlobal(numCells*numQuadPts*spaceDim);
+    for(PetscInt c = 0; c < numCells; ++c) {
+      const PetscInt cell = cells[c];
+
+      // Compute geometry information for current cell
+      coordsVisitor.getClosure(&coordsCell, cell);
+      quadrature->computeGeometry(&coordsCell[0], coordsCell.size(), cell);
 
+      const scalar_array& quadPtsNonDim = quadrature->quadPts();
+      for (int i=0; i < numQuadPts*spaceDim; ++i) {
+	quadPtsGlobal[c*numQuadPts*spaceDim+i] = quadPtsNonDim[i];
+      } // for
     } // for
-    // Insert cell contribution into fields
-    const PetscInt off = propertiesVisitor.sectionOffset(cell);
-    assert(propsFiberDim == propertiesVisitor.sectionDof(cell));
-    for(PetscInt d = 0; d < propsFiberDim; ++d) {
-      propertiesArray[off+d] = propertiesCell[d];
+    const PylithScalar* quadPtsPtr = (quadPtsGlobal.size() > 0) ? &quadPtsGlobal[0] : 0;
+    if (quadPtsGlobal.size() > 0) {
+      _normalizer->dimensionalize(&quadPtsGlobal[0], quadPtsGlobal.size(), lengthScale);
+    } // if
+
+    // Query database for physical properties.
+    scalar_array propertiesDB;
+    _queryDBNodeShared(&propertiesDB, _dbProperties, _metadata.dbProperties(), numDBProperties, quadPtsPtr, numCells*numQuadPts, spaceDim, cs, mesh.comm(), "parameters for physical properties");
+
+    scalar_array propertiesQuery(numDBProperties);
+    for (PetscInt c=0, iPt=0; c < numCells; ++c) {
+      for (int iQuadPt=0; iQuadPt < numQuadPts; ++iQuadPt, ++iPt) {
+	for (int i=0; i < numDBProperties; ++i) {
+	  propertiesQuery[i] = propertiesDB[iPt*numDBProperties+i];
+	} // for
+	PylithScalar* propertiesPt = &propertiesAll[c*propsFiberDim+iQuadPt*_numPropsQuadPt];
+	_dbToProperties(propertiesPt, propertiesQuery);
+	_nondimProperties(propertiesPt, _numPropsQuadPt);
+      } // for
     } // for
+    propertiesDB.resize(0);
+
+    // Query database for initial state variables.
     if (_dbInitialState) {
+      scalar_array stateVarsDB;
+      _queryDBNodeShared(&stateVarsDB, _dbInitialState, _metadata.dbStateVars(), numDBStateVars, quadPtsPtr, numCells*numQuadPts, spaceDim, cs, mesh.comm(), "initial state variables");
+
       assert(stateVarsVisitor);
       assert(stateVarsArray);
-      const PetscInt off = stateVarsVisitor->sectionOffset(cell);
-      assert(stateVarsFiberDim == stateVarsVisitor->sectionDof(cell));
-      for(PetscInt d = 0; d < stateVarsFiberDim; ++d) {
-        stateVarsArray[off+d] = stateVarsCell[d];
+      scalar_array stateVarsQuery(numDBStateVars);
+      for (PetscInt c=0, iPt=0; c < numCells; ++c) {
+	const PetscInt off = stateVarsVisitor->sectionOffset(cells[c]);
+	assert(stateVarsFiberDim == stateVarsVisitor->sectionDof(cells[c]));
+	for (int iQuadPt=0; iQuadPt < numQuadPts; ++iQuadPt, ++iPt) {
+	  for (int i=0; i < numDBStateVars; ++i) {
+	    stateVarsQuery[i] = stateVarsDB[iPt*numDBStateVars+i];
+	  } // for
+	  PylithScalar* stateVarsPt = &stateVarsArray[off+iQuadPt*_numVarsQuadPt];
+	  _dbToStateVars(stateVarsPt, stateVarsQuery);
+	  _nondimStateVars(stateVarsPt, _numVarsQuadPt);
+	} // for
       } // for
     } // if
-  } // for
+  } // if/else
   delete stateVarsVisitor; stateVarsVisitor = 0;
 
-  // Close databases
-  _dbProperties->close();
-  if (_dbInitialState)
-    _dbInitialState->close();
+  _storeProperties(mesh, propertiesAll, cellsTmp, numQuadPts);
 
   PYLITH_METHOD_END;
 } // initialize
 
+// ----------------------------------------------------------------------
+// Query spatial database for values at points on one process per
+// compute node.
+void
+pylith::materials::Material::_queryDBNodeShared(scalar_array* values,
+						spatialdata::spatialdb::SpatialDB* db,
+						const char* const* names,
+						const int numValues,
+						const PylithScalar* points,
+						const size_t numPoints,
+						const int spaceDim,
+						const spatialdata::geocoords::CoordSys* cs,
+						const MPI_Comm comm,
+						const char* description)
+{ // _queryDBNodeShared
+  PYLITH_METHOD_BEGIN;
+
+  assert(values);
+  assert(db);
+  assert(cs);
+  assert(!numPoints || points);
+
+  values->resize(numPoints*numValues);
+
+  // Only the leader on each node opens the database and queries it
+  // for the points of all of the processes on the node. The last entry
+  // for each point is the error flag from the query.
+  const int stride = numValues + 1;
+  utils::NodeSharedArray pointsShared;
+  pointsShared.allocate(comm, numPoints*spaceDim);
+  for (size_t i=0; i < numPoints*spaceDim; ++i) {
+    pointsShared.localArray()[i] = points[i];
+  } // for
+  pointsShared.sync();
+
+  utils::NodeSharedArray valuesShared;
+  valuesShared.allocate(comm, numPoints*stride);
+  PetscLogDouble memoryDB = 0.0;
+  if (valuesShared.isLeader()) {
+    PetscErrorCode err = 0;
+    PetscLogDouble memoryBefore = 0.0, memoryAfter = 0.0;
+    err = PetscMemoryGetCurrentUsage(&memoryBefore);PYLITH_CHECK_ERROR(err);
+    db->open();
+    err = PetscMemoryGetCurrentUsage(&memoryAfter);PYLITH_CHECK_ERROR(err);
+    memoryDB = (memoryAfter > memoryBefore) ? memoryAfter - memoryBefore : 0.0;
+
+    db->queryVals(names, numValues);
+    const size_t numNodePoints = pointsShared.nodeSize() / spaceDim;
+    const PylithScalar* nodePoints = pointsShared.nodeArray();
+    PylithScalar* nodeValues = valuesShared.nodeArray();
+    for (size_t iPt=0; iPt < numNodePoints; ++iPt) {
+      const int errQuery = db->query(&nodeValues[iPt*stride], numValues, &nodePoints[iPt*spaceDim], spaceDim, cs);
+      nodeValues[iPt*stride+numValues] = errQuery ? 1.0 : 0.0;
+    } // for
+    db->close();
+  } // if
+  valuesShared.sync();
+
+  int failedPoint = -1;
+  const PylithScalar* localValues = valuesShared.localArray();
+  for (size_t iPt=0; iPt < numPoints; ++iPt) {
+    if (localValues[iPt*stride+numValues] != 0.0 && failedPoint < 0) {
+      failedPoint = iPt;
+    } // if
+    for (int i=0; i < numValues; ++i) {
+      (*values)[iPt*numValues+i] = localValues[iPt*stride+i];
+    } // for
+  } // for
+
+  // Every process on the node except the leader avoids loading the
+  // database. The shared windows for the points and values of the
+  // node are the cost of sharing, so the net savings can be negative
+  // for small databases.
+  PetscErrorCode err = 0;
+  err = MPI_Bcast(&memoryDB, 1, MPI_DOUBLE, 0, valuesShared.nodeComm());PYLITH_CHECK_ERROR(err);
+  const double memoryWindows = double(pointsShared.nodeSize() + valuesShared.nodeSize()) * sizeof(PylithScalar);
+  _nodeSharedMemory += memoryDB * (valuesShared.nodeNumProcs() - 1) - memoryWindows;
+
+  // Release windows (collective) before reporting errors.
+  valuesShared.deallocate();
+  pointsShared.deallocate();
+
+  if (failedPoint >= 0) {
+    std::ostringstream msg;
+    msg << "Could not find " << description << " at " << "(";
+    for (int i=0; i < spaceDim; ++i)
+      msg << "  " << points[failedPoint*spaceDim+i];
+    msg << ") in material '" << _label << "' using spatial database '" << db->label() << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  PYLITH_METHOD_END;
+} // _queryDBNodeShared
+
 // ----------------------------------------------------------------------
 // Get the properties field.
 const pylith::topology::Field*
@@ -350,17 +505,12 @@ pylith::materials::Material::getField(topology::Field *field,
     topology::VecVisitorMesh propertiesVisitor(*_properties);
     PetscScalar* propertiesArray = propertiesVisitor.localArray();
 
-    // Get properties section
-    PetscInt totalPropsFiberDimLocal = 0;
-    PetscInt totalPropsFiberDim = 0;
-    if (numCells > 0) {
-      totalPropsFiberDimLocal = propertiesVisitor.sectionDof(cells[0]);
-    } // if
-    MPI_Allreduce((void *) &totalPropsFiberDimLocal, (void *) &totalPropsFiberDim, 1, MPIU_INT, MPI_MAX, field->mesh().comm());
-    assert(totalPropsFiberDim > 0);
+    // Properties may be stored once per cell or material, so the
+    // number of quadrature points comes from initialization rather
+    // than the properties section.
     const int numPropsQuadPt = _numPropsQuadPt;
-    const int numQuadPts = totalPropsFiberDim / numPropsQuadPt;
-    assert(totalPropsFiberDim == numQuadPts * numPropsQuadPt);
+    const int numQuadPts = _numPropsQuadPts;
+    assert(numQuadPts > 0);
     const int totalFiberDim = numQuadPts * fiberDim;
 
     // Allocate buffer for property field if necessary.
@@ -396,9 +546,11 @@ pylith::materials::Material::getField(topology::Field *field,
 
       const PetscInt poff = propertiesVisitor.sectionOffset(cell);
       const PetscInt foff = fieldVisitor.sectionOffset(cell);
+      int stride = 0;
+      const PylithScalar* propsCell = _propsCell(&stride, propertiesArray, poff);
       for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
         for (int i=0; i < numPropsQuadPt; ++i)
-          propertiesCell[i] = propertiesArray[iQuad*numPropsQuadPt + poff+i];
+          propertiesCell[i] = propsCell[iQuad*stride + i];
         _dimProperties(&propertiesCell[0], numPropsQuadPt);
         for (int i=0; i < fiberDim; ++i)
           fieldArray[iQuad*fiberDim + foff+i] = propertiesCell[propOffset+i];
@@ -534,6 +686,96 @@ pylith::materials::Material::_findField(int* propertyIndex,
 
   PYLITH_METHOD_END;
 } // _findField
+
+// ----------------------------------------------------------------------
+// Select storage for physical properties and create properties field.
+void
+pylith::materials::Material::_storeProperties(const topology::Mesh& mesh,
+					      const scalar_array& propertiesAll,
+					      const int_array& cells,
+					      const int numQuadPts)
+{ // _storeProperties
+  PYLITH_METHOD_BEGIN;
+
+  const int numPropsQuadPt = _numPropsQuadPt;
+  const int propsFiberDim = numQuadPts * numPropsQuadPt;
+  const int numCells = cells.size();
+  assert(int(propertiesAll.size()) == numCells * propsFiberDim);
+
+  // Comparisons are exact, so compressed storage reproduces the
+  // properties at every quadrature point bit for bit.
+  bool isCellConstant = true;
+  bool isUniform = true;
+  for (int c=0; c < numCells && isCellConstant; ++c) {
+    const PylithScalar* propsCell = &propertiesAll[c*propsFiberDim];
+    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+      for (int i=0; i < numPropsQuadPt; ++i) {
+	const PylithScalar value = propsCell[iQuad*numPropsQuadPt+i];
+	if (value != propsCell[i]) {
+	  isCellConstant = false;
+	  isUniform = false;
+	} // if
+	if (value != propertiesAll[i]) {
+	  isUniform = false;
+	} // if
+      } // for
+    } // for
+  } // for
+
+  _numPropsQuadPts = numQuadPts;
+  if (0 == numCells) {
+    _propsStorage = PROPS_QUADPTS;
+  } else if (isUniform) {
+    _propsStorage = PROPS_UNIFORM;
+  } else if (isCellConstant) {
+    _propsStorage = PROPS_CELL;
+  } else {
+    _propsStorage = PROPS_QUADPTS;
+  } // if/else
+
+  int fiberDim = 0;
+  switch (_propsStorage) {
+  case PROPS_QUADPTS :
+    fiberDim = propsFiberDim;
+    _propsUniform.resize(0);
+    break;
+  case PROPS_CELL :
+    fiberDim = numPropsQuadPt;
+    _propsUniform.resize(0);
+    break;
+  case PROPS_UNIFORM :
+    fiberDim = 0;
+    _propsUniform.resize(numPropsQuadPt);
+    for (int i=0; i < numPropsQuadPt; ++i) {
+      _propsUniform[i] = propertiesAll[i];
+    } // for
+    break;
+  default :
+    assert(0);
+    throw std::logic_error("Unknown storage for physical properties.");
+  } // switch
+
+  // Create field to hold physical properties.
+  delete _properties; _properties = new topology::Field(mesh);assert(_properties);
+  _properties->label("properties");
+  _properties->newSection(cells, fiberDim);
+  _properties->allocate();
+  _properties->zeroAll();
+
+  if (fiberDim > 0) {
+    topology::VecVisitorMesh propertiesVisitor(*_properties);
+    PetscScalar* propertiesArray = propertiesVisitor.localArray();
+    for (int c=0; c < numCells; ++c) {
+      const PetscInt off = propertiesVisitor.sectionOffset(cells[c]);
+      assert(fiberDim == propertiesVisitor.sectionDof(cells[c]));
+      for (int d=0; d < fiberDim; ++d) {
+	propertiesArray[off+d] = propertiesAll[c*propsFiberDim+d];
+      } // for
+    } // for
+  } // if
+
+  PYLITH_METHOD_END;
+} // _storeProperties
   
 
 // End of file 
@@ -30,10 +30,13 @@
 #include "pylith/topology/topologyfwd.hh" // forward declarations
 #include "pylith/feassemble/feassemblefwd.hh" // forward declarations
 #include "spatialdata/spatialdb/spatialdbfwd.hh" // forward declarations
+#include "spatialdata/geocoords/geocoordsfwd.hh" // forward declarations
 #include "spatialdata/units/unitsfwd.hh" // forward declarations
 
 #include "Metadata.hh" // HASA Metadata
 
+#include "pylith/utils/array.hh" // HASA scalar_array
+
 #include <string> // HASA std::string
 
 // Material -------------------------------------------------------------
@@ -48,6 +51,16 @@ class pylith::materials::Material
 { // class Material
   friend class TestMaterial; // unit testing
 
+  // PUBLIC ENUMS ///////////////////////////////////////////////////////
+public :
+
+  /// Storage of physical properties.
+  enum PropsStorageEnum {
+    PROPS_QUADPTS=0, ///< Properties at every quadrature point.
+    PROPS_CELL=1, ///< One copy of properties per cell.
+    PROPS_UNIFORM=2, ///< One copy of properties for the material.
+  }; // PropsStorageEnum
+
   // PUBLIC METHODS /////////////////////////////////////////////////////
 public :
 
@@ -124,6 +137,37 @@ public :
    */
   void dbInitialState(spatialdata::spatialdb::SpatialDB* value);
 
+  /** Set flag for querying spatial databases once per compute node.
+   *
+   * If true, only one process on each compute node opens the spatial
+   * databases in initialize() and queries them for the points of all
+   * of the processes on the node via MPI-3 shared memory, so the
+   * contents of the databases are loaded once per node rather than
+   * once per process.
+   *
+   * @param value True to query databases once per node, false otherwise.
+   */
+  void nodeSharedQuery(const bool value);
+
+  /** Get flag for querying spatial databases once per compute node.
+   *
+   * @returns True if databases are queried once per node, false otherwise.
+   */
+  bool nodeSharedQuery(void) const;
+
+  /** Get estimate of net memory (in bytes) on the compute node saved
+   * by querying the spatial databases once per node in initialize().
+   *
+   * This is the memory used by the leader to load the databases
+   * times the number of other processes on the node, minus the
+   * shared memory windows holding the query points and values for
+   * the node. The database memory is the change in resident set size
+   * of the leader while opening the databases, so it is approximate.
+   *
+   * @returns Net memory saved on node.
+   */
+  double nodeSharedMemory(void) const;
+
   /** Set scales used to nondimensionalize physical properties.
    *
    * @param dim Nondimensionalizer
@@ -210,9 +254,30 @@ public :
    */
   const topology::Field* stateVarsField() const;
 
+  /** Get storage of physical properties. Properties that are uniform
+   * over the material or constant over each cell are stored once per
+   * material or once per cell, respectively.
+   *
+   * @returns Storage of physical properties.
+   */
+  PropsStorageEnum propsStorage(void) const;
+
   // PROTECTED METHODS //////////////////////////////////////////////////
 protected :
 
+  /** Get physical properties stored for a cell.
+   *
+   * @param stride Stride between quadrature points in returned array
+   *   (0 if the properties are the same at all quadrature points).
+   * @param propertiesArray Local array for properties field.
+   * @param offset Offset of cell in properties field.
+   *
+   * @returns Properties at first quadrature point in cell.
+   */
+  const PylithScalar* _propsCell(int* stride,
+				 const PylithScalar* propertiesArray,
+				 const int offset) const;
+
   /// These methods should be implemented by every constitutive model.
 
   /** Compute properties from values in spatial database.
@@ -285,6 +350,9 @@ protected :
   topology::StratumIS* _materialIS; ///< Index set for material cells.
 
   int _numPropsQuadPt; ///< Number of properties per quad point.
+  int _numPropsQuadPts; ///< Number of quad points per cell for properties.
+  PropsStorageEnum _propsStorage; ///< Storage of physical properties.
+  scalar_array _propsUniform; ///< Properties if uniform over material.
   int _numVarsQuadPt; ///< Number of state variables per quad point.
   const int _dimension; ///< Spatial dimension associated with material.
   const int _tensorSize; ///< Tensor size for material.
@@ -306,6 +374,51 @@ private :
 		  int* stateVarIndex,
 		  const char* name) const;
 
+  /** Select storage for physical properties and create properties
+   * field. Properties are stored once for the material if they are
+   * the same at every quadrature point in every cell, once per cell if
+   * they are the same at every quadrature point within each cell, and
+   * at every quadrature point otherwise.
+   *
+   * @param mesh Finite-element mesh.
+   * @param propertiesAll Properties at quadrature points of all cells.
+   * @param cells Cells associated with material.
+   * @param numQuadPts Number of quadrature points per cell.
+   */
+  void _storeProperties(const topology::Mesh& mesh,
+			const scalar_array& propertiesAll,
+			const int_array& cells,
+			const int numQuadPts);
+
+  /** Query spatial database for values at points on one process per
+   * compute node. Only the leader on each node opens the database and
+   * queries it for the points of all of the processes on the node.
+   * Adds the net memory saved on the node (database memory avoided by
+   * the other processes minus the shared windows) to
+   * _nodeSharedMemory.
+   *
+   * @param values Array of values at points [numPoints*numValues].
+   * @param db Spatial database.
+   * @param names Names of values to query.
+   * @param numValues Number of values to query.
+   * @param points Coordinates of points (dimensioned) [numPoints*spaceDim].
+   * @param numPoints Number of points.
+   * @param spaceDim Spatial dimension.
+   * @param cs Coordinate system of points.
+   * @param comm Communicator for mesh.
+   * @param description Description of values for error messages.
+   */
+  void _queryDBNodeShared(scalar_array* values,
+			  spatialdata::spatialdb::SpatialDB* db,
+			  const char* const* names,
+			  const int numValues,
+			  const PylithScalar* points,
+			  const size_t numPoints,
+			  const int spaceDim,
+			  const spatialdata::geocoords::CoordSys* cs,
+			  const MPI_Comm comm,
+			  const char* description);
+
   // PRIVATE MEMBERS ////////////////////////////////////////////////////
 private :
 
@@ -320,6 +433,9 @@ private :
 
   const Metadata _metadata; ///< Property and state variable metadata.
 
+  bool _nodeSharedQuery; ///< True if databases are queried once per node.
+  double _nodeSharedMemory; ///< Memory on node saved by querying databases once per node.
+
   // NOT IMPLEMENTED ////////////////////////////////////////////////////
 private :
 
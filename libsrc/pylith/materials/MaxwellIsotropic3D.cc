@@ -63,6 +63,13 @@ namespace pylith {
       const int numDBProperties = 4;
       const char* dbProperties[] = {"density", "vs", "vp" , "viscosity"};
 
+      /// Number of time step coefficients.
+      const int numCoefs = 2;
+
+      /// Indices of time step coefficients.
+      const int c_viscousStrainParam = 0;
+      const int c_expFac = 1;
+
       /// Number of state variables.
       const int numStateVars = 2;
       
@@ -146,6 +153,7 @@ pylith::materials::MaxwellIsotropic3D::MaxwellIsotropic3D(void) :
   _calcStressFn(0),
   _updateStateVarsFn(0)
 { // constructor
+  _numCoefsQuadPt = _MaxwellIsotropic3D::numCoefs;
   useElasticBehavior(false);
   _viscousStrain.resize(_tensorSize);
 } // constructor
@@ -567,12 +575,13 @@ pylith::materials::MaxwellIsotropic3D::_calcElasticConstsViscoelastic(
 
   const PylithScalar mu = properties[p_mu];
   const PylithScalar lambda = properties[p_lambda];
-  const PylithScalar maxwellTime = properties[p_maxwellTime];
 
   const PylithScalar mu2 = 2.0 * mu;
   const PylithScalar bulkModulus = lambda + mu2 / 3.0;
 
-  PylithScalar dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+  PylithScalar coefsWork[_MaxwellIsotropic3D::numCoefs];
+  const PylithScalar* coefs = _timeStepCoefs(coefsWork, properties, numProperties);
+  const PylithScalar dq = coefs[_MaxwellIsotropic3D::c_viscousStrainParam];
 
   const PylithScalar visFac = mu * dq / 3.0;
 
@@ -753,6 +762,27 @@ pylith::materials::MaxwellIsotropic3D::_stableTimeStepExplicit(const PylithScala
 } // _stableTimeStepExplicit
 
 
+// ----------------------------------------------------------------------
+// Compute viscoelastic coefficients that depend only on the time step.
+void
+pylith::materials::MaxwellIsotropic3D::_calcTimeStepCoefs(PylithScalar* const coefs,
+                                                          const int numCoefs,
+                                                          const PylithScalar* properties,
+                                                          const int numProperties)
+{ // _calcTimeStepCoefs
+  assert(coefs);
+  assert(_MaxwellIsotropic3D::numCoefs == numCoefs);
+  assert(properties);
+  assert(_numPropsQuadPt == numProperties);
+
+  const PylithScalar maxwellTime = properties[p_maxwellTime];
+  coefs[_MaxwellIsotropic3D::c_viscousStrainParam] = 
+    ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+  coefs[_MaxwellIsotropic3D::c_expFac] = exp(-_dt/maxwellTime);
+
+  PetscLogFlops(2);
+} // _calcTimeStepCoefs
+
 // ----------------------------------------------------------------------
 // Compute viscous strain for current time step.
 void
@@ -780,7 +810,6 @@ pylith::materials::MaxwellIsotropic3D::_computeStateVars(
   assert(_MaxwellIsotropic3D::tensorSize == initialStrainSize);
 
   const int tensorSize = _tensorSize;
-  const PylithScalar maxwellTime = properties[p_maxwellTime];
 
   // :TODO: Need to account for initial values for state variables
   // and the initial strain??
@@ -799,8 +828,10 @@ pylith::materials::MaxwellIsotropic3D::_computeStateVars(
       stateVars[s_totalStrain+2] ) / 3.0;
   
   // Time integration.
-  PylithScalar dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
-  const PylithScalar expFac = exp(-_dt/maxwellTime);
+  PylithScalar coefsWork[_MaxwellIsotropic3D::numCoefs];
+  const PylithScalar* coefs = _timeStepCoefs(coefsWork, properties, numProperties);
+  const PylithScalar dq = coefs[_MaxwellIsotropic3D::c_viscousStrainParam];
+  const PylithScalar expFac = coefs[_MaxwellIsotropic3D::c_expFac];
 
   PylithScalar devStrainTpdt = 0.0;
   PylithScalar devStrainT = 0.0;
@@ -233,6 +233,19 @@ protected :
 				       const PylithScalar* stateVars,
 				       const int numStateVars,
 				       const double minCellWidth) const;
+
+  /** Compute viscoelastic coefficients that depend only on the time
+   * step and the properties.
+   *
+   * @param coefs Array for coefficients.
+   * @param numCoefs Number of coefficients.
+   * @param properties Properties at location.
+   * @param numProperties Number of properties.
+   */
+  void _calcTimeStepCoefs(PylithScalar* const coefs,
+			  const int numCoefs,
+			  const PylithScalar* properties,
+			  const int numProperties);
   
   // PRIVATE TYPEDEFS ///////////////////////////////////////////////////
 private :
@@ -64,6 +64,13 @@ namespace pylith {
       const int numDBProperties = 4;
       const char* dbProperties[] = {"density", "vs", "vp" , "viscosity"};
 
+      /// Number of time step coefficients.
+      const int numCoefs = 2;
+
+      /// Indices of time step coefficients.
+      const int c_viscousStrainParam = 0;
+      const int c_expFac = 1;
+
       /// Number of state variables.
       const int numStateVars = 3;
 
@@ -149,6 +156,7 @@ pylith::materials::MaxwellPlaneStrain::MaxwellPlaneStrain(void) :
   _calcStressFn(0),
   _updateStateVarsFn(0)
 { // constructor
+  _numCoefsQuadPt = _MaxwellPlaneStrain::numCoefs;
   useElasticBehavior(false);
   _viscousStrain.resize(4);
 } // constructor
@@ -563,12 +571,13 @@ pylith::materials::MaxwellPlaneStrain::_calcElasticConstsViscoelastic(
  
   const PylithScalar mu = properties[p_mu];
   const PylithScalar lambda = properties[p_lambda];
-  const PylithScalar maxwellTime = properties[p_maxwellTime];
 
   const PylithScalar mu2 = 2.0 * mu;
   const PylithScalar bulkModulus = lambda + mu2 / 3.0;
 
-  PylithScalar dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+  PylithScalar coefsWork[_MaxwellPlaneStrain::numCoefs];
+  const PylithScalar* coefs = _timeStepCoefs(coefsWork, properties, numProperties);
+  const PylithScalar dq = coefs[_MaxwellPlaneStrain::c_viscousStrainParam];
 
   const PylithScalar visFac = mu * dq / 3.0;
   elasticConsts[ 0] = bulkModulus + 4.0 * visFac; // C1111
@@ -722,6 +731,27 @@ pylith::materials::MaxwellPlaneStrain::_stableTimeStepExplicit(const PylithScala
 } // _stableTimeStepExplicit
 
 
+// ----------------------------------------------------------------------
+// Compute viscoelastic coefficients that depend only on the time step.
+void
+pylith::materials::MaxwellPlaneStrain::_calcTimeStepCoefs(PylithScalar* const coefs,
+                                                          const int numCoefs,
+                                                          const PylithScalar* properties,
+                                                          const int numProperties)
+{ // _calcTimeStepCoefs
+  assert(coefs);
+  assert(_MaxwellPlaneStrain::numCoefs == numCoefs);
+  assert(properties);
+  assert(_numPropsQuadPt == numProperties);
+
+  const PylithScalar maxwellTime = properties[p_maxwellTime];
+  coefs[_MaxwellPlaneStrain::c_viscousStrainParam] = 
+    ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
+  coefs[_MaxwellPlaneStrain::c_expFac] = exp(-_dt/maxwellTime);
+
+  PetscLogFlops(2);
+} // _calcTimeStepCoefs
+
 // ----------------------------------------------------------------------
 // Compute viscous strain for current time step.
 void
@@ -748,7 +778,6 @@ pylith::materials::MaxwellPlaneStrain::_computeStateVars(
   assert(initialStrain);
   assert(_MaxwellPlaneStrain::tensorSize == initialStrainSize);
 
-  const PylithScalar maxwellTime = properties[p_maxwellTime];
 
   const PylithScalar strainTpdt[4] = {
     totalStrain[0],
@@ -769,8 +798,10 @@ pylith::materials::MaxwellPlaneStrain::_computeStateVars(
   const PylithScalar diag[] = { 1.0, 1.0, 1.0, 0.0 };
 
   // Time integration.
-  PylithScalar dq = ViscoelasticMaxwell::viscousStrainParam(_dt, maxwellTime);
-  const PylithScalar expFac = exp(-_dt/maxwellTime);
+  PylithScalar coefsWork[_MaxwellPlaneStrain::numCoefs];
+  const PylithScalar* coefs = _timeStepCoefs(coefsWork, properties, numProperties);
+  const PylithScalar dq = coefs[_MaxwellPlaneStrain::c_viscousStrainParam];
+  const PylithScalar expFac = coefs[_MaxwellPlaneStrain::c_expFac];
 
   PylithScalar devStrainTpdt = 0.0;
   PylithScalar devStrainT = 0.0;
@@ -434,6 +434,16 @@ pylith::materials::PowerLawPlaneStrain::_stableTimeStepImplicit(
   return dtStable;
 } // _stableTimeStepImplicit
 
+// ----------------------------------------------------------------------
+// Get flag indicating whether the stable time step depends on the
+// state variables.
+bool
+pylith::materials::PowerLawPlaneStrain::_stableTimeStepUsesStateVars(void) const
+{ // _stableTimeStepUsesStateVars
+  // Stable implicit time step depends on the effective stress.
+  return true;
+} // _stableTimeStepUsesStateVars
+
 // ----------------------------------------------------------------------
 // Get stable time step for explicit time integration.
 PylithScalar
@@ -233,6 +233,13 @@ protected :
 				 const PylithScalar* stateVars,
 				 const int numStateVars) const;
 
+  /** Get flag indicating whether the stable time step depends on the
+   * state variables.
+   *
+   * @returns True (stable time step depends on effective stress).
+   */
+  bool _stableTimeStepUsesStateVars(void) const;
+
   /** Get stable time step for explicit time integration.
    *
    * @param properties Properties at location.
@@ -21,6 +21,7 @@
 #include "DataWriter.hh" // Implementation of class methods
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
 
 #include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
 
@@ -119,6 +120,47 @@ pylith::meshio::DataWriter::closeTimeStep(void)
   // Default: no implementation.
 } // closeTimeStep
 
+// ----------------------------------------------------------------------
+// Can time steps be buffered and written together?
+bool
+pylith::meshio::DataWriter::bufferStepsOkay(void) const
+{ // bufferStepsOkay
+  return true;
+} // bufferStepsOkay
+
+// ----------------------------------------------------------------------
+// Write field over vertices at several time steps to file.
+void
+pylith::meshio::DataWriter::writeVertexFieldSteps(const PylithScalar* times,
+                                                  const int numSteps,
+                                                  const PylithScalar* values,
+                                                  topology::Field& field,
+                                                  const topology::Mesh& mesh)
+{ // writeVertexFieldSteps
+  PYLITH_METHOD_BEGIN;
+
+  assert(times);
+
+  PetscErrorCode err = 0;
+  PetscVec localVec = field.localVector(); assert(localVec);
+  PetscInt localSize = 0;
+  err = VecGetLocalSize(localVec, &localSize); PYLITH_CHECK_ERROR(err);
+
+  for (int iStep=0; iStep < numSteps; ++iStep) {
+    PetscScalar* localArray = NULL;
+    err = VecGetArray(localVec, &localArray); PYLITH_CHECK_ERROR(err);
+    const PylithScalar* stepValues = &values[iStep*localSize];
+    for (PetscInt i=0; i < localSize; ++i) {
+      localArray[i] = stepValues[i];
+    } // for
+    err = VecRestoreArray(localVec, &localArray); PYLITH_CHECK_ERROR(err);
+
+    writeVertexField(times[iStep], field, mesh);
+  } // for
+
+  PYLITH_METHOD_END;
+} // writeVertexFieldSteps
+
 // ----------------------------------------------------------------------
 // Copy constructor.
 pylith::meshio::DataWriter::DataWriter(const DataWriter& w) :
@@ -111,6 +111,30 @@ void writeVertexField(const PylithScalar t,
                       topology::Field& field,
                       const topology::Mesh& mesh) = 0;
 
+/** Can time steps be buffered and written together?
+ *
+ * @returns True if all time steps go to a single file, false otherwise.
+ */
+virtual
+bool bufferStepsOkay(void) const;
+
+/** Write field over vertices at several time steps to file.
+ *
+ * Default implementation writes the time steps one at a time.
+ *
+ * @param times Array of times associated with field [numSteps].
+ * @param numSteps Number of time steps.
+ * @param values Array of local values at each time step [numSteps*localSize].
+ * @param field Field over vertices (provides layout and metadata).
+ * @param mesh Mesh associated with output.
+ */
+virtual
+void writeVertexFieldSteps(const PylithScalar* times,
+                           const int numSteps,
+                           const PylithScalar* values,
+                           topology::Field& field,
+                           const topology::Mesh& mesh);
+
 /** Write field over cells to file.
  *
  * @param t Time associated with field.
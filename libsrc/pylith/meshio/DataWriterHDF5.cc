@@ -24,6 +24,7 @@
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Field.hh" // USES Field
+#include "pylith/utils/array.hh" // USES scalar_array
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 
@@ -336,6 +337,101 @@ pylith::meshio::DataWriterHDF5::writeVertexField(const PylithScalar t,
     PYLITH_METHOD_END;
 } // writeVertexField
 
+// ----------------------------------------------------------------------
+// Write field over vertices at several time steps to file.
+void
+pylith::meshio::DataWriterHDF5::writeVertexFieldSteps(const PylithScalar* times,
+                                                      const int numSteps,
+                                                      const PylithScalar* values,
+                                                      topology::Field& field,
+                                                      const topology::Mesh& mesh)
+{ // writeVertexFieldSteps
+    PYLITH_METHOD_BEGIN;
+
+    assert(_viewer);
+    assert(times);
+
+    PetscErrorCode err;
+
+    PetscVec localVec = field.localVector(); assert(localVec);
+    PetscInt localSize = 0;
+    err = VecGetLocalSize(localVec, &localSize); PYLITH_CHECK_ERROR(err);
+
+    // First time step creates the dataset and its metadata.
+    int iStart = 0;
+    if (_timesteps.find(field.label()) == _timesteps.end()) {
+        DataWriter::writeVertexFieldSteps(times, 1, values, field, mesh);
+        iStart = 1;
+    } // if
+    const int numStepsWrite = numSteps - iStart;
+    if (numStepsWrite <= 0) {
+        PYLITH_METHOD_END;
+    } // if
+
+    const int istep = _timesteps[field.label()] + 1;
+    try {
+        const char* context  = DataWriter::_context.c_str();
+
+        field.createScatterWithBC(mesh, "", 0, context);
+        PetscVec vector = field.vector(context); assert(vector);
+        PetscInt lo = 0, hi = 0;
+        err = VecGetOwnershipRange(vector, &lo, &hi); PYLITH_CHECK_ERROR(err);
+
+        // Gather global values for all time steps into contiguous buffer.
+        scalar_array buffer(numStepsWrite*(hi-lo));
+        for (int iStep=0; iStep < numStepsWrite; ++iStep) {
+            PetscScalar* localArray = NULL;
+            err = VecGetArray(localVec, &localArray); PYLITH_CHECK_ERROR(err);
+            const PylithScalar* stepValues = &values[(iStart+iStep)*localSize];
+            for (PetscInt i=0; i < localSize; ++i) {
+                localArray[i] = stepValues[i];
+            } // for
+            err = VecRestoreArray(localVec, &localArray); PYLITH_CHECK_ERROR(err);
+
+            field.scatterLocalToGlobal(context);
+            const PetscScalar* globalArray = NULL;
+            err = VecGetArrayRead(vector, &globalArray); PYLITH_CHECK_ERROR(err);
+            for (PetscInt i=0; i < hi-lo; ++i) {
+                buffer[iStep*(hi-lo)+i] = globalArray[i];
+            } // for
+            err = VecRestoreArrayRead(vector, &globalArray); PYLITH_CHECK_ERROR(err);
+        } // for
+
+        _timesteps[field.label()] += numStepsWrite;
+
+        // Add time stamps to "/time" if necessary.
+        if (_tstampIndex == istep) {
+            PetscMPIInt commRank;
+            err = MPI_Comm_rank(mesh.comm(), &commRank); PYLITH_CHECK_ERROR(err);
+            scalar_array tDim(numStepsWrite);
+            for (int iStep=0; iStep < numStepsWrite; ++iStep) {
+                tDim[iStep] = times[iStart+iStep] * DataWriter::_timeScale;
+            } // for
+            const PetscInt tlo = 0;
+            const PetscInt thi = (!commRank) ? 1 : 0;
+            _appendSteps("/time", istep, numStepsWrite, tlo, thi, &tDim[0]);
+            _tstampIndex += numStepsWrite;
+        } // if
+
+        const std::string& fullName = std::string("/vertex_fields/") + field.label();
+        _appendSteps(fullName.c_str(), istep, numStepsWrite, lo, hi, (buffer.size() > 0) ? &buffer[0] : NULL);
+
+    } catch (const std::exception& err) {
+        std::ostringstream msg;
+        msg << "Error while writing field '" << field.label() << "' at time "
+            << times[numSteps-1] << " to HDF5 file '" << hdf5Filename() << "'.\n" << err.what();
+        throw std::runtime_error(msg.str());
+
+    } catch (...) {
+        std::ostringstream msg;
+        msg << "Error while writing field '" << field.label() << "' at time "
+            << times[numSteps-1] << " to HDF5 file '" << hdf5Filename() << "'.";
+        throw std::runtime_error(msg.str());
+    } // try/catch
+
+    PYLITH_METHOD_END;
+} // writeVertexFieldSteps
+
 // ----------------------------------------------------------------------
 // Write field over cells to file.
 void
@@ -590,5 +686,94 @@ pylith::meshio::DataWriterHDF5::_writeTimeStamp(const PylithScalar t,
     _tstampIndex++;
 } // _writeTimeStamp
 
+// ----------------------------------------------------------------------
+// Append time steps to existing dataset using a single collective write.
+void
+pylith::meshio::DataWriterHDF5::_appendSteps(const char* name,
+                                             const int istep,
+                                             const int numSteps,
+                                             const PetscInt lo,
+                                             const PetscInt hi,
+                                             const PylithScalar* values)
+{ // _appendSteps
+    assert(name);
+    assert(istep >= 0);
+    assert(numSteps > 0);
+
+    hid_t h5 = -1;
+    PetscErrorCode petscerr = PetscViewerHDF5GetFileId(_viewer, &h5); PYLITH_CHECK_ERROR(petscerr);
+    assert(h5 >= 0);
+
+#if defined(PYLITH_HDF5_USE_API_18)
+    hid_t dataset = H5Dopen2(h5, name, H5P_DEFAULT);
+#else
+    hid_t dataset = H5Dopen(h5, name);
+#endif
+    if (dataset < 0) throw std::runtime_error("Could not open dataset.");
+
+    // Dataset was created with time as the first (unlimited) dimension.
+    hid_t dataspace = H5Dget_space(dataset);
+    if (dataspace < 0) throw std::runtime_error("Could not get dataspace.");
+    const int ndims = H5Sget_simple_extent_ndims(dataspace);
+    if (ndims < 2 || ndims > 3) throw std::runtime_error("Unexpected number of dimensions in dataset.");
+    hsize_t dims[3];
+    herr_t err = H5Sget_simple_extent_dims(dataspace, dims, NULL);
+    if (err < 0) throw std::runtime_error("Could not get dimensions of dataset.");
+    err = H5Sclose(dataspace);
+    if (err < 0) throw std::runtime_error("Could not close dataspace.");
+
+    if (dims[0] < hsize_t(istep + numSteps)) {
+        dims[0] = istep + numSteps;
+        err = H5Dset_extent(dataset, dims);
+        if (err < 0) throw std::runtime_error("Could not set extent of dataset.");
+    } // if
+
+    // Values in a row are blocked by the last dimension, if present.
+    const hsize_t blockSize = (3 == ndims) ? dims[2] : 1;
+    assert(0 == lo % blockSize);
+    assert(0 == (hi-lo) % blockSize);
+    hsize_t offset[3];
+    hsize_t count[3];
+    offset[0] = istep;
+    count[0] = numSteps;
+    offset[1] = lo / blockSize;
+    count[1] = (hi-lo) / blockSize;
+    if (3 == ndims) {
+        offset[2] = 0;
+        count[2] = dims[2];
+    } // if
+
+    dataspace = H5Dget_space(dataset);
+    if (dataspace < 0) throw std::runtime_error("Could not get dataspace.");
+    hid_t memspace = H5Screate_simple(ndims, count, NULL);
+    if (memspace < 0) throw std::runtime_error("Could not create memspace.");
+    if (hi > lo) {
+        err = H5Sselect_hyperslab(dataspace, H5S_SELECT_SET, offset, NULL, count, NULL);
+        if (err < 0) throw std::runtime_error("Could not select hyperslab.");
+    } else {
+        err = H5Sselect_none(dataspace);
+        if (err < 0) throw std::runtime_error("Could not clear selection in dataspace.");
+        err = H5Sselect_none(memspace);
+        if (err < 0) throw std::runtime_error("Could not clear selection in memspace.");
+    } // if/else
+
+    hid_t property = H5Pcreate(H5P_DATASET_XFER);
+    if (property < 0) throw std::runtime_error("Could not create property.");
+    H5Pset_dxpl_mpio(property, H5FD_MPIO_COLLECTIVE);
+
+    const hid_t scalartype = (sizeof(double) == sizeof(PylithScalar)) ? H5T_NATIVE_DOUBLE : H5T_NATIVE_FLOAT;
+    err = H5Dwrite(dataset, scalartype, memspace, dataspace, property, values);
+    if (err < 0) throw std::runtime_error("Could not write dataset.");
+
+    err = H5Pclose(property);
+    if (err < 0) throw std::runtime_error("Could not close property.");
+    err = H5Sclose(memspace);
+    if (err < 0) throw std::runtime_error("Could not close memspace.");
+    err = H5Sclose(dataspace);
+    if (err < 0) throw std::runtime_error("Could not close dataspace.");
+    err = H5Dclose(dataset);
+    if (err < 0) throw std::runtime_error("Could not close dataset.");
+} // _appendSteps
+
 
 // End of file
@@ -124,6 +124,23 @@ void writeVertexField(const PylithScalar t,
                       topology::Field& field,
                       const topology::Mesh& mesh);
 
+/** Write field over vertices at several time steps to file.
+ *
+ * After the first time step, the time steps are appended to the
+ * dataset with a single collective hyperslab write.
+ *
+ * @param times Array of times associated with field [numSteps].
+ * @param numSteps Number of time steps.
+ * @param values Array of local values at each time step [numSteps*localSize].
+ * @param field Field over vertices (provides layout and metadata).
+ * @param mesh Mesh associated with output.
+ */
+void writeVertexFieldSteps(const PylithScalar* times,
+                           const int numSteps,
+                           const PylithScalar* values,
+                           topology::Field& field,
+                           const topology::Mesh& mesh);
+
 /** Write field over cells to file.
  *
  * @param t Time associated with field.
@@ -164,6 +181,25 @@ DataWriterHDF5(const DataWriterHDF5& w);
 void _writeTimeStamp(const PylithScalar t,
                      const int commRank);
 
+/** Append time steps to existing dataset using a single collective write.
+ *
+ * Each time step is one row of the dataset; each process writes the
+ * contiguous portion [lo, hi) of each row that it owns.
+ *
+ * @param name Full name of dataset.
+ * @param istep Index of first time step to write.
+ * @param numSteps Number of time steps to write.
+ * @param lo Index of first value in row owned by this process.
+ * @param hi Index one past last value in row owned by this process.
+ * @param values Array of values [numSteps*(hi-lo)].
+ */
+void _appendSteps(const char* name,
+                  const int istep,
+                  const int numSteps,
+                  const PetscInt lo,
+                  const PetscInt hi,
+                  const PylithScalar* values);
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private:
 
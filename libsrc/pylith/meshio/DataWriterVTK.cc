@@ -348,6 +348,14 @@ pylith::meshio::DataWriterVTK::writeCellField(const PylithScalar t,
   PYLITH_METHOD_END;
 } // writeCellField
 
+// ----------------------------------------------------------------------
+// Can time steps be buffered and written together?
+bool
+pylith::meshio::DataWriterVTK::bufferStepsOkay(void) const
+{ // bufferStepsOkay
+  return false;
+} // bufferStepsOkay
+
 // ----------------------------------------------------------------------
 // Generate filename for VTK file.
 std::string
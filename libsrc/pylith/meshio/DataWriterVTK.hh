@@ -134,6 +134,12 @@ public :
 			topology::Field& field,
 			const topology::Mesh& mesh);
 
+  /** Can time steps be buffered and written together?
+   *
+   * @returns False, because each time step goes to a separate file.
+   */
+  bool bufferStepsOkay(void) const;
+
   /** Write field over cells to file.
    *
    * @param t Time associated with field.
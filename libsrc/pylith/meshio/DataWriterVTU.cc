@@ -0,0 +1,918 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "DataWriterVTU.hh" // Implementation of class methods
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Stratum.hh" // USES Stratum, StratumIS
+#include "pylith/topology/CoordsVisitor.hh" // USES CoordsVisitor
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+
+#include <petscdmplex.h>
+
+#if defined(PETSC_HAVE_ZLIB)
+#include <zlib.h> // USES compress2()
+#endif
+
+#include <algorithm> // USES std::min()
+#include <cassert> // USES assert()
+#include <cstring> // USES memcpy()
+#include <fstream> // USES std::ofstream
+#include <iomanip> // USES std::setw(), std::setfill()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <sys/types.h> // USES int64_t
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace meshio {
+    namespace _DataWriterVTU {
+
+      /// Integer type for sizes in headers of appended data (UInt64).
+      typedef int64_t header_type;
+
+      /// Size of uncompressed blocks when compressing appended data.
+      const size_t compressionBlockSize = 32768;
+
+      /// VTK cell types.
+      enum VTKCellEnum {
+	VTK_VERTEX=1,
+	VTK_LINE=3,
+	VTK_TRIANGLE=5,
+	VTK_QUAD=9,
+	VTK_TETRA=10,
+	VTK_HEXAHEDRON=12
+      }; // VTKCellEnum
+
+      /** Get VTK cell type.
+       *
+       * @param cellDim Dimension of cell.
+       * @param numCorners Number of vertices in cell.
+       * @returns VTK cell type.
+       */
+      unsigned char cellType(const int cellDim,
+			     const int numCorners);
+
+      /** Get VTK byte order of this machine.
+       *
+       * @returns "LittleEndian" or "BigEndian".
+       */
+      const char* byteOrder(void);
+
+      /** Get filename without directory.
+       *
+       * @param filename Filename with directory.
+       * @returns Filename without directory.
+       */
+      std::string basename(const std::string& filename);
+
+    } // _DataWriterVTU
+  } // meshio
+} // pylith
+
+// ----------------------------------------------------------------------
+// Get VTK cell type.
+unsigned char
+pylith::meshio::_DataWriterVTU::cellType(const int cellDim,
+					 const int numCorners)
+{ // cellType
+  switch (cellDim) {
+  case 0 :
+    if (1 == numCorners) {
+      return VTK_VERTEX;
+    } // if
+    break;
+  case 1 :
+    if (2 == numCorners) {
+      return VTK_LINE;
+    } // if
+    break;
+  case 2 :
+    if (3 == numCorners) {
+      return VTK_TRIANGLE;
+    } else if (4 == numCorners) {
+      return VTK_QUAD;
+    } // if/else
+    break;
+  case 3 :
+    if (4 == numCorners) {
+      return VTK_TETRA;
+    } else if (8 == numCorners) {
+      return VTK_HEXAHEDRON;
+    } // if/else
+    break;
+  default :
+    break;
+  } // switch
+
+  std::ostringstream msg;
+  msg << "Unknown VTK cell type for cell with dimension " << cellDim
+      << " and " << numCorners << " vertices.";
+  throw std::runtime_error(msg.str());
+} // cellType
+
+// ----------------------------------------------------------------------
+// Get VTK byte order of this machine.
+const char*
+pylith::meshio::_DataWriterVTU::byteOrder(void)
+{ // byteOrder
+  const int value = 1;
+  return (1 == *((const char*) &value)) ? "LittleEndian" : "BigEndian";
+} // byteOrder
+
+// ----------------------------------------------------------------------
+// Get filename without directory.
+std::string
+pylith::meshio::_DataWriterVTU::basename(const std::string& filename)
+{ // basename
+  const size_t pos = filename.find_last_of('/');
+  return (pos != std::string::npos) ? filename.substr(pos+1) : filename;
+} // basename
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::meshio::DataWriterVTU::DataWriterVTU(void) :
+  _timeConstant(1.0),
+  _filename("output.vtu"),
+  _timeFormat("%f"),
+  _compressor(COMPRESSOR_NONE),
+  _dm(NULL),
+  _commRank(0),
+  _commSize(1),
+  _numVertices(0),
+  _vStart(0),
+  _timeStepTime(0.0),
+  _isOpen(false),
+  _isOpenTimeStep(false)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::meshio::DataWriterVTU::~DataWriterVTU(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::DataWriterVTU::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  closeTimeStep(); // Insure time step is closed.
+  close(); // Insure clean up.
+  DataWriter::deallocate();
+
+  PYLITH_METHOD_END;
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Copy constructor.
+pylith::meshio::DataWriterVTU::DataWriterVTU(const DataWriterVTU& w) :
+  DataWriter(w),
+  _timeConstant(w._timeConstant),
+  _filename(w._filename),
+  _timeFormat(w._timeFormat),
+  _compressor(w._compressor),
+  _dm(NULL),
+  _commRank(0),
+  _commSize(1),
+  _numVertices(0),
+  _vStart(0),
+  _timeStepTime(0.0),
+  _isOpen(false),
+  _isOpenTimeStep(false)
+{ // copy constructor
+} // copy constructor
+
+// ----------------------------------------------------------------------
+// Set value used to normalize time stamp in name of VTU files.
+void
+pylith::meshio::DataWriterVTU::timeConstant(const PylithScalar value)
+{ // timeConstant
+  PYLITH_METHOD_BEGIN;
+
+  if (value <= 0.0) {
+    std::ostringstream msg;
+    msg << "Time used to normalize time stamp in VTU data files must be "
+	<< "positive.\nCurrent value is " << value << ".";
+    throw std::runtime_error(msg.str());
+  } // if
+  _timeConstant = value;
+
+  PYLITH_METHOD_END;
+} // timeConstant
+
+// ----------------------------------------------------------------------
+// Set compressor for appended data.
+void
+pylith::meshio::DataWriterVTU::compressor(const char* value)
+{ // compressor
+  PYLITH_METHOD_BEGIN;
+
+  assert(value);
+  const std::string name(value);
+  if (name == "none") {
+    _compressor = COMPRESSOR_NONE;
+  } else if (name == "zlib") {
+#if defined(PETSC_HAVE_ZLIB)
+    _compressor = COMPRESSOR_ZLIB;
+#else
+    throw std::runtime_error("Cannot compress VTU data files with zlib. "
+			     "PETSc was not built with zlib.");
+#endif
+  } else {
+    std::ostringstream msg;
+    msg << "Unknown compressor '" << name << "' for VTU data files. "
+	<< "Known compressors are 'none' and 'zlib'.";
+    throw std::runtime_error(msg.str());
+  } // if/else
+
+  PYLITH_METHOD_END;
+} // compressor
+
+// ----------------------------------------------------------------------
+// Prepare for writing files.
+void
+pylith::meshio::DataWriterVTU::open(const topology::Mesh& mesh,
+				    const int numTimeSteps,
+				    const char* label,
+				    const int labelId)
+{ // open
+  PYLITH_METHOD_BEGIN;
+
+  DataWriter::open(mesh, numTimeSteps, label, labelId);
+
+  PetscErrorCode err = 0;
+  err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
+  _dm = mesh.dmMesh();assert(_dm);
+  err = PetscObjectReference((PetscObject) _dm);PYLITH_CHECK_ERROR(err);
+
+  _commRank = mesh.commRank();
+  err = MPI_Comm_size(mesh.comm(), &_commSize);PYLITH_CHECK_ERROR(err);
+
+  _pvdTimes.clear();
+  _pvdFiles.clear();
+
+  // The mesh does not change, so we encode the points and cells once
+  // and reuse them in every time step.
+  _encodeTopology(mesh, label, labelId);
+
+  _isOpen = true;
+
+  PYLITH_METHOD_END;
+} // open
+
+// ----------------------------------------------------------------------
+// Close output files.
+void
+pylith::meshio::DataWriterVTU::close(void)
+{ // close
+  PYLITH_METHOD_BEGIN;
+
+  if (_isOpen) {
+    assert(_dm);
+    PetscErrorCode err = DMDestroy(&_dm);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  _cells.clear();
+  _topologyData.clear();
+  _topologyArrays.clear();
+  _fieldData.clear();
+  _vertexArrays.clear();
+  _cellArrays.clear();
+  _packBuffer.resize(0);
+
+  DataWriter::close();
+
+  _isOpen = false;
+
+  PYLITH_METHOD_END;
+} // close
+
+// ----------------------------------------------------------------------
+// Prepare file for data at a new time step.
+void
+pylith::meshio::DataWriterVTU::openTimeStep(const PylithScalar t,
+					    const topology::Mesh& mesh,
+					    const char* label,
+					    const int labelId)
+{ // openTimeStep
+  PYLITH_METHOD_BEGIN;
+
+  assert(_dm && _dm == mesh.dmMesh());
+  assert(_isOpen && !_isOpenTimeStep);
+
+  _timeStepRoot = _vtuFilenameRoot(t);
+  _timeStepTime = t;
+
+  // Clearing retains the capacity of the buffer, so we do not
+  // reallocate it for every time step.
+  _fieldData.clear();
+  _vertexArrays.clear();
+  _cellArrays.clear();
+
+  _isOpenTimeStep = true;
+
+  PYLITH_METHOD_END;
+} // openTimeStep
+
+// ----------------------------------------------------------------------
+/// Cleanup after writing data for a time step.
+void
+pylith::meshio::DataWriterVTU::closeTimeStep(void)
+{ // closeTimeStep
+  PYLITH_METHOD_BEGIN;
+
+  if (_isOpenTimeStep) {
+    _writePiece(_pieceFilename(_timeStepRoot, _commRank));
+
+    if (!_commRank) {
+      const std::string filenamePVTU = _timeStepRoot + ".pvtu";
+      _writePVTU(filenamePVTU, _timeStepRoot);
+
+      if (DataWriter::_numTimeSteps > 0) {
+	_pvdTimes.push_back(_timeStepTime * DataWriter::_timeScale);
+	_pvdFiles.push_back(_DataWriterVTU::basename(filenamePVTU));
+	_writePVD();
+      } // if
+    } // if
+  } // if
+
+  _fieldData.clear();
+  _vertexArrays.clear();
+  _cellArrays.clear();
+
+  _isOpenTimeStep = false;
+
+  PYLITH_METHOD_END;
+} // closeTimeStep
+
+// ----------------------------------------------------------------------
+// Write field over vertices to file.
+void
+pylith::meshio::DataWriterVTU::writeVertexField(const PylithScalar t,
+						topology::Field& field,
+						const topology::Mesh& mesh)
+{ // writeVertexField
+  PYLITH_METHOD_BEGIN;
+
+  assert(_dm && _dm == mesh.dmMesh());
+  assert(_isOpen && _isOpenTimeStep);
+
+  _encodeField(&_vertexArrays, field, 0, _vStart, _numVertices);
+
+  PYLITH_METHOD_END;
+} // writeVertexField
+
+// ----------------------------------------------------------------------
+// Write field over cells to file.
+void
+pylith::meshio::DataWriterVTU::writeCellField(const PylithScalar t,
+					      topology::Field& field,
+					      const char* label,
+					      const int labelId)
+{ // writeCellField
+  PYLITH_METHOD_BEGIN;
+
+  assert(_dm && _dm == field.mesh().dmMesh());
+  assert(_isOpen && _isOpenTimeStep);
+
+  const PetscInt numCells = _cells.size();
+  const PetscInt* cells = (numCells > 0) ? &_cells[0] : 0;
+  _encodeField(&_cellArrays, field, cells, 0, numCells);
+
+  PYLITH_METHOD_END;
+} // writeCellField
+
+// ----------------------------------------------------------------------
+// Can time steps be buffered and written together?
+bool
+pylith::meshio::DataWriterVTU::bufferStepsOkay(void) const
+{ // bufferStepsOkay
+  return false;
+} // bufferStepsOkay
+
+// ----------------------------------------------------------------------
+// Generate root of filenames for time step.
+std::string
+pylith::meshio::DataWriterVTU::_vtuFilenameRoot(const PylithScalar t) const
+{ // _vtuFilenameRoot
+  PYLITH_METHOD_BEGIN;
+
+  const size_t indexExt = _filename.rfind(".vtu");
+  const std::string root = (indexExt != std::string::npos) ? std::string(_filename, 0, indexExt) : _filename;
+
+  std::ostringstream filename;
+  const int numTimeSteps = DataWriter::_numTimeSteps;
+  if (numTimeSteps > 0) {
+    // If data with multiple time steps, then add time stamp to filename
+    char sbuffer[256];
+    sprintf(sbuffer, _timeFormat.c_str(), t/_timeConstant);
+    std::string timestamp(sbuffer);
+    const size_t pos = timestamp.find(".");
+    if (pos != std::string::npos) {
+      timestamp.erase(pos, 1);
+    } // if
+    filename << root << "_t" << timestamp;
+  } else
+    filename << root << "_info";
+
+  PYLITH_METHOD_RETURN(std::string(filename.str()));
+} // _vtuFilenameRoot
+
+// ----------------------------------------------------------------------
+// Generate name of VTU file for piece.
+std::string
+pylith::meshio::DataWriterVTU::_pieceFilename(const std::string& root,
+					      const int rank)
+{ // _pieceFilename
+  std::ostringstream filename;
+  filename << root << "_p" << std::setw(4) << std::setfill('0') << rank << ".vtu";
+
+  return std::string(filename.str());
+} // _pieceFilename
+
+// ----------------------------------------------------------------------
+// Generate name of PVD file with time series.
+std::string
+pylith::meshio::DataWriterVTU::_pvdFilename(void) const
+{ // _pvdFilename
+  const size_t indexExt = _filename.rfind(".vtu");
+  const std::string root = (indexExt != std::string::npos) ? std::string(_filename, 0, indexExt) : _filename;
+
+  return root + ".pvd";
+} // _pvdFilename
+
+// ----------------------------------------------------------------------
+// Encode topology of local portion of mesh.
+void
+pylith::meshio::DataWriterVTU::_encodeTopology(const topology::Mesh& mesh,
+					       const char* label,
+					       const int labelId)
+{ // _encodeTopology
+  PYLITH_METHOD_BEGIN;
+
+  PetscDM dmMesh = mesh.dmMesh();assert(dmMesh);
+  PetscErrorCode err = 0;
+
+  const char* scalarType = (sizeof(double) == sizeof(PylithScalar)) ? "Float64" : "Float32";
+  const char* intType = (8 == sizeof(PetscInt)) ? "Int64" : "Int32";
+
+  _topologyData.clear();
+  _topologyArrays.clear();
+
+  // Vertices
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  _vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+  _numVertices = verticesStratum.size();
+
+  // Cells (account for censored cells).
+  PetscInt cellHeight = 0, cStart = 0, cEnd = 0, cMax = -1;
+  err = DMPlexGetVTKCellHeight(dmMesh, &cellHeight);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHeightStratum(dmMesh, cellHeight, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetHybridBounds(dmMesh, &cMax, PETSC_NULL, PETSC_NULL, PETSC_NULL);PYLITH_CHECK_ERROR(err);
+  if (cMax >= 0) {
+    cEnd = PetscMin(cEnd, cMax);
+  } // if
+  _cells.clear();
+  if (label) {
+    const bool includeOnlyCells = true;
+    topology::StratumIS cellsIS(dmMesh, label, labelId, includeOnlyCells);
+    const PetscInt numCells = cellsIS.size();
+    const PetscInt* cells = (numCells > 0) ? cellsIS.points() : 0;
+    _cells.reserve(numCells);
+    for (PetscInt c=0; c < numCells; ++c) {
+      if ((cells[c] >= cStart) && (cells[c] < cEnd)) {
+	_cells.push_back(cells[c]);
+      } // if
+    } // for
+  } else {
+    _cells.reserve(cEnd-cStart);
+    for (PetscInt c=cStart; c < cEnd; ++c) {
+      _cells.push_back(c);
+    } // for
+  } // if/else
+  const PetscInt numCells = _cells.size();
+
+  // Points (always 3 components in VTK).
+  PetscReal lengthScale = 1.0;
+  err = DMPlexGetScale(dmMesh, PETSC_UNIT_LENGTH, &lengthScale);PYLITH_CHECK_ERROR(err);
+  topology::CoordsVisitor coordsVisitor(dmMesh);
+  const PetscScalar* coordsArray = coordsVisitor.localArray();
+
+  _packBuffer.resize(_numVertices*3);
+  _packBuffer = 0.0;
+  for (PetscInt v=_vStart, index=0; v < vEnd; ++v, index += 3) {
+    const PetscInt off = coordsVisitor.sectionOffset(v);
+    const PetscInt dof = coordsVisitor.sectionDof(v);assert(dof <= 3);
+    for (PetscInt d=0; d < dof; ++d) {
+      _packBuffer[index+d] = coordsArray[off+d] * lengthScale;
+    } // for
+  } // for
+
+  DataArray points;
+  points.name = "Points";
+  points.type = scalarType;
+  points.numComponents = 3;
+  points.offset = _topologyData.size();
+  _appendBinary(&_topologyData, (_numVertices > 0) ? &_packBuffer[0] : 0, _numVertices*3*sizeof(PylithScalar));
+  _topologyArrays.push_back(points);
+
+  // Connectivity, offsets, and types of cells.
+  const int cellDim = mesh.dimension();
+  std::vector<PetscInt> connectivity;
+  std::vector<PetscInt> offsets(numCells);
+  std::vector<unsigned char> types(numCells);
+  for (PetscInt c=0; c < numCells; ++c) {
+    PetscInt* closure = NULL;
+    PetscInt closureSize = 0, numCorners = 0;
+
+    err = DMPlexGetTransitiveClosure(dmMesh, _cells[c], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    for (PetscInt p=0; p < closureSize*2; p += 2) {
+      if ((closure[p] >= _vStart) && (closure[p] < vEnd)) {
+	closure[numCorners++] = closure[p];
+      } // if
+    } // for
+    err = DMPlexInvertCell(cellDim, numCorners, closure);PYLITH_CHECK_ERROR(err);
+    for (PetscInt p=0; p < numCorners; ++p) {
+      connectivity.push_back(closure[p] - _vStart);
+    } // for
+    err = DMPlexRestoreTransitiveClosure(dmMesh, _cells[c], PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+
+    offsets[c] = connectivity.size();
+    types[c] = _DataWriterVTU::cellType(cellDim, numCorners);
+  } // for
+
+  DataArray connectivityArray;
+  connectivityArray.name = "connectivity";
+  connectivityArray.type = intType;
+  connectivityArray.numComponents = 1;
+  connectivityArray.offset = _topologyData.size();
+  _appendBinary(&_topologyData, (connectivity.size() > 0) ? &connectivity[0] : 0, connectivity.size()*sizeof(PetscInt));
+  _topologyArrays.push_back(connectivityArray);
+
+  DataArray offsetsArray;
+  offsetsArray.name = "offsets";
+  offsetsArray.type = intType;
+  offsetsArray.numComponents = 1;
+  offsetsArray.offset = _topologyData.size();
+  _appendBinary(&_topologyData, (numCells > 0) ? &offsets[0] : 0, numCells*sizeof(PetscInt));
+  _topologyArrays.push_back(offsetsArray);
+
+  DataArray typesArray;
+  typesArray.name = "types";
+  typesArray.type = "UInt8";
+  typesArray.numComponents = 1;
+  typesArray.offset = _topologyData.size();
+  _appendBinary(&_topologyData, (numCells > 0) ? &types[0] : 0, numCells*sizeof(unsigned char));
+  _topologyArrays.push_back(typesArray);
+
+  PYLITH_METHOD_END;
+} // _encodeTopology
+
+// ----------------------------------------------------------------------
+// Encode field over points into appended data.
+void
+pylith::meshio::DataWriterVTU::_encodeField(dataarray_vector* arrays,
+					    topology::Field& field,
+					    const PetscInt* points,
+					    const PetscInt pStart,
+					    const PetscInt numPoints)
+{ // _encodeField
+  PYLITH_METHOD_BEGIN;
+
+  assert(arrays);
+
+  topology::VecVisitorMesh fieldVisitor(field);
+  const PetscScalar* fieldArray = fieldVisitor.localArray();
+
+  // All processes must use the same number of components, even if
+  // they hold no points.
+  const PetscInt pFirst = points ? ((numPoints > 0) ? points[0] : 0) : pStart;
+  int fiberDimLocal = (numPoints > 0) ? fieldVisitor.sectionDof(pFirst) : 0;
+  int fiberDim = 0;
+  PetscErrorCode err = MPI_Allreduce(&fiberDimLocal, &fiberDim, 1, MPI_INT, MPI_MAX, field.mesh().comm());PYLITH_CHECK_ERROR(err);
+
+  // Pad 2-D vectors to 3 components, so ParaView can use them as vectors.
+  const int numComponents = (topology::FieldBase::VECTOR == field.vectorFieldType() && fiberDim < 3) ? 3 : fiberDim;
+
+  // Write values directly from the local array if the points are
+  // contiguous in the array; otherwise pack them.
+  const PetscInt offFirst = (numPoints > 0) ? fieldVisitor.sectionOffset(pFirst) : 0;
+  bool isContiguous = (numComponents == fiberDim);
+  for (PetscInt i=0; i < numPoints && isContiguous; ++i) {
+    const PetscInt point = points ? points[i] : pStart+i;
+    if (fieldVisitor.sectionOffset(point) != offFirst + i*fiberDim ||
+	fieldVisitor.sectionDof(point) != fiberDim) {
+      isContiguous = false;
+    } // if
+  } // for
+
+  DataArray array;
+  array.name = field.label();
+  array.type = (sizeof(double) == sizeof(PylithScalar)) ? "Float64" : "Float32";
+  array.numComponents = numComponents;
+  array.offset = _fieldData.size();
+
+  const size_t nbytes = numPoints*numComponents*sizeof(PylithScalar);
+  if (isContiguous) {
+    _appendBinary(&_fieldData, (numPoints > 0) ? &fieldArray[offFirst] : 0, nbytes);
+  } else {
+    _packBuffer.resize(numPoints*numComponents);
+    _packBuffer = 0.0;
+    for (PetscInt i=0, index=0; i < numPoints; ++i, index += numComponents) {
+      const PetscInt point = points ? points[i] : pStart+i;
+      const PetscInt off = fieldVisitor.sectionOffset(point);
+      const PetscInt dof = std::min(PetscInt(numComponents), fieldVisitor.sectionDof(point));
+      for (PetscInt d=0; d < dof; ++d) {
+	_packBuffer[index+d] = fieldArray[off+d];
+      } // for
+    } // for
+    _appendBinary(&_fieldData, (numPoints > 0) ? &_packBuffer[0] : 0, nbytes);
+  } // if/else
+  arrays->push_back(array);
+
+  PYLITH_METHOD_END;
+} // _encodeField
+
+// ----------------------------------------------------------------------
+// Append array to binary data block.
+void
+pylith::meshio::DataWriterVTU::_appendBinary(std::vector<char>* buffer,
+					     const void* values,
+					     const size_t nbytes) const
+{ // _appendBinary
+  PYLITH_METHOD_BEGIN;
+
+  assert(buffer);
+  assert(values || !nbytes);
+
+  typedef _DataWriterVTU::header_type header_type;
+  const size_t headerOffset = buffer->size();
+
+  switch (_compressor) {
+  case COMPRESSOR_NONE : {
+    // Header: [number of bytes]
+    const header_type size = nbytes;
+    buffer->resize(headerOffset + sizeof(header_type) + nbytes);
+    memcpy(&(*buffer)[headerOffset], &size, sizeof(header_type));
+    if (nbytes > 0) {
+      memcpy(&(*buffer)[headerOffset+sizeof(header_type)], values, nbytes);
+    } // if
+    break;
+  } // COMPRESSOR_NONE
+  case COMPRESSOR_ZLIB : {
+#if defined(PETSC_HAVE_ZLIB)
+    // Header: [number of blocks, block size, size of last partial
+    // block (0 if full), compressed size of each block]
+    const size_t blockSize = _DataWriterVTU::compressionBlockSize;
+    const size_t numBlocks = (nbytes + blockSize - 1) / blockSize;
+    const size_t lastBlockSize = nbytes % blockSize;
+    std::vector<header_type> header(3+numBlocks);
+    header[0] = numBlocks;
+    header[1] = blockSize;
+    header[2] = lastBlockSize;
+
+    const size_t headerSize = header.size()*sizeof(header_type);
+    buffer->resize(headerOffset + headerSize);
+    for (size_t iBlock=0; iBlock < numBlocks; ++iBlock) {
+      const size_t srcSize = (iBlock+1 == numBlocks && lastBlockSize > 0) ? lastBlockSize : blockSize;
+      const Bytef* src = (const Bytef*) values + iBlock*blockSize;
+      const size_t dataOffset = buffer->size();
+      uLongf destSize = compressBound(srcSize);
+      buffer->resize(dataOffset + destSize);
+      const int zerr = compress2((Bytef*) &(*buffer)[dataOffset], &destSize, src, srcSize, Z_DEFAULT_COMPRESSION);
+      if (Z_OK != zerr) {
+	std::ostringstream msg;
+	msg << "Error " << zerr << " while compressing data for VTU file.";
+	throw std::runtime_error(msg.str());
+      } // if
+      buffer->resize(dataOffset + destSize);
+      header[3+iBlock] = destSize;
+    } // for
+    memcpy(&(*buffer)[headerOffset], &header[0], headerSize);
+#else
+    assert(0);
+    throw std::logic_error("PETSc was not built with zlib.");
+#endif
+    break;
+  } // COMPRESSOR_ZLIB
+  default :
+    assert(0);
+    throw std::logic_error("Unknown compressor for VTU data files.");
+  } // switch
+
+  PYLITH_METHOD_END;
+} // _appendBinary
+
+// ----------------------------------------------------------------------
+// Write VTU file with piece of mesh owned by this process.
+void
+pylith::meshio::DataWriterVTU::_writePiece(const std::string& filename) const
+{ // _writePiece
+  PYLITH_METHOD_BEGIN;
+
+  std::ofstream fout(filename.c_str(), std::ios::out | std::ios::binary);
+  if (!(fout.is_open() && fout.good())) {
+    std::ostringstream msg;
+    msg << "Could not open VTU file '" << filename << "' for writing.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  assert(4 == _topologyArrays.size());
+  const size_t topologySize = _topologyData.size();
+
+  fout << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"UnstructuredGrid\" version=\"1.0\""
+       << " byte_order=\"" << _DataWriterVTU::byteOrder() << "\""
+       << " header_type=\"UInt64\"";
+  if (COMPRESSOR_ZLIB == _compressor) {
+    fout << " compressor=\"vtkZLibDataCompressor\"";
+  } // if
+  fout << ">\n"
+       << "  <UnstructuredGrid>\n"
+       << "    <Piece NumberOfPoints=\"" << _numVertices << "\""
+       << " NumberOfCells=\"" << _cells.size() << "\">\n";
+
+  fout << "      <PointData>\n";
+  _writeDataArrays(fout, _vertexArrays, topologySize, false, "        ");
+  fout << "      </PointData>\n";
+
+  fout << "      <CellData>\n";
+  _writeDataArrays(fout, _cellArrays, topologySize, false, "        ");
+  fout << "      </CellData>\n";
+
+  dataarray_vector pointsArrays(_topologyArrays.begin(), _topologyArrays.begin()+1);
+  fout << "      <Points>\n";
+  _writeDataArrays(fout, pointsArrays, 0, false, "        ");
+  fout << "      </Points>\n";
+
+  dataarray_vector cellsArrays(_topologyArrays.begin()+1, _topologyArrays.end());
+  fout << "      <Cells>\n";
+  _writeDataArrays(fout, cellsArrays, 0, false, "        ");
+  fout << "      </Cells>\n";
+
+  fout << "    </Piece>\n"
+       << "  </UnstructuredGrid>\n"
+       << "  <AppendedData encoding=\"raw\">\n"
+       << "_";
+  if (topologySize > 0) {
+    fout.write(&_topologyData[0], topologySize);
+  } // if
+  if (_fieldData.size() > 0) {
+    fout.write(&_fieldData[0], _fieldData.size());
+  } // if
+  fout << "\n"
+       << "  </AppendedData>\n"
+       << "</VTKFile>\n";
+
+  if (!fout.good()) {
+    std::ostringstream msg;
+    msg << "Error while writing VTU file '" << filename << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  fout.close();
+
+  PYLITH_METHOD_END;
+} // _writePiece
+
+// ----------------------------------------------------------------------
+// Write PVTU file with list of pieces.
+void
+pylith::meshio::DataWriterVTU::_writePVTU(const std::string& filename,
+					  const std::string& root) const
+{ // _writePVTU
+  PYLITH_METHOD_BEGIN;
+
+  std::ofstream fout(filename.c_str(), std::ios::out);
+  if (!(fout.is_open() && fout.good())) {
+    std::ostringstream msg;
+    msg << "Could not open PVTU file '" << filename << "' for writing.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  fout << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"PUnstructuredGrid\" version=\"1.0\""
+       << " byte_order=\"" << _DataWriterVTU::byteOrder() << "\""
+       << " header_type=\"UInt64\">\n"
+       << "  <PUnstructuredGrid GhostLevel=\"0\">\n";
+
+  fout << "    <PPointData>\n";
+  _writeDataArrays(fout, _vertexArrays, 0, true, "      ");
+  fout << "    </PPointData>\n";
+
+  fout << "    <PCellData>\n";
+  _writeDataArrays(fout, _cellArrays, 0, true, "      ");
+  fout << "    </PCellData>\n";
+
+  dataarray_vector pointsArrays(_topologyArrays.begin(), _topologyArrays.begin()+1);
+  fout << "    <PPoints>\n";
+  _writeDataArrays(fout, pointsArrays, 0, true, "      ");
+  fout << "    </PPoints>\n";
+
+  for (int rank=0; rank < _commSize; ++rank) {
+    fout << "    <Piece Source=\"" << _DataWriterVTU::basename(_pieceFilename(root, rank)) << "\"/>\n";
+  } // for
+
+  fout << "  </PUnstructuredGrid>\n"
+       << "</VTKFile>\n";
+
+  if (!fout.good()) {
+    std::ostringstream msg;
+    msg << "Error while writing PVTU file '" << filename << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  fout.close();
+
+  PYLITH_METHOD_END;
+} // _writePVTU
+
+// ----------------------------------------------------------------------
+// Write PVD file with time series.
+void
+pylith::meshio::DataWriterVTU::_writePVD(void) const
+{ // _writePVD
+  PYLITH_METHOD_BEGIN;
+
+  // Rewrite the entire file, so it is complete after every time step.
+  const std::string filename = _pvdFilename();
+  std::ofstream fout(filename.c_str(), std::ios::out);
+  if (!(fout.is_open() && fout.good())) {
+    std::ostringstream msg;
+    msg << "Could not open PVD file '" << filename << "' for writing.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  fout << "<?xml version=\"1.0\"?>\n"
+       << "<VTKFile type=\"Collection\" version=\"0.1\""
+       << " byte_order=\"" << _DataWriterVTU::byteOrder() << "\">\n"
+       << "  <Collection>\n";
+
+  fout.precision(16);
+  const size_t numSteps = _pvdFiles.size();
+  assert(numSteps == _pvdTimes.size());
+  for (size_t i=0; i < numSteps; ++i) {
+    fout << "    <DataSet timestep=\"" << _pvdTimes[i] << "\" group=\"\" part=\"0\""
+	 << " file=\"" << _pvdFiles[i] << "\"/>\n";
+  } // for
+
+  fout << "  </Collection>\n"
+       << "</VTKFile>\n";
+
+  if (!fout.good()) {
+    std::ostringstream msg;
+    msg << "Error while writing PVD file '" << filename << "'.";
+    throw std::runtime_error(msg.str());
+  } // if
+  fout.close();
+
+  PYLITH_METHOD_END;
+} // _writePVD
+
+// ----------------------------------------------------------------------
+// Write descriptions of data arrays to XML stream.
+void
+pylith::meshio::DataWriterVTU::_writeDataArrays(std::ostream& sout,
+						const dataarray_vector& arrays,
+						const size_t offsetShift,
+						const bool parallel,
+						const char* indent)
+{ // _writeDataArrays
+  const size_t numArrays = arrays.size();
+  for (size_t i=0; i < numArrays; ++i) {
+    const DataArray& array = arrays[i];
+    sout << indent << (parallel ? "<PDataArray" : "<DataArray")
+	 << " type=\"" << array.type << "\""
+	 << " Name=\"" << array.name << "\""
+	 << " NumberOfComponents=\"" << array.numComponents << "\"";
+    if (!parallel) {
+      sout << " format=\"appended\" offset=\"" << array.offset + offsetShift << "\"";
+    } // if
+    sout << "/>\n";
+  } // for
+} // _writeDataArrays
+
+
+// End of file
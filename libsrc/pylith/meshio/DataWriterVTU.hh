@@ -0,0 +1,334 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/DataWriterVTU.hh
+ *
+ * @brief Object for writing finite-element data to parallel VTK XML
+ * unstructured grid (VTU/PVTU) files.
+ *
+ * Each process writes the portion of the mesh and fields it holds to
+ * its own VTU file with the data stored as raw binary appended data
+ * (optionally compressed with zlib). Process 0 writes a PVTU file
+ * that ties the pieces together for each time step and a ParaView
+ * data (PVD) file that indexes the time steps.
+ *
+ * Files for a time step with time stamp TSTAMP and filename
+ * ROOT.vtu:
+ *
+ *   ROOT_tTSTAMP.pvtu - index of pieces (process 0)
+ *   ROOT_tTSTAMP_pRANK.vtu - piece for process RANK
+ *   ROOT.pvd - time series (process 0)
+ *
+ * Fields are encoded into the appended data block when they are
+ * written, so the output manager may reuse the fields as buffers
+ * without the writer caching copies of them.
+ */
+
+#if !defined(pylith_meshio_datawritervtu_hh)
+#define pylith_meshio_datawritervtu_hh
+
+// Include directives ---------------------------------------------------
+#include "DataWriter.hh" // ISA DataWriter
+
+#include "pylith/utils/petscfwd.h" // HASA PetscDM
+#include "pylith/utils/array.hh" // HASA scalar_array
+
+#include <string> // HASA std::string
+#include <vector> // HASA std::vector
+#include <iosfwd> // USES std::ostream
+
+// DataWriterVTU --------------------------------------------------------
+/// Object for writing finite-element data to VTU/PVTU files.
+class pylith::meshio::DataWriterVTU : public DataWriter
+{ // DataWriterVTU
+  friend class TestDataWriterVTUMesh; // unit testing
+
+// PUBLIC ENUMS /////////////////////////////////////////////////////////
+public :
+
+  /// Compression of appended data.
+  enum CompressorEnum {
+    COMPRESSOR_NONE=0, ///< Raw binary data.
+    COMPRESSOR_ZLIB=1 ///< Blocks of binary data compressed with zlib.
+  }; // CompressorEnum
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  DataWriterVTU(void);
+
+  /// Destructor
+  ~DataWriterVTU(void);
+
+  /** Make copy of this object.
+   *
+   * @returns Copy of this.
+   */
+  DataWriter* clone(void) const;
+
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
+  /** Set filename for VTU files.
+   *
+   * @param filename Name of VTU file.
+   */
+  void filename(const char* filename);
+
+  /** Set time format for time stamp in name of VTU files.
+   *
+   * @param format C style time format for filename.
+   */
+  void timeFormat(const char* format);
+
+  /** Set value used to normalize time stamp in name of VTU files.
+   *
+   * Time stamp is divided by this value (time in seconds).
+   *
+   * @param value Value (time in seconds) used to normalize time stamp in
+   * filename.
+   */
+  void timeConstant(const PylithScalar value);
+
+  /** Set compressor for appended data.
+   *
+   * @param value Name of compressor ("none" or "zlib").
+   */
+  void compressor(const char* value);
+
+  /** Prepare for writing files.
+   *
+   * @param mesh Finite-element mesh.
+   * @param numTimeSteps Expected number of time steps for fields.
+   * @param label Name of label defining cells to include in output
+   *   (=0 means use all cells in mesh).
+   * @param labelId Value of label defining which cells to include.
+   */
+  void open(const topology::Mesh& mesh,
+	    const int numTimeSteps,
+	    const char* label =0,
+	    const int labelId =0);
+
+  /// Close output files.
+  void close(void);
+
+  /** Prepare file for data at a new time step.
+   *
+   * @param t Time stamp for new data
+   * @param mesh Finite-element mesh.
+   * @param label Name of label defining cells to include in output
+   *   (=0 means use all cells in mesh).
+   * @param labelId Value of label defining which cells to include.
+   */
+  void openTimeStep(const PylithScalar t,
+		    const topology::Mesh& mesh,
+		    const char* label =0,
+		    const int labelId =0);
+
+  /// Cleanup after writing data for a time step.
+  void closeTimeStep(void);
+
+  /** Write field over vertices to file.
+   *
+   * @param t Time associated with field.
+   * @param field Field over vertices.
+   * @param mesh Mesh associated with output.
+   */
+  void writeVertexField(const PylithScalar t,
+			topology::Field& field,
+			const topology::Mesh& mesh);
+
+  /** Can time steps be buffered and written together?
+   *
+   * @returns False, because each time step goes to separate files.
+   */
+  bool bufferStepsOkay(void) const;
+
+  /** Write field over cells to file.
+   *
+   * @param t Time associated with field.
+   * @param field Field over cells.
+   * @param label Name of label defining cells to include in output
+   *   (=0 means use all cells in mesh).
+   * @param labelId Value of label defining which cells to include.
+   */
+  void writeCellField(const PylithScalar t,
+		      topology::Field& field,
+		      const char* label =0,
+		      const int labelId =0);
+
+// PRIVATE STRUCTS //////////////////////////////////////////////////////
+private :
+
+  /// Description of data array in appended data.
+  struct DataArray {
+    std::string name; ///< Name of array.
+    std::string type; ///< VTK data type.
+    int numComponents; ///< Number of components.
+    size_t offset; ///< Offset of array in appended data block.
+  }; // DataArray
+  typedef std::vector<DataArray> dataarray_vector;
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Copy constructor.
+   *
+   * @param w Object to copy.
+   */
+  DataWriterVTU(const DataWriterVTU& w);
+
+  /** Generate root of filenames for time step.
+   *
+   * @param t Time in seconds.
+   * @returns Filename without extension.
+   */
+  std::string _vtuFilenameRoot(const PylithScalar t) const;
+
+  /** Generate name of VTU file for piece.
+   *
+   * @param root Root of filenames for time step.
+   * @param rank Process rank.
+   * @returns Name of VTU file.
+   */
+  static
+  std::string _pieceFilename(const std::string& root,
+			     const int rank);
+
+  /** Generate name of PVD file with time series.
+   *
+   * @returns Name of PVD file.
+   */
+  std::string _pvdFilename(void) const;
+
+  /** Encode topology of local portion of mesh.
+   *
+   * @param mesh Finite-element mesh.
+   * @param label Name of label defining cells to include in output
+   *   (=0 means use all cells in mesh).
+   * @param labelId Value of label defining which cells to include.
+   */
+  void _encodeTopology(const topology::Mesh& mesh,
+		       const char* label,
+		       const int labelId);
+
+  /** Encode field over points into appended data.
+   *
+   * @param arrays Descriptions of arrays for points (vertices or cells).
+   * @param field Field to encode.
+   * @param points Array of points (=0 means contiguous from pStart).
+   * @param pStart First point (if points == 0).
+   * @param numPoints Number of points.
+   */
+  void _encodeField(dataarray_vector* arrays,
+		    topology::Field& field,
+		    const PetscInt* points,
+		    const PetscInt pStart,
+		    const PetscInt numPoints);
+
+  /** Append array to binary data block.
+   *
+   * @param buffer Data block.
+   * @param values Array of values.
+   * @param nbytes Size of values in bytes.
+   */
+  void _appendBinary(std::vector<char>* buffer,
+		     const void* values,
+		     const size_t nbytes) const;
+
+  /** Write VTU file with piece of mesh owned by this process.
+   *
+   * @param filename Name of VTU file.
+   */
+  void _writePiece(const std::string& filename) const;
+
+  /** Write PVTU file with list of pieces.
+   *
+   * @param filename Name of PVTU file.
+   * @param root Root of filenames for time step.
+   */
+  void _writePVTU(const std::string& filename,
+		  const std::string& root) const;
+
+  /// Write PVD file with time series.
+  void _writePVD(void) const;
+
+  /** Write descriptions of data arrays to XML stream.
+   *
+   * @param sout Output stream.
+   * @param arrays Descriptions of data arrays.
+   * @param offsetShift Offset added to offsets of arrays.
+   * @param parallel True if writing to PVTU file.
+   * @param indent Indentation.
+   */
+  static
+  void _writeDataArrays(std::ostream& sout,
+			const dataarray_vector& arrays,
+			const size_t offsetShift,
+			const bool parallel,
+			const char* indent);
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  const DataWriterVTU& operator=(const DataWriterVTU&); ///< Not implemented
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  /// Time value (in seconds) used to normalize time stamp.
+  PylithScalar _timeConstant;
+
+  std::string _filename; ///< Name of VTU file.
+  std::string _timeFormat; ///< C style time format for time stamp.
+  CompressorEnum _compressor; ///< Compressor for appended data.
+
+  PetscDM _dm; ///< Handle to PETSc DM for mesh
+  int _commRank; ///< Rank of this process.
+  int _commSize; ///< Number of processes.
+
+  PetscInt _numVertices; ///< Number of local vertices in piece.
+  PetscInt _vStart; ///< First vertex in DM.
+  std::vector<PetscInt> _cells; ///< Cells in piece.
+
+  std::vector<char> _topologyData; ///< Appended data for points and cells.
+  dataarray_vector _topologyArrays; ///< Arrays for points and cells.
+
+  std::vector<char> _fieldData; ///< Appended data for fields.
+  dataarray_vector _vertexArrays; ///< Arrays for vertex fields.
+  dataarray_vector _cellArrays; ///< Arrays for cell fields.
+  scalar_array _packBuffer; ///< Buffer for packing noncontiguous fields.
+
+  std::string _timeStepRoot; ///< Root of filenames for current time step.
+  PylithScalar _timeStepTime; ///< Time of current time step.
+  std::vector<PylithScalar> _pvdTimes; ///< Times of steps in PVD file.
+  std::vector<std::string> _pvdFiles; ///< PVTU files in PVD file.
+
+  bool _isOpen; ///< True if called open().
+  bool _isOpenTimeStep; ///< true if called openTimeStep().
+
+}; // DataWriterVTU
+
+#include "DataWriterVTU.icc" // inline methods
+
+#endif // pylith_meshio_datawritervtu_hh
+
+
+// End of file
@@ -48,6 +48,33 @@ pylith::meshio::MeshBuilder::buildMesh(topology::Mesh* mesh,
 
   assert(mesh);
   assert(coordinates);
+  PetscErrorCode err;
+
+  const PetscInt bound = numCells*numCorners;
+  for (PetscInt coff = 0; coff < bound; coff += numCorners) {
+    err = DMPlexInvertCell(meshDim, numCorners, (int *) &cells[coff]);PYLITH_CHECK_ERROR(err);
+  } // for
+  buildMesh(mesh, &(*coordinates)[0], numVertices, spaceDim, &cells[0], numCells, numCorners, meshDim, interpolate);
+
+  PYLITH_METHOD_END;
+} // buildMesh
+
+// ----------------------------------------------------------------------
+// Set vertices and cells in mesh from arrays in PETSc layout.
+void
+pylith::meshio::MeshBuilder::buildMesh(topology::Mesh* mesh,
+				       const PylithScalar* coordinates,
+				       const int numVertices,
+				       int spaceDim,
+				       const int* cells,
+				       const int numCells,
+				       const int numCorners,
+				       const int meshDim,
+				       const bool interpolate)
+{ // buildMesh
+  PYLITH_METHOD_BEGIN;
+
+  assert(mesh);
   MPI_Comm comm  = mesh->comm();
   PetscInt dim  = meshDim;
   PetscErrorCode err;
@@ -55,7 +82,7 @@ pylith::meshio::MeshBuilder::buildMesh(topology::Mesh* mesh,
   { // Check to make sure every vertex is in at least one cell.
     // This is required by PETSc
     std::vector<bool> vertexInCell(numVertices, false);
-    const int size = cells.size();
+    const int size = numCells*numCorners;
     for (int i=0; i < size; ++i)
       vertexInCell[cells[i]] = true;
     int count = 0;
@@ -72,14 +99,10 @@ pylith::meshio::MeshBuilder::buildMesh(topology::Mesh* mesh,
   /* DMPlex */
   PetscDM   dmMesh;
   PetscBool pInterpolate = PETSC_TRUE; /* pInterpolate = interpolate ? PETSC_TRUE : PETSC_FALSE; */
-  PetscInt  bound        = numCells*numCorners, coff;
 
   err = MPI_Bcast(&dim, 1, MPIU_INT, 0, comm);PYLITH_CHECK_ERROR(err);
   err = MPI_Bcast(&spaceDim, 1, MPIU_INT, 0, comm);PYLITH_CHECK_ERROR(err);
-  for (coff = 0; coff < bound; coff += numCorners) {
-    err = DMPlexInvertCell(dim, numCorners, (int *) &cells[coff]);PYLITH_CHECK_ERROR(err);
-  }
-  err = DMPlexCreateFromCellList(comm, dim, numCells, numVertices, numCorners, pInterpolate, &cells[0], spaceDim, &(*coordinates)[0], &dmMesh);PYLITH_CHECK_ERROR(err);
+  err = DMPlexCreateFromCellList(comm, dim, numCells, numVertices, numCorners, pInterpolate, cells, spaceDim, coordinates, &dmMesh);PYLITH_CHECK_ERROR(err);
   mesh->dmMesh(dmMesh);
 
   PYLITH_METHOD_END;
@@ -74,6 +74,35 @@ public :
 		 const int meshDim,
 		 const bool interpolate,
 		 const bool isParallel =false);
+
+  /** Build mesh topology and set vertex coordinates from arrays
+   * already in the layout used by PETSc.
+   *
+   * The vertices in each cell must be in the PETSc ordering (as
+   * produced by DMPlexInvertCell()). The arrays are neither modified
+   * nor copied, so they may point directly into read-only memory,
+   * such as a memory mapped mesh file.
+   *
+   * @param mesh PyLith finite-element mesh.
+   * @param coordinates Array of coordinates of vertices.
+   * @param numVertices Number of vertices.
+   * @param spaceDim Dimension of vector space for vertex coordinates.
+   * @param cells Array of indices of vertices in cells (first index is 0).
+   * @param numCells Number of cells.
+   * @param numCorners Number of vertices per cell.
+   * @param meshDim Dimension of cells in mesh.
+   * @param interpolate Create interpolated mesh.
+   */
+  static
+  void buildMesh(topology::Mesh* mesh,
+		 const PylithScalar* coordinates,
+		 const int numVertices,
+		 int spaceDim,
+		 const int* cells,
+		 const int numCells,
+		 const int numCorners,
+		 const int meshDim,
+		 const bool interpolate);
 }; // MeshBuilder
 
 #endif // pylith_meshio_meshbuilder_hh
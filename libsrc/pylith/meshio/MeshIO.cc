@@ -211,6 +211,19 @@ pylith::meshio::MeshIO::_setMaterials(const int_array& materialIds)
 { // _setMaterials
   PYLITH_METHOD_BEGIN;
 
+  _setMaterials((materialIds.size() > 0) ? &materialIds[0] : 0, materialIds.size());
+
+  PYLITH_METHOD_END;
+} // _setMaterials
+
+// ----------------------------------------------------------------------
+// Tag cells in mesh with material identifiers.
+void
+pylith::meshio::MeshIO::_setMaterials(const int* materialIds,
+				      const int numCells)
+{ // _setMaterials
+  PYLITH_METHOD_BEGIN;
+
   assert(_mesh);
 
   if (!_mesh->commRank()) {
@@ -219,12 +232,13 @@ pylith::meshio::MeshIO::_setMaterials(const int_array& materialIds)
     const PetscInt cStart = cellsStratum.begin();
     const PetscInt cEnd = cellsStratum.end();
 
-    if (size_t(cellsStratum.size()) != materialIds.size()) {
+    if (cellsStratum.size() != numCells) {
       std::ostringstream msg;
       msg << "Mismatch in size of materials identifier array ("
-          << materialIds.size() << ") and number of cells in mesh ("<< (cEnd - cStart) << ").";
+          << numCells << ") and number of cells in mesh ("<< (cEnd - cStart) << ").";
       throw std::runtime_error(msg.str());
     } // if
+    assert(!numCells || materialIds);
     PetscErrorCode err = 0;
     for(PetscInt c = cStart; c < cEnd; ++c) {
       err = DMSetLabelValue(dmMesh, "material-id", c, materialIds[c-cStart]);PYLITH_CHECK_ERROR(err);
@@ -269,10 +283,25 @@ pylith::meshio::MeshIO::_setGroup(const std::string& name,
 { // _setGroup
   PYLITH_METHOD_BEGIN;
 
+  _setGroup(name, type, (points.size() > 0) ? &points[0] : 0, points.size());
+
+  PYLITH_METHOD_END;
+} // _setGroup
+
+// ----------------------------------------------------------------------
+// Build a point group from an array of points.
+void
+pylith::meshio::MeshIO::_setGroup(const std::string& name,
+				  const GroupPtType type,
+				  const int* points,
+				  const int numPoints)
+{ // _setGroup
+  PYLITH_METHOD_BEGIN;
+
   assert(_mesh);
+  assert(!numPoints || points);
 
   PetscDM        dmMesh    = _mesh->dmMesh();assert(dmMesh);
-  const PetscInt numPoints = points.size();
   DMLabel        label;
   PetscErrorCode err;
 
@@ -150,6 +150,14 @@ protected :
    */
   void _setMaterials(const int_array& materialIds);
 
+  /** Tag cells in mesh with material identifiers.
+   *
+   * @param materialIds Array of material identifiers [numCells].
+   * @param numCells Number of cells.
+   */
+  void _setMaterials(const int* materialIds,
+		     const int numCells);
+
   /** Get material identifiers for cells.
    *
    * @param materialIds Material identifiers [numCells]
@@ -169,6 +177,21 @@ protected :
 		 const GroupPtType type,
 		 const int_array& points);
 
+  /** Build a point group
+   *
+   * The indices in the points array must use zero based indices. In
+   * other words, the lowest index MUST be 0 not 1.
+   *
+   * @param name The group name
+   * @param type The point type, e.g. VERTEX, CELL
+   * @param points Array of the points in the group.
+   * @param numPoints Number of points in the group.
+   */
+  void _setGroup(const std::string& name,
+		 const GroupPtType type,
+		 const int* points,
+		 const int numPoints);
+
   /** Get names of all groups in mesh.
    *
    * @returns Array of group names.
@@ -0,0 +1,488 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "MeshIOBinary.hh" // implementation of class methods
+
+#include "MeshBuilder.hh" // USES MeshBuilder
+#include "pylith/topology/Mesh.hh" // USES Mesh
+
+#include "pylith/utils/array.hh" // USES scalar_array, int_array, string_vector
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <petscdmplex.h> // USES DMPlexInvertCell()
+
+#include <cassert> // USES assert()
+#include <climits> // USES INT_MAX
+#include <cstring> // USES memcmp(), memchr(), memset(), strncpy()
+#include <fstream> // USES std::ofstream
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+#include <vector> // USES std::vector
+#include <stdint.h> // USES int32_t, int64_t
+#include <fcntl.h> // USES open()
+#include <sys/mman.h> // USES mmap(), munmap(), madvise()
+#include <sys/stat.h> // USES fstat()
+#include <unistd.h> // USES close()
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace meshio {
+    namespace _MeshIOBinary {
+
+      /// Magic string at start of file.
+      const char magic[8] = { 'P', 'Y', 'L', 'I', 'T', 'H', 'M', 'B' };
+
+      /// Version of file layout.
+      const int32_t version = 1;
+
+      /// Value used to detect byte order.
+      const int32_t byteOrderTag = 0x01020304;
+
+      /// Alignment (in bytes) of arrays in file.
+      const int64_t alignment = 64;
+
+      /// Header at start of file.
+      struct Header {
+	char magic[8]; ///< Magic string identifying file.
+	int32_t version; ///< Version of file layout.
+	int32_t byteOrder; ///< Byte order tag.
+	int32_t scalarSize; ///< Size of coordinates in bytes.
+	int32_t meshDim; ///< Dimension of cells.
+	int32_t spaceDim; ///< Dimension of coordinates.
+	int32_t numCorners; ///< Number of vertices in each cell.
+	int64_t numVertices; ///< Number of vertices.
+	int64_t numCells; ///< Number of cells.
+	int64_t numGroups; ///< Number of groups.
+	int64_t coordinatesOffset; ///< Offset of coordinates.
+	int64_t cellsOffset; ///< Offset of cells.
+	int64_t materialIdsOffset; ///< Offset of material identifiers.
+	int64_t groupsOffset; ///< Offset of group table.
+      }; // Header
+
+      /// Entry in group table.
+      struct GroupHeader {
+	char name[64]; ///< Name of group (null terminated).
+	int32_t type; ///< Type of points in group (GroupPtType).
+	int32_t reserved; ///< Padding.
+	int64_t numPoints; ///< Number of points in group.
+	int64_t pointsOffset; ///< Offset of points in group.
+      }; // GroupHeader
+
+      /// Read-only memory mapped file.
+      class MappedFile {
+      public :
+
+	/** Constructor.
+	 *
+	 * @param filename Name of file.
+	 */
+	MappedFile(const std::string& filename);
+
+	/// Destructor
+	~MappedFile(void);
+
+	/** Get contents of file.
+	 *
+	 * @returns Pointer to start of file.
+	 */
+	const char* data(void) const;
+
+	/** Get size of file.
+	 *
+	 * @returns Size of file in bytes.
+	 */
+	int64_t size(void) const;
+
+      private :
+
+	MappedFile(const MappedFile&); ///< Not implemented
+	const MappedFile& operator=(const MappedFile&); ///< Not implemented
+
+	void* _data; ///< Start of mapped memory.
+	int64_t _size; ///< Size of mapped memory.
+      }; // MappedFile
+
+      /** Check that array lies within file and is aligned.
+       *
+       * @param name Name of array.
+       * @param offset Offset of array in file.
+       * @param nbytes Size of array in bytes.
+       * @param fileSize Size of file in bytes.
+       */
+      void checkArray(const char* name,
+		      const int64_t offset,
+		      const int64_t nbytes,
+		      const int64_t fileSize);
+
+      /** Write array to file, starting at next aligned offset.
+       *
+       * @param fout Output stream.
+       * @param position Current position in file (updated).
+       * @param values Array of values.
+       * @param nbytes Size of array in bytes.
+       * @returns Offset of array in file.
+       */
+      int64_t writeArray(std::ofstream& fout,
+			 int64_t* position,
+			 const void* values,
+			 const int64_t nbytes);
+
+    } // _MeshIOBinary
+  } // meshio
+} // pylith
+
+// ----------------------------------------------------------------------
+// Constructor.
+pylith::meshio::_MeshIOBinary::MappedFile::MappedFile(const std::string& filename) :
+  _data(0),
+  _size(0)
+{ // constructor
+  const int fd = ::open(filename.c_str(), O_RDONLY);
+  if (fd < 0) {
+    std::ostringstream msg;
+    msg << "Could not open mesh file '" << filename << "' for reading.\n";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  struct stat info;
+  if (fstat(fd, &info) || info.st_size < off_t(sizeof(Header))) {
+    ::close(fd);
+    std::ostringstream msg;
+    msg << "Mesh file '" << filename << "' is too small to be a PyLith binary mesh file.\n";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  void* data = mmap(0, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd); // Mapping remains valid after closing file.
+  if (MAP_FAILED == data) {
+    std::ostringstream msg;
+    msg << "Could not map mesh file '" << filename << "' into memory.\n";
+    throw std::runtime_error(msg.str());
+  } // if
+  _data = data;
+  _size = info.st_size;
+
+#if defined(MADV_WILLNEED)
+  // Start reading the whole file; all of it is used to build the mesh.
+  madvise(_data, _size, MADV_WILLNEED);
+#endif
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor.
+pylith::meshio::_MeshIOBinary::MappedFile::~MappedFile(void)
+{ // destructor
+  if (_data) {
+    munmap(_data, _size);
+  } // if
+} // destructor
+
+// ----------------------------------------------------------------------
+// Get contents of file.
+const char*
+pylith::meshio::_MeshIOBinary::MappedFile::data(void) const
+{ // data
+  return static_cast<const char*>(_data);
+} // data
+
+// ----------------------------------------------------------------------
+// Get size of file.
+int64_t
+pylith::meshio::_MeshIOBinary::MappedFile::size(void) const
+{ // size
+  return _size;
+} // size
+
+// ----------------------------------------------------------------------
+// Check that array lies within file and is aligned.
+void
+pylith::meshio::_MeshIOBinary::checkArray(const char* name,
+					  const int64_t offset,
+					  const int64_t nbytes,
+					  const int64_t fileSize)
+{ // checkArray
+  if (offset < int64_t(sizeof(Header)) || nbytes < 0 || offset % alignment || offset + nbytes > fileSize) {
+    std::ostringstream msg;
+    msg << "Invalid location of " << name << " (offset " << offset << ", size " << nbytes
+	<< " bytes) in file with size " << fileSize << " bytes.";
+    throw std::runtime_error(msg.str());
+  } // if
+} // checkArray
+
+// ----------------------------------------------------------------------
+// Write array to file, starting at next aligned offset.
+int64_t
+pylith::meshio::_MeshIOBinary::writeArray(std::ofstream& fout,
+					  int64_t* position,
+					  const void* values,
+					  const int64_t nbytes)
+{ // writeArray
+  assert(position);
+
+  const char padding[alignment] = { 0 };
+  const int64_t offset = ((*position + alignment - 1) / alignment) * alignment;
+  fout.write(padding, offset - *position);
+  if (nbytes > 0) {
+    assert(values);
+    fout.write(static_cast<const char*>(values), nbytes);
+  } // if
+  *position = offset + nbytes;
+
+  return offset;
+} // writeArray
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::meshio::MeshIOBinary::MeshIOBinary(void) :
+  _filename("")
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::meshio::MeshIOBinary::~MeshIOBinary(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::meshio::MeshIOBinary::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  MeshIO::deallocate();
+
+  PYLITH_METHOD_END;
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Read mesh.
+void
+pylith::meshio::MeshIOBinary::_read(void)
+{ // _read
+  PYLITH_METHOD_BEGIN;
+
+  using namespace _MeshIOBinary;
+
+  assert(_mesh);
+  assert(sizeof(int) == sizeof(int32_t));
+
+  const int commRank = _mesh->commRank();
+  if (0 == commRank) {
+    try {
+      MappedFile file(_filename);
+      const char* data = file.data();
+      const int64_t fileSize = file.size();
+
+      const Header* header = reinterpret_cast<const Header*>(data);
+      if (memcmp(header->magic, magic, sizeof(magic))) {
+	throw std::runtime_error("File is not a PyLith binary mesh file.");
+      } // if
+      if (byteOrderTag != header->byteOrder) {
+	throw std::runtime_error("File was written on a machine with a different byte order. "
+				 "Regenerate it from the original mesh on this machine.");
+      } // if
+      if (version != header->version) {
+	std::ostringstream msg;
+	msg << "Unsupported version " << header->version << " of PyLith binary mesh file. "
+	    << "Expected version " << version << ".";
+	throw std::runtime_error(msg.str());
+      } // if
+      if (int32_t(sizeof(PylithScalar)) != header->scalarSize) {
+	std::ostringstream msg;
+	msg << "Size of coordinates in file (" << header->scalarSize << " bytes) does not match "
+	    << "size of PylithScalar (" << sizeof(PylithScalar) << " bytes).";
+	throw std::runtime_error(msg.str());
+      } // if
+      if (header->numVertices < 0 || header->numVertices > INT_MAX ||
+	  header->numCells < 0 || header->numCells > INT_MAX ||
+	  header->numGroups < 0 || header->numGroups > INT_MAX ||
+	  header->numCorners <= 0 || header->meshDim < 0 || header->spaceDim <= 0) {
+	throw std::runtime_error("Invalid sizes in header of PyLith binary mesh file.");
+      } // if
+
+      const int meshDim = header->meshDim;
+      const int spaceDim = header->spaceDim;
+      const int numCorners = header->numCorners;
+      const int numVertices = header->numVertices;
+      const int numCells = header->numCells;
+      const int numGroups = header->numGroups;
+
+      checkArray("coordinates", header->coordinatesOffset, int64_t(numVertices)*spaceDim*sizeof(PylithScalar), fileSize);
+      checkArray("cells", header->cellsOffset, int64_t(numCells)*numCorners*sizeof(int32_t), fileSize);
+      checkArray("material identifiers", header->materialIdsOffset, int64_t(numCells)*sizeof(int32_t), fileSize);
+      checkArray("group table", header->groupsOffset, int64_t(numGroups)*sizeof(GroupHeader), fileSize);
+
+      const PylithScalar* coordinates = reinterpret_cast<const PylithScalar*>(data + header->coordinatesOffset);
+      const int* cells = reinterpret_cast<const int*>(data + header->cellsOffset);
+      const int* materialIds = reinterpret_cast<const int*>(data + header->materialIdsOffset);
+      MeshBuilder::buildMesh(_mesh, coordinates, numVertices, spaceDim, cells, numCells, numCorners, meshDim, _interpolate);
+      _setMaterials(materialIds, numCells);
+
+      const GroupHeader* groups = reinterpret_cast<const GroupHeader*>(data + header->groupsOffset);
+      for (int iGroup=0; iGroup < numGroups; ++iGroup) {
+	const GroupHeader& group = groups[iGroup];
+	if (!memchr(group.name, '\0', sizeof(group.name))) {
+	  throw std::runtime_error("Name of group is not null terminated.");
+	} // if
+	if (group.type != VERTEX && group.type != CELL) {
+	  std::ostringstream msg;
+	  msg << "Unknown type " << group.type << " for points in group '" << group.name << "'.";
+	  throw std::runtime_error(msg.str());
+	} // if
+	if (group.numPoints < 0 || group.numPoints > INT_MAX) {
+	  std::ostringstream msg;
+	  msg << "Invalid number of points (" << group.numPoints << ") in group '" << group.name << "'.";
+	  throw std::runtime_error(msg.str());
+	} // if
+	checkArray(group.name, group.pointsOffset, group.numPoints*sizeof(int32_t), fileSize);
+
+	const int* points = reinterpret_cast<const int*>(data + group.pointsOffset);
+	_setGroup(group.name, GroupPtType(group.type), points, group.numPoints);
+      } // for
+    } catch (const std::exception& err) {
+      std::ostringstream msg;
+      msg << "Error occurred while reading PyLith binary mesh file '"
+	  << _filename << "'.\n"
+	  << err.what();
+      throw std::runtime_error(msg.str());
+    } catch (...) {
+      std::ostringstream msg;
+      msg << "Unknown I/O error while reading PyLith binary mesh file '"
+	  << _filename << "'.\n";
+      throw std::runtime_error(msg.str());
+    } // catch
+  } else {
+    MeshBuilder::buildMesh(_mesh, (const PylithScalar*)0, 0, 0, (const int*)0, 0, 0, 0, _interpolate);
+    _setMaterials((const int*)0, 0);
+  } // if/else
+  _distributeGroups();
+
+  PYLITH_METHOD_END;
+} // _read
+
+// ----------------------------------------------------------------------
+// Write mesh to file.
+void
+pylith::meshio::MeshIOBinary::_write(void) const
+{ // _write
+  PYLITH_METHOD_BEGIN;
+
+  using namespace _MeshIOBinary;
+
+  int spaceDim = 0;
+  int numVertices = 0;
+  scalar_array coordinates;
+  _getVertices(&coordinates, &numVertices, &spaceDim);
+
+  int numCells = 0;
+  int numCorners = 0;
+  int meshDim = 0;
+  int_array cells;
+  _getCells(&cells, &numCells, &numCorners, &meshDim);
+
+  // Store cells using PETSc ordering of vertices, so reading does
+  // not need to reorder them.
+  PetscErrorCode err = 0;
+  const int cellsSize = numCells*numCorners;
+  for (int coff=0; coff < cellsSize; coff += numCorners) {
+    err = DMPlexInvertCell(meshDim, numCorners, &cells[coff]);PYLITH_CHECK_ERROR(err);
+  } // for
+
+  int_array materialIds;
+  _getMaterials(&materialIds);
+
+  string_vector groupNames;
+  _getGroupNames(&groupNames);
+  const int numGroups = groupNames.size();
+
+  std::ofstream fout(_filename.c_str(), std::ios::out | std::ios::binary);
+  if (!fout.is_open() || !fout.good()) {
+    std::ostringstream msg;
+    msg << "Could not open mesh file '" << _filename
+	<< "' for writing.\n";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  Header header;
+  memset(&header, 0, sizeof(header));
+  memcpy(header.magic, magic, sizeof(magic));
+  header.version = version;
+  header.byteOrder = byteOrderTag;
+  header.scalarSize = sizeof(PylithScalar);
+  header.meshDim = meshDim;
+  header.spaceDim = spaceDim;
+  header.numCorners = numCorners;
+  header.numVertices = numVertices;
+  header.numCells = numCells;
+  header.numGroups = numGroups;
+
+  // Write placeholder for header; rewrite it once offsets are known.
+  fout.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  int64_t position = sizeof(header);
+
+  header.coordinatesOffset = writeArray(fout, &position, (coordinates.size() > 0) ? &coordinates[0] : 0,
+					coordinates.size()*sizeof(PylithScalar));
+  header.cellsOffset = writeArray(fout, &position, (cells.size() > 0) ? &cells[0] : 0,
+				  cells.size()*sizeof(int));
+  header.materialIdsOffset = writeArray(fout, &position, (materialIds.size() > 0) ? &materialIds[0] : 0,
+					materialIds.size()*sizeof(int));
+
+  std::vector<GroupHeader> groups(numGroups);
+  int_array points;
+  for (int iGroup=0; iGroup < numGroups; ++iGroup) {
+    const std::string& name = groupNames[iGroup];
+    GroupHeader& group = groups[iGroup];
+    if (name.length() >= sizeof(group.name)) {
+      std::ostringstream msg;
+      msg << "Name of group '" << name << "' is too long for PyLith binary mesh file (maximum of "
+	  << sizeof(group.name)-1 << " characters).";
+      throw std::runtime_error(msg.str());
+    } // if
+
+    GroupPtType type;
+    _getGroup(&points, &type, name.c_str());
+
+    memset(&group, 0, sizeof(group));
+    strncpy(group.name, name.c_str(), sizeof(group.name)-1);
+    group.type = type;
+    group.numPoints = points.size();
+    group.pointsOffset = writeArray(fout, &position, (points.size() > 0) ? &points[0] : 0,
+				    points.size()*sizeof(int));
+  } // for
+  header.groupsOffset = writeArray(fout, &position, (numGroups > 0) ? &groups[0] : 0,
+				   numGroups*sizeof(GroupHeader));
+
+  fout.seekp(0);
+  fout.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  if (!fout.good()) {
+    std::ostringstream msg;
+    msg << "Error occurred while writing PyLith binary mesh file '" << _filename << "'.\n";
+    throw std::runtime_error(msg.str());
+  } // if
+  fout.close();
+
+  PYLITH_METHOD_END;
+} // _write
+
+
+// End of file
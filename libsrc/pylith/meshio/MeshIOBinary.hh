@@ -0,0 +1,108 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/meshio/MeshIOBinary.hh
+ *
+ * @brief C++ input/output manager for PyLith binary mesh files.
+ *
+ * The binary mesh file is a flat image of the arrays used to build
+ * the mesh, so reading it requires no parsing. The file is memory
+ * mapped and the coordinates, cells, material identifiers, and
+ * groups are passed directly to MeshBuilder and the label setup
+ * without copying them into intermediate arrays.
+ *
+ * File layout (native byte order, all offsets are relative to the
+ * start of the file and aligned to 64 bytes):
+ *
+ *   header (magic "PYLITHMB", version, byte order tag, size of
+ *     scalars, mesh dimension, space dimension, number of corners,
+ *     number of vertices, number of cells, number of groups, offsets
+ *     of the arrays and group table)
+ *   coordinates [numVertices*spaceDim] (PylithScalar)
+ *   cells [numCells*numCorners] (int, zero based, PETSc ordering of
+ *     vertices in cells)
+ *   material identifiers [numCells] (int)
+ *   points in each group (int, zero based)
+ *   group table [numGroups] (name, type, number of points, offset)
+ *
+ * Because the cells are stored in the PETSc vertex ordering, the
+ * files are not interchangeable with the vertex ordering used in the
+ * ASCII files; use MeshIOBinary::write() (or the pylith_convertmesh
+ * utility) to create them.
+ */
+
+#if !defined(pylith_meshio_meshiobinary_hh)
+#define pylith_meshio_meshiobinary_hh
+
+// Include directives ---------------------------------------------------
+#include "MeshIO.hh" // ISA MeshIO
+
+#include <string> // HASA std::string
+
+// MeshIOBinary ---------------------------------------------------------
+/// C++ input/output manager for PyLith binary mesh files.
+class pylith::meshio::MeshIOBinary : public MeshIO
+{ // MeshIOBinary
+  friend class TestMeshIOBinary; // unit testing
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor
+  MeshIOBinary(void);
+
+  /// Destructor
+  ~MeshIOBinary(void);
+
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
+  /** Set filename for binary mesh file.
+   *
+   * @param filename Name of file
+   */
+  void filename(const char* name);
+
+  /** Get filename of binary mesh file.
+   *
+   * @returns Name of file
+   */
+  const char* filename(void) const;
+
+// PROTECTED METHODS ////////////////////////////////////////////////////
+protected :
+
+  /// Write mesh
+  void _write(void) const;
+
+  /// Read mesh
+  void _read(void);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  std::string _filename; ///< Name of file
+
+}; // MeshIOBinary
+
+#include "MeshIOBinary.icc" // inline methods
+
+#endif // pylith_meshio_meshiobinary_hh
+
+// End of file
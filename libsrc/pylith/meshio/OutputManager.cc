@@ -28,6 +28,8 @@
 #include "pylith/topology/Fields.hh" // USES Fields
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
+
+#include <cmath> // USES sqrt()
 #include <iostream> // USES std::cout
 
 // ----------------------------------------------------------------------
@@ -225,6 +227,77 @@ pylith::meshio::OutputManager::appendCellField(const PylithScalar t,
   PYLITH_METHOD_END;
 } // appendCellField
 
+// ----------------------------------------------------------------------
+// Get maximum magnitude of the values at a point in a field over all
+// processes.
+PylithScalar
+pylith::meshio::OutputManager::fieldMaxMagnitude(const topology::Field& field) const
+{ // fieldMaxMagnitude
+  PYLITH_METHOD_BEGIN;
+
+  PetscSection section = field.localSection();assert(section);
+  PetscVec vec = field.localVector();assert(vec);
+  PetscInt pStart = 0, pEnd = 0;
+  PetscErrorCode err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+  const PetscScalar* array = NULL;
+  err = VecGetArrayRead(vec, &array);PYLITH_CHECK_ERROR(err);
+  PylithScalar maxMagSqLocal = 0.0;
+  for (PetscInt p = pStart; p < pEnd; ++p) {
+    PetscInt dof = 0, off = 0;
+    err = PetscSectionGetDof(section, p, &dof);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetOffset(section, p, &off);PYLITH_CHECK_ERROR(err);
+    PylithScalar magSq = 0.0;
+    for (PetscInt d = 0; d < dof; ++d)
+      magSq += array[off+d]*array[off+d];
+    if (magSq > maxMagSqLocal)
+      maxMagSqLocal = magSq;
+  } // for
+  err = VecRestoreArrayRead(vec, &array);PYLITH_CHECK_ERROR(err);
+
+  PylithScalar maxMagSq = 0.0;
+  err = MPI_Allreduce(&maxMagSqLocal, &maxMagSq, 1, MPIU_SCALAR, MPI_MAX, field.mesh().comm());PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_RETURN(sqrt(maxMagSq) * field.scale());
+} // fieldMaxMagnitude
+
+// ----------------------------------------------------------------------
+// Get L2 norm of a field over all processes.
+PylithScalar
+pylith::meshio::OutputManager::fieldNorm(const topology::Field& field) const
+{ // fieldNorm
+  PYLITH_METHOD_BEGIN;
+
+  PetscSection section = field.localSection();assert(section);
+  PetscSection globalSection = field.globalSection();assert(globalSection);
+  PetscVec vec = field.localVector();assert(vec);
+  PetscInt pStart = 0, pEnd = 0;
+  PetscErrorCode err = PetscSectionGetChart(section, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+
+  // Only include points owned by this process so that shared points
+  // are counted once.
+  const PetscScalar* array = NULL;
+  err = VecGetArrayRead(vec, &array);PYLITH_CHECK_ERROR(err);
+  PylithScalar normSqLocal = 0.0;
+  for (PetscInt p = pStart; p < pEnd; ++p) {
+    PetscInt goff = 0;
+    err = PetscSectionGetOffset(globalSection, p, &goff);PYLITH_CHECK_ERROR(err);
+    if (goff < 0)
+      continue;
+    PetscInt dof = 0, off = 0;
+    err = PetscSectionGetDof(section, p, &dof);PYLITH_CHECK_ERROR(err);
+    err = PetscSectionGetOffset(section, p, &off);PYLITH_CHECK_ERROR(err);
+    for (PetscInt d = 0; d < dof; ++d)
+      normSqLocal += array[off+d]*array[off+d];
+  } // for
+  err = VecRestoreArrayRead(vec, &array);PYLITH_CHECK_ERROR(err);
+
+  PylithScalar normSq = 0.0;
+  err = MPI_Allreduce(&normSqLocal, &normSq, 1, MPIU_SCALAR, MPI_SUM, field.mesh().comm());PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_RETURN(sqrt(normSq) * field.scale());
+} // fieldNorm
+
 // ----------------------------------------------------------------------
 // Dimension field.
 pylith::topology::Field&
@@ -143,6 +143,24 @@ public :
 		       const char* label =0,
 		       const int labelId =0);
 
+  /** Get maximum magnitude of the values at a point in a field over
+   * all processes. Used by adaptive output triggers to decide whether
+   * to write the field without writing it.
+   *
+   * @param field Nondimensional field.
+   * @returns Maximum magnitude (dimensional).
+   */
+  PylithScalar fieldMaxMagnitude(const topology::Field& field) const;
+
+  /** Get L2 norm of a field over all processes. Used by adaptive
+   * output triggers to detect changes in the field since the last
+   * write.
+   *
+   * @param field Nondimensional field.
+   * @returns L2 norm (dimensional).
+   */
+  PylithScalar fieldNorm(const topology::Field& field) const;
+
 // PROTECTED METHODS ////////////////////////////////////////////////////
 protected :
 
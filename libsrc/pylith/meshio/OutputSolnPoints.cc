@@ -32,12 +32,16 @@
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
 // ----------------------------------------------------------------------
 // Constructor
 pylith::meshio::OutputSolnPoints::OutputSolnPoints(void) :
     _mesh(0),
     _pointsMesh(0),
-    _interpolator(0)
+    _interpolator(0),
+    _bufferSteps(1)
 { // constructor
 } // constructor
 
@@ -63,6 +67,7 @@ pylith::meshio::OutputSolnPoints::deallocate(void)
 
     _mesh = 0; // :TODO: Use shared pointer
     delete _pointsMesh; _pointsMesh = 0;
+    _buffers.clear();
 
     PYLITH_METHOD_END;
 } // deallocate
@@ -79,6 +84,33 @@ pylith::meshio::OutputSolnPoints::pointsMesh(void)
 } // pointsMesh
 
 
+// ----------------------------------------------------------------------
+// Set number of time steps to buffer in memory before writing.
+void
+pylith::meshio::OutputSolnPoints::bufferSteps(const int value)
+{ // bufferSteps
+    PYLITH_METHOD_BEGIN;
+
+    if (value < 1) {
+        std::ostringstream msg;
+        msg << "Number of time steps to buffer (" << value << ") must be positive.";
+        throw std::runtime_error(msg.str());
+    } // if
+    _bufferSteps = value;
+
+    PYLITH_METHOD_END;
+} // bufferSteps
+
+
+// ----------------------------------------------------------------------
+// Get number of time steps to buffer in memory before writing.
+int
+pylith::meshio::OutputSolnPoints::bufferSteps(void) const
+{ // bufferSteps
+    return _bufferSteps;
+} // bufferSteps
+
+
 // ----------------------------------------------------------------------
 // Setup interpolator.
 void
@@ -208,6 +240,25 @@ pylith::meshio::OutputSolnPoints::open(const topology::Mesh& mesh,
 } // open
 
 
+// ----------------------------------------------------------------------
+// Write any buffered time steps and close output files.
+void
+pylith::meshio::OutputSolnPoints::close(void)
+{ // close
+    PYLITH_METHOD_BEGIN;
+
+    // Iterate in key order, which is the same on all processes.
+    for (std::map<std::string, StepsBuffer>::const_iterator iter=_buffers.begin(); iter != _buffers.end(); ++iter) {
+        _flushBuffer(iter->first);
+    } // for
+    _buffers.clear();
+
+    OutputManager::close();
+
+    PYLITH_METHOD_END;
+} // close
+
+
 // ----------------------------------------------------------------------
 // Setup file for writing fields at time step.
 void
@@ -271,6 +322,7 @@ pylith::meshio::OutputSolnPoints::appendVertexField(const PylithScalar t,
     PetscInt reallocateGlobal = 0;
     err = MPI_Allreduce(&reallocate, &reallocateGlobal, 1, MPIU_INT, MPI_LOR, fieldInterp.mesh().comm()); PYLITH_CHECK_ERROR(err);
     if (reallocateGlobal) {
+        _flushBuffer(fieldName);
         fieldInterp.newSection(topology::FieldBase::VERTICES_FIELD, fiberDim);
         fieldInterp.allocate();
     } // if
@@ -294,7 +346,31 @@ pylith::meshio::OutputSolnPoints::appendVertexField(const PylithScalar t,
     err = DMInterpolationEvaluate(_interpolator, dmMesh, field.localVector(), fieldInterp.localVector()); PYLITH_CHECK_ERROR(err);
 #endif
 
-    OutputManager::appendVertexField(t, fieldInterp, *_pointsMesh);
+    assert(_writer);
+    if (_bufferSteps > 1 && !_vertexFilter && _writer->bufferStepsOkay()) {
+        // Save dimensioned values; write them once buffer is full.
+        topology::Field& fieldDimensioned = _dimension(fieldInterp);
+        PetscVec localVec = fieldDimensioned.localVector(); assert(localVec);
+        PetscInt localSize = 0;
+        err = VecGetLocalSize(localVec, &localSize); PYLITH_CHECK_ERROR(err);
+        const PetscScalar* localArray = NULL;
+        err = VecGetArrayRead(localVec, &localArray); PYLITH_CHECK_ERROR(err);
+
+        StepsBuffer& buffer = _buffers[fieldName];
+        if (buffer.times.empty()) {
+            buffer.times.reserve(_bufferSteps);
+            buffer.values.reserve(_bufferSteps*localSize);
+        } // if
+        buffer.times.push_back(t);
+        buffer.values.insert(buffer.values.end(), localArray, localArray+localSize);
+        err = VecRestoreArrayRead(localVec, &localArray); PYLITH_CHECK_ERROR(err);
+
+        if (int(buffer.times.size()) >= _bufferSteps) {
+            _flushBuffer(fieldName);
+        } // if
+    } else {
+        OutputManager::appendVertexField(t, fieldInterp, *_pointsMesh);
+    } // if/else
 
     PYLITH_METHOD_END;
 } // appendVertexField
@@ -324,4 +400,29 @@ pylith::meshio::OutputSolnPoints::writePointNames(void)
     PYLITH_METHOD_END;
 } // writePointNames
 
+// ----------------------------------------------------------------------
+// Write buffered time steps for field.
+void
+pylith::meshio::OutputSolnPoints::_flushBuffer(const std::string& fieldName)
+{ // _flushBuffer
+    PYLITH_METHOD_BEGIN;
+
+    std::map<std::string, StepsBuffer>::iterator iter = _buffers.find(fieldName);
+    if (iter == _buffers.end() || iter->second.times.empty()) {
+        PYLITH_METHOD_END;
+    } // if
+
+    assert(_writer);
+    assert(_fields);
+    StepsBuffer& buffer = iter->second;
+    topology::Field& fieldInterp = _fields->get(fieldName.c_str());
+    const PylithScalar* values = (!buffer.values.empty()) ? &buffer.values[0] : NULL;
+    _writer->writeVertexFieldSteps(&buffer.times[0], buffer.times.size(), values, fieldInterp, *_pointsMesh);
+
+    buffer.times.clear();
+    buffer.values.clear();
+
+    PYLITH_METHOD_END;
+} // _flushBuffer
+
 // End of file
@@ -36,6 +36,10 @@
 #include "pylith/topology/Field.hh" // ISA OutputManager<Field<Mesh>>
 #include "OutputManager.hh" // ISA OutputManager
 
+#include <map> // HASA std::map
+#include <vector> // USES std::vector
+#include <string> // USES std::string
+
 // OutputSolnPoints -----------------------------------------------------
 /** @brief C++ object for managing output of finite-element data over
  * a subdomain.
@@ -62,6 +66,21 @@ void deallocate(void);
  */
 const pylith::topology::Mesh& pointsMesh(void);
 
+/** Set number of time steps to buffer in memory before writing.
+ *
+ * Buffered time steps are written with a single write per field. A
+ * value of 1 writes each time step as it is computed.
+ *
+ * @param value Number of time steps.
+ */
+void bufferSteps(const int value);
+
+/** Get number of time steps to buffer in memory before writing.
+ *
+ * @returns Number of time steps.
+ */
+int bufferSteps(void) const;
+
 /** Setup interpolator.
  *
  * @param mesh Domain mesh.
@@ -93,6 +112,9 @@ void open(const pylith::topology::Mesh& mesh,
           const char* label =0,
           const int labelId =0);
 
+/// Write any buffered time steps and close output files.
+void close(void);
+
 /** Setup file for writing fields at time step.
  *
  * @param t Time of time step.
@@ -133,6 +155,24 @@ void appendCellField(const PylithScalar t,
  */
 void writePointNames(void);
 
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private:
+
+/** Write buffered time steps for field.
+ *
+ * @param fieldName Name of interpolated field.
+ */
+void _flushBuffer(const std::string& fieldName);
+
+// PRIVATE STRUCTS //////////////////////////////////////////////////////
+private:
+
+/// Interpolated values of a field at buffered time steps.
+struct StepsBuffer {
+    std::vector<PylithScalar> times; ///< Time of each buffered step.
+    std::vector<PylithScalar> values; ///< Local values [numSteps*localSize].
+}; // StepsBuffer
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private:
 
@@ -146,6 +186,8 @@ pylith::topology::Mesh* _mesh;   ///< Domain mesh.
 pylith::topology::Mesh* _pointsMesh;   ///< Mesh for points (no cells).
 DMInterpolationInfo _interpolator;   ///< Field interpolator.
 pylith::string_vector _stations; ///< Array of station names.
+std::map<std::string, StepsBuffer> _buffers; ///< Buffered time steps for each field.
+int _bufferSteps; ///< Number of time steps to buffer before writing.
 
 }; // OutputSolnPoints
 
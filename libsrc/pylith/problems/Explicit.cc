@@ -28,8 +28,13 @@
 
 // ----------------------------------------------------------------------
 // Constructor
-pylith::problems::Explicit::Explicit(void)
+pylith::problems::Explicit::Explicit(void) :
+  _rateDt(0.0)
 { // constructor
+  for (int i=0; i < 5; ++i) {
+    _rateVecs[i] = NULL;
+    _rateStates[i] = -1;
+  } // for
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -47,74 +52,158 @@ pylith::problems::Explicit::calcRateFields(void)
 
   assert(_fields);
 
-  // vel(t) = (disp(t+dt) - disp(t-dt)) / (2*dt)
-  //        = (dispIncr(t+dt) + disp(t) - disp(t-dt)) / (2*dt)
-  //
-  // acc(t) = (disp(t+dt) - 2*disp(t) + disp(t-dt)) / (dt*dt)
-  //        = (dispIncr(t+dt) - disp(t) + disp(t-dt)) / (dt*dt)
-
-  const PylithScalar dt = _dt;
-  const PylithScalar dt2 = dt*dt;
-  const PylithScalar twodt = 2.0*dt;
-
-  topology::Field& dispIncr = _fields->get("dispIncr(t->t+dt)");
-  const spatialdata::geocoords::CoordSys* cs = dispIncr.mesh().coordsys();assert(cs);
-  const int spaceDim = cs->spaceDim();
-
-  // Get sections.
-  topology::VecVisitorMesh dispIncrVisitor(dispIncr);
-  PetscScalar* dispIncrArray = dispIncrVisitor.localArray();
-
-  topology::Field& dispT = _fields->get("disp(t)");
-  topology::VecVisitorMesh dispTVisitor(dispT);
-  PetscScalar* dispTArray = dispTVisitor.localArray();
-
-  topology::Field& dispTmdt = _fields->get("disp(t-dt)");
-  topology::VecVisitorMesh dispTmdtVisitor(dispTmdt);
-  PetscScalar* dispTmdtArray = dispTmdtVisitor.localArray();
-
-  topology::Field& velocity = _fields->get("velocity(t)");
-  topology::VecVisitorMesh velVisitor(velocity);
-  PetscScalar* velArray = velVisitor.localArray();
+  const int numRateVecs = 5;
+  const char* rateFieldNames[numRateVecs] = {
+    "dispIncr(t->t+dt)",
+    "disp(t)",
+    "disp(t-dt)",
+    "velocity(t)",
+    "acceleration(t)",
+  };
+
+  // Skip computation if nothing has changed since the last call (for
+  // example, when the solver calls this more than once per time
+  // step). Check handles as well as states, because shifting the
+  // displacement history swaps the vectors.
+  PetscErrorCode err = 0;
+  bool isCurrent = (_dt == _rateDt);
+  for (int i=0; i < numRateVecs && isCurrent; ++i) {
+    const PetscVec vec = _fields->get(rateFieldNames[i]).localVector();
+    PetscObjectState state = 0;
+    err = PetscObjectStateGet((PetscObject) vec, &state);PYLITH_CHECK_ERROR(err);
+    isCurrent = (vec == _rateVecs[i] && state == _rateStates[i]);
+  } // for
+  if (isCurrent) {
+    PYLITH_METHOD_END;
+  } // if
+
+  { // Compute rate fields; visitors release arrays at end of scope.
+    // vel(t) = (disp(t+dt) - disp(t-dt)) / (2*dt)
+    //        = (dispIncr(t+dt) + disp(t) - disp(t-dt)) / (2*dt)
+    //
+    // acc(t) = (disp(t+dt) - 2*disp(t) + disp(t-dt)) / (dt*dt)
+    //        = (dispIncr(t+dt) - disp(t) + disp(t-dt)) / (dt*dt)
+
+    const PylithScalar dt = _dt;
+    const PylithScalar dt2 = dt*dt;
+    const PylithScalar twodt = 2.0*dt;
+
+    topology::Field& dispIncr = _fields->get("dispIncr(t->t+dt)");
+    const spatialdata::geocoords::CoordSys* cs = dispIncr.mesh().coordsys();assert(cs);
+    const int spaceDim = cs->spaceDim();
+
+    // Get sections.
+    topology::VecVisitorMesh dispIncrVisitor(dispIncr);
+    PetscScalar* dispIncrArray = dispIncrVisitor.localArray();
+
+    topology::Field& dispT = _fields->get("disp(t)");
+    topology::VecVisitorMesh dispTVisitor(dispT);
+    PetscScalar* dispTArray = dispTVisitor.localArray();
+
+    topology::Field& dispTmdt = _fields->get("disp(t-dt)");
+    topology::VecVisitorMesh dispTmdtVisitor(dispTmdt);
+    PetscScalar* dispTmdtArray = dispTmdtVisitor.localArray();
+
+    topology::Field& velocity = _fields->get("velocity(t)");
+    topology::VecVisitorMesh velVisitor(velocity);
+    PetscScalar* velArray = velVisitor.localArray();
+
+    topology::Field& acceleration = _fields->get("acceleration(t)");
+    topology::VecVisitorMesh accVisitor(acceleration);
+    PetscScalar* accArray = accVisitor.localArray();
+
+    // Get mesh vertices.
+    PetscDM dmMesh = dispIncr.mesh().dmMesh();assert(dmMesh);
+    topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+    const PetscInt vStart = verticesStratum.begin();
+    const PetscInt vEnd = verticesStratum.end();
+
+    for(PetscInt v = vStart; v < vEnd; ++v) {
+      const PetscInt dioff = dispIncrVisitor.sectionOffset(v);
+      assert(spaceDim == dispIncrVisitor.sectionDof(v));
+
+      const PetscInt dtoff = dispTVisitor.sectionOffset(v);
+      assert(spaceDim == dispTVisitor.sectionDof(v));
+
+      const PetscInt dmoff = dispTmdtVisitor.sectionOffset(v);
+      assert(spaceDim == dispTmdtVisitor.sectionDof(v));
+
+      const PetscInt voff = velVisitor.sectionOffset(v);
+      assert(spaceDim == velVisitor.sectionDof(v));
+
+      const PetscInt aoff = accVisitor.sectionOffset(v);
+      assert(spaceDim == accVisitor.sectionDof(v));
+
+      // TODO: I am not sure why these were updateAll() before, but if BCs need to be changed, then
+      // the global update will probably need to be modified
+      for (PetscInt i = 0; i < spaceDim; ++i) {
+        velArray[voff+i] = (dispIncrArray[dioff+i] + dispTArray[dtoff+i] - dispTmdtArray[dmoff+i]) / twodt;
+        accArray[aoff+i] = (dispIncrArray[dioff+i] - dispTArray[dtoff+i] + dispTmdtArray[dmoff+i]) / dt2;
+      } // for
+    } // for
 
-  topology::Field& acceleration = _fields->get("acceleration(t)");
-  topology::VecVisitorMesh accVisitor(acceleration);
-  PetscScalar* accArray = accVisitor.localArray();
+    PetscLogFlops((vEnd - vStart) * 6*spaceDim);
+  } // Compute rate fields
 
-  // Get mesh vertices.
-  PetscDM dmMesh = dispIncr.mesh().dmMesh();assert(dmMesh);
-  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
-  const PetscInt vStart = verticesStratum.begin();
-  const PetscInt vEnd = verticesStratum.end();
+  // Record handles and states after the arrays have been restored.
+  for (int i=0; i < numRateVecs; ++i) {
+    const PetscVec vec = _fields->get(rateFieldNames[i]).localVector();
+    PetscObjectState state = 0;
+    err = PetscObjectStateGet((PetscObject) vec, &state);PYLITH_CHECK_ERROR(err);
+    _rateVecs[i] = vec;
+    _rateStates[i] = state;
+  } // for
+  _rateDt = _dt;
 
-  for(PetscInt v = vStart; v < vEnd; ++v) {
-    const PetscInt dioff = dispIncrVisitor.sectionOffset(v);
-    assert(spaceDim == dispIncrVisitor.sectionDof(v));
+  PYLITH_METHOD_END;
+} // calcRateFields
 
-    const PetscInt dtoff = dispTVisitor.sectionOffset(v);
-    assert(spaceDim == dispTVisitor.sectionDof(v));
+// ----------------------------------------------------------------------
+// Advance displacement fields from time t to time t+dt.
+void
+pylith::problems::Explicit::advanceDisplacement(void)
+{ // advanceDisplacement
+  PYLITH_METHOD_BEGIN;
 
-    const PetscInt dmoff = dispTmdtVisitor.sectionOffset(v);
-    assert(spaceDim == dispTmdtVisitor.sectionDof(v));
+  assert(_fields);
 
-    const PetscInt voff = velVisitor.sectionOffset(v);
-    assert(spaceDim == velVisitor.sectionDof(v));
+  // Storage of disp(t-dt) becomes disp(t) and vice versa.
+  _fields->shiftHistory();
 
-    const PetscInt aoff = accVisitor.sectionOffset(v);
-    assert(spaceDim == accVisitor.sectionDof(v));
+  // disp(t+dt) = disp(t) + dispIncr(t->t+dt), written into the
+  // storage that held disp(t-dt), with dispIncr zeroed in the same
+  // sweep. All fields share the same layout, so operate on the local
+  // arrays directly.
+  topology::Field& dispIncr = _fields->get("dispIncr(t->t+dt)");
+  const topology::Field& dispTmdt = _fields->get("disp(t-dt)");
+  topology::Field& dispT = _fields->get("disp(t)");
 
-    // TODO: I am not sure why these were updateAll() before, but if BCs need to be changed, then
-    // the global update will probably need to be modified
-    for (PetscInt i = 0; i < spaceDim; ++i) {
-      velArray[voff+i] = (dispIncrArray[dioff+i] + dispTArray[dtoff+i] - dispTmdtArray[dmoff+i]) / twodt;
-      accArray[aoff+i] = (dispIncrArray[dioff+i] - dispTArray[dtoff+i] + dispTmdtArray[dmoff+i]) / dt2;
-    } // for
+  PetscErrorCode err = 0;
+  PetscInt size = 0;
+  err = VecGetLocalSize(dispT.localVector(), &size);PYLITH_CHECK_ERROR(err);
+  assert(dispIncr.sectionSize() == size);
+  assert(dispTmdt.sectionSize() == size);
+
+  PetscScalar* dispIncrArray = NULL;
+  PetscScalar* dispTArray = NULL;
+  const PetscScalar* dispTmdtArray = NULL;
+  err = VecGetArray(dispIncr.localVector(), &dispIncrArray);PYLITH_CHECK_ERROR(err);
+  err = VecGetArray(dispT.localVector(), &dispTArray);PYLITH_CHECK_ERROR(err);
+  err = VecGetArrayRead(dispTmdt.localVector(), &dispTmdtArray);PYLITH_CHECK_ERROR(err);
+
+  for (PetscInt i=0; i < size; ++i) {
+    dispTArray[i] = dispTmdtArray[i] + dispIncrArray[i];
+    dispIncrArray[i] = 0.0;
   } // for
 
-  PetscLogFlops((vEnd - vStart) * 6*spaceDim);
+  err = VecRestoreArrayRead(dispTmdt.localVector(), &dispTmdtArray);PYLITH_CHECK_ERROR(err);
+  err = VecRestoreArray(dispT.localVector(), &dispTArray);PYLITH_CHECK_ERROR(err);
+  err = VecRestoreArray(dispIncr.localVector(), &dispIncrArray);PYLITH_CHECK_ERROR(err);
+
+  PetscLogFlops(size);
 
   PYLITH_METHOD_END;
-} // calcRateFields
+} // advanceDisplacement
 
 
 // End of file
@@ -47,9 +47,31 @@ public :
   /// Destructor
   ~Explicit(void);
 
-  /// Compute rate fields (velocity and/or acceleration) at time t.
+  /** Compute rate fields (velocity and/or acceleration) at time t.
+   *
+   * The computation is skipped if the displacement fields, rate
+   * fields, and time step have not changed since the last call.
+   */
   void calcRateFields(void);
 
+  /** Advance displacement fields from time t to time t+dt.
+   *
+   * Shifts the displacement history so disp(t) becomes disp(t-dt)
+   * and the storage of the old disp(t-dt) holds the new disp(t) =
+   * disp(t) + dispIncr(t->t+dt). The increment is zeroed in the same
+   * sweep.
+   */
+  void advanceDisplacement(void);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  /// Vectors (dispIncr, disp(t), disp(t-dt), velocity, acceleration)
+  /// when rate fields were last computed.
+  PetscVec _rateVecs[5];
+  long long _rateStates[5]; ///< PETSc object states of vectors in _rateVecs.
+  PylithScalar _rateDt; ///< Time step when rate fields were last computed.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
@@ -29,6 +29,9 @@
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 #include <cassert> // USES assert()
+#include <algorithm> // USES std::max()
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
 
 // ----------------------------------------------------------------------
 // Constructor
@@ -40,8 +43,18 @@ pylith::problems::Formulation::Formulation(void) :
   _jacobianLumped(0),
   _fields(0),
   _isJacobianSymmetric(false),
-  _splitFields(false)
+  _splitFields(false),
+  _nonzeroInitialGuess(false),
+  _numJacobianReforms(0)
 { // constructor
+  _jacobianLag.maxSteps = 0;
+  _jacobianLag.iterationsRatio = 2.0;
+  _jacobianLag.dtRatio = 1.25;
+  _jacobianLag.dtReform = 0.0;
+  _jacobianLag.numStepsLagged = 0;
+  _jacobianLag.iterationsReform = -1;
+  _jacobianLag.iterationsLast = 0;
+  _jacobianLag.isLagged = false;
 } // constructor
 
 // ----------------------------------------------------------------------
@@ -136,6 +149,19 @@ pylith::problems::Formulation::integrators(feassemble::Integrator* integratorArr
     _integrators[i] = integratorArray[i];
 } // integrators
   
+// ----------------------------------------------------------------------
+// Set constraints over the mesh.
+void
+pylith::problems::Formulation::constraints(feassemble::Constraint* constraintArray[],
+					   const int numConstraints)
+{ // constraints
+  assert( (!constraintArray && 0 == numConstraints) ||
+	  (constraintArray && 0 < numConstraints) );
+  _constraints.resize(numConstraints);
+  for (int i=0; i < numConstraints; ++i)
+    _constraints[i] = constraintArray[i];
+} // constraints
+  
 // ----------------------------------------------------------------------
 // Set handle to preconditioner.
 void
@@ -149,6 +175,115 @@ pylith::problems::Formulation::customPCMatrix(PetscMat& mat)
 #endif
 } // preconditioner
 
+// ----------------------------------------------------------------------
+// Set parameters for lagging the preconditioner.
+void
+pylith::problems::Formulation::jacobianLag(const int maxSteps,
+					   const PylithScalar iterationsRatio,
+					   const PylithScalar dtRatio)
+{ // jacobianLag
+  PYLITH_METHOD_BEGIN;
+
+  if (maxSteps < 0) {
+    std::ostringstream msg;
+    msg << "Maximum number of time steps to lag preconditioner (" << maxSteps << ") must be nonnegative.";
+    throw std::runtime_error(msg.str());
+  } // if
+  if (iterationsRatio < 1.0) {
+    std::ostringstream msg;
+    msg << "Ratio of solver iterations for setting up preconditioner (" << iterationsRatio << ") must be at least 1.0.";
+    throw std::runtime_error(msg.str());
+  } // if
+  if (dtRatio < 1.0) {
+    std::ostringstream msg;
+    msg << "Ratio of time steps for setting up preconditioner (" << dtRatio << ") must be at least 1.0.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  _jacobianLag.maxSteps = maxSteps;
+  _jacobianLag.iterationsRatio = iterationsRatio;
+  _jacobianLag.dtRatio = dtRatio;
+
+  PYLITH_METHOD_END;
+} // jacobianLag
+
+// ----------------------------------------------------------------------
+// Determine whether to set up a new preconditioner for the upcoming
+// time step.
+bool
+pylith::problems::Formulation::needNewPreconditioner(const bool integratorsNeedNew,
+						     const PylithScalar dt)
+{ // needNewPreconditioner
+  PYLITH_METHOD_BEGIN;
+
+  assert(dt > 0.0);
+
+  // The preconditioner is out of date if the Jacobian is reformed in
+  // this time step or was reformed while the preconditioner was lagged.
+  JacobianLag& lag = _jacobianLag;
+  const bool isOutOfDate = integratorsNeedNew || lag.isLagged;
+  bool reform = isOutOfDate;
+  if (isOutOfDate && lag.maxSteps > 0 && lag.dtReform > 0.0) {
+    // Reuse the preconditioner unless one of the reform criteria is met.
+    const PylithScalar dtRatio = dt / lag.dtReform;
+    const int iterationsRef = std::max(lag.iterationsReform, 1);
+    reform = 
+      lag.numStepsLagged >= lag.maxSteps ||
+      dtRatio > lag.dtRatio || dtRatio*lag.dtRatio < 1.0 ||
+      (lag.iterationsReform >= 0 && lag.iterationsLast > lag.iterationsRatio*iterationsRef);
+  } // if
+
+  if (reform) {
+    lag.dtReform = dt;
+    lag.numStepsLagged = 0;
+    lag.iterationsReform = -1;
+    lag.isLagged = false;
+  } else {
+    lag.isLagged = isOutOfDate;
+    if (lag.isLagged) {
+      ++lag.numStepsLagged;
+    } // if
+  } // if/else
+
+  PYLITH_METHOD_RETURN(reform);
+} // needNewPreconditioner
+
+// ----------------------------------------------------------------------
+// Get flag indicating the preconditioner is being reused in the
+// current time step.
+bool
+pylith::problems::Formulation::lagPreconditioner(void) const
+{ // lagPreconditioner
+  return _jacobianLag.isLagged;
+} // lagPreconditioner
+
+// ----------------------------------------------------------------------
+// Get flag indicating the solution holds an initial guess for the solve.
+bool
+pylith::problems::Formulation::nonzeroInitialGuess(void) const
+{ // nonzeroInitialGuess
+  return _nonzeroInitialGuess;
+} // nonzeroInitialGuess
+
+// ----------------------------------------------------------------------
+// Record number of solver iterations for current time step.
+void
+pylith::problems::Formulation::solverIterations(const int numIterations)
+{ // solverIterations
+  _jacobianLag.iterationsLast = numIterations;
+  if (_jacobianLag.iterationsReform < 0) {
+    _jacobianLag.iterationsReform = numIterations;
+  } // if
+} // solverIterations
+
+// ----------------------------------------------------------------------
+// Get number of times the Jacobian has been reformed.
+int
+pylith::problems::Formulation::numJacobianReforms(void) const
+{ // numJacobianReforms
+  return _numJacobianReforms;
+} // numJacobianReforms
+
 // ----------------------------------------------------------------------
 // Update handles and parameters for reforming the Jacobian and
 // residual.
@@ -276,6 +411,7 @@ pylith::problems::Formulation::reformJacobian(const PetscVec* tmpSolutionVec)
     MatView(_customConstraintPCMat, PETSC_VIEWER_STDOUT_WORLD);
 #endif
   } // if
+  ++_numJacobianReforms;
 
   PYLITH_METHOD_END;
 } // reformJacobian
@@ -301,6 +437,7 @@ pylith::problems::Formulation::reformJacobianLumped(void)
   
   // Assemble jacbian.
   _jacobianLumped->complete();
+  ++_numJacobianReforms;
 
   PYLITH_METHOD_END;
 } // reformJacobianLumped
@@ -29,7 +29,7 @@
 // Include directives ---------------------------------------------------
 #include "problemsfwd.hh" // forward declarations
 
-#include "pylith/feassemble/feassemblefwd.hh" // USES Integrator
+#include "pylith/feassemble/feassemblefwd.hh" // USES Integrator, Constraint
 #include "pylith/topology/topologyfwd.hh" // USES Mesh, Field, SolutionFields
 
 #include "pylith/utils/petscfwd.h" // USES PetscVec, PetscMat
@@ -99,12 +99,77 @@ public :
   void integrators(feassemble::Integrator* integratorArray[] ,
 		   const int numIntegrators);
   
+  /** Set handles to constraints.
+   *
+   * @param constraintArray Array of constraints.
+   * @param numConstraints Number of constraints.
+   */
+  void constraints(feassemble::Constraint* constraintArray[] ,
+		   const int numConstraints);
+  
   /** Set handle to preconditioner.
    *
    * @param pc PETSc preconditioner.
    */
   void customPCMatrix(PetscMat& mat);
 
+  /** Set parameters for lagging the preconditioner over several time
+   * steps. The Jacobian itself is always reformed when the integrators
+   * request it, because it is the operator in the linear solve; only
+   * the preconditioner built from it is reused.
+   *
+   * @param maxSteps Maximum number of time steps to reuse preconditioner
+   * (0 disables lagging).
+   * @param iterationsRatio Reform when the number of solver iterations
+   * exceeds this ratio times the number of iterations in the first
+   * solve after the last reform.
+   * @param dtRatio Reform when the time step differs from the time
+   * step used in the last reform by more than this ratio.
+   */
+  void jacobianLag(const int maxSteps,
+		   const PylithScalar iterationsRatio,
+		   const PylithScalar dtRatio);
+
+  /** Determine whether to set up a new preconditioner for the
+   * upcoming time step using the lagging policy.
+   *
+   * The arguments must be the same on all processes (reduce the
+   * integrator flags before calling).
+   *
+   * @param integratorsNeedNew True if any integrator requests a new Jacobian.
+   * @param dt Time step (nondimensional).
+   * @returns True if the preconditioner should be set up from the
+   * reformed Jacobian.
+   */
+  bool needNewPreconditioner(const bool integratorsNeedNew,
+			     const PylithScalar dt);
+
+  /** Get flag indicating the preconditioner is being reused (lagged)
+   * in the current time step.
+   *
+   * @returns True if the solver should reuse the preconditioner.
+   */
+  bool lagPreconditioner(void) const;
+
+  /** Get flag indicating the global vector of the solution holds a
+   * nonzero initial guess for the current solve.
+   *
+   * @returns True if solver should start from the current solution.
+   */
+  bool nonzeroInitialGuess(void) const;
+
+  /** Record number of solver iterations for current time step.
+   *
+   * @param numIterations Number of linear (or nonlinear) iterations.
+   */
+  void solverIterations(const int numIterations);
+
+  /** Get number of times the Jacobian has been reformed.
+   *
+   * @returns Number of Jacobian reforms.
+   */
+  int numJacobianReforms(void) const;
+
   /** Update handles and parameters for reforming the Jacobian and
    *  residual.
    *
@@ -181,11 +246,27 @@ protected :
   topology::SolutionFields* _fields; ///< Handle to solution fields for system.
 
   std::vector<feassemble::Integrator*> _integrators; ///< Array of integrators.
+  std::vector<feassemble::Constraint*> _constraints; ///< Array of constraints.
 
   bool _isJacobianSymmetric; ///< Is system Jacobian symmetric?
   bool _splitFields; ///< True if splitting fields.
 
   bool _useCustomConstraintPC; ///< True if using custom preconditioner for Lagrange constraints.
+  bool _nonzeroInitialGuess; ///< True if solution holds initial guess for current solve.
+  int _numJacobianReforms; ///< Number of times the Jacobian has been reformed.
+
+  /// Parameters and state for lagging the preconditioner.
+  struct JacobianLag {
+    int maxSteps; ///< Maximum number of time steps to reuse preconditioner (0 = disabled).
+    PylithScalar iterationsRatio; ///< Iteration growth that triggers a reform.
+    PylithScalar dtRatio; ///< Change in time step that triggers a reform.
+    PylithScalar dtReform; ///< Time step at last reform (0 = never reformed).
+    int numStepsLagged; ///< Number of time steps since last reform.
+    int iterationsReform; ///< Solver iterations in first solve after last reform (-1 = pending).
+    int iterationsLast; ///< Solver iterations in most recent solve.
+    bool isLagged; ///< True if current time step reuses the preconditioner.
+  }; // JacobianLag
+  JacobianLag _jacobianLag; ///< Preconditioner lagging policy.
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
@@ -20,24 +20,62 @@
 
 #include "Implicit.hh" // implementation of class methods
 
+#include "Solver.hh" // USES Solver
+#include "pylith/feassemble/Integrator.hh" // USES Integrator
+#include "pylith/feassemble/Constraint.hh" // USES Constraint
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Jacobian.hh" // USES Jacobian
 #include "pylith/topology/SolutionFields.hh" // USES SolutionFields
 #include "pylith/topology/Stratum.hh" // USES Stratum
 #include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
 
+#include "pylith/utils/constdefs.h" // USES PYLITH_MAXSCALAR
+
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 
+#include <algorithm> // USES std::min(), std::max(), std::swap()
+#include <stdexcept> // USES std::runtime_error, std::logic_error
+#include <sstream> // USES std::ostringstream
+
 // ----------------------------------------------------------------------
 // Constructor
-pylith::problems::Implicit::Implicit(void)
+pylith::problems::Implicit::Implicit(void) :
+  _predictorOrder(0),
+  _numDispIncrSaved(0),
+  _dispIncrWork(NULL)
 { // constructor
+  for (int i=0; i < 2; ++i) {
+    _dtSaved[i] = 0.0;
+    _dispIncrSaved[i] = NULL;
+  } // for
 } // constructor
 
 // ----------------------------------------------------------------------
 // Destructor
 pylith::problems::Implicit::~Implicit(void)
 { // destructor
+  deallocate();
 } // destructor
 
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::problems::Implicit::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  Formulation::deallocate();
+
+  PetscErrorCode err = 0;
+  for (int i=0; i < 2; ++i) {
+    err = VecDestroy(&_dispIncrSaved[i]);PYLITH_CHECK_ERROR(err);
+  } // for
+  err = VecDestroy(&_dispIncrWork);PYLITH_CHECK_ERROR(err);
+  _numDispIncrSaved = 0;
+
+  PYLITH_METHOD_END;
+} // deallocate
+
 // ----------------------------------------------------------------------
 // Compute velocity at time t.
 void
@@ -86,5 +124,270 @@ pylith::problems::Implicit::calcRateFields(void)
   PYLITH_METHOD_END;
 } // calcRateFields
 
+// ----------------------------------------------------------------------
+// Set order of predictor for initial guess of displacement increment.
+void
+pylith::problems::Implicit::predictorOrder(const int order)
+{ // predictorOrder
+  PYLITH_METHOD_BEGIN;
+
+  if (order < 0 || order > 2) {
+    std::ostringstream msg;
+    msg << "Order of predictor for initial guess (" << order << ") must be 0, 1, or 2.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  _predictorOrder = order;
+  _numDispIncrSaved = std::min(_numDispIncrSaved, order);
+
+  PYLITH_METHOD_END;
+} // predictorOrder
+
+// ----------------------------------------------------------------------
+// Set initial guess for solve from displacement increments of previous
+// time steps.
+void
+pylith::problems::Implicit::predictDispIncr(const PylithScalar dt)
+{ // predictDispIncr
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fields);
+  assert(dt > 0.0);
+
+  _nonzeroInitialGuess = false;
+  const int order = std::min(_predictorOrder, _numDispIncrSaved);
+  if (order < 1) {
+    PYLITH_METHOD_END;
+  } // if
+
+  // The rates over the previous time steps, v1 = du1/dt1 and v2 =
+  // du2/dt2, are at the midpoints of those steps. The first order
+  // predictor uses v1 over the current time step; the second order
+  // predictor extrapolates the rate linearly to the midpoint of the
+  // current time step (du = 2*du1 - du2 for a uniform time step).
+  const PylithScalar dt1 = _dtSaved[0];
+  const PylithScalar dt2 = _dtSaved[1];
+  assert(dt1 > 0.0);
+  PylithScalar c1 = dt / dt1;
+  PylithScalar c2 = 0.0;
+  if (2 == order) {
+    assert(dt2 > 0.0);
+    const PylithScalar w = (dt1 + dt) / (dt1 + dt2);
+    c1 = dt * (1.0 + w) / dt1;
+    c2 = -dt * w / dt2;
+  } // if
+
+  topology::Field& dispIncr = _fields->get("dispIncr(t->t+dt)");
+  PetscVec dispIncrVec = dispIncr.localVector();assert(dispIncrVec);
+  assert(_dispIncrWork);
+
+  // Keep the local values, which hold the increments in the
+  // constrained DOF, and put the prediction in the global vector.
+  PetscErrorCode err = 0;
+  err = VecCopy(dispIncrVec, _dispIncrWork);PYLITH_CHECK_ERROR(err);
+  if (1 == order) {
+    err = VecAXPBY(dispIncrVec, c1, 0.0, _dispIncrSaved[0]);PYLITH_CHECK_ERROR(err);
+  } else {
+    err = VecAXPBYPCZ(dispIncrVec, c1, c2, 0.0, _dispIncrSaved[0], _dispIncrSaved[1]);PYLITH_CHECK_ERROR(err);
+  } // if/else
+
+  // Project prediction onto constraints (e.g., prescribed fault slip).
+  const int numIntegrators = _integrators.size();
+  for (int i=0; i < numIntegrators; ++i) {
+    _integrators[i]->projectSolnIncr(_fields);
+  } // for
+
+  dispIncr.scatterLocalToGlobal();
+  err = VecCopy(_dispIncrWork, dispIncrVec);PYLITH_CHECK_ERROR(err);
+
+  _nonzeroInitialGuess = true;
+
+  PYLITH_METHOD_END;
+} // predictDispIncr
+
+// ----------------------------------------------------------------------
+// Save displacement increment for current time step.
+void
+pylith::problems::Implicit::saveDispIncr(const PylithScalar dt)
+{ // saveDispIncr
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fields);
+
+  _nonzeroInitialGuess = false;
+  if (_predictorOrder < 1) {
+    PYLITH_METHOD_END;
+  } // if
+
+  topology::Field& dispIncr = _fields->get("dispIncr(t->t+dt)");
+  PetscVec dispIncrVec = dispIncr.localVector();assert(dispIncrVec);
+
+  PetscErrorCode err = 0;
+  if (!_dispIncrWork) {
+    err = VecDuplicate(dispIncrVec, &_dispIncrWork);PYLITH_CHECK_ERROR(err);
+  } // if
+  for (int i=0; i < _predictorOrder; ++i) {
+    if (!_dispIncrSaved[i]) {
+      err = VecDuplicate(dispIncrVec, &_dispIncrSaved[i]);PYLITH_CHECK_ERROR(err);
+    } // if
+  } // for
+
+  // Rotate saved increments, reusing storage of the oldest one.
+  if (2 == _predictorOrder) {
+    std::swap(_dispIncrSaved[0], _dispIncrSaved[1]);
+    _dtSaved[1] = _dtSaved[0];
+  } // if
+  err = VecCopy(dispIncrVec, _dispIncrSaved[0]);PYLITH_CHECK_ERROR(err);
+  _dtSaved[0] = dt;
+  _numDispIncrSaved = std::min(_numDispIncrSaved+1, _predictorOrder);
+
+  PYLITH_METHOD_END;
+} // saveDispIncr
+
+// ----------------------------------------------------------------------
+// Advance the solution over several time steps.
+void
+pylith::problems::Implicit::advance(Solver* const solver,
+				    const PylithScalar t,
+				    const PylithScalar dt,
+				    const int numSteps)
+{ // advance
+  PYLITH_METHOD_BEGIN;
+
+  assert(solver);
+  assert(_fields);
+
+  if (!_jacobian) {
+    throw std::logic_error("Jacobian must be formed in a time step in Python before advancing the solution natively.");
+  } // if
+  if (dt <= 0.0) {
+    std::ostringstream msg;
+    msg << "Time step (" << dt << ") for advancing the solution must be positive.";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  // Accumulate the time the same way as the Python time loop, so
+  // both give identical times at the end.
+  PylithScalar tStep = t;
+  for (int iStep=0; iStep < numSteps; ++iStep) {
+    _prestep(tStep, dt);
+    _step(solver, tStep, dt);
+    _poststep(tStep, dt);
+    tStep += dt;
+  } // for
+
+  PYLITH_METHOD_END;
+} // advance
+
+// ----------------------------------------------------------------------
+// Prepare for advancing from t to t+dt.
+void
+pylith::problems::Implicit::_prestep(const PylithScalar t,
+				     const PylithScalar dt)
+{ // _prestep
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fields);
+
+  topology::Field& dispIncr = _fields->get("dispIncr(t->t+dt)");
+  const topology::Mesh& mesh = dispIncr.mesh();
+
+  // Combine the stable time step and the integrator flags for a new
+  // Jacobian into a single reduction (max of -dtStable and flag).
+  PylithScalar valuesLocal[2];
+  valuesLocal[0] = -pylith::PYLITH_MAXSCALAR;
+  valuesLocal[1] = 0.0;
+  const size_t numIntegrators = _integrators.size();
+  for (size_t i=0; i < numIntegrators; ++i) {
+    assert(_integrators[i]);
+    valuesLocal[0] = std::max(valuesLocal[0], -_integrators[i]->stableTimeStep(mesh));
+  } // for
+
+  dispIncr.zeroAll();
+  const size_t numConstraints = _constraints.size();
+  for (size_t i=0; i < numConstraints; ++i) {
+    assert(_constraints[i]);
+    _constraints[i]->setFieldIncr(t, t+dt, dispIncr);
+  } // for
+
+  for (size_t i=0; i < numIntegrators; ++i) {
+    _integrators[i]->timeStep(dt);
+    if (_integrators[i]->needNewJacobian()) {
+      valuesLocal[1] = 1.0;
+    } // if
+  } // for
+
+  PylithScalar values[2];
+  PetscErrorCode err = MPI_Allreduce(valuesLocal, values, 2, MPIU_SCALAR, MPI_MAX, mesh.comm());PYLITH_CHECK_ERROR(err);
+  const PylithScalar dtStable = -values[0];
+  if (dtStable < dt) {
+    std::ostringstream msg;
+    msg << "Current nondimensionalized time step of " << dt
+	<< " exceeds the nondimensionalized stable time step of " << dtStable << ".";
+    throw std::runtime_error(msg.str());
+  } // if
+
+  // The Jacobian is the operator in the solve, so reform it whenever
+  // an integrator requests it; only the preconditioner is lagged.
+  const bool integratorsNeedNew = values[1] > 0.0;
+  needNewPreconditioner(integratorsNeedNew, dt);
+  if (integratorsNeedNew) {
+    updateSettings(_jacobian, _fields, t, dt);
+    reformJacobian();
+  } // if
+
+  PYLITH_METHOD_END;
+} // _prestep
+
+// ----------------------------------------------------------------------
+// Solve for displacement increment from t to t+dt.
+void
+pylith::problems::Implicit::_step(Solver* const solver,
+				  const PylithScalar t,
+				  const PylithScalar dt)
+{ // _step
+  PYLITH_METHOD_BEGIN;
+
+  assert(solver);
+  assert(_fields);
+
+  updateSettings(_jacobian, _fields, t+dt, dt);
+  reformResidual();
+
+  // Initial guess from previous increments (residual must not include it).
+  predictDispIncr(dt);
+
+  topology::Field& dispIncr = _fields->get("dispIncr(t->t+dt)");
+  const topology::Field& residual = _fields->get("residual");
+  solver->solve(&dispIncr, _jacobian, residual);
+  solverIterations(solver->numIterations());
+
+  PYLITH_METHOD_END;
+} // _step
+
+// ----------------------------------------------------------------------
+// Update displacement and state variables after advancing from t to t+dt.
+void
+pylith::problems::Implicit::_poststep(const PylithScalar t,
+				      const PylithScalar dt)
+{ // _poststep
+  PYLITH_METHOD_BEGIN;
+
+  assert(_fields);
+
+  topology::Field& dispIncr = _fields->get("dispIncr(t->t+dt)");
+  topology::Field& disp = _fields->get("disp(t)");
+  disp.add(dispIncr);
+  saveDispIncr(dt);
+  dispIncr.zeroAll();
+
+  const size_t numIntegrators = _integrators.size();
+  for (size_t i=0; i < numIntegrators; ++i) {
+    _integrators[i]->updateStateVars(t, _fields);
+  } // for
+
+  PYLITH_METHOD_END;
+} // _poststep
+
 
 // End of file
@@ -47,9 +47,107 @@ public :
   /// Destructor
   ~Implicit(void);
 
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
   /// Compute rate fields (velocity and/or acceleration) at time t.
   void calcRateFields(void);
 
+  /** Set order of predictor for the initial guess of the displacement
+   * increment.
+   *
+   * @param order 0 for zero initial guess, 1 for previous increment
+   *   scaled by ratio of time steps, 2 for linear extrapolation of
+   *   rate from the previous two increments.
+   */
+  void predictorOrder(const int order);
+
+  /** Set initial guess for the solve by extrapolating the displacement
+   * increments from previous time steps. The integrators project the
+   * guess onto their constraints (e.g., prescribed slip). The guess is
+   * put in the global vector of the solution, which omits the
+   * constrained DOF, so the local values (including the Dirichlet
+   * increments) are unchanged. Must be called after reforming the
+   * residual, which computes the prescribed slip at the end of the
+   * time step.
+   *
+   * @param dt Current time step (nondimensional).
+   */
+  void predictDispIncr(const PylithScalar dt);
+
+  /** Save displacement increment for current time step for use by the
+   * predictor in later time steps.
+   *
+   * @param dt Current time step (nondimensional).
+   */
+  void saveDispIncr(const PylithScalar dt);
+
+  /** Advance the solution over several time steps of uniform size
+   * without returning to Python.
+   *
+   * Each time step does the same work as the prestep, step, and
+   * poststep in the Python time loop (setting the constrained
+   * increments, checking the stable time step, reforming the
+   * Jacobian as needed, solving, and updating the displacement and
+   * state variables), but no output is written. The caller must
+   * limit the number of time steps so no output is due in any of
+   * them and must have completed at least one time step in Python
+   * (so the Jacobian has been created and formed).
+   *
+   * Only TimeDependent uses this driver. Green's functions write
+   * output for every impulse, so GreensFns always computes impulses
+   * in the Python loop.
+   *
+   * @param solver Solver for the system of equations.
+   * @param t Time at the beginning of the first time step (nondimensional).
+   * @param dt Time step (nondimensional).
+   * @param numSteps Number of time steps.
+   */
+  void advance(Solver* const solver,
+	       const PylithScalar t,
+	       const PylithScalar dt,
+	       const int numSteps);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Set constrained increments, check stable time step, and reform
+   * the Jacobian if needed before advancing from t to t+dt.
+   *
+   * @param t Current time (nondimensional).
+   * @param dt Time step (nondimensional).
+   */
+  void _prestep(const PylithScalar t,
+		const PylithScalar dt);
+
+  /** Solve for the displacement increment from t to t+dt.
+   *
+   * @param solver Solver for the system of equations.
+   * @param t Current time (nondimensional).
+   * @param dt Time step (nondimensional).
+   */
+  void _step(Solver* const solver,
+	     const PylithScalar t,
+	     const PylithScalar dt);
+
+  /** Update displacement and state variables after advancing from t
+   * to t+dt.
+   *
+   * @param t Current time (nondimensional).
+   * @param dt Time step (nondimensional).
+   */
+  void _poststep(const PylithScalar t,
+		 const PylithScalar dt);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  int _predictorOrder; ///< Order of predictor for initial guess (0 = none).
+  int _numDispIncrSaved; ///< Number of saved displacement increments.
+  PylithScalar _dtSaved[2]; ///< Time steps of saved displacement increments.
+  PetscVec _dispIncrSaved[2]; ///< Saved displacement increments (most recent first).
+  PetscVec _dispIncrWork; ///< Work vector for displacement increment.
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
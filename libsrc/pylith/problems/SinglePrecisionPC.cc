@@ -0,0 +1,388 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "SinglePrecisionPC.hh" // implementation of class methods
+
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include "journal/warning.h" // USES journal::warning_t
+
+#include <petscpc.h> // USES PetscPC
+
+#include <algorithm> // USES std::max()
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+// Constructor
+pylith::problems::SinglePrecisionPC::SinglePrecisionPC(void) :
+  _pc(0),
+  _numRows(0)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor
+pylith::problems::SinglePrecisionPC::~SinglePrecisionPC(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::problems::SinglePrecisionPC::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  _pc = 0; // Handle only, do not manage memory.
+  _numRows = 0;
+  _rowOffsets.clear();
+  _cols.clear();
+  _diagLocation.clear();
+  _values.clear();
+  _rowWork.clear();
+  _colLocation.clear();
+
+  PYLITH_METHOD_END;
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Use this object as the preconditioner.
+void
+pylith::problems::SinglePrecisionPC::initialize(PetscPC pc)
+{ // initialize
+  PYLITH_METHOD_BEGIN;
+
+  assert(pc);
+  _pc = pc;
+
+  // The shell replaces any preconditioner selected by the user.
+  PetscErrorCode err = 0;
+  const char* prefix = NULL;
+  char pcType[256];
+  PetscBool hasPCType = PETSC_FALSE;
+  err = PCGetOptionsPrefix(_pc, &prefix);PYLITH_CHECK_ERROR(err);
+  err = PetscOptionsGetString(NULL, prefix, "-pc_type", pcType, sizeof(pcType), &hasPCType);PYLITH_CHECK_ERROR(err);
+  if (hasPCType) {
+    int rank = 0;
+    err = MPI_Comm_rank(PetscObjectComm((PetscObject) _pc), &rank);PYLITH_CHECK_ERROR(err);
+    if (!rank) {
+      journal::warning_t warning("solver");
+      warning << journal::at(__HERE__)
+	      << "Ignoring preconditioner type '" << pcType << "'. Preconditioning with single precision "
+	      << "storage (mixed precision) uses block Jacobi ILU(0)." << journal::endl;
+    } // if
+  } // if
+
+  err = PCSetType(_pc, PCSHELL);PYLITH_CHECK_ERROR(err);
+  err = PCShellSetContext(_pc, (void*) this);PYLITH_CHECK_ERROR(err);
+  err = PCShellSetSetUp(_pc, setUp);PYLITH_CHECK_ERROR(err);
+  err = PCShellSetApply(_pc, apply);PYLITH_CHECK_ERROR(err);
+  err = PCShellSetName(_pc, "block Jacobi ILU(0) with single precision factors");PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // initialize
+
+// ----------------------------------------------------------------------
+// Get number of nonzero entries in factors.
+PetscInt
+pylith::problems::SinglePrecisionPC::numNonzeros(void) const
+{ // numNonzeros
+  return _values.size();
+} // numNonzeros
+
+// ----------------------------------------------------------------------
+// Get memory used by factors in bytes.
+size_t
+pylith::problems::SinglePrecisionPC::memoryUsed(void) const
+{ // memoryUsed
+  return _values.size()*sizeof(float) + _cols.size()*sizeof(PetscInt) +
+    (_rowOffsets.size() + _diagLocation.size())*sizeof(PetscInt);
+} // memoryUsed
+
+// ----------------------------------------------------------------------
+// Compute ILU(0) factorization of matrix.
+PetscErrorCode
+pylith::problems::SinglePrecisionPC::_factor(PetscMat mat)
+{ // _factor
+  PYLITH_METHOD_BEGIN;
+
+  assert(mat);
+
+  PetscErrorCode err = 0;
+  PetscBool isSeqAIJ = PETSC_FALSE, isSeqBAIJ = PETSC_FALSE, isSeqSBAIJ = PETSC_FALSE;
+  err = PetscObjectTypeCompare((PetscObject) mat, MATSEQAIJ, &isSeqAIJ);CHKERRQ(err);
+  err = PetscObjectTypeCompare((PetscObject) mat, MATSEQBAIJ, &isSeqBAIJ);CHKERRQ(err);
+  err = PetscObjectTypeCompare((PetscObject) mat, MATSEQSBAIJ, &isSeqSBAIJ);CHKERRQ(err);
+  if (!isSeqAIJ && !isSeqBAIJ && !isSeqSBAIJ) {
+    MatType matType = NULL;
+    err = MatGetType(mat, &matType);CHKERRQ(err);
+    SETERRQ1(PETSC_COMM_SELF, PETSC_ERR_SUP, "Single precision ILU(0) factorization does not support matrix type %s.", matType);
+  } // if
+
+  // The factors are built directly from the compressed row structure
+  // of the blocks (AIJ is the case with a block size of 1). Values in
+  // BAIJ and SBAIJ blocks are stored by column.
+  PetscInt bs = 1;
+  if (!isSeqAIJ) {
+    err = MatGetBlockSize(mat, &bs);CHKERRQ(err);
+  } // if
+  const PetscInt bs2 = bs*bs;
+  const PetscBool blockCompressed = isSeqAIJ ? PETSC_FALSE : PETSC_TRUE;
+  PetscInt numBlockRows = 0;
+  const PetscInt* ia = NULL;
+  const PetscInt* ja = NULL;
+  PetscBool done = PETSC_FALSE;
+  err = MatGetRowIJ(mat, 0, PETSC_FALSE, blockCompressed, &numBlockRows, &ia, &ja, &done);CHKERRQ(err);
+  if (!done) {
+    SETERRQ(PETSC_COMM_SELF, PETSC_ERR_SUP, "Could not get compressed row structure of preconditioning matrix.");
+  } // if
+  PetscScalar* a = NULL;
+  if (isSeqAIJ) {
+    err = MatSeqAIJGetArray(mat, &a);CHKERRQ(err);
+  } else if (isSeqBAIJ) {
+    err = MatSeqBAIJGetArray(mat, &a);CHKERRQ(err);
+  } else {
+    err = MatSeqSBAIJGetArray(mat, &a);CHKERRQ(err);
+  } // if/else
+
+  // SBAIJ only stores the blocks in the upper triangle. The blocks
+  // below the diagonal in block row i are the transposes of the blocks
+  // in column i of the rows above it; list them in order of column.
+  std::vector<PetscInt> lowerOffsets(numBlockRows+1, 0);
+  std::vector<PetscInt> lowerBlocks;
+  std::vector<PetscInt> lowerCols;
+  if (isSeqSBAIJ) {
+    for (PetscInt bi=0; bi < numBlockRows; ++bi) {
+      for (PetscInt k=ia[bi]; k < ia[bi+1]; ++k) {
+	if (ja[k] > bi) {
+	  ++lowerOffsets[ja[k]+1];
+	} // if
+      } // for
+    } // for
+    for (PetscInt bi=0; bi < numBlockRows; ++bi) {
+      lowerOffsets[bi+1] += lowerOffsets[bi];
+    } // for
+    lowerBlocks.resize(lowerOffsets[numBlockRows]);
+    lowerCols.resize(lowerOffsets[numBlockRows]);
+    std::vector<PetscInt> count(lowerOffsets.begin(), lowerOffsets.end()-1);
+    for (PetscInt bi=0; bi < numBlockRows; ++bi) {
+      for (PetscInt k=ia[bi]; k < ia[bi+1]; ++k) {
+	if (ja[k] > bi) {
+	  lowerBlocks[count[ja[k]]] = k;
+	  lowerCols[count[ja[k]]] = bi;
+	  ++count[ja[k]];
+	} // if
+      } // for
+    } // for
+  } // if
+
+  // Structure of factors (same as the matrix, one row per point).
+  const PetscInt numRows = numBlockRows*bs;
+  _numRows = numRows;
+  _rowOffsets.resize(numRows+1);
+  _rowOffsets[0] = 0;
+  PetscInt maxRowSize = 1;
+  for (PetscInt bi=0; bi < numBlockRows; ++bi) {
+    const PetscInt rowSize = (lowerOffsets[bi+1] - lowerOffsets[bi] + ia[bi+1] - ia[bi]) * bs;
+    maxRowSize = std::max(maxRowSize, rowSize);
+    for (PetscInt r=0; r < bs; ++r) {
+      _rowOffsets[bi*bs+r+1] = _rowOffsets[bi*bs+r] + rowSize;
+    } // for
+  } // for
+  const PetscInt numNonzeros = _rowOffsets[numRows];
+  _cols.resize(numNonzeros);
+  _values.resize(numNonzeros);
+  _diagLocation.resize(numRows);
+  _colLocation.assign(numRows, -1);
+  _rowWork.resize(maxRowSize);
+
+  // ILU(0), row by row (IKJ variant). The current row is accumulated
+  // in PetscScalar; previously factored rows are read from the single
+  // precision factors.
+  PetscInt zeroPivotRow = -1;
+  for (PetscInt i=0; i < numRows && zeroPivotRow < 0; ++i) {
+    const PetscInt bi = i / bs;
+    const PetscInt r = i % bs;
+    const PetscInt rStart = _rowOffsets[i];
+    const PetscInt rEnd = _rowOffsets[i+1];
+    PetscScalar* w = &_rowWork[0];
+
+    // Gather row from transposed blocks below the diagonal (SBAIJ)
+    // and stored blocks, in order of column.
+    PetscInt kk = rStart;
+    for (PetscInt l=lowerOffsets[bi]; l < lowerOffsets[bi+1]; ++l) {
+      for (PetscInt c=0; c < bs; ++c, ++kk) {
+	_cols[kk] = lowerCols[l]*bs + c;
+	w[kk-rStart] = a[lowerBlocks[l]*bs2 + r*bs + c];
+      } // for
+    } // for
+    for (PetscInt k=ia[bi]; k < ia[bi+1]; ++k) {
+      for (PetscInt c=0; c < bs; ++c, ++kk) {
+	_cols[kk] = ja[k]*bs + c;
+	// Only the upper triangle of SBAIJ diagonal blocks is used.
+	const bool transpose = isSeqSBAIJ && ja[k] == bi && c < r;
+	w[kk-rStart] = transpose ? a[k*bs2 + r*bs + c] : a[k*bs2 + c*bs + r];
+      } // for
+    } // for
+    assert(kk == rEnd);
+
+    PetscInt diag = -1;
+    for (PetscInt k=rStart; k < rEnd; ++k) {
+      _colLocation[_cols[k]] = k;
+      if (_cols[k] == i) {
+	diag = k;
+      } // if
+    } // for
+    if (diag < 0) {
+      zeroPivotRow = i;
+      break;
+    } // if
+
+    // Columns are sorted, so entries before the diagonal are in L.
+    for (PetscInt k=rStart; k < diag; ++k) {
+      const PetscInt row = _cols[k];
+      const PetscScalar lik = w[k-rStart] * PetscScalar(_values[_diagLocation[row]]);
+      w[k-rStart] = lik;
+      for (PetscInt kr=_diagLocation[row]+1; kr < _rowOffsets[row+1]; ++kr) {
+	const PetscInt loc = _colLocation[_cols[kr]];
+	if (loc >= 0) {
+	  w[loc-rStart] -= lik * PetscScalar(_values[kr]);
+	} // if
+      } // for
+    } // for
+
+    if (0.0 == w[diag-rStart]) {
+      zeroPivotRow = i;
+    } else {
+      w[diag-rStart] = 1.0 / w[diag-rStart];
+    } // if/else
+    for (PetscInt k=rStart; k < rEnd; ++k) {
+      _values[k] = float(w[k-rStart]);
+      _colLocation[_cols[k]] = -1;
+    } // for
+    _diagLocation[i] = diag;
+  } // for
+
+  if (isSeqAIJ) {
+    err = MatSeqAIJRestoreArray(mat, &a);CHKERRQ(err);
+  } else if (isSeqBAIJ) {
+    err = MatSeqBAIJRestoreArray(mat, &a);CHKERRQ(err);
+  } else {
+    err = MatSeqSBAIJRestoreArray(mat, &a);CHKERRQ(err);
+  } // if/else
+  err = MatRestoreRowIJ(mat, 0, PETSC_FALSE, blockCompressed, &numBlockRows, &ia, &ja, &done);CHKERRQ(err);
+  if (zeroPivotRow >= 0) {
+    SETERRQ1(PETSC_COMM_SELF, PETSC_ERR_MAT_LU_ZRPVT, "Zero pivot in row %D of single precision ILU(0) factorization.", zeroPivotRow);
+  } // if
+
+  err = PetscLogFlops(2.0*numNonzeros);CHKERRQ(err);
+
+  PYLITH_METHOD_RETURN(0);
+} // _factor
+
+// ----------------------------------------------------------------------
+// Apply preconditioner.
+PetscErrorCode
+pylith::problems::SinglePrecisionPC::_apply(PetscVec x,
+					    PetscVec y) const
+{ // _apply
+  PYLITH_METHOD_BEGIN;
+
+  PetscErrorCode err = 0;
+  const PetscScalar* xArray = NULL;
+  PetscScalar* yArray = NULL;
+  err = VecGetArrayRead(x, &xArray);CHKERRQ(err);
+  err = VecGetArray(y, &yArray);CHKERRQ(err);
+
+  const PetscInt numRows = _numRows;
+  const PetscInt* rowOffsets = (numRows > 0) ? &_rowOffsets[0] : NULL;
+  const PetscInt* cols = (numRows > 0) ? &_cols[0] : NULL;
+  const PetscInt* diagLocation = (numRows > 0) ? &_diagLocation[0] : NULL;
+  const float* values = (numRows > 0) ? &_values[0] : NULL;
+
+  // Solve L z = x (unit diagonal).
+  for (PetscInt i=0; i < numRows; ++i) {
+    PetscScalar sum = xArray[i];
+    for (PetscInt k=rowOffsets[i]; k < diagLocation[i]; ++k) {
+      sum -= PetscScalar(values[k]) * yArray[cols[k]];
+    } // for
+    yArray[i] = sum;
+  } // for
+
+  // Solve U y = z (inverted diagonal).
+  for (PetscInt i=numRows-1; i >= 0; --i) {
+    PetscScalar sum = yArray[i];
+    for (PetscInt k=diagLocation[i]+1; k < rowOffsets[i+1]; ++k) {
+      sum -= PetscScalar(values[k]) * yArray[cols[k]];
+    } // for
+    yArray[i] = sum * PetscScalar(values[diagLocation[i]]);
+  } // for
+
+  err = VecRestoreArrayRead(x, &xArray);CHKERRQ(err);
+  err = VecRestoreArray(y, &yArray);CHKERRQ(err);
+
+  err = PetscLogFlops(2.0*_values.size() - numRows);CHKERRQ(err);
+
+  PYLITH_METHOD_RETURN(0);
+} // _apply
+
+// ----------------------------------------------------------------------
+// Generic C interface for setting up preconditioner.
+PetscErrorCode
+pylith::problems::SinglePrecisionPC::setUp(PetscPC pc)
+{ // setUp
+  PYLITH_METHOD_BEGIN;
+
+  PetscErrorCode err = 0;
+  void* context = NULL;
+  err = PCShellGetContext(pc, &context);CHKERRQ(err);
+  SinglePrecisionPC* spc = (SinglePrecisionPC*) context;assert(spc);
+
+  // Factor diagonal block of locally owned rows (block Jacobi).
+  PetscMat pmat = NULL;
+  PetscMat block = NULL;
+  err = PCGetOperators(pc, NULL, &pmat);CHKERRQ(err);
+  err = MatGetDiagonalBlock(pmat, &block);CHKERRQ(err);
+  err = spc->_factor(block);CHKERRQ(err);
+
+  PYLITH_METHOD_RETURN(0);
+} // setUp
+
+// ----------------------------------------------------------------------
+// Generic C interface for applying preconditioner.
+PetscErrorCode
+pylith::problems::SinglePrecisionPC::apply(PetscPC pc,
+					   PetscVec x,
+					   PetscVec y)
+{ // apply
+  PYLITH_METHOD_BEGIN;
+
+  PetscErrorCode err = 0;
+  void* context = NULL;
+  err = PCShellGetContext(pc, &context);CHKERRQ(err);
+  const SinglePrecisionPC* spc = (const SinglePrecisionPC*) context;assert(spc);
+  err = spc->_apply(x, y);CHKERRQ(err);
+
+  PYLITH_METHOD_RETURN(0);
+} // apply
+
+
+// End of file
@@ -0,0 +1,166 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/problems/SinglePrecisionPC.hh
+ *
+ * @brief Block Jacobi ILU(0) preconditioner with the factors stored in
+ * single precision.
+ */
+
+#if !defined(pylith_problems_singleprecisionpc_hh)
+#define pylith_problems_singleprecisionpc_hh
+
+// Include directives ---------------------------------------------------
+#include "problemsfwd.hh" // forward declarations
+
+#include "pylith/utils/petscfwd.h" // USES PetscPC, PetscMat, PetscVec
+#include "pylith/utils/types.hh" // HASA PetscInt, PetscScalar
+
+#include <vector> // HASA std::vector
+
+// SinglePrecisionPC ----------------------------------------------------
+/** @brief Block Jacobi ILU(0) preconditioner with the factors stored in
+ * single precision.
+ *
+ * PetscScalar is fixed when PETSc is built, so PETSc preconditioners
+ * always store their data in the same precision as the residual and
+ * solution. This preconditioner is a PCSHELL that computes the
+ * incomplete LU factorization with zero fill of the diagonal block of
+ * the locally owned rows of the preconditioning matrix (equivalent to
+ * -pc_type bjacobi -sub_pc_type ilu) and stores the factors as float
+ * values. The factorization and the triangular solves accumulate in
+ * PetscScalar, so only the storage of the factors is rounded.
+ *
+ * The Krylov solver continues to use the double precision Jacobian as
+ * the operator, so the accuracy of the solution is controlled by the
+ * Krylov tolerances; the single precision factors only affect the
+ * number of iterations. The values of the factors take half the
+ * memory of a double precision ILU(0) factorization, and applying the
+ * preconditioner moves correspondingly less memory.
+ *
+ * PETSc calls the setup whenever the preconditioning matrix changes,
+ * so reformed Jacobians are refactored automatically.
+ *
+ * ILU(0) requires nonzero diagonal entries, so the preconditioner
+ * cannot be used for the Lagrange multiplier rows of faults.
+ */
+class pylith::problems::SinglePrecisionPC
+{ // SinglePrecisionPC
+  friend class TestSinglePrecisionPC; // unit testing
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor.
+  SinglePrecisionPC(void);
+
+  /// Destructor
+  ~SinglePrecisionPC(void);
+
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
+  /** Use this object as the preconditioner.
+   *
+   * Sets the type of the PETSc preconditioner to PCSHELL, overriding
+   * (with a warning) any preconditioner type set via -pc_type. The
+   * object must outlive the preconditioner.
+   *
+   * @param pc PETSc preconditioner.
+   */
+  void initialize(PetscPC pc);
+
+  /** Get number of nonzero entries in factors.
+   *
+   * @returns Number of nonzero entries.
+   */
+  PetscInt numNonzeros(void) const;
+
+  /** Get memory used by factors in bytes.
+   *
+   * @returns Memory used by factors.
+   */
+  size_t memoryUsed(void) const;
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Compute ILU(0) factorization of matrix.
+   *
+   * The factors are built directly from the AIJ, BAIJ, or SBAIJ
+   * storage of the matrix without converting it.
+   *
+   * @param mat Sequential AIJ, BAIJ, or SBAIJ matrix.
+   * @returns PETSc error code.
+   */
+  PetscErrorCode _factor(PetscMat mat);
+
+  /** Apply preconditioner.
+   *
+   * @param x Input vector.
+   * @param y Output vector.
+   * @returns PETSc error code.
+   */
+  PetscErrorCode _apply(PetscVec x,
+			PetscVec y) const;
+
+  /** Generic C interface for setting up preconditioner.
+   *
+   * @param pc PETSc preconditioner.
+   * @returns PETSc error code.
+   */
+  static
+  PetscErrorCode setUp(PetscPC pc);
+
+  /** Generic C interface for applying preconditioner.
+   *
+   * @param pc PETSc preconditioner.
+   * @param x Input vector.
+   * @param y Output vector.
+   * @returns PETSc error code.
+   */
+  static
+  PetscErrorCode apply(PetscPC pc,
+		       PetscVec x,
+		       PetscVec y);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  PetscPC _pc; ///< PETSc preconditioner (handle only).
+  PetscInt _numRows; ///< Number of rows in local block.
+  std::vector<PetscInt> _rowOffsets; ///< Offsets of rows in factors.
+  std::vector<PetscInt> _cols; ///< Columns of entries in factors (sorted in each row).
+  std::vector<PetscInt> _diagLocation; ///< Locations of diagonal entries in factors.
+  std::vector<float> _values; ///< Factors (unit lower triangle L and U with inverted diagonal).
+  std::vector<PetscScalar> _rowWork; ///< Work array for factoring a row.
+  std::vector<PetscInt> _colLocation; ///< Work array mapping columns to locations in current row.
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  SinglePrecisionPC(const SinglePrecisionPC&); ///< Not implemented
+  const SinglePrecisionPC& operator=(const SinglePrecisionPC&); ///< Not implemented
+
+}; // SinglePrecisionPC
+
+#endif // pylith_problems_singleprecisionpc_hh
+
+
+// End of file
@@ -21,6 +21,7 @@
 #include "Solver.hh" // implementation of class methods
 
 #include "Formulation.hh" // USES Formulation
+#include "SinglePrecisionPC.hh" // USES SinglePrecisionPC
 
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/topology/Field.hh" // USES Field
@@ -32,7 +33,11 @@
 
 #include "spatialdata/geocoords/CoordSys.hh" // USES CoordSys
 
+#include <petscksp.h> // USES PCGAMGSetReuseInterpolation()
+
 #include <cassert> // USES assert()
+#include <string> // USES std::string
+#include <stdexcept> // USES std::logic_error, std::runtime_error
 
 
 // ----------------------------------------------------------------------
@@ -73,7 +78,13 @@ pylith::problems::Solver::Solver(void) :
     _logger(0),
     _jacobianPC(0),
     _jacobianPCFault(0),
-    _skipNullSpaceCreation(false)
+    _skipNullSpaceCreation(false),
+    _reuseAMGInterpolation(false),
+    _isInterpolationReused(false),
+    _mixedPrecision(false),
+    _pcSingle(0),
+    _numLinearIterationsTotal(0),
+    _numNonlinearIterationsTotal(0)
 { // constructor
 } // constructor
 
@@ -102,6 +113,12 @@ pylith::problems::Solver::deallocate(void)
     _ctx.A = 0; // Jacobian (managed separately)
     _ctx.faultA  = 0; // Handle to _jacobianPCFault
 
+    _isInterpolationReused = false;
+
+    // Preconditioner has no destroy callback, so it can be deleted
+    // before the KSP.
+    delete _pcSingle; _pcSingle = 0;
+
     PYLITH_METHOD_END;
 } // deallocate
 
@@ -118,6 +135,30 @@ pylith::problems::Solver::skipNullSpaceCreation(const bool value)
     PYLITH_METHOD_END;
 } // skipNullSpaceCreation
 
+// ----------------------------------------------------------------------
+// Set flag for reusing AMG interpolation when Jacobian is reformed.
+void
+pylith::problems::Solver::reuseAMGInterpolation(const bool value)
+{ // reuseAMGInterpolation
+    PYLITH_METHOD_BEGIN;
+
+    _reuseAMGInterpolation = value;
+
+    PYLITH_METHOD_END;
+} // reuseAMGInterpolation
+
+// ----------------------------------------------------------------------
+// Set flag for preconditioning with single precision storage.
+void
+pylith::problems::Solver::mixedPrecision(const bool value)
+{ // mixedPrecision
+    PYLITH_METHOD_BEGIN;
+
+    _mixedPrecision = value;
+
+    PYLITH_METHOD_END;
+} // mixedPrecision
+
 
 // ----------------------------------------------------------------------
 // Initialize solver.
@@ -131,6 +172,10 @@ pylith::problems::Solver::initialize(const topology::SolutionFields& fields,
     assert(formulation);
     _formulation = formulation;
 
+    if (_mixedPrecision && formulation->splitFields()) {
+        throw std::runtime_error("Preconditioning with single precision storage (mixed precision) is not supported with split fields.");
+    } // if
+
     // Make global preconditioner matrix
     PetscMat jacobianMat = jacobian.matrix();
 
@@ -139,6 +184,23 @@ pylith::problems::Solver::initialize(const topology::SolutionFields& fields,
     PetscInt numFields;
     PetscErrorCode err;
 
+    if (_mixedPrecision) {
+        // Lagrange multiplier rows for faults have zero diagonal
+        // entries, which give zero pivots in ILU(0).
+        const int indexLagrange = fields.solution().subfieldInfo("lagrange_multiplier").index;
+        PetscInt pStart, pEnd, numLagrangeDofLocal = 0, numLagrangeDof = 0;
+        err = PetscSectionGetChart(solutionSection, &pStart, &pEnd); PYLITH_CHECK_ERROR(err);
+        for (PetscInt p = pStart; p < pEnd; ++p) {
+            PetscInt dof = 0;
+            err = PetscSectionGetFieldDof(solutionSection, p, indexLagrange, &dof); PYLITH_CHECK_ERROR(err);
+            numLagrangeDofLocal += dof;
+        } // for
+        err = MPI_Allreduce(&numLagrangeDofLocal, &numLagrangeDof, 1, MPIU_INT, MPI_SUM, fields.mesh().comm()); PYLITH_CHECK_ERROR(err);
+        if (numLagrangeDof > 0) {
+            throw std::runtime_error("Preconditioning with single precision storage (mixed precision) is not supported with faults.");
+        } // if
+    } // if
+
     err = DMGetNumFields(dmMesh, &numFields); PYLITH_CHECK_ERROR(err);
     if (formulation->splitFields() && formulation->useCustomConstraintPC() &&
         numFields > 1) {
@@ -160,6 +222,40 @@ pylith::problems::Solver::initialize(const topology::SolutionFields& fields,
     PYLITH_METHOD_END;
 } // initialize
 
+// ----------------------------------------------------------------------
+// Solve the system.
+void
+pylith::problems::Solver::solve(topology::Field* solution,
+				topology::Jacobian* jacobian,
+				const topology::Field& residual)
+{ // solve
+  throw std::logic_error("Solver does not support solving with a sparse Jacobian matrix.");
+} // solve
+
+// ----------------------------------------------------------------------
+// Get number of iterations in the most recent solve.
+int
+pylith::problems::Solver::numIterations(void) const
+{ // numIterations
+  return 0;
+} // numIterations
+
+// ----------------------------------------------------------------------
+// Get total number of linear iterations over all solves.
+long
+pylith::problems::Solver::numLinearIterationsTotal(void) const
+{ // numLinearIterationsTotal
+  return _numLinearIterationsTotal;
+} // numLinearIterationsTotal
+
+// ----------------------------------------------------------------------
+// Get total number of nonlinear iterations over all solves.
+long
+pylith::problems::Solver::numNonlinearIterationsTotal(void) const
+{ // numNonlinearIterationsTotal
+  return _numNonlinearIterationsTotal;
+} // numNonlinearIterationsTotal
+
 // ----------------------------------------------------------------------
 // Create null space.
 void
@@ -414,4 +510,53 @@ pylith::problems::Solver::_epsilon(int i,
 } // _epsilon
 
 
+// ----------------------------------------------------------------------
+// Tell GAMG preconditioners to reuse their interpolation.
+bool
+pylith::problems::Solver::_setReuseInterpolation(PetscPC pc)
+{ // _setReuseInterpolation
+    PYLITH_METHOD_BEGIN;
+
+    assert(pc);
+    PetscErrorCode err;
+
+    PetscBool isGAMG = PETSC_FALSE, isFieldSplit = PETSC_FALSE;
+    err = PetscObjectTypeCompare((PetscObject) pc, PCGAMG, &isGAMG); PYLITH_CHECK_ERROR(err);
+    err = PetscObjectTypeCompare((PetscObject) pc, PCFIELDSPLIT, &isFieldSplit); PYLITH_CHECK_ERROR(err);
+
+    bool foundAMG = false;
+    if (isGAMG) {
+        err = PCGAMGSetReuseInterpolation(pc, PETSC_TRUE); PYLITH_CHECK_ERROR(err);
+        foundAMG = true;
+    } else if (isFieldSplit) {
+        PetscKSP* subksps = NULL;
+        PetscInt numSplits = 0;
+        err = PCFieldSplitGetSubKSP(pc, &numSplits, &subksps); PYLITH_CHECK_ERROR(err);
+        for (PetscInt i = 0; i < numSplits; ++i) {
+            PetscPC subpc = NULL;
+            err = KSPGetPC(subksps[i], &subpc); PYLITH_CHECK_ERROR(err);
+            foundAMG = _setReuseInterpolation(subpc) || foundAMG;
+        } // for
+        err = PetscFree(subksps); PYLITH_CHECK_ERROR(err);
+    } // if/else
+
+    PYLITH_METHOD_RETURN(foundAMG);
+} // _setReuseInterpolation
+
+// ----------------------------------------------------------------------
+// Use preconditioner with single precision factors.
+void
+pylith::problems::Solver::_setupMixedPrecision(PetscPC pc)
+{ // _setupMixedPrecision
+    PYLITH_METHOD_BEGIN;
+
+    assert(pc);
+
+    delete _pcSingle; _pcSingle = new SinglePrecisionPC(); assert(_pcSingle);
+    _pcSingle->initialize(pc);
+
+    PYLITH_METHOD_END;
+} // _setupMixedPrecision
+
+
 // End of file
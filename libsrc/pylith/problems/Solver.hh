@@ -73,6 +73,37 @@ public :
    */
   void skipNullSpaceCreation(const bool value);
 
+  /** Set flag for reusing the coarse spaces (aggregates and
+   * interpolation) of algebraic multigrid preconditioners when the
+   * Jacobian is reformed.
+   *
+   * Only GAMG preconditioners (including those nested in field
+   * splits) are supported. ML only takes this setting from the
+   * options database before its first setup; use
+   * -pc_ml_reuse_interpolation for ML.
+   *
+   * Only the numeric part of the preconditioner setup (Galerkin
+   * coarse operators and smoothers) is redone for reformed Jacobians,
+   * which is much cheaper and works well if the Jacobian values
+   * change only mildly between reforms.
+   *
+   * @param[in] value True to reuse AMG interpolation.
+   */
+  void reuseAMGInterpolation(const bool value);
+
+  /** Set flag for preconditioning with single precision storage.
+   *
+   * The preconditioner is replaced with a block Jacobi ILU(0)
+   * preconditioner whose factors are stored in single precision (see
+   * SinglePrecisionPC). The Krylov solver continues to use the
+   * double precision Jacobian as the operator. Not available with
+   * split fields or faults (Lagrange multiplier rows have zero
+   * diagonal entries).
+   *
+   * @param[in] value True to use single precision preconditioner storage.
+   */
+  void mixedPrecision(const bool value);
+
 
   /** Initialize solver.
    *
@@ -85,6 +116,39 @@ public :
 		  const topology::Jacobian& jacobian,
 		  Formulation* const formulation);
 
+  /** Solve the system.
+   *
+   * Only solvers that use a sparse Jacobian matrix implement this
+   * method.
+   *
+   * @param solution Solution field.
+   * @param jacobian Jacobian of the system.
+   * @param residual Residual field.
+   */
+  virtual
+  void solve(topology::Field* solution,
+	     topology::Jacobian* jacobian,
+	     const topology::Field& residual);
+
+  /** Get number of iterations in the most recent solve.
+   *
+   * @returns Number of iterations.
+   */
+  virtual
+  int numIterations(void) const;
+
+  /** Get total number of linear (KSP) iterations over all solves.
+   *
+   * @returns Number of linear iterations.
+   */
+  long numLinearIterationsTotal(void) const;
+
+  /** Get total number of nonlinear (SNES) iterations over all solves.
+   *
+   * @returns Number of nonlinear iterations.
+   */
+  long numNonlinearIterationsTotal(void) const;
+
 // PROTECTED METHODS ////////////////////////////////////////////////////
 protected :
 
@@ -105,6 +169,24 @@ protected :
 			Formulation* const formulation,
 			const topology::Jacobian& jacobian,
 			const topology::SolutionFields& fields);
+
+  /** Tell GAMG preconditioners (including those nested in field
+   * splits) to reuse their interpolation in later setups. Must be
+   * called after the preconditioner is set up.
+   *
+   * @param pc PETSc preconditioner.
+   * @returns True if at least one GAMG preconditioner was found.
+   */
+  static
+  bool _setReuseInterpolation(PetscPC pc);
+
+  /** Use block Jacobi ILU(0) preconditioner with single precision
+   * factors. Must be called after the options are set for the
+   * solver, so that they do not override the preconditioner type.
+   *
+   * @param pc PETSc preconditioner.
+   */
+  void _setupMixedPrecision(PetscPC pc);
   
   /** :MATT: :TODO: DOCUMENT THIS.
    */
@@ -122,6 +204,12 @@ protected :
   PetscMat _jacobianPCFault; ///< Preconditioning matrix for Lagrange constraints.
   FaultPreconCtx _ctx; ///< Context for preconditioning matrix for Lagrange constraints.
   bool _skipNullSpaceCreation; ///< Skip creating the null space (useful for very small problems with no null space).
+  bool _reuseAMGInterpolation; ///< Reuse AMG interpolation when Jacobian is reformed.
+  bool _isInterpolationReused; ///< True if AMG preconditioners were told to reuse interpolation.
+  bool _mixedPrecision; ///< Use preconditioner with single precision storage.
+  SinglePrecisionPC* _pcSingle; ///< Preconditioner with single precision factors.
+  long _numLinearIterationsTotal; ///< Total number of linear iterations over all solves.
+  long _numNonlinearIterationsTotal; ///< Total number of nonlinear iterations over all solves.
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
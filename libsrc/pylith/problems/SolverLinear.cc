@@ -30,13 +30,17 @@
 #include "pylith/utils/EventLogger.hh" // USES EventLogger
 
 #include <petscksp.h> // USES PetscKSP
+#include <petsctime.h> // USES PetscTime()
+
+#include "journal/info.h" // USES journal::info_t
 
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 
 // ----------------------------------------------------------------------
 // Constructor
 pylith::problems::SolverLinear::SolverLinear(void) :
-  _ksp(0)
+  _ksp(0),
+  _pcSetupTimeFull(0.0)
 { // constructor
 } // constructor
 
@@ -81,6 +85,21 @@ pylith::problems::SolverLinear::initialize(const topology::SolutionFields& field
   err = KSPSetInitialGuessNonzero(_ksp, PETSC_FALSE);PYLITH_CHECK_ERROR(err);
   err = KSPSetFromOptions(_ksp);PYLITH_CHECK_ERROR(err);
 
+  // Measure convergence relative to the residual for a zero initial
+  // guess, so a predicted initial guess does not tighten the relative
+  // tolerance.
+  PetscErrorCode (*convergedTest)(PetscKSP, PetscInt, PetscReal, KSPConvergedReason*, void*) = NULL;
+  err = KSPGetConvergenceTest(_ksp, &convergedTest, NULL, NULL);PYLITH_CHECK_ERROR(err);
+  if (KSPConvergedDefault == convergedTest) {
+    err = KSPConvergedDefaultSetUIRNorm(_ksp);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  if (_mixedPrecision) {
+    PetscPC pc = 0;
+    err = KSPGetPC(_ksp, &pc);PYLITH_CHECK_ERROR(err);
+    _setupMixedPrecision(pc);
+  } // if
+
   if (formulation->splitFields()) {
     PetscPC pc = 0;
     err = KSPGetPC(_ksp, &pc);PYLITH_CHECK_ERROR(err);
@@ -120,16 +139,33 @@ pylith::problems::SolverLinear::solve(topology::Field* solution,
 
   PetscErrorCode err = 0;
   const PetscMat jacobianMat = jacobian->matrix();
+  const bool jacobianChanged = jacobian->valuesChanged();
   err = KSPSetOperators(_ksp, jacobianMat, jacobianMat);PYLITH_CHECK_ERROR(err);
   jacobian->resetValuesChanged();
 
+  // The operator is always the current Jacobian; only the
+  // preconditioner is lagged.
+  const bool lagPC = _formulation->lagPreconditioner();
+  err = KSPSetReusePreconditioner(_ksp, lagPC ? PETSC_TRUE : PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+
+  // Start from the predicted solution if the formulation provides one.
+  err = KSPSetInitialGuessNonzero(_ksp, _formulation->nonzeroInitialGuess() ? PETSC_TRUE : PETSC_FALSE);PYLITH_CHECK_ERROR(err);
+
   const PetscVec residualVec = residual.globalVector();
   const PetscVec solutionVec = solution->globalVector();
 
   _logger->eventEnd(setupEvent);
+
+  if (jacobianChanged && !lagPC) {
+    _setupPC();
+  } // if
+
   _logger->eventBegin(solveEvent);
 
   err = KSPSolve(_ksp, residualVec, solutionVec); PYLITH_CHECK_ERROR(err);
+  PetscInt numIterations = 0;
+  err = KSPGetIterationNumber(_ksp, &numIterations);PYLITH_CHECK_ERROR(err);
+  _numLinearIterationsTotal += numIterations;
 
   _logger->eventEnd(solveEvent);
   _logger->eventBegin(scatterEvent);
@@ -145,6 +181,21 @@ pylith::problems::SolverLinear::solve(topology::Field* solution,
   PYLITH_METHOD_END;
 } // solve
 
+// ----------------------------------------------------------------------
+// Get number of linear iterations in the most recent solve.
+int
+pylith::problems::SolverLinear::numIterations(void) const
+{ // numIterations
+  PYLITH_METHOD_BEGIN;
+
+  PetscInt numIterations = 0;
+  if (_ksp) {
+    PetscErrorCode err = KSPGetIterationNumber(_ksp, &numIterations);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  PYLITH_METHOD_RETURN(numIterations);
+} // numIterations
+
 // ----------------------------------------------------------------------
 // Initialize logger.
 void
@@ -158,9 +209,55 @@ pylith::problems::SolverLinear::_initializeLogger(void)
   _logger->registerEvent("SoLi setup");
   _logger->registerEvent("SoLi solve");
   _logger->registerEvent("SoLi scatter");
+  _logger->registerEvent("SoLi PC setup");
+  _logger->registerEvent("SoLi PC numeric setup");
 
   PYLITH_METHOD_END;
 } // initializeLogger
 
+// ----------------------------------------------------------------------
+// Set up preconditioner for reformed Jacobian.
+void
+pylith::problems::SolverLinear::_setupPC(void)
+{ // _setupPC
+  PYLITH_METHOD_BEGIN;
+
+  assert(_ksp);
+  assert(_logger);
+
+  const bool isNumericOnly = _reuseAMGInterpolation && _isInterpolationReused;
+  const int pcEvent = _logger->eventId(isNumericOnly ? "SoLi PC numeric setup" : "SoLi PC setup");
+
+  PetscErrorCode err = 0;
+  PetscLogDouble tStart = 0.0, tEnd = 0.0;
+  err = PetscTime(&tStart);PYLITH_CHECK_ERROR(err);
+  _logger->eventBegin(pcEvent);
+  err = KSPSetUp(_ksp);PYLITH_CHECK_ERROR(err);
+  err = KSPSetUpOnBlocks(_ksp);PYLITH_CHECK_ERROR(err);
+  _logger->eventEnd(pcEvent);
+  err = PetscTime(&tEnd);PYLITH_CHECK_ERROR(err);
+  const double setupTime = tEnd - tStart;
+
+  journal::info_t info("solverlinear");
+  if (isNumericOnly) {
+    info << journal::at(__HERE__)
+	 << "Numeric-only preconditioner setup took " << setupTime
+	 << " s, full setup took " << _pcSetupTimeFull << " s." << journal::endl;
+  } else {
+    _pcSetupTimeFull = setupTime;
+    if (_reuseAMGInterpolation) {
+      PetscPC pc = NULL;
+      err = KSPGetPC(_ksp, &pc);PYLITH_CHECK_ERROR(err);
+      _isInterpolationReused = _setReuseInterpolation(pc);
+      if (!_isInterpolationReused) {
+	info << journal::at(__HERE__)
+	     << "No GAMG preconditioner found; cannot reuse interpolation." << journal::endl;
+      } // if
+    } // if
+  } // if/else
+
+  PYLITH_METHOD_END;
+} // _setupPC
+
 
 // End of file
@@ -75,16 +75,31 @@ public :
 	     topology::Jacobian* jacobian,
 	     const topology::Field& residual);
 
+  /** Get number of linear iterations in the most recent solve.
+   *
+   * @returns Number of iterations.
+   */
+  int numIterations(void) const;
+
 // PRIVATE METHODS //////////////////////////////////////////////////////
 private :
 
   /// Initialize logger.
   void _initializeLogger(void);
 
+  /** Set up preconditioner for reformed Jacobian.
+   *
+   * The full and numeric-only setups are logged as separate events,
+   * so the time saved by reusing AMG interpolation is reported by
+   * the PETSc log.
+   */
+  void _setupPC(void);
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
 
   PetscKSP _ksp; ///< PETSc KSP linear solver.
+  double _pcSetupTimeFull; ///< Wall time for most recent full preconditioner setup.
 
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
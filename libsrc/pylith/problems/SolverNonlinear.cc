@@ -116,6 +116,14 @@ pylith::problems::SolverNonlinear::initialize(const topology::SolutionFields& fi
   err = SNESSetFromOptions(_snes);PYLITH_CHECK_ERROR(err);
   err = SNESSetComputeInitialGuess(_snes, initialGuess, (void*) formulation);PYLITH_CHECK_ERROR(err);
 
+  if (_mixedPrecision) {
+    PetscKSP ksp = 0;
+    PetscPC pc = 0;
+    err = SNESGetKSP(_snes, &ksp); PYLITH_CHECK_ERROR(err);
+    err = KSPGetPC(ksp, &pc); PYLITH_CHECK_ERROR(err);
+    _setupMixedPrecision(pc);
+  } // if
+
   if (formulation->splitFields()) {
     PetscKSP ksp = 0;
     PetscPC pc = 0;
@@ -149,7 +157,28 @@ pylith::problems::SolverNonlinear::solve(topology::Field* solution,
   PetscErrorCode err = 0;
   const PetscVec solutionVec = solution->globalVector();
 
+  // Keep the preconditioner from an earlier solve if the formulation
+  // is lagging it (the Jacobian is still reformed).
+  assert(_formulation);
+  err = SNESSetLagPreconditioner(_snes, _formulation->lagPreconditioner() ? -1 : 1);PYLITH_CHECK_ERROR(err);
+
   err = SNESSolve(_snes, PETSC_NULL, solutionVec); PYLITH_CHECK_ERROR(err);
+  PetscInt numIterations = 0;
+  err = SNESGetIterationNumber(_snes, &numIterations);PYLITH_CHECK_ERROR(err);
+  _numNonlinearIterationsTotal += numIterations;
+  err = SNESGetLinearSolveIterations(_snes, &numIterations);PYLITH_CHECK_ERROR(err);
+  _numLinearIterationsTotal += numIterations;
+
+  // AMG preconditioners exist once the first solve has set them up;
+  // later Jacobian reforms only redo the numeric setup (see PCSetUp
+  // in the PETSc log for timing).
+  if (_reuseAMGInterpolation && !_isInterpolationReused) {
+    PetscKSP ksp = NULL;
+    PetscPC pc = NULL;
+    err = SNESGetKSP(_snes, &ksp); PYLITH_CHECK_ERROR(err);
+    err = KSPGetPC(ksp, &pc); PYLITH_CHECK_ERROR(err);
+    _isInterpolationReused = _setReuseInterpolation(pc);
+  } // if
   
   _logger->eventEnd(solveEvent);
   _logger->eventBegin(scatterEvent);
@@ -165,6 +194,21 @@ pylith::problems::SolverNonlinear::solve(topology::Field* solution,
   PYLITH_METHOD_END;
 } // solve
 
+// ----------------------------------------------------------------------
+// Get number of nonlinear iterations in the most recent solve.
+int
+pylith::problems::SolverNonlinear::numIterations(void) const
+{ // numIterations
+  PYLITH_METHOD_BEGIN;
+
+  PetscInt numIterations = 0;
+  if (_snes) {
+    PetscErrorCode err = SNESGetIterationNumber(_snes, &numIterations);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  PYLITH_METHOD_RETURN(numIterations);
+} // numIterations
+
 // ----------------------------------------------------------------------
 // Generic C interface for reformResidual for integration with
 // PETSc SNES solvers.
@@ -582,7 +626,11 @@ pylith::problems::SolverNonlinear::initialGuess(PetscSNES snes,
 { // initialGuess
   PYLITH_METHOD_BEGIN;
 
-  PetscErrorCode err = VecSet(initialGuessVec, 0.0);PYLITH_CHECK_ERROR(err);
+  // Keep the predicted solution if the formulation provides one.
+  Formulation* formulation = (Formulation*) lsctx;
+  if (!formulation || !formulation->nonzeroInitialGuess()) {
+    PetscErrorCode err = VecSet(initialGuessVec, 0.0);PYLITH_CHECK_ERROR(err);
+  } // if
 
   PYLITH_METHOD_RETURN(0);
 } // initialGuess
@@ -76,6 +76,12 @@ public :
 	     topology::Jacobian* jacobian,
 	     const topology::Field& residual);
 
+  /** Get number of nonlinear iterations in the most recent solve.
+   *
+   * @returns Number of iterations.
+   */
+  int numIterations(void) const;
+
   /** Generic C interface for reformResidual for integration with
    * PETSc SNES solvers.
    *
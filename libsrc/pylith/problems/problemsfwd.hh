@@ -38,6 +38,7 @@ namespace pylith {
     class SolverLinear;
     class SolverNonlinear;
     class SolverLumped;
+    class SinglePrecisionPC;
 
   } // problems
 } // pylith
@@ -0,0 +1,560 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "MatAssemblyPlan.hh" // implementation of class methods
+
+#include "Mesh.hh" // USES Mesh
+#include "Field.hh" // USES Field
+
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include <algorithm> // USES std::equal(), std::lower_bound()
+#include <cassert> // USES assert()
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace topology {
+    namespace _MatAssemblyPlan {
+      /** Find location of column in row of compressed sparse row matrix.
+       *
+       * @param ia Row offsets.
+       * @param ja Column indices (sorted within each row).
+       * @param row Local row.
+       * @param col Local column.
+       * @returns Location of entry in value array or -1 if not found.
+       */
+      PetscInt
+      findEntry(const PetscInt* ia,
+		const PetscInt* ja,
+		const PetscInt row,
+		const PetscInt col)
+      { // findEntry
+	const PetscInt* begin = &ja[ia[row]];
+	const PetscInt* end = &ja[ia[row+1]];
+	const PetscInt* entry = std::lower_bound(begin, end, col);
+	return (entry != end && *entry == col) ? PetscInt(entry - ja) : -1;
+      } // findEntry
+    } // _MatAssemblyPlan
+  } // topology
+} // pylith
+
+// ----------------------------------------------------------------------
+// Default constructor.
+pylith::topology::MatAssemblyPlan::MatAssemblyPlan(void) :
+  _mat(NULL),
+  _matDiag(NULL),
+  _matOffDiag(NULL),
+  _valuesDiag(NULL),
+  _valuesOffDiag(NULL),
+  _nonzeroState(-1),
+  _blockSize(1),
+  _isSymmetricStorage(false),
+  _isDirect(false),
+  _useDirect(false),
+  _inAssembly(false)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Default destructor
+pylith::topology::MatAssemblyPlan::~MatAssemblyPlan(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate PETSc and local data structures.
+void
+pylith::topology::MatAssemblyPlan::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  if (_inAssembly) {
+    end();
+  } // if
+
+  _mat = NULL;
+  _matDiag = NULL;
+  _matOffDiag = NULL;
+  _nonzeroState = -1;
+  _isDirect = false;
+  _useDirect = false;
+
+  _cells.clear();
+  _indicesOffset.clear();
+  _indices.clear();
+  _locationOffset.clear();
+  _location.clear();
+  _remoteRows.clear();
+  _hasRemote.clear();
+  _blockOffset.clear();
+  _blockIndices.clear();
+  _isBlocked.clear();
+  _blockSize = 1;
+  _isSymmetricStorage = false;
+
+  PYLITH_METHOD_END;
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Start adding cell matrices to sparse matrix.
+void
+pylith::topology::MatAssemblyPlan::begin(const PetscMat mat,
+					 const Field& field,
+					 const PetscInt* cells,
+					 const PetscInt numCells)
+{ // begin
+  PYLITH_METHOD_BEGIN;
+
+  assert(mat);
+  assert(!_inAssembly);
+  assert(cells || 0 == numCells);
+
+  const bool isCurrent = mat == _mat && size_t(numCells) == _cells.size() &&
+    std::equal(cells, cells+numCells, _cells.begin());
+  if (!isCurrent) {
+    deallocate();
+    _mat = mat;
+    _setupIndices(field, cells, numCells);
+    _setupBlocks();
+  } // if
+
+  PetscErrorCode err;
+  if (_isSymmetricStorage) {
+    // Entries below the diagonal may still arrive through addClosure().
+    err = MatSetOption(_mat, MAT_IGNORE_LOWER_TRIANGULAR, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  // Locations of entries in the value arrays are only valid as long
+  // as the nonzero structure of the matrix does not change. We can
+  // only compute them once the matrix has been assembled.
+  PetscObjectState nonzeroState = 0;
+  PetscBool assembled = PETSC_FALSE;
+  err = MatGetNonzeroState(_mat, &nonzeroState);PYLITH_CHECK_ERROR(err);
+  err = MatAssembled(_mat, &assembled);PYLITH_CHECK_ERROR(err);
+  if (nonzeroState != _nonzeroState) {
+    _isDirect = false;
+    _location.clear();
+    if (assembled) {
+      _isDirect = _setupDirect();
+      _nonzeroState = nonzeroState;
+    } // if
+  } // if
+
+  _useDirect = _isDirect && assembled;
+  if (_useDirect) {
+    assert(_matDiag);
+    err = MatSeqAIJGetArray(_matDiag, &_valuesDiag);PYLITH_CHECK_ERROR(err);
+    if (_matOffDiag) {
+      err = MatSeqAIJGetArray(_matOffDiag, &_valuesOffDiag);PYLITH_CHECK_ERROR(err);
+    } // if
+  } // if
+  _inAssembly = true;
+
+  PYLITH_METHOD_END;
+} // begin
+
+// ----------------------------------------------------------------------
+// Add values associated with closure of cell to sparse matrix.
+void
+pylith::topology::MatAssemblyPlan::addClosure(const PetscScalar* valuesCell,
+					      const PetscInt valuesSize,
+					      const PetscInt index)
+{ // addClosure
+  assert(_inAssembly);
+  assert(valuesCell);
+  assert(0 <= index && size_t(index+1) < _indicesOffset.size());
+
+  const PetscInt offset = _indicesOffset[index];
+  const PetscInt numIndices = _indicesOffset[index+1] - offset;
+  assert(numIndices*numIndices == valuesSize);
+  const PetscInt* indices = &_indices[offset];
+
+  PetscErrorCode err;
+  if (!_useDirect) {
+    if (_blockSize > 1 && _isBlocked[index]) {
+      const PetscInt blockOffset = _blockOffset[index];
+      const PetscInt numBlocks = _blockOffset[index+1] - blockOffset;
+      const PetscInt* blockIndices = &_blockIndices[blockOffset];
+      err = MatSetValuesBlocked(_mat, numBlocks, blockIndices, numBlocks, blockIndices, valuesCell, ADD_VALUES);PYLITH_CHECK_ERROR(err);
+    } else {
+      err = MatSetValues(_mat, numIndices, indices, numIndices, indices, valuesCell, ADD_VALUES);PYLITH_CHECK_ERROR(err);
+    } // if/else
+    return;
+  } // if
+
+  const PetscInt* location = &_location[_locationOffset[index]];
+  for (PetscInt i=0; i < valuesSize; ++i) {
+    const PetscInt loc = location[i];
+    if (loc >= 0) {
+      _valuesDiag[loc] += valuesCell[i];
+    } else if (loc < -1) {
+      assert(_valuesOffDiag);
+      _valuesOffDiag[-(loc+2)] += valuesCell[i];
+    } // if/else
+  } // for
+
+  // Rows owned by other processes go through the stash.
+  if (_hasRemote[index]) {
+    err = MatSetValues(_mat, numIndices, &_remoteRows[offset], numIndices, indices, valuesCell, ADD_VALUES);PYLITH_CHECK_ERROR(err);
+  } // if
+} // addClosure
+
+// ----------------------------------------------------------------------
+// Add values associated with closure of cell to sparse matrix for a
+// symmetric cell matrix.
+void
+pylith::topology::MatAssemblyPlan::addClosureSymmetric(PetscScalar* valuesCell,
+						       const PetscInt valuesSize,
+						       const PetscInt blockSize,
+						       const PetscInt index)
+{ // addClosureSymmetric
+  assert(_inAssembly);
+  assert(valuesCell);
+  assert(blockSize > 0);
+  assert(0 <= index && size_t(index+1) < _indicesOffset.size());
+
+  const PetscInt numIndices = _indicesOffset[index+1] - _indicesOffset[index];
+  assert(numIndices*numIndices == valuesSize);
+  assert(0 == numIndices % blockSize);
+
+  if (!_isSymmetricStorage || blockSize != _blockSize || !_isBlocked[index]) {
+    _fillLowerBlocks(valuesCell, numIndices, blockSize);
+    addClosure(valuesCell, valuesSize, index);
+    return;
+  } // if
+
+  // Insert one row of blocks at a time into the upper triangle of the
+  // matrix. Global block (gi, gj) with gj >= gi is cell block (i, j)
+  // if j >= i, otherwise it is the transpose of cell block (j, i).
+  const PetscInt bs = _blockSize;
+  const PetscInt blockOffset = _blockOffset[index];
+  const PetscInt numBlocks = _blockOffset[index+1] - blockOffset;
+  const PetscInt* blockIndices = &_blockIndices[blockOffset];
+  _blockValues.resize(bs*numIndices);
+  _blockCols.resize(numBlocks);
+
+  PetscErrorCode err;
+  for (PetscInt i=0; i < numBlocks; ++i) {
+    const PetscInt gi = blockIndices[i];
+    if (gi < 0) {
+      continue;
+    } // if
+
+    PetscInt numCols = 0;
+    for (PetscInt j=0; j < numBlocks; ++j) {
+      if (blockIndices[j] >= gi) {
+	_blockCols[numCols++] = blockIndices[j];
+      } // if
+    } // for
+
+    const PetscInt width = numCols*bs;
+    for (PetscInt j=0, k=0; j < numBlocks; ++j) {
+      if (blockIndices[j] < gi) {
+	continue;
+      } // if
+      for (PetscInt r=0; r < bs; ++r) {
+	for (PetscInt s=0; s < bs; ++s) {
+	  _blockValues[r*width+k*bs+s] = (j >= i) ?
+	    valuesCell[(i*bs+r)*numIndices+j*bs+s] :
+	    valuesCell[(j*bs+s)*numIndices+i*bs+r];
+	} // for
+      } // for
+      ++k;
+    } // for
+    err = MatSetValuesBlocked(_mat, 1, &gi, numCols, &_blockCols[0], &_blockValues[0], ADD_VALUES);PYLITH_CHECK_ERROR(err);
+  } // for
+} // addClosureSymmetric
+
+// ----------------------------------------------------------------------
+// Finish adding cell matrices to sparse matrix.
+void
+pylith::topology::MatAssemblyPlan::end(void)
+{ // end
+  PYLITH_METHOD_BEGIN;
+
+  PetscErrorCode err;
+  if (_valuesDiag) {
+    err = MatSeqAIJRestoreArray(_matDiag, &_valuesDiag);PYLITH_CHECK_ERROR(err);
+    _valuesDiag = NULL;
+  } // if
+  if (_valuesOffDiag) {
+    err = MatSeqAIJRestoreArray(_matOffDiag, &_valuesOffDiag);PYLITH_CHECK_ERROR(err);
+    _valuesOffDiag = NULL;
+  } // if
+  if (_useDirect) {
+    err = PetscObjectStateIncrease((PetscObject) _mat);PYLITH_CHECK_ERROR(err);
+  } // if
+  _inAssembly = false;
+
+  PYLITH_METHOD_END;
+} // end
+
+// ----------------------------------------------------------------------
+// Get flag indicating whether values are added directly to matrix storage.
+bool
+pylith::topology::MatAssemblyPlan::isDirect(void) const
+{ // isDirect
+  return _useDirect;
+} // isDirect
+
+// ----------------------------------------------------------------------
+// Get flag indicating whether the matrix only stores the upper triangle.
+bool
+pylith::topology::MatAssemblyPlan::isSymmetricStorage(void) const
+{ // isSymmetricStorage
+  return _isSymmetricStorage;
+} // isSymmetricStorage
+
+// ----------------------------------------------------------------------
+// Compute global indices of closure of each cell.
+void
+pylith::topology::MatAssemblyPlan::_setupIndices(const Field& field,
+						 const PetscInt* cells,
+						 const PetscInt numCells)
+{ // _setupIndices
+  PYLITH_METHOD_BEGIN;
+
+  PetscDM dmMesh = field.mesh().dmMesh();assert(dmMesh);
+  PetscSection section = field.localSection();assert(section);
+  PetscSection globalSection = NULL;
+  PetscSF sf = NULL;
+  PetscErrorCode err;
+  err = DMGetPointSF(dmMesh, &sf);PYLITH_CHECK_ERROR(err);assert(sf);
+  err = PetscSectionCreateGlobalSection(section, sf, PETSC_FALSE, PETSC_FALSE, &globalSection);PYLITH_CHECK_ERROR(err);assert(globalSection);
+
+  _cells.assign(cells, cells+numCells);
+  _indicesOffset.resize(numCells+1);
+  _indicesOffset[0] = 0;
+  _indices.clear();
+  for (PetscInt c=0; c < numCells; ++c) {
+    PetscInt numIndices = 0;
+    PetscInt* indices = NULL;
+    err = DMPlexGetClosureIndices(dmMesh, section, globalSection, cells[c], &numIndices, &indices, NULL);PYLITH_CHECK_ERROR(err);
+    _indices.insert(_indices.end(), indices, indices+numIndices);
+    _indicesOffset[c+1] = _indicesOffset[c] + numIndices;
+    err = DMPlexRestoreClosureIndices(dmMesh, section, globalSection, cells[c], &numIndices, &indices, NULL);PYLITH_CHECK_ERROR(err);
+  } // for
+
+  err = PetscSectionDestroy(&globalSection);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _setupIndices
+
+// ----------------------------------------------------------------------
+// Compute locations of entries in value arrays of matrix.
+bool
+pylith::topology::MatAssemblyPlan::_setupDirect(void)
+{ // _setupDirect
+  PYLITH_METHOD_BEGIN;
+
+  assert(_mat);
+
+  PetscErrorCode err;
+  PetscBool isSeqAIJ = PETSC_FALSE;
+  PetscBool isMPIAIJ = PETSC_FALSE;
+  err = PetscObjectTypeCompare((PetscObject) _mat, MATSEQAIJ, &isSeqAIJ);PYLITH_CHECK_ERROR(err);
+  err = PetscObjectTypeCompare((PetscObject) _mat, MATMPIAIJ, &isMPIAIJ);PYLITH_CHECK_ERROR(err);
+
+  // Map from local columns of off-diagonal block to global columns.
+  const PetscInt* colmap = NULL;
+  PetscInt numColsOffDiag = 0;
+  if (isSeqAIJ) {
+    _matDiag = _mat;
+    _matOffDiag = NULL;
+  } else if (isMPIAIJ) {
+    err = MatMPIAIJGetSeqAIJ(_mat, &_matDiag, &_matOffDiag, &colmap);PYLITH_CHECK_ERROR(err);
+    err = MatGetSize(_matOffDiag, NULL, &numColsOffDiag);PYLITH_CHECK_ERROR(err);
+  } else {
+    // Use cached indices with MatSetValues() for other matrix types.
+    PYLITH_METHOD_RETURN(false);
+  } // if/else
+
+  PetscInt rStart = 0, rEnd = 0, cStart = 0, cEnd = 0;
+  err = MatGetOwnershipRange(_mat, &rStart, &rEnd);PYLITH_CHECK_ERROR(err);
+  err = MatGetOwnershipRangeColumn(_mat, &cStart, &cEnd);PYLITH_CHECK_ERROR(err);
+
+  PetscInt numRows = 0;
+  const PetscInt* iaDiag = NULL;
+  const PetscInt* jaDiag = NULL;
+  const PetscInt* iaOffDiag = NULL;
+  const PetscInt* jaOffDiag = NULL;
+  PetscBool doneDiag = PETSC_FALSE;
+  PetscBool doneOffDiag = PETSC_TRUE;
+  err = MatGetRowIJ(_matDiag, 0, PETSC_FALSE, PETSC_FALSE, &numRows, &iaDiag, &jaDiag, &doneDiag);PYLITH_CHECK_ERROR(err);
+  if (_matOffDiag) {
+    err = MatGetRowIJ(_matOffDiag, 0, PETSC_FALSE, PETSC_FALSE, &numRows, &iaOffDiag, &jaOffDiag, &doneOffDiag);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  bool found = doneDiag && doneOffDiag;
+  const PetscInt numCells = _cells.size();
+  _locationOffset.resize(numCells+1);
+  _locationOffset[0] = 0;
+  for (PetscInt c=0; c < numCells; ++c) {
+    const PetscInt numIndices = _indicesOffset[c+1] - _indicesOffset[c];
+    _locationOffset[c+1] = _locationOffset[c] + numIndices*numIndices;
+  } // for
+  _location.resize(_locationOffset[numCells]);
+  _remoteRows.resize(_indices.size());
+  _hasRemote.resize(numCells);
+
+  for (PetscInt c=0; c < numCells && found; ++c) {
+    const PetscInt numIndices = _indicesOffset[c+1] - _indicesOffset[c];
+    const PetscInt* indices = &_indices[_indicesOffset[c]];
+    PetscInt* remoteRows = &_remoteRows[_indicesOffset[c]];
+    PetscInt* location = &_location[_locationOffset[c]];
+
+    _hasRemote[c] = false;
+    for (PetscInt i=0; i < numIndices && found; ++i) {
+      const PetscInt row = indices[i];
+      remoteRows[i] = -1;
+      if (row < rStart || row >= rEnd) {
+	// Constrained DOF or row owned by another process.
+	if (row >= 0) {
+	  remoteRows[i] = row;
+	  _hasRemote[c] = true;
+	} // if
+	for (PetscInt j=0; j < numIndices; ++j) {
+	  location[i*numIndices+j] = -1;
+	} // for
+	continue;
+      } // if
+
+      const PetscInt rowLocal = row - rStart;
+      for (PetscInt j=0; j < numIndices; ++j) {
+	const PetscInt col = indices[j];
+	PetscInt loc = -1;
+	if (col < 0) {
+	  // Constrained DOF.
+	} else if (col >= cStart && col < cEnd) {
+	  loc = _MatAssemblyPlan::findEntry(iaDiag, jaDiag, rowLocal, col-cStart);
+	  found = found && loc >= 0;
+	} else {
+	  const PetscInt* colEntry = (colmap) ? std::lower_bound(colmap, colmap+numColsOffDiag, col) : NULL;
+	  if (colEntry && colEntry != colmap+numColsOffDiag && *colEntry == col) {
+	    const PetscInt entry = _MatAssemblyPlan::findEntry(iaOffDiag, jaOffDiag, rowLocal, colEntry-colmap);
+	    found = found && entry >= 0;
+	    loc = -(entry+2);
+	  } else {
+	    found = false;
+	  } // if/else
+	} // if/else
+	location[i*numIndices+j] = loc;
+      } // for
+    } // for
+  } // for
+
+  err = MatRestoreRowIJ(_matDiag, 0, PETSC_FALSE, PETSC_FALSE, &numRows, &iaDiag, &jaDiag, &doneDiag);PYLITH_CHECK_ERROR(err);
+  if (_matOffDiag) {
+    err = MatRestoreRowIJ(_matOffDiag, 0, PETSC_FALSE, PETSC_FALSE, &numRows, &iaOffDiag, &jaOffDiag, &doneOffDiag);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  if (!found) {
+    // Nonzero structure does not contain all entries of the cell
+    // matrices; fall back to MatSetValues().
+    _location.clear();
+    _remoteRows.clear();
+    _hasRemote.clear();
+  } // if
+
+  PYLITH_METHOD_RETURN(found);
+} // _setupDirect
+
+
+// ----------------------------------------------------------------------
+// Compute block indices of closure of each cell.
+void
+pylith::topology::MatAssemblyPlan::_setupBlocks(void)
+{ // _setupBlocks
+  PYLITH_METHOD_BEGIN;
+
+  assert(_mat);
+
+  PetscErrorCode err;
+  PetscBool isSeqBAIJ = PETSC_FALSE;
+  PetscBool isMPIBAIJ = PETSC_FALSE;
+  PetscBool isSeqSBAIJ = PETSC_FALSE;
+  PetscBool isMPISBAIJ = PETSC_FALSE;
+  err = PetscObjectTypeCompare((PetscObject) _mat, MATSEQBAIJ, &isSeqBAIJ);PYLITH_CHECK_ERROR(err);
+  err = PetscObjectTypeCompare((PetscObject) _mat, MATMPIBAIJ, &isMPIBAIJ);PYLITH_CHECK_ERROR(err);
+  err = PetscObjectTypeCompare((PetscObject) _mat, MATSEQSBAIJ, &isSeqSBAIJ);PYLITH_CHECK_ERROR(err);
+  err = PetscObjectTypeCompare((PetscObject) _mat, MATMPISBAIJ, &isMPISBAIJ);PYLITH_CHECK_ERROR(err);
+
+  _isSymmetricStorage = isSeqSBAIJ || isMPISBAIJ;
+  _blockSize = 1;
+  _blockOffset.clear();
+  _blockIndices.clear();
+  _isBlocked.clear();
+  if (!(isSeqBAIJ || isMPIBAIJ || _isSymmetricStorage)) {
+    PYLITH_METHOD_END;
+  } // if
+  err = MatGetBlockSize(_mat, &_blockSize);PYLITH_CHECK_ERROR(err);
+  const PetscInt bs = _blockSize;
+
+  const PetscInt numCells = _cells.size();
+  _blockOffset.resize(numCells+1);
+  _blockOffset[0] = 0;
+  _isBlocked.resize(numCells);
+  for (PetscInt c=0; c < numCells; ++c) {
+    const PetscInt numIndices = _indicesOffset[c+1] - _indicesOffset[c];
+    const PetscInt* indices = &_indices[_indicesOffset[c]];
+
+    // Closure must consist of whole blocks that are either
+    // contiguous, aligned global indices or completely constrained.
+    bool isBlocked = 0 == numIndices % bs;
+    for (PetscInt i=0; i < numIndices && isBlocked; i += bs) {
+      const PetscInt first = indices[i];
+      for (PetscInt d=1; d < bs && isBlocked; ++d) {
+	isBlocked = (first < 0) ? indices[i+d] < 0 : indices[i+d] == first+d;
+      } // for
+      isBlocked = isBlocked && (first < 0 || 0 == first % bs);
+    } // for
+    if (isBlocked) {
+      for (PetscInt i=0; i < numIndices; i += bs) {
+	_blockIndices.push_back((indices[i] >= 0) ? indices[i] / bs : -1);
+      } // for
+    } // if
+    _isBlocked[c] = isBlocked;
+    _blockOffset[c+1] = _blockIndices.size();
+  } // for
+
+  PYLITH_METHOD_END;
+} // _setupBlocks
+
+// ----------------------------------------------------------------------
+// Fill blocks below diagonal of cell matrix from blocks above the diagonal.
+void
+pylith::topology::MatAssemblyPlan::_fillLowerBlocks(PetscScalar* values,
+						    const PetscInt numIndices,
+						    const PetscInt blockSize)
+{ // _fillLowerBlocks
+  assert(values);
+  assert(blockSize > 0);
+
+  for (PetscInt r=blockSize; r < numIndices; ++r) {
+    const PetscInt cEnd = (r / blockSize) * blockSize;
+    for (PetscInt c=0; c < cEnd; ++c) {
+      values[r*numIndices+c] = values[c*numIndices+r];
+    } // for
+  } // for
+} // _fillLowerBlocks
+
+
+// End of file
@@ -0,0 +1,230 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/topology/MatAssemblyPlan.hh
+ *
+ * @brief Precomputed insertion pattern for adding cell matrices to a
+ * sparse matrix.
+ */
+
+#if !defined(pylith_topology_matassemblyplan_hh)
+#define pylith_topology_matassemblyplan_hh
+
+// Include directives ---------------------------------------------------
+#include "topologyfwd.hh" // forward declarations
+
+#include "pylith/utils/petscfwd.h" // HASA PetscMat
+#include "pylith/utils/types.hh" // HASA PetscInt, PetscScalar
+
+#include <vector> // HASA std::vector
+
+// MatAssemblyPlan ------------------------------------------------------
+/** @brief Precomputed insertion pattern for adding cell matrices to a
+ * sparse matrix.
+ *
+ * Replaces MatVisitorMesh::setClosure() for repeated assembly of the
+ * same set of cells into the same matrix. The global indices of the
+ * closure of each cell are computed once, when the plan is created,
+ * instead of for every cell in every assembly.
+ *
+ * If the matrix is AIJ (sequential or MPI) and has been assembled,
+ * the plan also stores the location of every entry of each cell
+ * matrix in the value arrays of the diagonal and off-diagonal blocks
+ * of the locally owned rows. The values are then added directly to
+ * the matrix storage; only rows owned by other processes go through
+ * MatSetValues(). For other matrix types, or before the nonzero
+ * structure is known, the cached indices are passed to
+ * MatSetValues().
+ *
+ * If the matrix is BAIJ or SBAIJ and the closure indices of a cell
+ * form whole blocks of the matrix block size, the plan also stores
+ * the block indices of the cell and inserts the cell matrix with
+ * MatSetValuesBlocked().
+ *
+ * For symmetric cell matrices, addClosureSymmetric() only uses the
+ * blocks on and above the diagonal of the cell matrix. For SBAIJ
+ * matrices these blocks are inserted directly into the upper
+ * triangle of the sparse matrix (transposing blocks whose global
+ * block row is larger than the global block column); for other
+ * matrix types the blocks below the diagonal are filled in by
+ * symmetry before insertion.
+ *
+ * The plan is rebuilt when the matrix, the cells, or the nonzero
+ * structure of the matrix change.
+ *
+ * Usage:
+ * @code
+ * plan.begin(mat, field, cells, numCells);
+ * for (PetscInt c=0; c < numCells; ++c) {
+ *   ...
+ *   plan.addClosure(&cellMatrix[0], cellMatrix.size(), c);
+ * } // for
+ * plan.end();
+ * @endcode
+ */
+class pylith::topology::MatAssemblyPlan
+{ // MatAssemblyPlan
+  friend class TestMatAssemblyPlan; // unit testing
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Default constructor.
+  MatAssemblyPlan(void);
+
+  /// Default destructor
+  ~MatAssemblyPlan(void);
+
+  /// Deallocate PETSc and local data structures.
+  void deallocate(void);
+
+  /** Start adding cell matrices to sparse matrix, creating the plan
+   * if necessary.
+   *
+   * @param mat PETSc matrix.
+   * @param field Field associated with matrix layout.
+   * @param cells Array of cells.
+   * @param numCells Number of cells.
+   */
+  void begin(const PetscMat mat,
+	     const Field& field,
+	     const PetscInt* cells,
+	     const PetscInt numCells);
+
+  /** Add values associated with closure of cell to sparse matrix.
+   *
+   * @param valuesCell Array of values for cell.
+   * @param valuesSize Size of values array.
+   * @param index Index of cell in array of cells passed to begin().
+   */
+  void addClosure(const PetscScalar* valuesCell,
+		  const PetscInt valuesSize,
+		  const PetscInt index);
+
+  /** Add values associated with closure of cell to sparse matrix
+   * for a symmetric cell matrix.
+   *
+   * Only the blockSize x blockSize blocks on and above the diagonal
+   * of the cell matrix need to be set. The blocks below the diagonal
+   * are overwritten if the matrix format needs them.
+   *
+   * @param valuesCell Array of values for cell.
+   * @param valuesSize Size of values array.
+   * @param blockSize Size of blocks in cell matrix (number of components).
+   * @param index Index of cell in array of cells passed to begin().
+   */
+  void addClosureSymmetric(PetscScalar* valuesCell,
+			   const PetscInt valuesSize,
+			   const PetscInt blockSize,
+			   const PetscInt index);
+
+  /// Finish adding cell matrices to sparse matrix.
+  void end(void);
+
+  /** Get flag indicating whether values are added directly to matrix
+   * storage in the current (or most recent) assembly.
+   *
+   * @returns True if values are added directly to matrix storage.
+   */
+  bool isDirect(void) const;
+
+  /** Get flag indicating whether the matrix only stores the upper
+   * triangle (SBAIJ).
+   *
+   * @returns True if matrix uses symmetric storage.
+   */
+  bool isSymmetricStorage(void) const;
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Compute global indices of closure of each cell.
+   *
+   * @param field Field associated with matrix layout.
+   * @param cells Array of cells.
+   * @param numCells Number of cells.
+   */
+  void _setupIndices(const Field& field,
+		     const PetscInt* cells,
+		     const PetscInt numCells);
+
+  /** Compute locations of entries in value arrays of matrix.
+   *
+   * @returns True if all locally owned entries were found.
+   */
+  bool _setupDirect(void);
+
+  /** Compute block indices of closure of each cell for BAIJ and
+   * SBAIJ matrices.
+   */
+  void _setupBlocks(void);
+
+  /** Fill blocks below diagonal of cell matrix from blocks above the
+   * diagonal.
+   *
+   * @param values Array of values for cell.
+   * @param numIndices Number of rows (and columns) in cell matrix.
+   * @param blockSize Size of blocks in cell matrix.
+   */
+  static
+  void _fillLowerBlocks(PetscScalar* values,
+			const PetscInt numIndices,
+			const PetscInt blockSize);
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  PetscMat _mat; ///< PETSc matrix associated with plan.
+  PetscMat _matDiag; ///< Diagonal block of locally owned rows.
+  PetscMat _matOffDiag; ///< Off-diagonal block of locally owned rows (NULL if sequential).
+  PetscScalar* _valuesDiag; ///< Values of diagonal block (during assembly).
+  PetscScalar* _valuesOffDiag; ///< Values of off-diagonal block (during assembly).
+  PetscObjectState _nonzeroState; ///< State of nonzero structure when locations were computed.
+
+  std::vector<PetscInt> _cells; ///< Cells in plan.
+  std::vector<PetscInt> _indicesOffset; ///< Offsets into indices for each cell.
+  std::vector<PetscInt> _indices; ///< Global indices of closure of each cell.
+  std::vector<PetscInt> _locationOffset; ///< Offsets into locations for each cell.
+  std::vector<PetscInt> _location; ///< Locations of cell matrix entries in value arrays.
+  std::vector<PetscInt> _remoteRows; ///< Rows owned by other processes (-1 if local).
+  std::vector<bool> _hasRemote; ///< True if cell has rows owned by other processes.
+  std::vector<PetscInt> _blockOffset; ///< Offsets into block indices for each cell.
+  std::vector<PetscInt> _blockIndices; ///< Global block indices of closure of each cell (-1 if constrained).
+  std::vector<bool> _isBlocked; ///< True if closure of cell consists of whole blocks.
+  std::vector<PetscScalar> _blockValues; ///< Buffer for row of blocks.
+  std::vector<PetscInt> _blockCols; ///< Buffer for block columns.
+
+  PetscInt _blockSize; ///< Block size of matrix (1 if not BAIJ or SBAIJ).
+  bool _isSymmetricStorage; ///< True if matrix only stores upper triangle.
+  bool _isDirect; ///< True if locations are valid.
+  bool _useDirect; ///< True if current assembly uses locations.
+  bool _inAssembly; ///< True between begin() and end().
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  MatAssemblyPlan(const MatAssemblyPlan&); ///< Not implemented
+  const MatAssemblyPlan& operator=(const MatAssemblyPlan&); ///< Not implemented
+
+}; // MatAssemblyPlan
+
+#endif // pylith_topology_matassemblyplan_hh
+
+
+// End of file
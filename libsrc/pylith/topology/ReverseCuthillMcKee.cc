@@ -23,6 +23,11 @@
 #include "pylith/topology/Mesh.hh" // USES Mesh
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 
+#include <algorithm> // USES std::sort(), std::reverse()
+#include <cassert> // USES assert()
+#include <vector> // USES std::vector
+#include <utility> // USES std::pair
+
 // ----------------------------------------------------------------------
 // Reorder vertices and cells in mesh.
 void
@@ -42,5 +47,244 @@ pylith::topology::ReverseCuthillMcKee::reorder(topology::Mesh* mesh)
   mesh->dmMesh(dmNew);
 } // reorder
 
+// ----------------------------------------------------------------------
+// Reorder points of local mesh on each process.
+void
+pylith::topology::ReverseCuthillMcKee::reorderLocal(topology::Mesh* mesh)
+{ // reorderLocal
+  PYLITH_METHOD_BEGIN;
+
+  assert(mesh);
+  PetscDM dmOrig = mesh->dmMesh();assert(dmOrig);
+  PetscErrorCode err;
+
+  PetscInt pStart, pEnd, depth;
+  err = DMPlexGetChart(dmOrig, &pStart, &pEnd);PYLITH_CHECK_ERROR(err);
+  err = DMPlexGetDepth(dmOrig, &depth);PYLITH_CHECK_ERROR(err);
+  assert(0 == pStart);
+  assert(depth <= 3);
+
+  // Hybrid bounds; hybrid points are at the end of each stratum.
+  PetscInt cMax, fMax, eMax, vMax;
+  err = DMPlexGetHybridBounds(dmOrig, &cMax, &fMax, &eMax, &vMax);PYLITH_CHECK_ERROR(err);
+
+  // Range of each depth stratum, split into normal and hybrid points.
+  PetscInt stratumStart[4], stratumEnd[4], stratumMax[4];
+  for (PetscInt d=0; d <= depth; ++d) {
+    err = DMPlexGetDepthStratum(dmOrig, d, &stratumStart[d], &stratumEnd[d]);PYLITH_CHECK_ERROR(err);
+    PetscInt dMax = -1;
+    if (d == depth) {
+      dMax = cMax;
+    } else if (0 == d) {
+      dMax = vMax;
+    } else if (d == depth-1) {
+      dMax = fMax;
+    } else {
+      dMax = eMax;
+    } // if/else
+    stratumMax[d] = (dMax >= 0) ? dMax : stratumEnd[d];
+  } // for
+
+  std::vector<PetscInt> perm(pEnd-pStart, -1);
+  PetscInt nextNormal[4], nextHybrid[4];
+  for (PetscInt d=0; d <= depth; ++d) {
+    nextNormal[d] = stratumStart[d];
+    nextHybrid[d] = stratumMax[d];
+  } // for
+
+  // Order cells using adjacency across faces.
+  PetscInt numCells = 0;
+  PetscInt* offsets = NULL;
+  PetscInt* adjacency = NULL;
+  err = DMPlexCreateNeighborCSR(dmOrig, 0, &numCells, &offsets, &adjacency);PYLITH_CHECK_ERROR(err);
+  const PetscInt cStart = stratumStart[depth];
+  assert(numCells == stratumEnd[depth] - cStart);
+  int_array cellOrder;
+  _orderRCM(&cellOrder, numCells, offsets, adjacency);
+  err = PetscFree(offsets);PYLITH_CHECK_ERROR(err);
+  err = PetscFree(adjacency);PYLITH_CHECK_ERROR(err);
+
+  // Number points in the order they appear in the closures of the
+  // reordered cells, keeping hybrid points after normal points.
+  for (int i=0; i < 2; ++i) {
+    const bool hybridCells = (1 == i);
+    for (PetscInt iCell=0; iCell < numCells; ++iCell) {
+      const PetscInt cell = cStart + cellOrder[iCell];
+      if ((cell >= stratumMax[depth]) != hybridCells) {
+	continue;
+      } // if
+      PetscInt closureSize = 0;
+      PetscInt* closure = NULL;
+      err = DMPlexGetTransitiveClosure(dmOrig, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+      for (PetscInt iPt=0; iPt < closureSize*2; iPt+=2) {
+	const PetscInt point = closure[iPt];
+	if (perm[point] >= 0) {
+	  continue;
+	} // if
+	PetscInt d = 0;
+	while (point >= stratumEnd[d] || point < stratumStart[d]) {
+	  ++d;
+	} // while
+	assert(d <= depth);
+	perm[point] = (point < stratumMax[d]) ? nextNormal[d]++ : nextHybrid[d]++;
+      } // for
+      err = DMPlexRestoreTransitiveClosure(dmOrig, cell, PETSC_TRUE, &closureSize, &closure);PYLITH_CHECK_ERROR(err);
+    } // for
+  } // for
+
+  // Points not in the closure of any cell keep their relative order.
+  for (PetscInt d=0; d <= depth; ++d) {
+    for (PetscInt point=stratumStart[d]; point < stratumEnd[d]; ++point) {
+      if (perm[point] < 0) {
+	perm[point] = (point < stratumMax[d]) ? nextNormal[d]++ : nextHybrid[d]++;
+      } // if
+    } // for
+    assert(nextNormal[d] == stratumMax[d]);
+    assert(nextHybrid[d] == stratumEnd[d]);
+  } // for
+
+  PetscIS permutation = NULL;
+  PetscDM dmNew = NULL;
+  err = ISCreateGeneral(PETSC_COMM_SELF, perm.size(), &perm[0], PETSC_COPY_VALUES, &permutation);PYLITH_CHECK_ERROR(err);
+  err = DMPlexPermute(dmOrig, permutation, &dmNew);PYLITH_CHECK_ERROR(err);
+  err = ISDestroy(&permutation);PYLITH_CHECK_ERROR(err);
+  err = DMPlexSetHybridBounds(dmNew, cMax, fMax, eMax, vMax);PYLITH_CHECK_ERROR(err);
+
+  // Map the point star forest to the new numbering. The new numbers
+  // of remote points are obtained from their owners.
+  PetscSF sfOrig = NULL;
+  PetscInt numRoots = 0, numLeaves = 0;
+  const PetscInt* leaves = NULL;
+  const PetscSFNode* remotePoints = NULL;
+  err = DMGetPointSF(dmOrig, &sfOrig);PYLITH_CHECK_ERROR(err);
+  err = PetscSFGetGraph(sfOrig, &numRoots, &numLeaves, &leaves, &remotePoints);PYLITH_CHECK_ERROR(err);
+  if (numRoots >= 0) {
+    std::vector<PetscInt> permRemote(pEnd-pStart, -1);
+    err = PetscSFBcastBegin(sfOrig, MPIU_INT, &perm[0], &permRemote[0]);PYLITH_CHECK_ERROR(err);
+    err = PetscSFBcastEnd(sfOrig, MPIU_INT, &perm[0], &permRemote[0]);PYLITH_CHECK_ERROR(err);
+
+    // Leaves must be sorted by (new) local point.
+    std::vector<PetscInt> leafIndex(pEnd-pStart, -1);
+    for (PetscInt iLeaf=0; iLeaf < numLeaves; ++iLeaf) {
+      const PetscInt point = leaves ? leaves[iLeaf] : iLeaf;
+      leafIndex[perm[point]] = iLeaf;
+    } // for
+    PetscInt* leavesNew = NULL;
+    PetscSFNode* remotePointsNew = NULL;
+    err = PetscMalloc1(numLeaves, &leavesNew);PYLITH_CHECK_ERROR(err);
+    err = PetscMalloc1(numLeaves, &remotePointsNew);PYLITH_CHECK_ERROR(err);
+    PetscInt index = 0;
+    for (PetscInt pointNew=pStart; pointNew < pEnd; ++pointNew) {
+      const PetscInt iLeaf = leafIndex[pointNew];
+      if (iLeaf < 0) {
+	continue;
+      } // if
+      const PetscInt point = leaves ? leaves[iLeaf] : iLeaf;
+      leavesNew[index] = pointNew;
+      remotePointsNew[index].rank = remotePoints[iLeaf].rank;
+      remotePointsNew[index].index = permRemote[point];
+      ++index;
+    } // for
+    assert(numLeaves == index);
+
+    PetscSF sfNew = NULL;
+    err = DMGetPointSF(dmNew, &sfNew);PYLITH_CHECK_ERROR(err);
+    err = PetscSFSetGraph(sfNew, numRoots, numLeaves, leavesNew, PETSC_OWN_POINTER, remotePointsNew, PETSC_OWN_POINTER);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  mesh->dmMesh(dmNew);
+
+  PYLITH_METHOD_END;
+} // reorderLocal
+
+// ----------------------------------------------------------------------
+// Compute reverse Cuthill-McKee ordering of graph.
+void
+pylith::topology::ReverseCuthillMcKee::_orderRCM(int_array* order,
+						 const PetscInt numVertices,
+						 const PetscInt* offsets,
+						 const PetscInt* adjacency)
+{ // _orderRCM
+  assert(order);
+  assert(!numVertices || offsets);
+
+  order->resize(numVertices);
+  if (!numVertices) {
+    return;
+  } // if
+
+  // Start each connected component at an unvisited vertex of minimum
+  // degree.
+  std::vector<std::pair<PetscInt,PetscInt> > byDegree(numVertices);
+  for (PetscInt v=0; v < numVertices; ++v) {
+    byDegree[v] = std::make_pair(offsets[v+1]-offsets[v], v);
+  } // for
+  std::sort(byDegree.begin(), byDegree.end());
+
+  std::vector<bool> visited(numVertices, false);
+  std::vector<PetscInt> level(numVertices, -1);
+  std::vector<std::pair<PetscInt,PetscInt> > neighbors;
+  PetscInt numOrdered = 0;
+  for (PetscInt iStart=0; iStart < numVertices; ++iStart) {
+    PetscInt start = byDegree[iStart].second;
+    if (visited[start]) {
+      continue;
+    } // if
+
+    // Find a pseudo-peripheral vertex: the vertex of minimum degree
+    // in the last level of a breadth-first search from the start.
+    { // pseudo-peripheral
+      std::vector<PetscInt> queue(1, start);
+      level[start] = 0;
+      PetscInt lastLevel = 0;
+      for (size_t iQueue=0; iQueue < queue.size(); ++iQueue) {
+	const PetscInt v = queue[iQueue];
+	for (PetscInt i=offsets[v]; i < offsets[v+1]; ++i) {
+	  const PetscInt w = adjacency[i];
+	  if (level[w] < 0) {
+	    level[w] = level[v] + 1;
+	    lastLevel = level[w];
+	    queue.push_back(w);
+	  } // if
+	} // for
+      } // for
+      PetscInt minDegree = offsets[start+1] - offsets[start] + 1;
+      for (size_t iQueue=0; iQueue < queue.size(); ++iQueue) {
+	const PetscInt v = queue[iQueue];
+	const PetscInt degree = offsets[v+1] - offsets[v];
+	if (level[v] == lastLevel && degree < minDegree) {
+	  start = v;
+	  minDegree = degree;
+	} // if
+	level[v] = -1;
+      } // for
+    } // pseudo-peripheral
+
+    // Cuthill-McKee: breadth-first search visiting neighbors in order
+    // of increasing degree.
+    PetscInt iQueue = numOrdered;
+    (*order)[numOrdered++] = start;
+    visited[start] = true;
+    for (; iQueue < numOrdered; ++iQueue) {
+      const PetscInt v = (*order)[iQueue];
+      neighbors.clear();
+      for (PetscInt i=offsets[v]; i < offsets[v+1]; ++i) {
+	const PetscInt w = adjacency[i];
+	if (!visited[w]) {
+	  visited[w] = true;
+	  neighbors.push_back(std::make_pair(offsets[w+1]-offsets[w], w));
+	} // if
+      } // for
+      std::sort(neighbors.begin(), neighbors.end());
+      for (size_t i=0; i < neighbors.size(); ++i) {
+	(*order)[numOrdered++] = neighbors[i].second;
+      } // for
+    } // for
+  } // for
+  assert(numVertices == numOrdered);
+
+  std::reverse(&(*order)[0], &(*order)[0]+numVertices);
+} // _orderRCM
+
 
 // End of file 
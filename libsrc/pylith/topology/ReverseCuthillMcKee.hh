@@ -28,6 +28,8 @@
 // Include directives ---------------------------------------------------
 #include "topologyfwd.hh" // forward declarations
 
+#include "pylith/utils/array.hh" // USES int_array
+
 // ReverseCuthillMcKee --------------------------------------------------
 /// Interface to PETSc reverse Cuthill-McKee reordering.
 class pylith::topology::ReverseCuthillMcKee
@@ -44,6 +46,39 @@ public :
   static
   void reorder(topology::Mesh* mesh);
 
+  /** Reorder points of the local mesh on each process using reverse
+   * Cuthill-McKee ordering of the cells.
+   *
+   * Unlike reorder(), this may be used after the mesh has been
+   * distributed and cohesive cells have been inserted. Cells are
+   * ordered using the adjacency across faces; the other points are
+   * numbered in the order they appear in the closures of the
+   * reordered cells. Each depth stratum keeps its range, with hybrid
+   * (cohesive) points after the normal points, so the hybrid bounds
+   * are unchanged. Labels, coordinates, and the point star forest
+   * are mapped to the new numbering.
+   *
+   * @param mesh PyLith finite-element mesh.
+   */
+  static
+  void reorderLocal(topology::Mesh* mesh);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Compute reverse Cuthill-McKee ordering of graph.
+   *
+   * @param order Array of vertices of graph in new order.
+   * @param numVertices Number of vertices in graph.
+   * @param offsets Offsets into adjacency for each vertex (CSR).
+   * @param adjacency Adjacent vertices (CSR).
+   */
+  static
+  void _orderRCM(int_array* order,
+		 const PetscInt numVertices,
+		 const PetscInt* offsets,
+		 const PetscInt* adjacency);
+
 }; // ReverseCuthillMcKee
 
 #endif // pylith_topology_reversecuthillmckee_hh
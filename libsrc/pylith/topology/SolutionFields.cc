@@ -20,6 +20,8 @@
 
 #include "SolutionFields.hh" // implementation of class methods
 
+#include "Field.hh" // USES Field
+
 #include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
 
 // ----------------------------------------------------------------------
@@ -81,5 +83,61 @@ pylith::topology::SolutionFields::solution(void)
   return get(_solutionName.c_str());
 } // solution
 
+// ----------------------------------------------------------------------
+// Create history manager for a subset of the managed fields.
+void
+pylith::topology::SolutionFields::createHistory(const char* const* fields,
+						const int size)
+{ // createHistory
+  PYLITH_METHOD_BEGIN;
+
+  if (size > 0 && 0 != fields) {
+    _history.resize(size);
+    _historyLabels.resize(size);
+    for (int i=0; i < size; ++i) {
+      map_type::const_iterator iter = _fields.find(fields[i]);
+      if (iter == _fields.end()) {
+	std::ostringstream msg;
+	msg << "Cannot use unknown field '" << fields[i] << "' when creating history.";
+	throw std::runtime_error(msg.str());
+      } // if
+      assert(iter->second);
+      _history[i] = fields[i];
+      _historyLabels[i] = iter->second->label();
+    } // for
+  } else {
+    _history.resize(0);
+    _historyLabels.resize(0);
+  } // if/else
+
+  PYLITH_METHOD_END;
+} // createHistory
+
+// ----------------------------------------------------------------------
+// Shift fields in history.
+void
+pylith::topology::SolutionFields::shiftHistory(void)
+{ // shiftHistory
+  PYLITH_METHOD_BEGIN;
+
+  const int size = _history.size();
+  if (size < 2) {
+    PYLITH_METHOD_END;
+  } // if
+
+  Field* oldest = _fields[_history[size-1]];
+  for (int i=size-1; i > 0; --i) {
+    _fields[_history[i]] = _fields[_history[i-1]];
+  } // for
+  _fields[_history[0]] = oldest;
+
+  for (int i=0; i < size; ++i) {
+    assert(_fields[_history[i]]);
+    _fields[_history[i]]->label(_historyLabels[i].c_str());
+  } // for
+
+  PYLITH_METHOD_END;
+} // shiftHistory
+
 
 // End of file 
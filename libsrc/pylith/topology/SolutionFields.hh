@@ -74,6 +74,21 @@ public :
    */
   Field& solution(void);
 
+  /** Create history manager for a subset of the managed fields.
+   *
+   * @param fields Fields in history (first is most recent).
+   * @param size Number of fields in history.
+   */
+  void createHistory(const char* const* fields,
+		     const int size);
+
+  /** Shift fields in history. Handles to fields are shifted so that
+   * the most recent field becomes the next to most recent, etc. The
+   * storage of the oldest field is reused for the most recent field,
+   * so no values are copied.
+   */
+  void shiftHistory(void);
+
 // PRIVATE MEMBERS //////////////////////////////////////////////////////
 private :
 
@@ -81,6 +96,13 @@ private :
   /// problem.
   std::string _solutionName;
 
+  /// Names of fields in history (first is most recent).
+  std::vector<std::string> _history;
+
+  /// Labels of fields in history (labels stay with the name, not the
+  /// storage).
+  std::vector<std::string> _historyLabels;
+
 // NOT IMPLEMENTED //////////////////////////////////////////////////////
 private :
 
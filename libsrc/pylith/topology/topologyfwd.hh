@@ -50,6 +50,7 @@ namespace pylith {
     class Jacobian;
     class MatVisitorMesh;
     class MatVisitorSubMesh;
+    class MatAssemblyPlan;
 
     class Distributor;
 
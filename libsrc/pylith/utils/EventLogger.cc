@@ -138,5 +138,43 @@ pylith::utils::EventLogger::stageId(const char* name)
   PYLITH_METHOD_RETURN(iter->second);
 } // stagesId
 
+// ----------------------------------------------------------------------
+// Get wall time spent in event, summed over all logging stages.
+double
+pylith::utils::EventLogger::eventTime(const char* name)
+{ // eventTime
+  PYLITH_METHOD_BEGIN;
+
+  assert(name);
+  PetscLogEvent event = -1;
+  PetscErrorCode err = PetscLogEventGetId(name, &event);PYLITH_CHECK_ERROR(err);
+  if (event < 0) {
+    PYLITH_METHOD_RETURN(0.0);
+  } // if
+
+  PetscStageLog stageLog = NULL;
+  err = PetscLogGetStageLog(&stageLog);PYLITH_CHECK_ERROR(err);assert(stageLog);
+  double time = 0.0;
+  for (int stage=0; stage < stageLog->numStages; ++stage) {
+    PetscEventPerfInfo info;
+    err = PetscLogEventGetPerfInfo(stage, event, &info);PYLITH_CHECK_ERROR(err);
+    time += info.time;
+  } // for
+
+  PYLITH_METHOD_RETURN(time);
+} // eventTime
+
+// ----------------------------------------------------------------------
+// Activate PETSc logging of events and stages.
+void
+pylith::utils::EventLogger::activateLogging(void)
+{ // activateLogging
+  PYLITH_METHOD_BEGIN;
+
+  PetscErrorCode err = PetscLogDefaultBegin();PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // activateLogging
+
 
 // End of file 
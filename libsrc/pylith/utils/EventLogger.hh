@@ -122,6 +122,22 @@ public :
   /// Log stage end.
   void stagePop(void);
 
+  /** Get wall time spent in event, summed over all logging stages,
+   * on this process.
+   *
+   * Events may belong to any logging class. Time is only accumulated
+   * while PETSc logging is active (see activateLogging()).
+   *
+   * @param name Name of event.
+   * @returns Time in seconds (0 if event has not been registered).
+   */
+  static
+  double eventTime(const char* name);
+
+  /// Activate PETSc logging of events and stages (as done by -log_view).
+  static
+  void activateLogging(void);
+
 // PRIVATE METHODS //////////////////////////////////////////////////////
 private :
 
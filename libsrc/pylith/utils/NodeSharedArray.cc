@@ -0,0 +1,213 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+#include <portinfo>
+
+#include "NodeSharedArray.hh" // implementation of class methods
+
+#include "pylith/utils/error.h" // USES PYLITH_CHECK_ERROR
+
+#include <cassert> // USES assert()
+
+#if MPI_VERSION >= 3
+#define PYLITH_NODESHAREDARRAY_MPI3
+#endif
+
+// ----------------------------------------------------------------------
+// Constructor.
+pylith::utils::NodeSharedArray::NodeSharedArray(void) :
+  _nodeComm(MPI_COMM_NULL),
+  _window(MPI_WIN_NULL),
+  _nodeArray(0),
+  _nodeSize(0),
+  _localOffset(0),
+  _localSize(0),
+  _nodeRank(0),
+  _nodeNumProcs(1)
+{ // constructor
+} // constructor
+
+// ----------------------------------------------------------------------
+// Destructor.
+pylith::utils::NodeSharedArray::~NodeSharedArray(void)
+{ // destructor
+  deallocate();
+} // destructor
+
+// ----------------------------------------------------------------------
+// Deallocate array.
+void
+pylith::utils::NodeSharedArray::deallocate(void)
+{ // deallocate
+  PYLITH_METHOD_BEGIN;
+
+  PetscErrorCode err = 0;
+#if defined(PYLITH_NODESHAREDARRAY_MPI3)
+  if (MPI_WIN_NULL != _window) {
+    err = MPI_Win_unlock_all(_window);PYLITH_CHECK_ERROR(err);
+    err = MPI_Win_free(&_window);PYLITH_CHECK_ERROR(err);
+  } // if
+#endif
+  if (MPI_COMM_NULL != _nodeComm) {
+    err = MPI_Comm_free(&_nodeComm);PYLITH_CHECK_ERROR(err);
+  } // if
+  _window = MPI_WIN_NULL;
+  _nodeComm = MPI_COMM_NULL;
+  _nodeArray = 0;
+  _nodeSize = 0;
+  _localOffset = 0;
+  _localSize = 0;
+  _nodeRank = 0;
+  _nodeNumProcs = 1;
+  _privateArray.clear();
+
+  PYLITH_METHOD_END;
+} // deallocate
+
+// ----------------------------------------------------------------------
+// Allocate array.
+void
+pylith::utils::NodeSharedArray::allocate(const MPI_Comm comm,
+					 const size_t localSize)
+{ // allocate
+  PYLITH_METHOD_BEGIN;
+
+  deallocate();
+
+  PetscErrorCode err = 0;
+#if defined(PYLITH_NODESHAREDARRAY_MPI3)
+  err = MPI_Comm_split_type(comm, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &_nodeComm);PYLITH_CHECK_ERROR(err);
+  err = MPI_Comm_rank(_nodeComm, &_nodeRank);PYLITH_CHECK_ERROR(err);
+  err = MPI_Comm_size(_nodeComm, &_nodeNumProcs);PYLITH_CHECK_ERROR(err);
+
+  // Slices are stored in order of rank on the node.
+  unsigned long localSizeUL = localSize;
+  std::vector<unsigned long> sizes(_nodeNumProcs);
+  err = MPI_Allgather(&localSizeUL, 1, MPI_UNSIGNED_LONG, &sizes[0], 1, MPI_UNSIGNED_LONG, _nodeComm);PYLITH_CHECK_ERROR(err);
+  for (int i=0; i < _nodeNumProcs; ++i) {
+    if (i < _nodeRank) {
+      _localOffset += sizes[i];
+    } // if
+    _nodeSize += sizes[i];
+  } // for
+  _localSize = localSize;
+
+  // Leader allocates all of the memory for the node, so that the
+  // array is contiguous.
+  const MPI_Aint windowSize = (0 == _nodeRank) ? MPI_Aint(_nodeSize*sizeof(PylithScalar)) : 0;
+  void* base = NULL;
+  err = MPI_Win_allocate_shared(windowSize, sizeof(PylithScalar), MPI_INFO_NULL, _nodeComm, &base, &_window);PYLITH_CHECK_ERROR(err);
+
+  MPI_Aint querySize = 0;
+  int queryDispUnit = 0;
+  err = MPI_Win_shared_query(_window, 0, &querySize, &queryDispUnit, &base);PYLITH_CHECK_ERROR(err);
+  _nodeArray = (PylithScalar*) base;
+
+  // Passive target epoch for the lifetime of the window; sync() orders
+  // the loads and stores.
+  err = MPI_Win_lock_all(MPI_MODE_NOCHECK, _window);PYLITH_CHECK_ERROR(err);
+#else
+  err = MPI_Comm_dup(MPI_COMM_SELF, &_nodeComm);PYLITH_CHECK_ERROR(err);
+  _nodeRank = 0;
+  _nodeNumProcs = 1;
+  _nodeSize = localSize;
+  _localOffset = 0;
+  _localSize = localSize;
+  _privateArray.resize(localSize);
+  _nodeArray = (localSize > 0) ? &_privateArray[0] : 0;
+#endif
+
+  PYLITH_METHOD_END;
+} // allocate
+
+// ----------------------------------------------------------------------
+// Synchronize memory across processes on the node.
+void
+pylith::utils::NodeSharedArray::sync(void)
+{ // sync
+  PYLITH_METHOD_BEGIN;
+
+#if defined(PYLITH_NODESHAREDARRAY_MPI3)
+  assert(MPI_WIN_NULL != _window);
+  PetscErrorCode err = 0;
+  err = MPI_Win_sync(_window);PYLITH_CHECK_ERROR(err);
+  err = MPI_Barrier(_nodeComm);PYLITH_CHECK_ERROR(err);
+  err = MPI_Win_sync(_window);PYLITH_CHECK_ERROR(err);
+#endif
+
+  PYLITH_METHOD_END;
+} // sync
+
+// ----------------------------------------------------------------------
+// Get array for all processes on the node.
+PylithScalar*
+pylith::utils::NodeSharedArray::nodeArray(void)
+{ // nodeArray
+  return _nodeArray;
+} // nodeArray
+
+// ----------------------------------------------------------------------
+// Get number of values in array for node.
+size_t
+pylith::utils::NodeSharedArray::nodeSize(void) const
+{ // nodeSize
+  return _nodeSize;
+} // nodeSize
+
+// ----------------------------------------------------------------------
+// Get slice of array for this process.
+PylithScalar*
+pylith::utils::NodeSharedArray::localArray(void)
+{ // localArray
+  return (_nodeArray) ? _nodeArray + _localOffset : 0;
+} // localArray
+
+// ----------------------------------------------------------------------
+// Get number of values in slice for this process.
+size_t
+pylith::utils::NodeSharedArray::localSize(void) const
+{ // localSize
+  return _localSize;
+} // localSize
+
+// ----------------------------------------------------------------------
+// Get communicator for processes on the node.
+MPI_Comm
+pylith::utils::NodeSharedArray::nodeComm(void) const
+{ // nodeComm
+  return _nodeComm;
+} // nodeComm
+
+// ----------------------------------------------------------------------
+// Get number of processes on the node.
+int
+pylith::utils::NodeSharedArray::nodeNumProcs(void) const
+{ // nodeNumProcs
+  return _nodeNumProcs;
+} // nodeNumProcs
+
+// ----------------------------------------------------------------------
+// Is this process the leader on the node?
+bool
+pylith::utils::NodeSharedArray::isLeader(void) const
+{ // isLeader
+  return 0 == _nodeRank;
+} // isLeader
+
+
+// End of file
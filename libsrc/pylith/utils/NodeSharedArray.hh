@@ -0,0 +1,147 @@
+// -*- C++ -*-
+//
+// ======================================================================
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ======================================================================
+//
+
+/**
+ * @file libsrc/utils/NodeSharedArray.hh
+ *
+ * @brief C++ object for an array shared by the processes on a compute
+ * node.
+ */
+
+#if !defined(pylith_utils_nodesharedarray_hh)
+#define pylith_utils_nodesharedarray_hh
+
+// Include directives ---------------------------------------------------
+#include "utilsfwd.hh" // forward declarations
+
+#include "types.hh" // HASA PylithScalar
+
+#include <mpi.h> // HASA MPI_Comm, MPI_Win
+#include <vector> // HASA std::vector
+
+// NodeSharedArray ------------------------------------------------------
+/** @brief C++ object for an array shared by the processes on a compute
+ * node.
+ *
+ * Each process contributes a slice of the array. The slices of all of
+ * the processes on a node are stored contiguously (in order of the
+ * rank in the node communicator) in an MPI-3 shared memory window
+ * allocated by the first process on the node (the leader), so every
+ * process on the node can read and write the entire node array.
+ *
+ * Call sync() after writing to the array and before reading values
+ * written by other processes. Allocation, sync(), and deallocation
+ * are collective over the communicator.
+ *
+ * If the MPI implementation does not support MPI-3, every process is
+ * its own node and the array is stored in private memory.
+ */
+class pylith::utils::NodeSharedArray
+{ // NodeSharedArray
+  friend class TestNodeSharedArray; // unit testing
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Constructor.
+  NodeSharedArray(void);
+
+  /// Destructor.
+  ~NodeSharedArray(void);
+
+  /// Deallocate array (collective).
+  void deallocate(void);
+
+  /** Allocate array (collective).
+   *
+   * @param comm Communicator for processes sharing the array.
+   * @param localSize Number of values in the slice for this process.
+   */
+  void allocate(const MPI_Comm comm,
+		const size_t localSize);
+
+  /// Synchronize memory across processes on the node (collective).
+  void sync(void);
+
+  /** Get array for all processes on the node.
+   *
+   * @returns Array for node.
+   */
+  PylithScalar* nodeArray(void);
+
+  /** Get number of values in array for node.
+   *
+   * @returns Number of values.
+   */
+  size_t nodeSize(void) const;
+
+  /** Get slice of array for this process.
+   *
+   * @returns Array for this process.
+   */
+  PylithScalar* localArray(void);
+
+  /** Get number of values in slice for this process.
+   *
+   * @returns Number of values.
+   */
+  size_t localSize(void) const;
+
+  /** Get communicator for processes on the node.
+   *
+   * @returns Node communicator.
+   */
+  MPI_Comm nodeComm(void) const;
+
+  /** Get number of processes on the node.
+   *
+   * @returns Number of processes.
+   */
+  int nodeNumProcs(void) const;
+
+  /** Is this process the leader (rank 0) on the node?
+   *
+   * @returns True if process is the leader, false otherwise.
+   */
+  bool isLeader(void) const;
+
+// PRIVATE MEMBERS //////////////////////////////////////////////////////
+private :
+
+  MPI_Comm _nodeComm; ///< Communicator for processes on node.
+  MPI_Win _window; ///< Shared memory window.
+  PylithScalar* _nodeArray; ///< Array for node.
+  size_t _nodeSize; ///< Number of values in array for node.
+  size_t _localOffset; ///< Offset of slice for this process.
+  size_t _localSize; ///< Number of values in slice for this process.
+  int _nodeRank; ///< Rank of process in node communicator.
+  int _nodeNumProcs; ///< Number of processes on node.
+  std::vector<PylithScalar> _privateArray; ///< Array if shared memory is not available.
+
+// NOT IMPLEMENTED //////////////////////////////////////////////////////
+private :
+
+  NodeSharedArray(const NodeSharedArray&); ///< Not implemented
+  const NodeSharedArray& operator=(const NodeSharedArray&); ///< Not implemented
+
+}; // NodeSharedArray
+
+#endif // pylith_utils_nodesharedarray_hh
+
+
+// End of file
@@ -34,6 +34,7 @@ namespace pylith {
     class PylithVersion;
     class PetscVersion;
     class DependenciesVersion;
+    class NodeSharedArray;
     
     class TestArray;
 
@@ -94,6 +94,15 @@ namespace pylith {
 			     const PylithScalar t,
 			     pylith::topology::SolutionFields* const fields);
 
+      /** Update state variables as needed.
+       *
+       * @param t Current time
+       * @param fields Solution fields
+       */
+      virtual
+      void updateStateVars(const PylithScalar t,
+			   pylith::topology::SolutionFields* const fields);
+
       /** Adjust solution from solver with lumped Jacobian to match Lagrange
        *  multiplier constraints.
        *
@@ -118,6 +127,45 @@ namespace pylith {
        */
       virtual
       void checkConstraints(const pylith::topology::Field& solution) const;
+
+      /** Enable computation of earthquake source statistics.
+       *
+       * @param slipThreshold Minimum slip for a vertex to contribute to
+       *   the rupture area (dimensional).
+       * @param slipRateThreshold Slip rate at which the rupture front
+       *   arrives at a vertex (dimensional).
+       */
+      void initializeSourceStats(const PylithScalar slipThreshold,
+				 const PylithScalar slipRateThreshold);
+
+      /** Add shear modulus from cells of material adjacent to the fault.
+       *
+       * @param mesh Finite-element mesh of the domain.
+       * @param material Material (ignored if it lacks a shear modulus).
+       */
+      void addShearModulus(const pylith::topology::Mesh& mesh,
+			   pylith::materials::Material* material);
+
+      /// Average shear modulus at fault vertices over adjacent cells.
+      void averageShearModulus(void);
+
+      /** Get number of source statistics records not yet retrieved.
+       *
+       * @returns Number of records.
+       */
+      int numSourceStats(void) const;
+
+      /** Get value in source statistics record.
+       *
+       * @param index Index of record.
+       * @param name Name of value.
+       * @returns Value.
+       */
+      PylithScalar sourceStat(const int index,
+			      const char* name) const;
+
+      /// Clear source statistics records.
+      void clearSourceStats(void);
       
     }; // class FaultCohesiveLagrange
 
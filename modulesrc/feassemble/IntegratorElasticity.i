@@ -86,6 +86,31 @@ namespace pylith {
 					       const pylith::topology::Mesh& mesh,
 					       pylith::topology::SolutionFields* const fields =0);
       
+      /** Set names of cell fields requested for output.
+       *
+       * When both the total strain and the stress must be computed
+       * from the displacement field, they are computed together in a
+       * single pass over the cells.
+       *
+       * @param names Array of names of cell fields.
+       * @param numNames Number of names.
+       */
+      %apply(const char* const* string_list, const int list_len){
+	(const char* const* names,
+	 const int numNames)
+	  };
+      void cellFieldsRequested(const char* const* names,
+			       const int numNames);
+      %clear(const char* const* names, const int numNames);
+
+      /** Set whether output may be written after the next update of
+       * the state variables. If so, updateStateVars() keeps the total
+       * strain it computes for output.
+       *
+       * @param value True if output may be written, false otherwise.
+       */
+      void outputDue(const bool value);
+
       /** Get output fields.
        *
        * @returns Output (buffer) fields.
@@ -27,6 +27,16 @@ namespace pylith {
     class Material
     { // class Material
 
+      // PUBLIC ENUMS ///////////////////////////////////////////////////
+    public :
+
+      /// Storage of physical properties.
+      enum PropsStorageEnum {
+	PROPS_QUADPTS=0, ///< Properties at every quadrature point.
+	PROPS_CELL=1, ///< One copy of properties per cell.
+	PROPS_UNIFORM=2, ///< One copy of properties for the material.
+      }; // PropsStorageEnum
+
       // PUBLIC METHODS /////////////////////////////////////////////////
     public :
       
@@ -103,6 +113,26 @@ namespace pylith {
        */
       void dbInitialState(spatialdata::spatialdb::SpatialDB* value);
       
+      /** Set flag for querying spatial databases once per compute node.
+       *
+       * @param value True to query databases once per node, false otherwise.
+       */
+      void nodeSharedQuery(const bool value);
+
+      /** Get flag for querying spatial databases once per compute node.
+       *
+       * @returns True if databases are queried once per node, false otherwise.
+       */
+      bool nodeSharedQuery(void) const;
+
+      /** Get estimate of net memory (in bytes) on the compute node
+       * saved by querying the spatial databases once per node in
+       * initialize(). The shared memory windows are subtracted.
+       *
+       * @returns Net memory saved on node.
+       */
+      double nodeSharedMemory(void) const;
+
       /** Set scales used to nondimensionalize physical properties.
        *
        * @param dim Nondimensionalizer
@@ -153,6 +183,14 @@ namespace pylith {
        */
       const pylith::topology::Field* stateVarsField() const;
 
+      /** Get storage of physical properties. Properties that are uniform
+       * over the material or constant over each cell are stored once per
+       * material or once per cell, respectively.
+       *
+       * @returns Storage of physical properties.
+       */
+      PropsStorageEnum propsStorage(void) const;
+
       // PROTECTED METHODS //////////////////////////////////////////////
     protected :
       
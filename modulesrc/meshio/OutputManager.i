@@ -128,6 +128,21 @@ namespace pylith {
 			   const char* label =0,
 			   const int labelId =0);
 
+      /** Get maximum magnitude of the values at a point in a field over
+       * all processes.
+       *
+       * @param field Nondimensional field.
+       * @returns Maximum magnitude (dimensional).
+       */
+      PylithScalar fieldMaxMagnitude(const pylith::topology::Field& field) const;
+
+      /** Get L2 norm of a field over all processes.
+       *
+       * @param field Nondimensional field.
+       * @returns L2 norm (dimensional).
+       */
+      PylithScalar fieldNorm(const pylith::topology::Field& field) const;
+
     }; // OutputManager
 
   } // meshio
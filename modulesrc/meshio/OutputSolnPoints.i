@@ -46,6 +46,18 @@ public :
      */
     const pylith::topology::Mesh& pointsMesh(void);
     
+    /** Set number of time steps to buffer in memory before writing.
+     *
+     * @param value Number of time steps.
+     */
+    void bufferSteps(const int value);
+
+    /** Get number of time steps to buffer in memory before writing.
+     *
+     * @returns Number of time steps.
+     */
+    int bufferSteps(void) const;
+    
     /** Setup interpolator.
      *
      * @param mesh Domain mesh.
@@ -87,6 +99,9 @@ public :
 	      const char* label =0,
 	      const int labelId =0);
     
+    /// Write any buffered time steps and close output files.
+    void close(void);
+    
     /** Setup file for writing fields at time step.
      *
      * @param t Time of time step.
@@ -23,6 +23,7 @@
 %{
 #include "pylith/meshio/MeshIO.hh"
 #include "pylith/meshio/MeshIOAscii.hh"
+#include "pylith/meshio/MeshIOBinary.hh"
 #include "pylith/meshio/MeshIOLagrit.hh"
 #if defined(ENABLE_CUBIT)
 #include "pylith/meshio/MeshIOCubit.hh"
@@ -34,6 +35,7 @@
 #include "pylith/meshio/CellFilterAvg.hh"
 #include "pylith/meshio/DataWriter.hh"
 #include "pylith/meshio/DataWriterVTK.hh"
+#include "pylith/meshio/DataWriterVTU.hh"
 #include "pylith/meshio/OutputManager.hh"
 #include "pylith/meshio/OutputSolnSubset.hh"
 #include "pylith/meshio/OutputSolnPoints.hh"
@@ -71,6 +73,7 @@ import_array();
 // Interfaces
 %include "MeshIOObj.i"
 %include "MeshIOAscii.i"
+%include "MeshIOBinary.i"
 %include "MeshIOLagrit.i"
 #if defined(ENABLE_CUBIT)
 %include "MeshIOCubit.i"
@@ -82,6 +85,7 @@ import_array();
 %include "CellFilterAvg.i"
 %include "DataWriter.i"
 %include "DataWriterVTK.i"
+%include "DataWriterVTU.i"
 %include "OutputManager.i"
 %include "OutputSolnSubset.i"
 %include "OutputSolnPoints.i"
@@ -37,9 +37,21 @@ namespace pylith {
       /// Destructor
       ~Explicit(void);
 
-      /// Compute rate fields (velocity and/or acceleration) at time t.
+      /** Compute rate fields (velocity and/or acceleration) at time t.
+       *
+       * The computation is skipped if the displacement fields, rate
+       * fields, and time step have not changed since the last call.
+       */
       void calcRateFields(void);
 
+      /** Advance displacement fields from time t to time t+dt.
+       *
+       * Shifts the displacement history so disp(t) becomes
+       * disp(t-dt) and the storage of the old disp(t-dt) holds the
+       * new disp(t) = disp(t) + dispIncr(t->t+dt).
+       */
+      void advanceDisplacement(void);
+
     }; // Explicit
 
   } // problems
@@ -86,6 +86,69 @@ namespace pylith {
       void integrators(pylith::feassemble::Integrator* integratorArray[],
 		       const int numIntegrators);
       
+      /** Set handles to constraints.
+       *
+       * @param constraintArray Array of constraints.
+       * @param numConstraints Number of constraints.
+       */
+      void constraints(pylith::feassemble::Constraint* constraintArray[],
+		       const int numConstraints);
+      
+      /** Set parameters for lagging the preconditioner over several time
+       * steps. The Jacobian itself is always reformed when the integrators
+       * request it, because it is the operator in the linear solve; only
+       * the preconditioner built from it is reused.
+       *
+       * @param maxSteps Maximum number of time steps to reuse preconditioner
+       * (0 disables lagging).
+       * @param iterationsRatio Reform when the number of solver
+       * iterations exceeds this ratio times the number of iterations
+       * in the first solve after the last reform.
+       * @param dtRatio Reform when the time step differs from the time
+       * step used in the last reform by more than this ratio.
+       */
+      void jacobianLag(const int maxSteps,
+		       const PylithScalar iterationsRatio,
+		       const PylithScalar dtRatio);
+
+      /** Determine whether to set up a new preconditioner for the
+       * upcoming time step using the lagging policy.
+       *
+       * @param integratorsNeedNew True if any integrator requests a
+       * new Jacobian.
+       * @param dt Time step (nondimensional).
+       * @returns True if the preconditioner should be set up from the
+       * reformed Jacobian.
+       */
+      bool needNewPreconditioner(const bool integratorsNeedNew,
+				 const PylithScalar dt);
+
+      /** Get flag indicating the preconditioner is being reused
+       * (lagged) in the current time step.
+       *
+       * @returns True if the solver should reuse the preconditioner.
+       */
+      bool lagPreconditioner(void) const;
+
+      /** Get flag indicating the global vector of the solution holds a
+       * nonzero initial guess for the current solve.
+       *
+       * @returns True if solver should start from the current solution.
+       */
+      bool nonzeroInitialGuess(void) const;
+
+      /** Record number of solver iterations for current time step.
+       *
+       * @param numIterations Number of linear (or nonlinear) iterations.
+       */
+      void solverIterations(const int numIterations);
+
+      /** Get number of times the Jacobian has been reformed.
+       *
+       * @returns Number of Jacobian reforms.
+       */
+      int numJacobianReforms(void) const;
+
       /** Update handles and parameters for reforming the Jacobian and
        *  residual.
        *
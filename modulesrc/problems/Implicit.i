@@ -37,9 +37,48 @@ namespace pylith {
       /// Destructor
       ~Implicit(void);
 
+      /// Deallocate PETSc and local data structures.
+      void deallocate(void);
+
       /// Compute rate fields (velocity and/or acceleration) at time t.
       void calcRateFields(void);
 
+      /** Set order of predictor for the initial guess of the displacement
+       * increment.
+       *
+       * @param order 0 for zero initial guess, 1 for previous increment
+       *   scaled by ratio of time steps, 2 for linear extrapolation of
+       *   rate from the previous two increments.
+       */
+      void predictorOrder(const int order);
+
+      /** Set initial guess for the solve by extrapolating the
+       * displacement increments from previous time steps.
+       *
+       * @param dt Current time step (nondimensional).
+       */
+      void predictDispIncr(const PylithScalar dt);
+
+      /** Save displacement increment for current time step for use by
+       * the predictor in later time steps.
+       *
+       * @param dt Current time step (nondimensional).
+       */
+      void saveDispIncr(const PylithScalar dt);
+
+      /** Advance the solution over several time steps of uniform size
+       * without returning to Python. No output is written.
+       *
+       * @param solver Solver for the system of equations.
+       * @param t Time at the beginning of the first time step (nondimensional).
+       * @param dt Time step (nondimensional).
+       * @param numSteps Number of time steps.
+       */
+      void advance(pylith::problems::Solver* const solver,
+		   const PylithScalar t,
+		   const PylithScalar dt,
+		   const int numSteps);
+
     }; // Implicit
 
   } // problems
@@ -52,6 +52,21 @@ namespace pylith {
        */
       void skipNullSpaceCreation(const bool value);
 
+      /** Set flag for reusing the coarse spaces (aggregates and
+       * interpolation) of algebraic multigrid preconditioners when the
+       * Jacobian is reformed. Only GAMG preconditioners are supported.
+       *
+       * @param[in] value True to reuse AMG interpolation.
+       */
+      void reuseAMGInterpolation(const bool value);
+
+      /** Set flag for preconditioning with single precision storage
+       * (block Jacobi ILU(0) with single precision factors).
+       *
+       * @param[in] value True to use single precision preconditioner storage.
+       */
+      void mixedPrecision(const bool value);
+
       /** Initialize solver.
        *
        * @param fields Solution fields.
@@ -63,6 +78,18 @@ namespace pylith {
 		      const pylith::topology::Jacobian& jacobian,
 		      Formulation* const formulation);
 
+      /** Get total number of linear (KSP) iterations over all solves.
+       *
+       * @returns Number of linear iterations.
+       */
+      long numLinearIterationsTotal(void) const;
+
+      /** Get total number of nonlinear (SNES) iterations over all solves.
+       *
+       * @returns Number of nonlinear iterations.
+       */
+      long numNonlinearIterationsTotal(void) const;
+
     }; // Solver
 
   } // problems
@@ -61,6 +61,12 @@ namespace pylith {
 		 pylith::topology::Jacobian* jacobian,
 		 const pylith::topology::Field& residual);
 
+      /** Get number of linear iterations in the most recent solve.
+       *
+       * @returns Number of iterations.
+       */
+      int numIterations(void) const;
+
     }; // SolverLinear
 
   } // problems
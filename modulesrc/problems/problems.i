@@ -24,7 +24,7 @@
 #include "pylith/problems/problemsfwd.hh" // forward declarations
 
 #include "pylith/topology/topologyfwd.hh" // USES Mesh
-#include "pylith/feassemble/feassemblefwd.hh" // USES Integrator
+#include "pylith/feassemble/feassemblefwd.hh" // USES Integrator, Constraint
 
 #include "pylith/problems/Formulation.hh"
 #include "pylith/problems/Explicit.hh"
@@ -46,6 +46,7 @@
 
 %include "typemaps.i"
 %include "../include/integratorarray.i"
+%include "../include/constraintarray.i"
 %include "../include/scalartypemaps.i"
 
 // Interfaces
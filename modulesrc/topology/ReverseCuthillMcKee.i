@@ -40,6 +40,15 @@ namespace pylith {
       static
       void reorder(topology::Mesh* mesh);
 
+      /** Reorder points of the local mesh on each process using
+       * reverse Cuthill-McKee ordering of the cells. May be used
+       * after distribution and insertion of cohesive cells.
+       *
+       * @param mesh PyLith finite-element mesh.
+       */
+      static
+      void reorderLocal(topology::Mesh* mesh);
+
     }; // ReverseCuthillMcKee
 
   } // topology
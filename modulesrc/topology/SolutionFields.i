@@ -57,6 +57,26 @@ namespace pylith {
        * @returns Solution field.
        */
       Field& solution(void);
+
+      /** Create history manager for a subset of the managed fields.
+       *
+       * @param fields Fields in history (first is most recent).
+       * @param size Number of fields in history.
+       */
+      %apply(const char* const* string_list, const int list_len){
+	(const char* const* fields,
+	 const int size)
+	  };
+      void createHistory(const char* const* fields,
+			 const int size);
+      %clear(const char* const* fields, const int size);
+
+      /** Shift fields in history. Handles to fields are shifted so
+       * that the most recent field becomes the next to most recent,
+       * etc. The storage of the oldest field is reused for the most
+       * recent field.
+       */
+      void shiftHistory(void);
       
     }; // SolutionFields
 
@@ -106,6 +106,19 @@ namespace pylith {
       /// Log stage end.
       void stagePop(void);
 
+      /** Get wall time spent in event, summed over all logging
+       * stages, on this process.
+       *
+       * @param name Name of event.
+       * @returns Time in seconds (0 if event has not been registered).
+       */
+      static
+      double eventTime(const char* name);
+
+      /// Activate PETSc logging of events and stages (as done by -log_view).
+      static
+      void activateLogging(void);
+
     }; // EventLogger
 
   } // utils
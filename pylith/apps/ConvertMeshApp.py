@@ -0,0 +1,99 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+# @file pylith/apps/ConvertMeshApp.py
+##
+# @brief Python application for converting a finite-element mesh
+# from one file format to another.
+
+from PetscApplication import PetscApplication
+
+# ConvertMeshApp class
+
+
+class ConvertMeshApp(PetscApplication):
+    """
+    Python application for converting a finite-element mesh from one
+    file format to another, such as from an ASCII or CUBIT/Trelis
+    Exodus II file to a PyLith binary mesh file.
+
+    The conversion must be run on a single process.
+    """
+
+    # INVENTORY //////////////////////////////////////////////////////////
+
+    class Inventory(PetscApplication.Inventory):
+        """
+        Python object for managing ConvertMeshApp facilities and properties.
+        """
+
+        # @class Inventory
+        # Python object for managing ConvertMeshApp facilities and properties.
+        ##
+        # \b Properties
+        # @li None
+        ##
+        # \b Facilities
+        # @li \b reader Reader for input mesh.
+        # @li \b writer Writer for output mesh.
+
+        import pyre.inventory
+
+        from pylith.meshio.MeshIOAscii import MeshIOAscii
+        reader = pyre.inventory.facility("reader", family="mesh_io", factory=MeshIOAscii)
+        reader.meta['tip'] = "Reader for input mesh."
+
+        from pylith.meshio.MeshIOBinary import MeshIOBinary
+        writer = pyre.inventory.facility("writer", family="mesh_io", factory=MeshIOBinary)
+        writer.meta['tip'] = "Writer for output mesh."
+
+    # PUBLIC METHODS /////////////////////////////////////////////////////
+
+    def __init__(self, name="convertmeshapp"):
+        """
+        Constructor.
+        """
+        PetscApplication.__init__(self, name)
+        return
+
+    def main(self, *args, **kwds):
+        """
+        Run the application.
+        """
+        from pylith.mpi.Communicator import mpi_comm_world
+        comm = mpi_comm_world()
+        if comm.size > 1:
+            raise ValueError("Mesh conversion must be run on a single process.")
+
+        mesh = self.reader.read(debug=False, interpolate=False)
+        self.writer.write(mesh)
+        return
+
+    # PRIVATE METHODS ////////////////////////////////////////////////////
+
+    def _configure(self):
+        """
+        Setup members using inventory.
+        """
+        PetscApplication._configure(self)
+        self.reader = self.inventory.reader
+        self.writer = self.inventory.writer
+        return
+
+
+# End of file
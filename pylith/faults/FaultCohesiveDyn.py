@@ -52,6 +52,7 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
   @li \b tract_perturbation Prescribed perturbation in fault tractions.
   @li \b friction Fault constitutive model.
   @li \b output Output manager associated with fault data.
+  @li \b source_stats Earthquake source statistics computed during the run.
 
   Factory: fault
   """
@@ -80,6 +81,9 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
   from pylith.meshio.OutputFaultDyn import OutputFaultDyn
   output = pyre.inventory.facility("output", family="output_manager", factory=OutputFaultDyn)
   output.meta['tip'] = "Output manager associated with fault data."
+
+  sourceStats = pyre.inventory.facility("source_stats", family="source_stats", factory=NullComponent)
+  sourceStats.meta['tip'] = "Earthquake source statistics computed during the run."
   
 
   # PUBLIC METHODS /////////////////////////////////////////////////////
@@ -192,10 +196,23 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
     return field
 
 
+  def writeData(self, t, fields):
+    """
+    Write data at time t.
+    """
+    FaultCohesive.writeData(self, t, fields)
+    if not self.sourceStats is None:
+      self.sourceStats.write(self)
+    return
+
+
   def finalize(self):
     """
     Cleanup.
     """
+    if not self.sourceStats is None:
+      self.sourceStats.write(self)
+      self.sourceStats.close()
     FaultCohesive.finalize(self)
     Integrator.finalize(self)
     self.output.close()
@@ -217,6 +234,12 @@ class FaultCohesiveDyn(FaultCohesive, Integrator, ModuleFaultCohesiveDyn):
     ModuleFaultCohesiveDyn.zeroToleranceNormal(self, self.inventory.zeroToleranceNormal)
     ModuleFaultCohesiveDyn.openFreeSurf(self, self.inventory.openFreeSurf)
     self.output = self.inventory.output
+    if not isinstance(self.inventory.sourceStats, NullComponent):
+      self.sourceStats = self.inventory.sourceStats
+      self.availableFields['vertex']['data'] += ["rupture_time",
+                                                 "peak_slip_rate"]
+    else:
+      self.sourceStats = None
     return
 
 
@@ -28,6 +28,8 @@ from FaultCohesive import FaultCohesive
 from pylith.feassemble.Integrator import Integrator
 from faults import FaultCohesiveKin as ModuleFaultCohesiveKin
 
+from pylith.utils.NullComponent import NullComponent
+
 # ITEM FACTORIES ///////////////////////////////////////////////////////
 
 def eqsrcFactory(name):
@@ -56,6 +58,7 @@ class FaultCohesiveKin(FaultCohesive, Integrator, ModuleFaultCohesiveKin):
   \b Facilities
   @li \b eq_srcs Kinematic earthquake sources information.
   @li \b output Output manager associated with fault data.
+  @li \b source_stats Earthquake source statistics computed during the run.
 
   Factory: fault
   """
@@ -74,6 +77,10 @@ class FaultCohesiveKin(FaultCohesive, Integrator, ModuleFaultCohesiveKin):
                                    factory=OutputFaultKin)
   output.meta['tip'] = "Output manager associated with fault data."
 
+  sourceStats = pyre.inventory.facility("source_stats", family="source_stats",
+                                        factory=NullComponent)
+  sourceStats.meta['tip'] = "Earthquake source statistics computed during the run."
+
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
   def __init__(self, name="faultcohesivekin"):
@@ -191,10 +198,23 @@ class FaultCohesiveKin(FaultCohesive, Integrator, ModuleFaultCohesiveKin):
     return field
 
 
+  def writeData(self, t, fields):
+    """
+    Write data at time t.
+    """
+    FaultCohesive.writeData(self, t, fields)
+    if not self.sourceStats is None:
+      self.sourceStats.write(self)
+    return
+
+
   def finalize(self):
     """
     Cleanup.
     """
+    if not self.sourceStats is None:
+      self.sourceStats.write(self)
+      self.sourceStats.close()
     for eqsrc in self.eqsrcs.components():
       eqsrc.finalize()
     FaultCohesive.finalize(self)
@@ -213,6 +233,12 @@ class FaultCohesiveKin(FaultCohesive, Integrator, ModuleFaultCohesiveKin):
     FaultCohesive._configure(self)
     self.eqsrcs = self.inventory.eqsrcs
     self.output = self.inventory.output
+    if not isinstance(self.inventory.sourceStats, NullComponent):
+      self.sourceStats = self.inventory.sourceStats
+      self.availableFields['vertex']['data'] += ["rupture_time",
+                                                 "peak_slip_rate"]
+    else:
+      self.sourceStats = None
     return
 
 
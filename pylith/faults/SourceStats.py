@@ -0,0 +1,196 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file pylith/faults/SourceStats.py
+##
+## @brief Python object for writing earthquake source statistics
+## computed during the run.
+##
+## Each time step the fault computes the rupture area, potency,
+## seismic moment, maximum slip, and maximum slip rate from the slip,
+## the fault area, and the shear modulus of the adjacent material
+## cells. This object writes one line per time step with these values
+## along with the average slip and moment magnitude (computed as in
+## pylith_eqinfo). Values are in SI units; in 2-D the area, potency,
+## and moment are per unit length along strike.
+##
+## Factory: source_stats
+
+from pylith.utils.PetscComponent import PetscComponent
+
+# Columns in output file.
+COLUMNS = ["t", "rupture_area", "potency", "moment", "mw", "avg_slip", "max_slip", "max_slip_rate"]
+
+# SourceStats class
+class SourceStats(PetscComponent):
+  """
+  Python object for writing earthquake source statistics computed
+  during the run.
+
+  Factory: source_stats
+  """
+
+  # INVENTORY //////////////////////////////////////////////////////////
+
+  class Inventory(PetscComponent.Inventory):
+    """
+    Python object for managing SourceStats facilities and properties.
+    """
+
+    ## @class Inventory
+    ## Python object for managing SourceStats facilities and properties.
+    ##
+    ## \b Properties
+    ## @li \b filename Name of output file ('%s' is replaced by the fault label).
+    ## @li \b rupture_slip Minimum slip for a vertex to contribute to the rupture area.
+    ## @li \b rupture_slip_rate Slip rate at which the rupture front arrives at a vertex.
+    ##
+    ## \b Facilities
+    ## @li None
+
+    import pyre.inventory
+    from pyre.units.length import m
+    from pyre.units.time import s
+
+    filename = pyre.inventory.str("filename", default="output/source_stats_%s.txt")
+    filename.meta['tip'] = "Name of output file ('%s' is replaced by the fault label)."
+
+    ruptureSlip = pyre.inventory.dimensional("rupture_slip", default=0.0*m)
+    ruptureSlip.meta['tip'] = "Minimum slip for a vertex to contribute to the rupture area."
+
+    ruptureSlipRate = pyre.inventory.dimensional("rupture_slip_rate", default=1.0e-3*m/s)
+    ruptureSlipRate.meta['tip'] = "Slip rate at which the rupture front arrives at a vertex."
+
+
+  # PUBLIC METHODS /////////////////////////////////////////////////////
+
+  def __init__(self, name="sourcestats"):
+    """
+    Constructor.
+    """
+    PetscComponent.__init__(self, name, facility="source_stats")
+    self.isMaster = True
+    self.fout = None
+    return
+
+
+  def initialize(self, fault, materials):
+    """
+    Enable source statistics for fault and open output file.
+
+    @param fault Fault with source statistics.
+    @param materials Materials adjacent to the fault.
+    """
+    import pylith.mpi.mpi as mpi
+    self.isMaster = 0 == mpi.rank()
+
+    fault.initializeSourceStats(self.ruptureSlip.value, self.ruptureSlipRate.value)
+    for material in materials:
+      fault.addShearModulus(fault.mesh(), material)
+    fault.averageShearModulus()
+
+    if self.isMaster:
+      filename = self.filename
+      if filename.find("%s") >= 0:
+        filename = filename % fault.label()
+      self._createPath(filename)
+      self.fout = open(filename, "w")
+      self.fout.write("# %s\n" % " ".join(COLUMNS))
+    return
+
+
+  def write(self, fault):
+    """
+    Write source statistics accumulated since the previous write.
+
+    @param fault Fault with source statistics.
+    """
+    numRecords = fault.numSourceStats()
+    if self.isMaster:
+      for i in xrange(numRecords):
+        self.fout.write(self._format(self._record(fault, i)))
+      self.fout.flush()
+    fault.clearSourceStats()
+    return
+
+
+  def close(self):
+    """
+    Close output file.
+    """
+    if not self.fout is None:
+      self.fout.close()
+      self.fout = None
+    return
+
+
+  # PRIVATE METHODS /////////////////////////////////////////////////////
+
+  def _configure(self):
+    """
+    Set members based using inventory.
+    """
+    PetscComponent._configure(self)
+    self.filename = self.inventory.filename
+    self.ruptureSlip = self.inventory.ruptureSlip
+    self.ruptureSlipRate = self.inventory.ruptureSlipRate
+    return
+
+
+  def _record(self, fault, index):
+    """
+    Get values in record, adding average slip and moment magnitude.
+    """
+    import math
+    value = lambda name: fault.sourceStat(index, name)
+    area = value("rupture_area")
+    potency = value("potency")
+    moment = value("moment")
+    avgslip = potency / area if area > 0.0 else 0.0
+    mw = 2.0/3.0*(math.log10(moment) - 9.05) if moment > 0.0 else float("nan")
+    return [value("t"), area, potency, moment, mw, avgslip, value("max_slip"), value("max_slip_rate")]
+
+
+  def _format(self, record):
+    """
+    Format record as single line.
+    """
+    return "%s\n" % " ".join(["%14.6e" % value for value in record])
+
+
+  def _createPath(self, filename):
+    """
+    Create path for filename if it doesn't exist.
+    """
+    import os
+    relpath = os.path.dirname(filename)
+    if len(relpath) > 0 and not os.path.exists(relpath):
+      os.makedirs(relpath)
+    return
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def source_stats():
+  """
+  Factory associated with SourceStats.
+  """
+  return SourceStats()
+
+
+# End of file
@@ -112,6 +112,17 @@ class IntegratorElasticity(Integrator):
     return
   
   
+  def poststep(self, t, dt, fields):
+    """
+    Hook for doing stuff after advancing time step.
+    """
+    # Keep total strain computed when updating state variables only if
+    # output may be written at the end of this time step.
+    self.outputDue(self.output.mayWrite(t+dt))
+    Integrator.poststep(self, t, dt, fields)
+    return
+
+
   def writeData(self, t, fields):
     """
     Hook for writing data at time t.
@@ -174,6 +185,7 @@ class IntegratorElasticity(Integrator):
     Initialize output.
     """
     self.output.initialize(normalizer, self.materialObj.quadrature)
+    self.cellFieldsRequested(self.output.cellDataFields)
     self.output.writeInfo()
     self.output.open(totalTime, numTimeSteps)
     return
@@ -67,6 +67,7 @@ class Material(PetscComponent):
     ## \b Properties
     ## @li \b id Material identifier (from mesh generator)
     ## @li \b label Descriptive label for material.
+    ## @li \b node_shared_query Query spatial databases once per compute node.
     ##
     ## \b Facilities
     ## @li \b db_properties Database of material property parameters
@@ -81,6 +82,10 @@ class Material(PetscComponent):
     label = pyre.inventory.str("label", default="", validator=validateLabel)
     label.meta['tip'] = "Descriptive label for material."
 
+    nodeSharedQuery = pyre.inventory.bool("node_shared_query", default=False)
+    nodeSharedQuery.meta['tip'] = "Open spatial databases on one process per " \
+        "compute node and share query results via MPI shared memory."
+
     from spatialdata.spatialdb.SimpleDB import SimpleDB
     dbProperties = pyre.inventory.facility("db_properties",
                                            family="spatial_database",
@@ -185,6 +190,7 @@ class Material(PetscComponent):
       PetscComponent._configure(self)
       self.id(self.inventory.id)
       self.label(self.inventory.label)
+      self.nodeSharedQuery(self.inventory.nodeSharedQuery)
       self.dbProperties(self.inventory.dbProperties)
       from pylith.utils.NullComponent import NullComponent
       if not isinstance(self.inventory.dbInitialState, NullComponent):
@@ -214,6 +220,8 @@ class Material(PetscComponent):
     self.perfLogger.logMaterial('Materials', self)
     self.perfLogger.logField('Materials', self.propertiesField())
     self.perfLogger.logField('Materials', self.stateVarsField())
+    if self.nodeSharedQuery():
+      self.perfLogger.logNodeShared('Materials', self.label(), self.nodeSharedMemory())
     return
 
 
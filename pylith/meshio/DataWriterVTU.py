@@ -0,0 +1,123 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file pyre/meshio/DataWriterVTU.py
+##
+## @brief Python object for writing finite-element data to parallel
+## VTK XML unstructured grid (VTU/PVTU) files.
+
+from DataWriter import DataWriter
+from meshio import DataWriterVTU as ModuleDataWriterVTU
+
+# DataWriterVTU class
+class DataWriterVTU(DataWriter, ModuleDataWriterVTU):
+  """
+  Python object for writing finite-element data to parallel VTK XML
+  unstructured grid (VTU/PVTU) files.
+
+  Each process writes its portion of the mesh to its own VTU file
+  with raw binary appended data. A PVTU file for each time step and a
+  PVD file with the time series can be opened in ParaView.
+
+  Inventory
+
+  \b Properties
+  @li \b filename Name of VTU file.
+  @li \b time_format C style format string for time stamp in filename.
+  @li \b time_constant Value used to normalize time stamp in filename.
+  @li \b compressor Compressor for binary data ('none' or 'zlib').
+
+  \b Facilities
+  @li None
+  """
+
+  # INVENTORY //////////////////////////////////////////////////////////
+
+  import pyre.inventory
+
+  filename = pyre.inventory.str("filename", default="output.vtu")
+  filename.meta['tip'] = "Name of VTU file."
+
+  timeFormat = pyre.inventory.str("time_format", default="%f")
+  timeFormat.meta['tip'] = "C style format string for time stamp in filename."
+
+  from pyre.units.time import second
+  timeConstant = pyre.inventory.dimensional("time_constant",
+                                            default=1.0*second,
+                                            validator=pyre.inventory.greater(0.0*second))
+  timeConstant.meta['tip'] = "Values used to normalize time stamp in filename."
+
+  compressor = pyre.inventory.str("compressor", default="none",
+                                  validator=pyre.inventory.choice(["none", "zlib"]))
+  compressor.meta['tip'] = "Compressor for binary data ('none' or 'zlib')."
+
+
+  # PUBLIC METHODS /////////////////////////////////////////////////////
+
+  def __init__(self, name="datawritervtu"):
+    """
+    Constructor.
+    """
+    DataWriter.__init__(self, name)
+    ModuleDataWriterVTU.__init__(self)
+    return
+
+
+  def initialize(self, normalizer):
+    """
+    Initialize writer.
+    """
+    DataWriter.initialize(self, normalizer, self.filename)
+
+    timeScale = normalizer.timeScale()
+    timeConstantN = normalizer.nondimensionalize(self.timeConstant, timeScale)
+
+    ModuleDataWriterVTU.filename(self, self.filename)
+    ModuleDataWriterVTU.timeScale(self, timeScale.value)
+    ModuleDataWriterVTU.timeFormat(self, self.timeFormat)
+    ModuleDataWriterVTU.timeConstant(self, timeConstantN)
+    ModuleDataWriterVTU.compressor(self, self.compressor)
+    return
+
+
+  # PRIVATE METHODS ////////////////////////////////////////////////////
+
+  def _configure(self):
+    """
+    Configure object.
+    """
+    try:
+      DataWriter._configure(self)
+    except ValueError, err:
+      aliases = ", ".join(self.aliases)
+      raise ValueError("Error while configuring VTU output "
+                       "(%s):\n%s" % (aliases, err.message))
+
+    return
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def data_writer():
+  """
+  Factory associated with DataWriter.
+  """
+  return DataWriterVTU()
+
+
+# End of file
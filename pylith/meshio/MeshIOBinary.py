@@ -0,0 +1,120 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file pyre/meshio/MeshIOBinary.py
+##
+## @brief Python object for reading/writing finite-element mesh from
+## PyLith binary mesh file.
+##
+## Factory: mesh_io
+
+from MeshIOObj import MeshIOObj
+from meshio import MeshIOBinary as ModuleMeshIOBinary
+
+# Validator for filename
+def validateFilename(value):
+  """
+  Validate filename.
+  """
+  if 0 == len(value):
+    msg = "Filename for binary input mesh not specified.  " + \
+          "Use pylith_convertmesh to create a binary mesh file."
+    raise ValueError(msg)
+  return value
+
+
+# MeshIOBinary class
+class MeshIOBinary(MeshIOObj, ModuleMeshIOBinary):
+  """
+  Python object for reading/writing finite-element mesh from PyLith
+  binary mesh file.
+
+  The file is memory mapped and its arrays are used directly to build
+  the mesh, so reading requires no parsing.
+
+  Factory: mesh_io
+  """
+
+  # INVENTORY //////////////////////////////////////////////////////////
+
+  class Inventory(MeshIOObj.Inventory):
+    """
+    Python object for managing MeshIOBinary facilities and properties.
+    """
+
+    ## @class Inventory
+    ## Python object for managing MeshIOBinary facilities and properties.
+    ##
+    ## \b Properties
+    ## @li \b filename Name of mesh file
+    ##
+    ## \b Facilities
+    ## @li coordsys Coordinate system associated with mesh.
+
+    import pyre.inventory
+
+    filename = pyre.inventory.str("filename", default="", 
+                                  validator=validateFilename)
+    filename.meta['tip'] = "Name of mesh file"
+
+    from spatialdata.geocoords.CSCart import CSCart
+    coordsys = pyre.inventory.facility("coordsys", family="coordsys",
+                                       factory=CSCart)
+    coordsys.meta['tip'] = "Coordinate system associated with mesh."
+  
+
+  # PUBLIC METHODS /////////////////////////////////////////////////////
+
+  def __init__(self, name="meshiobinary"):
+    """
+    Constructor.
+    """
+    MeshIOObj.__init__(self, name)
+    return
+
+
+  # PRIVATE METHODS ////////////////////////////////////////////////////
+
+  def _configure(self):
+    """
+    Set members based using inventory.
+    """
+    MeshIOObj._configure(self)
+    self.coordsys = self.inventory.coordsys
+    self.filename(self.inventory.filename)
+    return
+
+
+  def _createModuleObj(self):
+    """
+    Create C++ MeshIOBinary object.
+    """
+    ModuleMeshIOBinary.__init__(self)
+    return
+  
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def mesh_io():
+  """
+  Factory associated with MeshIOBinary.
+  """
+  return MeshIOBinary()
+
+
+# End of file 
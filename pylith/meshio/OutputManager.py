@@ -34,10 +34,19 @@ class OutputManager(PetscComponent, ModuleOutputManager):
   information.
 
   \b Properties
-  @li \b output_freq Flag indicating whether to use 'time_step' or 'skip'
-  to set frequency of solution output.
+  @li \b output_freq Flag indicating whether to use 'time_step', 'skip',
+  or 'adaptive' to set frequency of solution output.
   @li \b time_step Time step between solution output.
   @li \b skip Number of time steps to skip between solution output.
+  @li \b min_interval Minimum time between adaptive output.
+  @li \b max_interval Maximum time between adaptive output (0 for no maximum).
+  @li \b trigger_field Name of vertex data field used by adaptive output triggers.
+  @li \b trigger_max_magnitude Write when maximum magnitude of trigger
+  field exceeds this value (SI units, 0 to disable).
+  @li \b trigger_norm_change Write when relative change in L2 norm of
+  trigger field since last output exceeds this value (0 to disable).
+  @li \b trigger_wall_time Write when wall clock time since last output
+  exceeds this value (0 to disable).
   
   \b Facilities
   @li \b coordsys Coordinate system for output.
@@ -55,9 +64,9 @@ class OutputManager(PetscComponent, ModuleOutputManager):
   writer.meta['tip'] = "Writer for data."
 
   outputFreq = pyre.inventory.str("output_freq", default="skip",
-                                  validator=pyre.inventory.choice(["skip", "time_step"]))
-  outputFreq.meta['tip'] = "Flag indicating whether to use 'time_step' " \
-      "or 'skip' to set frequency of output."
+                                  validator=pyre.inventory.choice(["skip", "time_step", "adaptive"]))
+  outputFreq.meta['tip'] = "Flag indicating whether to use 'time_step', " \
+      "'skip', or 'adaptive' to set frequency of output."
   
   from pyre.units.time import s
   dt = pyre.inventory.dimensional("time_step", default=1.0*s)
@@ -66,6 +75,29 @@ class OutputManager(PetscComponent, ModuleOutputManager):
   skip = pyre.inventory.int("skip", default=0,
                             validator=pyre.inventory.greaterEqual(0))
   skip.meta['tip'] = "Number of time steps to skip between output."
+
+  minInterval = pyre.inventory.dimensional("min_interval", default=0.0*s)
+  minInterval.meta['tip'] = "Minimum time between adaptive output."
+
+  maxInterval = pyre.inventory.dimensional("max_interval", default=0.0*s)
+  maxInterval.meta['tip'] = "Maximum time between adaptive output (0 for no maximum)."
+
+  triggerField = pyre.inventory.str("trigger_field", default="")
+  triggerField.meta['tip'] = "Name of vertex data field used by adaptive output triggers."
+
+  triggerMaxMagnitude = pyre.inventory.float("trigger_max_magnitude", default=0.0,
+                                             validator=pyre.inventory.greaterEqual(0.0))
+  triggerMaxMagnitude.meta['tip'] = "Write when maximum magnitude of trigger " \
+      "field exceeds this value (SI units, 0 to disable)."
+
+  triggerNormChange = pyre.inventory.float("trigger_norm_change", default=0.0,
+                                           validator=pyre.inventory.greaterEqual(0.0))
+  triggerNormChange.meta['tip'] = "Write when relative change in L2 norm of " \
+      "trigger field since last output exceeds this value (0 to disable)."
+
+  triggerWallTime = pyre.inventory.dimensional("trigger_wall_time", default=0.0*s)
+  triggerWallTime.meta['tip'] = "Write when wall clock time since last " \
+      "output exceeds this value (0 to disable)."
   
   from spatialdata.geocoords.CSCart import CSCart
   coordsys = pyre.inventory.facility("coordsys", family="coordsys",
@@ -99,6 +131,8 @@ class OutputManager(PetscComponent, ModuleOutputManager):
     self._stepCur = 0
     self._stepWrite = None
     self._tWrite = None
+    self._normWrite = None
+    self._wallWrite = None
     self.dataProvider = None
     self.vertexInfoFields = []
     self.vertexDataFields = []
@@ -137,6 +171,19 @@ class OutputManager(PetscComponent, ModuleOutputManager):
     if len(self.cellInfoFields) > 0 or len(self.cellDataFields) > 0:
       if not "getCellField" in dir(self.dataProvider()):
         raise TypeError("Data provider must have a 'getCellField' function.")
+
+    if self.outputFreq == "adaptive":
+      if self.triggerMaxMagnitude > 0.0 or self.triggerNormChange > 0.0:
+        if 0 == len(self.triggerField):
+          raise ValueError("Adaptive output triggers on maximum magnitude or "
+                           "norm change require a trigger field.")
+      if len(self.triggerField) > 0 and \
+            not self.triggerField in self.dataProvider().availableFields['vertex']['data']:
+        raise ValueError("Trigger field '%s' for adaptive output is not "
+                         "an available vertex data field." % self.triggerField)
+      if self.maxInterval.value > 0.0 and self.maxInterval.value < self.minInterval.value:
+        raise ValueError("Maximum interval (%s) for adaptive output must not be "
+                         "less than minimum interval (%s)." % (self.maxInterval, self.minInterval))
     return
 
 
@@ -152,6 +199,8 @@ class OutputManager(PetscComponent, ModuleOutputManager):
     self.normalizer = normalizer
     timeScale = normalizer.timeScale()
     self.dtN = normalizer.nondimensionalize(self.dt, timeScale)
+    self.minIntervalN = normalizer.nondimensionalize(self.minInterval, timeScale)
+    self.maxIntervalN = normalizer.nondimensionalize(self.maxInterval, timeScale)
 
     # Initialize coordinate system
     if self.coordsys is None:
@@ -240,7 +289,7 @@ class OutputManager(PetscComponent, ModuleOutputManager):
     logEvent = "%swriteData" % self._loggingPrefix
     self._eventLogger.eventBegin(logEvent)    
 
-    if self._checkWrite(t) and ( len(self.vertexDataFields) > 0 or len(self.cellDataFields) ) > 0:
+    if self._checkWrite(t, fields) and ( len(self.vertexDataFields) > 0 or len(self.cellDataFields) ) > 0:
 
       (mesh, label, labelId) = self.dataProvider().getDataMesh()
       self._openTimeStep(t, mesh, label, labelId)
@@ -259,6 +308,67 @@ class OutputManager(PetscComponent, ModuleOutputManager):
     return
       
     
+  def mayWrite(self, t):
+    """
+    Check whether data may be written at time t without changing the
+    state of the output manager. Adaptive output may still skip
+    writing once the minimum interval has elapsed.
+    """
+    if 0 == len(self.vertexDataFields) and 0 == len(self.cellDataFields):
+      return False
+
+    # If first call, then data will be written.
+    if None == self._stepWrite and None == self._tWrite:
+      return True
+
+    if self.outputFreq == "skip":
+      mayWrite = self._stepCur > self._stepWrite + self.skip
+    elif self.outputFreq == "time_step":
+      mayWrite = t >= self._tWrite + self.dtN
+    elif self.outputFreq == "adaptive":
+      mayWrite = t - self._tWrite >= self.minIntervalN
+    else:
+      raise ValueError, \
+            "Unknown value '%s' for output frequency." % self.outputFreq
+    return mayWrite
+
+
+  def numStepsNoWrite(self, t, dt):
+    """
+    Get number of upcoming time steps of size dt, starting at time t,
+    that are certain not to write data.
+    """
+    import sys
+    if 0 == len(self.vertexDataFields) and 0 == len(self.cellDataFields):
+      return sys.maxint
+
+    # If first call, then data will be written.
+    if None == self._stepWrite and None == self._tWrite:
+      return 0
+
+    if self.outputFreq == "skip":
+      nsteps = self._stepWrite + self.skip - self._stepCur + 1
+    elif self.outputFreq == "time_step":
+      # Leave a margin of one step for roundoff in accumulated time.
+      nsteps = int((self._tWrite + self.dtN - t) / dt) - 1
+    elif self.outputFreq == "adaptive":
+      # Triggers are checked every time step after the minimum
+      # interval has elapsed.
+      nsteps = int((self._tWrite + self.minIntervalN - t) / dt) - 1
+    else:
+      raise ValueError, \
+            "Unknown value '%s' for output frequency." % self.outputFreq
+    return min(max(0, nsteps), sys.maxint)
+
+
+  def skipSteps(self, nsteps):
+    """
+    Account for time steps advanced without calling writeData().
+    """
+    self._stepCur += nsteps
+    return
+
+
   # PRIVATE METHODS ////////////////////////////////////////////////////
 
   def _configure(self):
@@ -309,7 +419,7 @@ class OutputManager(PetscComponent, ModuleOutputManager):
     return nsteps
 
 
-  def _checkWrite(self, t):
+  def _checkWrite(self, t, fields=None):
     """
     Check if we want to write data at time t.
     """
@@ -320,6 +430,8 @@ class OutputManager(PetscComponent, ModuleOutputManager):
       write = True
       self._stepWrite = self._stepCur
       self._tWrite = t
+      if self.outputFreq == "adaptive":
+        self._checkTriggers(t, fields, first=True)
 
     elif self.outputFreq == "skip":
       if self._stepCur > self._stepWrite + self.skip:
@@ -331,6 +443,12 @@ class OutputManager(PetscComponent, ModuleOutputManager):
        write = True
        self._tWrite = t
 
+    elif self.outputFreq == "adaptive":
+      if self._checkTriggers(t, fields):
+        write = True
+        self._stepWrite = self._stepCur
+        self._tWrite = t
+
     else:
       raise ValueError, \
             "Unknown value '%s' for output frequency." % self.outputFreq
@@ -339,6 +457,51 @@ class OutputManager(PetscComponent, ModuleOutputManager):
     return write
 
 
+  def _checkTriggers(self, t, fields, first=False):
+    """
+    Check adaptive output triggers at time t. The triggers are checked
+    only after the minimum interval since the last output has elapsed.
+    Reference values for the wall clock time and trigger field norm are
+    reset whenever output is written.
+
+    @param first True if this is the first output (always written).
+    """
+    write = first
+    elapsed = t - self._tWrite
+    if not write and elapsed < self.minIntervalN:
+      return False
+    if not write and self.maxIntervalN > 0.0 and elapsed >= self.maxIntervalN:
+      write = True
+
+    # Wall clock time may differ among processes, so use the maximum
+    # so that all processes make the same decision.
+    import time
+    wall = time.time()
+    if not write and self.triggerWallTime.value > 0.0:
+      from pylith.mpi.Communicator import mpi_comm_world
+      import pylith.mpi.mpi as mpi
+      comm = mpi_comm_world()
+      elapsedWall = mpi.allreduce_scalar_double(wall - self._wallWrite, mpi.mpi_max(), comm.handle)
+      write = elapsedWall >= self.triggerWallTime.value
+
+    # Field metrics are computed in C++ without writing the field.
+    norm = None
+    if len(self.triggerField) > 0 and not fields is None and \
+          (self.triggerMaxMagnitude > 0.0 or self.triggerNormChange > 0.0):
+      field = self.dataProvider().getVertexField(self.triggerField, fields)
+      if not write and self.triggerMaxMagnitude > 0.0:
+        write = ModuleOutputManager.fieldMaxMagnitude(self, field) >= self.triggerMaxMagnitude
+      if self.triggerNormChange > 0.0:
+        norm = ModuleOutputManager.fieldNorm(self, field)
+        if not write and not self._normWrite is None:
+          write = abs(norm - self._normWrite) > self.triggerNormChange*self._normWrite
+
+    if write:
+      self._wallWrite = wall
+      self._normWrite = norm
+    return write
+
+
   def _verifyFields(self, available):
     """
     Verify fields for output are available.
@@ -49,6 +49,7 @@ class OutputSolnPoints(OutputManager, ModuleOutputSolnPoints):
 
     \b Properties
     @li \b vertex_data_fields Names of vertex data fields to output.
+    @li \b buffer_steps Number of time steps to buffer in memory before writing.
 
     \b Facilities
     @li \b reader Reader for list of points.
@@ -63,6 +64,9 @@ class OutputSolnPoints(OutputManager, ModuleOutputSolnPoints):
     vertexDataFields = pyre.inventory.list("vertex_data_fields", default=["displacement"])
     vertexDataFields.meta['tip'] = "Names of vertex data fields to output."
 
+    bufferSteps = pyre.inventory.int("buffer_steps", default=1, validator=pyre.inventory.greaterEqual(1))
+    bufferSteps.meta['tip'] = "Number of time steps to buffer in memory before writing (1=write every step)."
+
     from PointsList import PointsList
     reader = pyre.inventory.facility("reader", factory=PointsList, family="points_list")
     reader.meta['tip'] = "Reader for points list."
@@ -145,6 +149,7 @@ class OutputSolnPoints(OutputManager, ModuleOutputSolnPoints):
             raise ValueError("Error while configuring output over points "
                              "(%s):\n%s" % (aliases, err.message))
 
+        ModuleOutputSolnPoints.bufferSteps(self, self.inventory.bufferSteps)
         return
 
     def _createModuleObj(self):
@@ -166,6 +171,13 @@ class OutputSolnPoints(OutputManager, ModuleOutputSolnPoints):
         ModuleOutputSolnPoints.writePointNames(self)
         return
 
+    def _close(self):
+        """
+        Call C++ close(), which writes any buffered time steps.
+        """
+        ModuleOutputSolnPoints.close(self)
+        return
+
 
 # FACTORIES ////////////////////////////////////////////////////////////
 
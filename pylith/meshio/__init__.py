@@ -24,8 +24,10 @@ __all__ = ['CellFilter',
            'CellFilterAvg',
            'DataWriter',
            'DataWriterVTK',
+           'DataWriterVTU',
            'MeshIOObj',
            'MeshIOAscii',
+           'MeshIOBinary',
            'MeshIOCubit',
            'MeshIOLagrit',
            'OutputDirichlet',
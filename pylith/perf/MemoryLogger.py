@@ -61,6 +61,7 @@ class MemoryLogger(Logger):
     self.megabyte = float(2**20)
     self.memory   = {}
     self.memory['Completion'] = 0
+    self.nodeShared = {}
     return
 
 
@@ -112,6 +113,20 @@ class MemoryLogger(Logger):
     return
 
 
+  def logNodeShared(self, stage, label, memorySaved):
+    """
+    Log memory saved on the compute node by sharing data among the
+    processes on the node.
+    """
+    import pylith.perf.NodeShared
+
+    if not stage in self.nodeShared:
+      self.nodeShared[stage] = {}
+    sharedModel = pylith.perf.NodeShared.NodeShared(label, memorySaved)
+    sharedModel.tabulate(self.nodeShared[stage])
+    return
+
+
   def logQuadrature(self, stage, quadrature):
     ##self.logField(stage, quadrature.quadPtsPrecomp())
     ##self.logField(stage, quadrature.jacobianPrecomp())
@@ -209,6 +224,7 @@ class MemoryLogger(Logger):
     Incorporate information from another logger.
     """
     self.mergeMemDict(self.memory, logger.memory)
+    self.mergeMemDict(self.nodeShared, logger.nodeShared)
     return
 
 
@@ -283,6 +299,16 @@ class MemoryLogger(Logger):
     output.append(self.memLine('Code',  'Total Dealloced', 0))
                                #logger.getDeallocationTotal('default'), 1))
 
+    if len(self.nodeShared) > 0:
+      output.append("NET MEMORY SAVED PER COMPUTE NODE BY SHARING DATA")
+      total = 0
+      for stage,memDict in self.nodeShared.iteritems():
+        output.append(self.prefix(1)+stage)
+        for name,m in memDict.iteritems():
+          output.append(self.memLine('Model', name, m, 2))
+          total += m
+      output.append(self.memLine('Model', 'Total', total, 1))
+
     print '\n'.join(output)
     return
 
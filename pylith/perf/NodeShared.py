@@ -0,0 +1,56 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file pylith/perf/NodeShared.py
+##
+## @brief Python memory model for net memory saved on a compute node
+## by sharing data among the processes on the node (memory avoided by
+## the other processes minus the shared memory windows).
+
+from Memory import Memory
+
+class NodeShared(Memory):
+  """
+  Object for holding net memory saved on a compute node by sharing
+  data among the processes on the node.
+  """
+  def __init__(self, label = '', memorySaved = 0):
+    """
+    Constructor.
+    """
+    self.label = label
+    self.memorySaved = memorySaved
+    return
+
+
+  def tabulate(self, memDict):
+    """
+    Tabulate memory saved.
+    """
+    if not self.label in memDict:
+      memDict[self.label] = 0
+    memDict[self.label] += int(self.memorySaved)
+    return
+
+if __name__ == '__main__':
+  d = {}
+  NodeShared('rock', 2**20).tabulate(d)
+  print 'Memory saved:',d
+
+
+# End of file
@@ -28,6 +28,7 @@ __all__ = ['Memory',
            'Material', 
            'Field',
            'GlobalOrder',
+           'NodeShared',
            ]
 
 
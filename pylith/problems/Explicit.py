@@ -121,6 +121,7 @@ class Explicit(Formulation, ModuleExplicit):
     self.fields.add("velocity(t)", "velocity")
     self.fields.add("acceleration(t)", "acceleration")
     self.fields.copyLayout("dispIncr(t->t+dt)")
+    self.fields.createHistory(["disp(t)", "disp(t-dt)"])
     self._debug.log(resourceUsageString())
 
     # Setup fields and set to zero
@@ -244,14 +245,9 @@ class Explicit(Formulation, ModuleExplicit):
       output.writeData(t, self.fields)
     self._writeData(t)
 
-    # Update displacement field from time t to time t+dt.
-    dispIncr = self.fields.get("dispIncr(t->t+dt)")
-    dispT = self.fields.get("disp(t)")
-    dispTmdt = self.fields.get("disp(t-dt)")
-
-    dispTmdt.copy(dispT)
-    dispT.add(dispIncr)
-    dispIncr.zeroAll()
+    # Update displacement field from time t to time t+dt. The
+    # displacement history is rotated rather than copied.
+    ModuleExplicit.advanceDisplacement(self)
 
     # Complete post-step processing.
     Formulation.poststep(self, t, dt)
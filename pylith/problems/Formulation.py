@@ -221,6 +221,33 @@ class Formulation(PetscComponent, ModuleFormulation):
     return dt
   
 
+  def useNativeDriver(self):
+    """
+    Check whether formulation can advance the solution over several time
+    steps natively (in C++).
+    """
+    return False
+
+
+  def numStepsNative(self, t, dt):
+    """
+    Get number of upcoming time steps of size dt, starting at time t,
+    that do not write output and can be advanced natively.
+    """
+    import sys
+    nsteps = sys.maxint
+    for output in self._outputManagers():
+      nsteps = min(nsteps, output.numStepsNoWrite(t, dt))
+    return nsteps
+
+
+  def advanceNative(self, t, dt, nsteps):
+    """
+    Advance solution over nsteps time steps of size dt natively (in C++).
+    """
+    raise NotImplementedError("Please implement 'advanceNative' in derived class.")
+
+
   def prestep(self, t, dt):
     """
     Hook for doing stuff before advancing time step.
@@ -471,10 +498,22 @@ class Formulation(PetscComponent, ModuleFormulation):
     ModuleFormulation.integrators(self, self.integrators)
     self._debug.log(resourceUsageString())
 
+    # Source statistics use the shear modulus of the materials
+    # adjacent to the fault, so they are initialized after all
+    # integrators.
+    materials = [integrator.materialObj for integrator in self.integrators \
+                   if hasattr(integrator, "materialObj")]
+    for integrator in self.integrators:
+      if not getattr(integrator, "sourceStats", None) is None:
+        if 0 == comm.rank:
+          self._info.log("Initializing source statistics for fault '%s'." % integrator.label())
+        integrator.sourceStats.initialize(integrator, materials)
+
     if 0 == comm.rank:
       self._info.log("Initializing constraints.")
     for constraint in self.constraints:
       constraint.initialize(totalTime, numTimeSteps, normalizer)
+    ModuleFormulation.constraints(self, self.constraints)
     self._debug.log(resourceUsageString())
 
     if 0 == comm.rank:
@@ -618,6 +657,18 @@ class Formulation(PetscComponent, ModuleFormulation):
     return
 
 
+  def _outputManagers(self):
+    """
+    Get output managers that may write data every time step.
+    """
+    managers = [output for output in self.output.components()]
+    for obj in self.integrators + self.constraints:
+      output = getattr(obj, "output", None)
+      if not output is None and "numStepsNoWrite" in dir(output):
+        managers.append(output)
+    return managers
+
+
   def _setupLogging(self):
     """
     Setup event logging.
@@ -637,6 +688,7 @@ class Formulation(PetscComponent, ModuleFormulation):
               "prestep",
               "step",
               "poststep",
+              "advance",
               "write",
               "finalize"]
     for event in events:
@@ -80,13 +80,36 @@ class Implicit(Formulation, ModuleImplicit):
     ## Python object for managing Implicit facilities and properties.
     ##
     ## \b Properties
-    ## @li None
+    ## @li \b jacobian_lag_max_steps Maximum number of time steps to reuse the preconditioner (0 disables lagging).
+    ## @li \b jacobian_reform_iterations_ratio Set up lagged preconditioner when solver iterations grow by this ratio.
+    ## @li \b jacobian_reform_dt_ratio Set up lagged preconditioner when time step changes by more than this ratio.
+    ## @li \b predictor_order Order of extrapolation of previous increments for initial guess (0 = zero initial guess).
     ##
     ## \b Facilities
     ## @li None
 
     import pyre.inventory
 
+    jacobianLagMaxSteps = pyre.inventory.int("jacobian_lag_max_steps", default=0,
+                                             validator=pyre.inventory.greaterEqual(0))
+    jacobianLagMaxSteps.meta['tip'] = "Maximum number of time steps to reuse " \
+        "the preconditioner while the Jacobian is reformed (0 disables lagging)."
+
+    jacobianReformItsRatio = pyre.inventory.float("jacobian_reform_iterations_ratio", default=2.0,
+                                                  validator=pyre.inventory.greaterEqual(1.0))
+    jacobianReformItsRatio.meta['tip'] = "Set up lagged preconditioner when solver " \
+        "iterations exceed this ratio times the iterations after the last reform."
+
+    jacobianReformDtRatio = pyre.inventory.float("jacobian_reform_dt_ratio", default=1.25,
+                                                 validator=pyre.inventory.greaterEqual(1.0))
+    jacobianReformDtRatio.meta['tip'] = "Set up lagged preconditioner when time step " \
+        "changes by more than this ratio relative to the last reform."
+
+    predictorOrder = pyre.inventory.int("predictor_order", default=0,
+                                        validator=pyre.inventory.choice([0, 1, 2]))
+    predictorOrder.meta['tip'] = "Order of extrapolation of displacement " \
+        "increments from previous time steps for initial guess (0 = zero initial guess)."
+
 
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
@@ -97,6 +120,7 @@ class Implicit(Formulation, ModuleImplicit):
     Formulation.__init__(self, name)
     ModuleImplicit.__init__(self)
     self._loggingPrefix = "TSIm "
+    self._savePredictor = False
     return
 
 
@@ -181,13 +205,16 @@ class Implicit(Formulation, ModuleImplicit):
     dispIncr.zeroAll()
     for constraint in self.constraints:
       constraint.setFieldIncr(t, t+dt, dispIncr)
+    self._savePredictor = True
 
     needNewJacobian = False
     for integrator in self.integrators:
       integrator.timeStep(dt)
       if integrator.needNewJacobian():
         needNewJacobian = True
-    if self._collectNeedNewJacobian(needNewJacobian):
+    needNewJacobian = self._collectNeedNewJacobian(needNewJacobian)
+    self._lagPreconditioner(needNewJacobian, dt)
+    if needNewJacobian:
       self._reformJacobian(t, dt)
 
     return
@@ -203,6 +230,9 @@ class Implicit(Formulation, ModuleImplicit):
 
     self._reformResidual(t+dt, dt)
 
+    # Initial guess from previous increments (residual must not include it).
+    ModuleImplicit.predictDispIncr(self, dt)
+
     if 0 == comm.rank:
       self._info.log("Solving equations.")
     self._eventLogger.stagePush("Solve")
@@ -210,6 +240,7 @@ class Implicit(Formulation, ModuleImplicit):
     residual = self.fields.get("residual")
     #self.jacobian.view() # TEMPORARY
     self.solver.solve(dispIncr, self.jacobian, residual)
+    ModuleImplicit.solverIterations(self, self.solver.numIterations())
     #dispIncr.view("DISP INCR") # TEMPORARY
 
     # DEBUGGING Verify solution makes residual 0
@@ -231,6 +262,8 @@ class Implicit(Formulation, ModuleImplicit):
     dispIncr = self.fields.get("dispIncr(t->t+dt)")
     disp = self.fields.get("disp(t)")
     disp.add(dispIncr)
+    if self._savePredictor:
+      ModuleImplicit.saveDispIncr(self, dt)
     dispIncr.zeroAll()
 
     # Complete post-step processing, then write data.
@@ -247,6 +280,35 @@ class Implicit(Formulation, ModuleImplicit):
     return
 
 
+  def useNativeDriver(self):
+    """
+    Check whether formulation can advance the solution over several time
+    steps natively (in C++).
+    """
+    # Viewing the Jacobian requires returning to Python when it is reformed.
+    return not self.viewJacobian
+
+
+  def advanceNative(self, t, dt, nsteps):
+    """
+    Advance solution over nsteps time steps of size dt natively (in C++).
+    """
+    logEvent = "%sadvance" % self._loggingPrefix
+    self._eventLogger.eventBegin(logEvent)
+
+    comm = self.mesh().comm()
+    if 0 == comm.rank:
+      self._info.log("Advancing solution natively over %d time steps." % nsteps)
+    ModuleImplicit.advance(self, self.solver, t, dt, nsteps)
+
+    # No output was due in these time steps, but output managers count them.
+    for output in self._outputManagers():
+      output.skipSteps(nsteps)
+
+    self._eventLogger.eventEnd(logEvent)
+    return
+
+
   def prestepElastic(self, t, dt):
     """
     Hook for doing stuff before advancing time step.
@@ -259,13 +321,17 @@ class Implicit(Formulation, ModuleImplicit):
     disp.zeroAll()
     for constraint in self.constraints:
       constraint.setField(t+dt, disp)
+    # Elastic solution is not part of the smooth history used by the predictor.
+    self._savePredictor = False
 
     needNewJacobian = False
     for integrator in self.integrators:
       integrator.timeStep(dt)
       if integrator.needNewJacobian():
         needNewJacobian = True
-    if self._collectNeedNewJacobian(needNewJacobian):
+    needNewJacobian = self._collectNeedNewJacobian(needNewJacobian)
+    self._lagPreconditioner(needNewJacobian, dt)
+    if needNewJacobian:
       self._reformJacobian(t, dt)
 
     return
@@ -286,12 +352,28 @@ class Implicit(Formulation, ModuleImplicit):
     Set members based using inventory.
     """
     Formulation._configure(self)
+    ModuleImplicit.jacobianLag(self, self.inventory.jacobianLagMaxSteps,
+                               self.inventory.jacobianReformItsRatio,
+                               self.inventory.jacobianReformDtRatio)
+    ModuleImplicit.predictorOrder(self, self.inventory.predictorOrder)
 
     import journal
     self._debug = journal.debug(self.name)
     return
 
 
+  def _lagPreconditioner(self, needNewJacobian, dt):
+    """
+    Apply lagging policy for the preconditioner. The Jacobian is the
+    operator in the linear solve, so it is always reformed when
+    needed; the solver only reuses the preconditioner.
+    """
+    ModuleImplicit.needNewPreconditioner(self, needNewJacobian, dt)
+    if ModuleImplicit.lagPreconditioner(self) and 0 == self.mesh().comm().rank:
+      self._info.log("Reusing lagged preconditioner.")
+    return
+
+
 # FACTORIES ////////////////////////////////////////////////////////////
 
 def pde_formulation():
@@ -53,6 +53,9 @@ class Solver(PetscComponent):
     ## Python object for managing Solver facilities and properties.
     ##
     ## \b Properties
+    ## @li \b create_null_space Create solution null space.
+    ## @li \b reuse_amg_interpolation Reuse AMG interpolation when Jacobian is reformed.
+    ## @li \b mixed_precision Experimental: replace preconditioner with block Jacobi ILU(0) using single precision factors (not available with faults or split fields).
     ## @li \b use_cuda Use CUDA in solve if supported by solver.
     ##
     ## \b Facilities
@@ -63,6 +66,12 @@ class Solver(PetscComponent):
     createNullSpace = pyre.inventory.bool("create_null_space", default=True)
     createNullSpace.meta['tip'] = "Create solution null space. Changing this setting should only be necessary for test problems with fewer DOF than the null space."
 
+    reuseAMGInterpolation = pyre.inventory.bool("reuse_amg_interpolation", default=False)
+    reuseAMGInterpolation.meta['tip'] = "Reuse coarse spaces of GAMG preconditioners when Jacobian is reformed (numeric-only setup)."
+
+    mixedPrecision = pyre.inventory.bool("mixed_precision", default=False)
+    mixedPrecision.meta['tip'] = "Experimental: replace the preconditioner selected via PETSc options with block Jacobi ILU(0) with factors stored in single precision; the Krylov solver still uses the double precision Jacobian. Not available with faults or split fields."
+
     useCUDA = pyre.inventory.bool("use_cuda", default=False,
                                   validator=validateUseCUDA)
     useCUDA.meta['tip'] = "Enable use of CUDA for finite-element integrations."
@@ -97,6 +106,8 @@ class Solver(PetscComponent):
 
     self.useCUDA = self.inventory.useCUDA
     self.createNullSpace = self.inventory.createNullSpace
+    self.reuseAMGInterpolation = self.inventory.reuseAMGInterpolation
+    self.mixedPrecision = self.inventory.mixedPrecision
     return
 
 
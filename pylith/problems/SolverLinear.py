@@ -75,6 +75,8 @@ class SolverLinear(Solver, ModuleSolverLinear):
     Solver._configure(self)
 
     ModuleSolverLinear.skipNullSpaceCreation(self, not self.createNullSpace)
+    ModuleSolverLinear.reuseAMGInterpolation(self, self.reuseAMGInterpolation)
+    ModuleSolverLinear.mixedPrecision(self, self.mixedPrecision)
     return
 
 
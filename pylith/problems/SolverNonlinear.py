@@ -68,6 +68,8 @@ class SolverNonlinear(Solver, ModuleSolverNonlinear):
     Solver._configure(self)
 
     ModuleSolverNonlinear.skipNullSpaceCreation(self, not self.createNullSpace)
+    ModuleSolverNonlinear.reuseAMGInterpolation(self, self.reuseAMGInterpolation)
+    ModuleSolverNonlinear.mixedPrecision(self, self.mixedPrecision)
     return
 
 
@@ -0,0 +1,244 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file pylith/problems/StepTelemetry.py
+##
+## @brief Python PyLith object for writing per time step solver and
+## assembly telemetry.
+##
+## Each update appends one JSON record (JSON Lines format) with the
+## wall time spent in residual assembly, Jacobian assembly,
+## preconditioner setup, solve, fault constraints, and output along
+## with solver iteration counts and the number of Jacobian reforms
+## since the previous update. Times are taken from the PETSc event log
+## and are the maximum over all processes.
+##
+## With the nonlinear solver, the residual and Jacobian are assembled
+## in SNES callbacks inside the solve. This time is reported in the
+## residual, Jacobian, and fault categories and excluded from the solve
+## time.
+##
+## Factory: step_telemetry
+
+from pylith.utils.PetscComponent import PetscComponent
+
+# Logged events contributing to each category, and events nested
+# within them whose time is subtracted. The SNES callbacks (PETSc
+# events SNESFunctionEval and SNESJacobianEval) run inside "SoNl solve"
+# and contain the residual, Jacobian, and fault preconditioner events
+# of nonlinear solves, so they are subtracted from the solve time.
+# The other events do not nest within one another, so no time is
+# counted twice.
+EVENTS = [
+  ("residual", ["ElIR setup", "ElIR compute",
+                "FaIR setup", "FaIR compute",
+                "AdIR setup", "AdIR compute"], []),
+  ("jacobian", ["ElIJ setup", "ElIJ compute",
+                "FaIJ setup", "FaIJ compute",
+                "AdIJ setup", "AdIJ compute"], []),
+  ("pc_setup", ["SoLi PC setup", "SoLi PC numeric setup"], []),
+  ("solve", ["SoLi solve", "SoNl solve", "SoLu solve"],
+   ["SNESFunctionEval", "SNESJacobianEval"]),
+  ("fault", ["FaAS setup", "FaAS compute",
+             "FaPr setup", "FaPr compute"], []),
+  ("output", ["OutM writeData"], []),
+  ]
+
+# StepTelemetry class
+class StepTelemetry(PetscComponent):
+  """
+  Python PyLith object for writing per time step solver and assembly
+  telemetry.
+
+  Factory: step_telemetry
+  """
+
+  # INVENTORY //////////////////////////////////////////////////////////
+
+  class Inventory(PetscComponent.Inventory):
+    """
+    Python object for managing StepTelemetry facilities and properties.
+    """
+
+    ## @class Inventory
+    ## Python object for managing StepTelemetry facilities and properties.
+    ##
+    ## \b Properties
+    ## @li \b filename Name of output file (JSON Lines).
+    ##
+    ## \b Facilities
+    ## @li None
+
+    import pyre.inventory
+
+    filename = pyre.inventory.str("filename", default="telemetry.jsonl")
+    filename.meta['tip'] = "Name of output file (JSON Lines)."
+
+
+  # PUBLIC METHODS /////////////////////////////////////////////////////
+
+  def __init__(self, name="steptelemetry"):
+    """
+    Constructor.
+    """
+    PetscComponent.__init__(self, name, facility="step_telemetry")
+    self.isMaster = True
+    self.fout = None
+    return
+
+
+  def open(self, formulation):
+    """
+    Open telemetry file and record current counters as the baseline
+    for the first update.
+
+    @param formulation Formulation for solving PDE.
+    """
+    import pylith.mpi.mpi as mpi
+    self.isMaster = 0 == mpi.rank()
+
+    # Event times are only accumulated when PETSc logging is active.
+    from pylith.utils.utils import EventLogger
+    EventLogger.activateLogging()
+
+    self.formulation = formulation
+    self.istep = 0
+    self.counters = self._counters()
+
+    if self.isMaster:
+      self._createPath(self.filename)
+      self.fout = open(self.filename, "a")
+    return
+
+
+  def close(self):
+    """
+    Close telemetry file.
+    """
+    if not self.fout is None:
+      self.fout.close()
+      self.fout = None
+    self.formulation = None
+    return
+
+
+  def update(self, t, dt, nsteps=1):
+    """
+    Write record for time steps completed since the previous update.
+
+    @param t Time at beginning of the time steps (dimensioned).
+    @param dt Time step (dimensioned).
+    @param nsteps Number of time steps since previous update.
+    """
+    counters = self._counters()
+    delta = [current-previous for current,previous in zip(counters, self.counters)]
+    self.counters = counters
+
+    from pylith.mpi.Communicator import mpi_comm_world
+    import pylith.mpi.mpi as mpi
+    comm = mpi_comm_world()
+    ntimes = 1 + len(EVENTS)
+    times = [mpi.allreduce_scalar_double(value, mpi.mpi_max(), comm.handle) \
+               for value in delta[:ntimes]]
+
+    self.istep += nsteps
+    if self.isMaster:
+      record = [("step", self.istep),
+                ("nsteps", nsteps),
+                ("t", t.value),
+                ("dt", dt.value),
+                ("wall", times[0]),
+                ]
+      record += [(name, value) for (name, events, nested),value in zip(EVENTS, times[1:])]
+      record += [("ksp_iterations", int(delta[ntimes+0])),
+                 ("snes_iterations", int(delta[ntimes+1])),
+                 ("jacobian_reforms", int(delta[ntimes+2])),
+                 ]
+      self.fout.write(self._format(record))
+      self.fout.flush()
+    return
+
+
+  # PRIVATE METHODS /////////////////////////////////////////////////////
+
+  def _configure(self):
+    """
+    Set members based using inventory.
+    """
+    PetscComponent._configure(self)
+    self.filename = self.inventory.filename
+    return
+
+
+  def _counters(self):
+    """
+    Get cumulative wall time, event times, and solver counters on this
+    process.
+    """
+    import time
+    counters = [time.time()]
+    for (name, events, nested) in EVENTS:
+      counters.append(sum([self._eventTime(event) for event in events]) - \
+                        sum([self._eventTime(event) for event in nested]))
+
+    solver = self.formulation.solver
+    counters += [solver.numLinearIterationsTotal(),
+                 solver.numNonlinearIterationsTotal(),
+                 self.formulation.numJacobianReforms(),
+                 ]
+    return counters
+
+
+  def _eventTime(self, name):
+    """
+    Get cumulative wall time spent in logged event on this process.
+    """
+    from pylith.utils.utils import EventLogger
+    return EventLogger.eventTime(name)
+
+
+  def _format(self, record):
+    """
+    Format record as single line of JSON with fields in order.
+    """
+    import json
+    fields = ["%s: %s" % (json.dumps(name), json.dumps(value)) for (name, value) in record]
+    return "{%s}\n" % ", ".join(fields)
+
+
+  def _createPath(self, filename):
+    """
+    Create path for filename if it doesn't exist.
+    """
+    import os
+    relpath = os.path.dirname(filename)
+    if len(relpath) > 0 and not os.path.exists(relpath):
+      os.makedirs(relpath)
+    return
+
+
+# FACTORIES ////////////////////////////////////////////////////////////
+
+def step_telemetry():
+  """
+  Factory associated with StepTelemetry.
+  """
+  return StepTelemetry()
+
+
+# End of file
@@ -45,17 +45,23 @@ class TimeDependent(Problem):
     ##
     ## \b Properties
     ## @li \b elastic_prestep Include a static calculation with elastic behavior before time stepping.
+    ## @li \b native_driver Advance time steps without output natively (in C++).
     ##
     ## \b Facilities
     ## @li \b formulation Formulation for solving PDE.
     ## @li \b progress_monitor Simple progress monitor via text file.
     ## @li \b checkpoint Checkpoint manager.
+    ## @li \b telemetry Per time step solver and assembly telemetry.
 
     import pyre.inventory
 
     elasticPrestep = pyre.inventory.bool("elastic_prestep", default=True)
     elasticPrestep.meta['tip'] = "Include a static calculation with elastic behavior before time stepping."
 
+    nativeDriver = pyre.inventory.bool("native_driver", default=False)
+    nativeDriver.meta['tip'] = "Advance time steps without output natively (in C++) " \
+        "to avoid per-step Python overhead (requires uniform time step)."
+
     from Implicit import Implicit
     formulation = pyre.inventory.facility("formulation", family="pde_formulation", factory=Implicit)
     formulation.meta['tip'] = "Formulation for solving PDE."
@@ -68,6 +74,10 @@ class TimeDependent(Problem):
     checkpointTimer = pyre.inventory.facility("checkpoint", family="checkpointer", factory=CheckpointTimer)
     checkpointTimer.meta['tip'] = "Checkpoint manager."
 
+    from pylith.utils.NullComponent import NullComponent
+    telemetry = pyre.inventory.facility("telemetry", family="step_telemetry", factory=NullComponent)
+    telemetry.meta['tip'] = "Per time step solver and assembly telemetry."
+
 
   # PUBLIC METHODS /////////////////////////////////////////////////////
 
@@ -169,6 +179,14 @@ class TimeDependent(Problem):
 
     if (self.formulation.getTotalTime() > self.formulation.getStartTime()):
       self.progressMonitor.open()
+    if not self.telemetry is None:
+      self.telemetry.open(self.formulation)
+
+    useNative = self._useNativeDriver()
+    if self.nativeDriver and not useNative and 0 == comm.rank:
+      self._info.log("WARNING: Native driver requires a uniform time step and "
+                     "an implicit formulation without Jacobian viewing. "
+                     "Using Python time loop.")
 
     # Normal time loop
     t = self.formulation.getStartTime()
@@ -210,10 +228,29 @@ class TimeDependent(Problem):
       self.formulation.poststep(t, dt)
       self._eventLogger.stagePop()
 
+      if not self.telemetry is None:
+        self.telemetry.update(tsec, dtsec)
+
       # Update time
       t += dt
 
+      # Advance time steps without output natively.
+      if useNative:
+        nsteps = self._numStepsNative(t, dt)
+        if nsteps > 0:
+          self._eventLogger.stagePush("Step")
+          self.formulation.advanceNative(t, dt, nsteps)
+          self._eventLogger.stagePop()
+          if not self.telemetry is None:
+            self.telemetry.update(self.normalizer.dimensionalize(t, timeScale), dtsec, nsteps)
+          # Accumulate time the same way as the native driver.
+          for i in xrange(nsteps):
+            t += dt
+          self.progressMonitor.update(self.normalizer.dimensionalize(t, timeScale), tStart, tEnd)
+
     self.progressMonitor.close()
+    if not self.telemetry is None:
+      self.telemetry.close()
     return
 
 
@@ -241,15 +278,46 @@ class TimeDependent(Problem):
 
   # PRIVATE METHODS ////////////////////////////////////////////////////
 
+  def _useNativeDriver(self):
+    """
+    Check whether to advance time steps without output natively.
+    """
+    from TimeStepUniform import TimeStepUniform
+    return self.nativeDriver and \
+        self.formulation.useNativeDriver() and \
+        isinstance(self.formulation.timeStep, TimeStepUniform)
+
+
+  def _numStepsNative(self, t, dt):
+    """
+    Get number of upcoming time steps, starting at time t, to advance
+    natively.
+    """
+    nsteps = self.formulation.numStepsNative(t, dt)
+    nsteps = min(nsteps, self.checkpointTimer.numStepsNoCheckpoint(t, dt))
+
+    # Leave a margin of one step for roundoff in accumulated time.
+    tEnd = self.formulation.getTotalTime()
+    nsteps = min(nsteps, int((tEnd - t) / dt) - 1)
+    return max(0, nsteps)
+
+
   def _configure(self):
     """
     Set members based using inventory.
     """
     Problem._configure(self)
     self.elasticPrestep = self.inventory.elasticPrestep
+    self.nativeDriver = self.inventory.nativeDriver
     self.formulation = self.inventory.formulation
     self.progressMonitor = self.inventory.progressMonitor
     self.checkpointTimer = self.inventory.checkpointTimer
+
+    from pylith.utils.NullComponent import NullComponent
+    if isinstance(self.inventory.telemetry, NullComponent):
+      self.telemetry = None
+    else:
+      self.telemetry = self.inventory.telemetry
     return
 
 
@@ -44,6 +44,8 @@ class MeshImporter(MeshGenerator):
     ##
     ## \b Properties
     ## @li reorder_mesh Reorder mesh using reverse Cuthill-McKee if true.
+    ## @li insert_faults_parallel Insert cohesive cells after distributing mesh if true.
+    ## @li reorder_mesh_local Reorder local mesh on each process after distribution and fault insertion if true.
     ##
     ## \b Facilities
     ## @li \b reader Mesh reader.
@@ -55,6 +57,13 @@ class MeshImporter(MeshGenerator):
     reorderMesh = pyre.inventory.bool("reorder_mesh", default=False)
     reorderMesh.meta['tip'] = "Reorder mesh using reverse Cuthill-McKee."
 
+    insertFaultsParallel = pyre.inventory.bool("insert_faults_parallel", default=False)
+    insertFaultsParallel.meta['tip'] = "Insert cohesive cells for faults after distributing mesh."
+
+    reorderMeshLocal = pyre.inventory.bool("reorder_mesh_local", default=False)
+    reorderMeshLocal.meta['tip'] = "Reorder local mesh (including cohesive cells) on each " \
+        "process using reverse Cuthill-McKee after distribution and fault insertion."
+
     from pylith.meshio.MeshIOAscii import MeshIOAscii
     reader = pyre.inventory.facility("reader", family="mesh_io",
                                        factory=MeshIOAscii)
@@ -113,11 +122,14 @@ class MeshImporter(MeshGenerator):
       ordering.reorder(mesh)
       self._eventLogger.eventEnd(logEvent2)
 
-    # Adjust topology
-    self._debug.log(resourceUsageString())
-    if 0 == comm.rank:
-      self._info.log("Adjusting topology.")
-    self._adjustTopology(mesh, faults)
+    # Adjust topology before distributing mesh, unless cohesive cells
+    # are inserted in parallel.
+    insertFaultsParallel = self.insertFaultsParallel and comm.size > 1
+    if not insertFaultsParallel:
+      self._debug.log(resourceUsageString())
+      if 0 == comm.rank:
+        self._info.log("Adjusting topology.")
+      self._adjustTopology(mesh, faults)
 
     # Distribute mesh
     if comm.size > 1:
@@ -128,14 +140,31 @@ class MeshImporter(MeshGenerator):
         mesh.view()
       mesh.memLoggingStage = "DistributedMesh"
 
+    # Adjust topology of distributed mesh
+    if insertFaultsParallel:
+      self._debug.log(resourceUsageString())
+      if 0 == comm.rank:
+        self._info.log("Adjusting topology of distributed mesh.")
+      self._adjustTopology(mesh, faults)
+
     # Refine mesh (if necessary)
     newMesh = self.refiner.refine(mesh)
     if not newMesh == mesh:
       mesh.cleanup()
       newMesh.memLoggingStage = "RefinedMesh"
 
-    # Can't reorder mesh again, because we do not have routine to
-    # unmix normal and hybrid cells.
+    # Reorder local mesh on each process. This keeps hybrid (cohesive)
+    # points after normal points, so it works with faults.
+    if self.reorderMeshLocal:
+      logEvent2 = "%sreorder" % self._loggingPrefix
+      self._eventLogger.eventBegin(logEvent2)
+      self._debug.log(resourceUsageString())
+      if 0 == comm.rank:
+        self._info.log("Reordering cells and vertices on each process.")
+      from pylith.topology.ReverseCuthillMcKee import ReverseCuthillMcKee
+      ordering = ReverseCuthillMcKee()
+      ordering.reorderLocal(newMesh)
+      self._eventLogger.eventEnd(logEvent2)
 
     # Nondimensionalize mesh (coordinates of vertices).
     from pylith.topology.topology import MeshOps_nondimensionalize
@@ -156,6 +185,8 @@ class MeshImporter(MeshGenerator):
     self.distributor = self.inventory.distributor
     self.refiner = self.inventory.refiner
     self.reorderMesh = self.inventory.reorderMesh
+    self.insertFaultsParallel = self.inventory.insertFaultsParallel
+    self.reorderMeshLocal = self.inventory.reorderMeshLocal
     return
   
 
@@ -47,4 +47,13 @@ class ReverseCuthillMcKee(ModuleReverseCuthillMcKee):
     return
 
 
+  def reorderLocal(self, mesh):
+    """
+    Reorder points of local mesh on each process (after distribution
+    and insertion of cohesive cells).
+    """
+    ModuleReverseCuthillMcKee.reorderLocal(mesh)
+    return
+
+
 # End of file
@@ -107,6 +107,17 @@ class CheckpointTimer(PetscComponent):
       self.toplevel.checkpoint()
       self.t = t
     return
+
+
+  def numStepsNoCheckpoint(self, t, dt):
+    """
+    Get number of upcoming time steps of size dt, starting at time t,
+    that are certain not to checkpoint.
+    """
+    import sys
+    # Leave a margin of one step for roundoff in accumulated time.
+    nsteps = int((self.t + self.dt - t) / dt) - 1
+    return min(max(0, nsteps), sys.maxint)
   
 
   # PRIVATE METHODS ////////////////////////////////////////////////////
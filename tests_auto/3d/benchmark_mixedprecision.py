@@ -0,0 +1,170 @@
+#!/usr/bin/env nemesis
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ======================================================================
+#
+
+## @file tests_auto/3d/benchmark_mixedprecision.py
+##
+## @brief Compare block Jacobi ILU(0) preconditioning with double
+## precision factors and with single precision factors
+## (solver.mixed_precision) for the 3-D axial and shear displacement
+## tests. The default algebraic multigrid preconditioner (PETSc GAMG)
+## is included as a baseline, because mixed precision replaces the
+## user's preconditioner with block Jacobi ILU(0).
+##
+## Usage (from tests_auto/3d in the build directory):
+##   benchmark_mixedprecision.py [--cells=hex8,tet4] [--cases=axialdisp,sheardisp] [--refine=LEVELS]
+##
+## For each run we report the wall clock time, the maximum process
+## memory reported by PETSc, the number of KSP iterations, the maximum
+## error in the displacement relative to the analytical solution, and
+## the maximum difference between the displacements and the double
+## precision block Jacobi ILU(0) displacements.
+
+import os
+import sys
+import re
+import time
+import subprocess
+
+import numpy
+import h5py
+
+CONFIGS = {
+  "double": ["--petsc.pc_type=bjacobi",
+             "--petsc.sub_pc_type=ilu"],
+  "mixed": ["--problem.formulation.solver.mixed_precision=True"],
+  "amg": ["--petsc.pc_type=gamg"],
+  }
+CONFIGS_ORDER = ["double", "mixed", "amg"]
+
+
+# ----------------------------------------------------------------------
+def runApp(case, args):
+  """
+  Run PyLith for a test case (called in a separate process so that the
+  configuration of each run starts from scratch).
+  """
+  from pylith.apps.PyLithApp import PyLithApp
+  app = PyLithApp(name=case)
+  sys.argv = [sys.argv[0]] + args
+  app.run()
+  return
+
+
+# ----------------------------------------------------------------------
+def runCase(cell, case, config, refine):
+  """
+  Run a case and collect the timing, memory, and iteration statistics.
+  """
+  filename = "%s_%s.h5" % (case, config)
+  args = CONFIGS[config] + [
+    "--problem.formulation.output.output.writer.filename=%s" % filename,
+    "--petsc.ksp_converged_reason=true",
+    "--petsc.memory_view=true",
+    ]
+  if refine > 0:
+    args += ["--mesh_generator.refiner=pylith.topology.RefineUniform",
+             "--mesh_generator.refiner.levels=%d" % refine]
+
+  cmd = [sys.executable, os.path.abspath(__file__), "--run", case] + args
+  t0 = time.time()
+  proc = subprocess.Popen(cmd, cwd=cell, stdout=subprocess.PIPE, stderr=subprocess.STDOUT)
+  log = proc.communicate()[0].decode("utf-8", "replace")
+  wallTime = time.time() - t0
+  if proc.returncode != 0:
+    sys.stderr.write(log)
+    raise RuntimeError("Run of %s/%s with %s preconditioner failed." % (cell, case, config))
+
+  iterations = sum([int(n) for n in re.findall(r"Linear solve converged due to \S+ iterations (\d+)", log)])
+  memory = re.findall(r"Maximum \(over computational time\) process memory:\s+total\s+(\S+)", log)
+  memory = float(memory[-1]) if len(memory) > 0 else numpy.nan
+
+  return {'time': wallTime,
+          'memory': memory,
+          'iterations': iterations,
+          'filename': os.path.join(cell, filename)}
+
+
+# ----------------------------------------------------------------------
+def loadDisplacement(filename):
+  """
+  Get vertices and displacement field from HDF5 output.
+  """
+  h5 = h5py.File(filename, "r", driver="sec2")
+  vertices = h5['geometry/vertices'][:]
+  disp = h5['vertex_fields/displacement'][0,:,:]
+  h5.close()
+  return vertices, disp
+
+
+# ----------------------------------------------------------------------
+def benchmark(cells, cases, refine):
+  """
+  Run benchmark and print summary table.
+  """
+  print("%-5s %-10s %-7s %10s %12s %6s %12s %12s" % \
+          ("cell", "case", "pc", "time (s)", "memory (MB)", "its", "err(soln)", "diff(double)"))
+  for cell in cells:
+    for case in cases:
+      sys.path.insert(0, os.path.abspath(cell))
+      dbModule = __import__("%s_gendb" % case)
+      solnModule = __import__("%s_soln" % case)
+      cwd = os.getcwd()
+      os.chdir(cell)
+      dbModule.GenerateDB().run()
+      os.chdir(cwd)
+      soln = solnModule.AnalyticalSoln()
+
+      results = {}
+      for config in CONFIGS_ORDER:
+        results[config] = runCase(cell, case, config, refine)
+
+      (vertices, dispDouble) = loadDisplacement(results['double']['filename'])
+      dispExact = soln.displacement(vertices)[0,:,:]
+      for config in CONFIGS_ORDER:
+        stats = results[config]
+        (vertices, disp) = loadDisplacement(stats['filename'])
+        errSoln = numpy.max(numpy.abs(disp - dispExact))
+        diffDouble = numpy.max(numpy.abs(disp - dispDouble))
+        print("%-5s %-10s %-7s %10.3f %12.1f %6d %12.3e %12.3e" % \
+                (cell, case, config, stats['time'], stats['memory']/(1024.0**2),
+                 stats['iterations'], errSoln, diffDouble))
+
+      # Modules have the same names for each cell type.
+      del sys.modules["%s_gendb" % case]
+      del sys.modules["%s_soln" % case]
+      sys.path.pop(0)
+  return
+
+
+# ----------------------------------------------------------------------
+if __name__ == "__main__":
+  if len(sys.argv) > 2 and sys.argv[1] == "--run":
+    runApp(sys.argv[2], sys.argv[3:])
+    sys.exit(0)
+
+  from optparse import OptionParser
+  parser = OptionParser()
+  parser.add_option("--cells", action="store", type="string", dest="cells", default="hex8,tet4")
+  parser.add_option("--cases", action="store", type="string", dest="cases", default="axialdisp,sheardisp")
+  parser.add_option("--refine", action="store", type="int", dest="refine", default=0)
+  (options, args) = parser.parse_args()
+
+  benchmark(options.cells.split(","), options.cases.split(","), options.refine)
+
+
+# End of file
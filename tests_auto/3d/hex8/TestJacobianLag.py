@@ -0,0 +1,111 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file tests/3d/hex8/TestJacobianLag.py
+##
+## @brief Test suite for lagging the preconditioner in viscoelastic
+## relaxation with time steps that change every step.
+
+import unittest
+import numpy
+
+from pylith.tests import run_pylith
+from pylith.tests import has_h5py
+
+from axialdisp_gendb import GenerateDB
+
+# Local version of PyLithApp
+from pylith.apps.PyLithApp import PyLithApp
+class LagApp(PyLithApp):
+  def __init__(self):
+    PyLithApp.__init__(self, name="jacobianlag")
+    return
+
+
+class NoLagApp(PyLithApp):
+  def __init__(self):
+    PyLithApp.__init__(self, name="jacobianlag_nolag")
+    return
+
+
+class TestJacobianLag(unittest.TestCase):
+  """
+  Test suite for lagging the preconditioner. The Maxwell materials
+  request a new Jacobian in the first viscoelastic step and whenever
+  the time step changes, so most steps of the lagged run reuse the
+  preconditioner. The solution must match the run without lagging.
+  """
+
+  def setUp(self):
+    """
+    Setup for test.
+    """
+    run_pylith(LagApp, GenerateDB)
+    run_pylith(NoLagApp)
+
+    if has_h5py():
+      self.checkResults = True
+    else:
+      self.checkResults = False
+    return
+
+
+  def test_soln(self):
+    """
+    Check solution (displacement) field against run without lagging.
+    """
+    if not self.checkResults:
+      return
+
+    import h5py
+    h5 = h5py.File("jacobianlag.h5", "r", driver="sec2")
+    disp = h5['vertex_fields/displacement'][:]
+    h5.close()
+    h5 = h5py.File("jacobianlag_nolag.h5", "r", driver="sec2")
+    dispE = h5['vertex_fields/displacement'][:]
+    h5.close()
+
+    self.assertEqual(dispE.shape, disp.shape)
+    (nsteps, nvertices, ncomps) = disp.shape
+    self.failUnless(nsteps > 2)
+
+    # Viscoelastic relaxation changes the solution over time.
+    scale = numpy.max(numpy.abs(dispE))
+    self.failUnless(numpy.max(numpy.abs(dispE[-1] - dispE[0])) > 1.0e-3*scale)
+
+    tolerance = 1.0e-6
+    for istep in xrange(nsteps):
+      diff = numpy.max(numpy.abs(disp[istep] - dispE[istep]))
+      if diff > tolerance*scale:
+        print "Displacement mismatch in time step %d: max difference %12.4e, scale %12.4e" % \
+            (istep, diff, scale)
+      self.failIf(diff > tolerance*scale)
+    return
+
+
+# ----------------------------------------------------------------------
+if __name__ == '__main__':
+  import unittest
+  from TestJacobianLag import TestJacobianLag as Tester
+
+  suite = unittest.TestSuite()
+  suite.addTest(unittest.makeSuite(Tester))
+  unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file 
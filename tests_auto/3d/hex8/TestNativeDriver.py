@@ -0,0 +1,171 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file tests/3d/hex8/TestNativeDriver.py
+##
+## @brief Test suite for advancing time steps without output natively
+## (in C++) in viscoelastic relaxation.
+
+import unittest
+import numpy
+
+from pylith.tests import run_pylith
+from pylith.tests import has_h5py
+
+from axialdisp_gendb import GenerateDB
+
+class GenerateDBTelemetry(GenerateDB):
+  """
+  Generate spatial databases and remove telemetry from previous runs
+  (telemetry records are appended).
+  """
+
+  def run(self):
+    import os
+    if os.path.exists("nativedriver.jsonl"):
+      os.remove("nativedriver.jsonl")
+    GenerateDB.run(self)
+    return
+
+
+# Local version of PyLithApp
+from pylith.apps.PyLithApp import PyLithApp
+class NativeApp(PyLithApp):
+  def __init__(self):
+    PyLithApp.__init__(self, name="nativedriver")
+    return
+
+
+class PythonApp(PyLithApp):
+  def __init__(self):
+    PyLithApp.__init__(self, name="nativedriver_python")
+    return
+
+
+class TestNativeDriver(unittest.TestCase):
+  """
+  Test suite for the native driver. Output is written every third time
+  step, so the steps in between are advanced natively. The output steps,
+  solution, and state variables must match the run with the Python time
+  loop.
+  """
+
+  def setUp(self):
+    """
+    Setup for test.
+    """
+    run_pylith(NativeApp, GenerateDBTelemetry)
+    run_pylith(PythonApp)
+
+    if has_h5py():
+      self.checkResults = True
+    else:
+      self.checkResults = False
+    return
+
+
+  def test_native(self):
+    """
+    Check that time steps were advanced natively.
+    """
+    import json
+    nstepsNative = 0
+    fin = open("nativedriver.jsonl", "r")
+    for line in fin:
+      if len(line.strip()) > 0:
+        nsteps = json.loads(line)["nsteps"]
+        if nsteps > 1:
+          nstepsNative += nsteps
+    fin.close()
+    self.failUnless(nstepsNative > 0)
+    return
+
+
+  def test_soln(self):
+    """
+    Check output time stamps and solution (displacement) field.
+    """
+    if not self.checkResults:
+      return
+
+    self._checkFields("nativedriver", "nativedriver_python", "vertex_fields", ["displacement"])
+    return
+
+
+  def test_statevars(self):
+    """
+    Check output time stamps and state variables in materials.
+    """
+    if not self.checkResults:
+      return
+
+    fields = ["total_strain", "stress", "viscous_strain"]
+    for material in ["elastic", "viscoelastic"]:
+      self._checkFields("nativedriver-%s" % material, "nativedriver_python-%s" % material,
+                        "cell_fields", fields)
+    return
+
+
+  def _checkFields(self, filename, filenameE, group, fields):
+    """
+    Check output time stamps and fields against run with Python time
+    loop.
+    """
+    import h5py
+    h5 = h5py.File("%s.h5" % filename, "r", driver="sec2")
+    h5E = h5py.File("%s.h5" % filenameE, "r", driver="sec2")
+
+    time = h5['time'][:]
+    timeE = h5E['time'][:]
+    self.assertEqual(timeE.shape, time.shape)
+    self.failUnless(timeE.shape[0] > 2)
+    tolerance = 1.0e-6
+    self.failIf(numpy.max(numpy.abs(time - timeE)) > tolerance*numpy.max(numpy.abs(timeE)))
+
+    for name in fields:
+      value = h5[group][name][:]
+      valueE = h5E[group][name][:]
+      self.assertEqual(valueE.shape, value.shape)
+      nsteps = value.shape[0]
+
+      scale = numpy.max(numpy.abs(valueE))
+      if scale == 0.0:
+        scale = 1.0
+      for istep in xrange(nsteps):
+        diff = numpy.max(numpy.abs(value[istep] - valueE[istep]))
+        if diff > tolerance*scale:
+          print "Mismatch in %s of %s in time step %d: max difference %12.4e, scale %12.4e" % \
+              (name, filename, istep, diff, scale)
+        self.failIf(diff > tolerance*scale)
+
+    h5.close()
+    h5E.close()
+    return
+
+
+# ----------------------------------------------------------------------
+if __name__ == '__main__':
+  import unittest
+  from TestNativeDriver import TestNativeDriver as Tester
+
+  suite = unittest.TestSuite()
+  suite.addTest(unittest.makeSuite(Tester))
+  unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
@@ -0,0 +1,153 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file tests/3d/hex8/TestPredictor.py
+##
+## @brief Test suite for the initial guess predicted from previous
+## increments in viscoelastic relaxation with time steps that change
+## every step.
+
+import unittest
+import numpy
+
+from pylith.tests import run_pylith
+from pylith.tests import has_h5py
+
+from axialdisp_gendb import GenerateDB
+
+class GenerateDBTelemetry(GenerateDB):
+  """
+  Generate spatial databases and remove telemetry from previous runs
+  (telemetry records are appended).
+  """
+
+  def run(self):
+    import os
+    for filename in ["predictor.jsonl", "predictor_none.jsonl"]:
+      if os.path.exists(filename):
+        os.remove(filename)
+    GenerateDB.run(self)
+    return
+
+
+# Local version of PyLithApp
+from pylith.apps.PyLithApp import PyLithApp
+class PredictorApp(PyLithApp):
+  def __init__(self):
+    PyLithApp.__init__(self, name="predictor")
+    return
+
+
+class NoPredictorApp(PyLithApp):
+  def __init__(self):
+    PyLithApp.__init__(self, name="predictor_none")
+    return
+
+
+class TestPredictor(unittest.TestCase):
+  """
+  Test suite for the second order predictor. The initial guess must
+  not change the converged solution and must not increase the number
+  of linear iterations compared with the run using a zero initial
+  guess.
+  """
+
+  def setUp(self):
+    """
+    Setup for test.
+    """
+    run_pylith(PredictorApp, GenerateDBTelemetry)
+    run_pylith(NoPredictorApp)
+
+    if has_h5py():
+      self.checkResults = True
+    else:
+      self.checkResults = False
+    return
+
+
+  def test_soln(self):
+    """
+    Check solution (displacement) field against run without predictor.
+    """
+    if not self.checkResults:
+      return
+
+    import h5py
+    h5 = h5py.File("predictor.h5", "r", driver="sec2")
+    disp = h5['vertex_fields/displacement'][:]
+    h5.close()
+    h5 = h5py.File("predictor_none.h5", "r", driver="sec2")
+    dispE = h5['vertex_fields/displacement'][:]
+    h5.close()
+
+    self.assertEqual(dispE.shape, disp.shape)
+    (nsteps, nvertices, ncomps) = disp.shape
+    self.failUnless(nsteps > 2)
+
+    scale = numpy.max(numpy.abs(dispE))
+    tolerance = 1.0e-6
+    for istep in xrange(nsteps):
+      diff = numpy.max(numpy.abs(disp[istep] - dispE[istep]))
+      if diff > tolerance*scale:
+        print "Displacement mismatch in time step %d: max difference %12.4e, scale %12.4e" % \
+            (istep, diff, scale)
+      self.failIf(diff > tolerance*scale)
+    return
+
+
+  def test_iterations(self):
+    """
+    Check number of linear iterations against run without predictor.
+    """
+    iters = self._iterations("predictor.jsonl")
+    itersE = self._iterations("predictor_none.jsonl")
+
+    self.assertEqual(len(itersE), len(iters))
+    self.failUnless(len(iters) > 2)
+    if sum(iters) > sum(itersE):
+      print "Linear iterations with predictor: %s, without predictor: %s" % (iters, itersE)
+    self.failIf(sum(iters) > sum(itersE))
+    return
+
+
+  def _iterations(self, filename):
+    """
+    Get number of linear iterations in each time step from telemetry.
+    """
+    import json
+    iterations = []
+    fin = open(filename, "r")
+    for line in fin:
+      if len(line.strip()) > 0:
+        iterations.append(json.loads(line)["ksp_iterations"])
+    fin.close()
+    return iterations
+
+
+# ----------------------------------------------------------------------
+if __name__ == '__main__':
+  import unittest
+  from TestPredictor import TestPredictor as Tester
+
+  suite = unittest.TestSuite()
+  suite.addTest(unittest.makeSuite(Tester))
+  unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
@@ -66,6 +66,15 @@ class TestApp(FullTestApp):
     from TestFrictionNoSlipHalo import TestFrictionNoSlipHalo
     suite.addTest(unittest.makeSuite(TestFrictionNoSlipHalo))
 
+    from TestJacobianLag import TestJacobianLag
+    suite.addTest(unittest.makeSuite(TestJacobianLag))
+
+    from TestPredictor import TestPredictor
+    suite.addTest(unittest.makeSuite(TestPredictor))
+
+    from TestNativeDriver import TestNativeDriver
+    suite.addTest(unittest.makeSuite(TestNativeDriver))
+
     return suite
 
 
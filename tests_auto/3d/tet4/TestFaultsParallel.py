@@ -0,0 +1,141 @@
+#!/usr/bin/env python
+#
+# ----------------------------------------------------------------------
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ----------------------------------------------------------------------
+#
+
+## @file tests/3d/tet4/TestFaultsParallel.py
+##
+## @brief Test suite for inserting cohesive cells after distributing
+## the mesh.
+
+import unittest
+import numpy
+
+from pylith.tests import run_pylith
+from pylith.tests import has_h5py
+
+# Local version of PyLithApp
+from pylith.apps.PyLithApp import PyLithApp
+class ParallelApp(PyLithApp):
+  def __init__(self):
+    PyLithApp.__init__(self, name="faultsparallel")
+    return
+
+
+class SerialApp(PyLithApp):
+  def __init__(self):
+    PyLithApp.__init__(self, name="faultsparallel_serial")
+    return
+
+
+def sortedRows(vertices, values):
+  """
+  Sort values at vertices by coordinates and then by value, so results
+  with different vertex orderings can be compared. Vertices on the
+  two sides of a fault have the same coordinates.
+  """
+  rows = numpy.hstack((numpy.round(vertices, 6), values))
+  order = numpy.lexsort(rows.transpose()[::-1])
+  return rows[order,vertices.shape[1]:]
+
+
+class TestFaultsParallel(unittest.TestCase):
+  """
+  Test suite for inserting cohesive cells after distributing the mesh
+  over 2 processes. The fault meshes and the solution must match the
+  run that inserts the cohesive cells before distributing the mesh.
+  """
+
+  def setUp(self):
+    """
+    Setup for test.
+    """
+    run_pylith(ParallelApp, nprocs=2)
+    run_pylith(SerialApp)
+
+    if has_h5py():
+      self.checkResults = True
+    else:
+      self.checkResults = False
+    return
+
+
+  def test_domain(self):
+    """
+    Check domain mesh and solution against serial fault insertion.
+    """
+    if not self.checkResults:
+      return
+
+    self._checkFile("faultsparallel.h5", "faultsparallel_serial.h5", "displacement")
+    return
+
+
+  def test_faults(self):
+    """
+    Check fault meshes and slip against serial fault insertion.
+    """
+    if not self.checkResults:
+      return
+
+    for fault in ["faultx", "faulty"]:
+      self._checkFile("faultsparallel-%s.h5" % fault, "faultsparallel_serial-%s.h5" % fault, "slip")
+    return
+
+
+  def _checkFile(self, filename, filenameE, field):
+    """
+    Compare mesh and vertex field in file against file from serial run.
+    """
+    import h5py
+    h5 = h5py.File(filename, "r", driver="sec2")
+    vertices = h5['geometry/vertices'][:]
+    cells = h5['topology/cells'][:]
+    values = h5['vertex_fields/%s' % field][0,:,:]
+    h5.close()
+    h5 = h5py.File(filenameE, "r", driver="sec2")
+    verticesE = h5['geometry/vertices'][:]
+    cellsE = h5['topology/cells'][:]
+    valuesE = h5['vertex_fields/%s' % field][0,:,:]
+    h5.close()
+
+    self.assertEqual(verticesE.shape, vertices.shape)
+    self.assertEqual(cellsE.shape, cells.shape)
+
+    values = sortedRows(vertices, values)
+    valuesE = sortedRows(verticesE, valuesE)
+
+    scale = max(1.0, numpy.max(numpy.abs(valuesE)))
+    tolerance = 1.0e-6
+    diff = numpy.max(numpy.abs(values - valuesE))
+    if diff > tolerance*scale:
+      print "Mismatch in field '%s' of '%s': max difference %12.4e, scale %12.4e" % \
+          (field, filename, diff, scale)
+    self.failIf(diff > tolerance*scale)
+    return
+
+
+# ----------------------------------------------------------------------
+if __name__ == '__main__':
+  import unittest
+  from TestFaultsParallel import TestFaultsParallel as Tester
+
+  suite = unittest.TestSuite()
+  suite.addTest(unittest.makeSuite(Tester))
+  unittest.TextTestRunner(verbosity=2).run(suite)
+
+
+# End of file
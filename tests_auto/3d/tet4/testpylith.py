@@ -63,6 +63,9 @@ class TestApp(FullTestApp):
     from TestFaultsIntersectNoSlip import TestFaultsIntersectNoSlip
     suite.addTest(unittest.makeSuite(TestFaultsIntersectNoSlip))
 
+    from TestFaultsParallel import TestFaultsParallel
+    suite.addTest(unittest.makeSuite(TestFaultsParallel))
+
     return suite
 
 
@@ -347,6 +347,21 @@ pylith::bc::TestDirichletBC::testSetField(void)
   const PylithScalar t = 1.0 / timeScale;
   bc.setField(t, field);
 
+  // Constraint map covers all constrained DOF.
+  CPPUNIT_ASSERT_EQUAL(size_t(_data->numConstrainedPts*_data->numFixedDOF), bc._constraintMap.offsets.size());
+  CPPUNIT_ASSERT_EQUAL(field.sectionSize(), bc._constraintMap.storageSize);
+  CPPUNIT_ASSERT(field.localSection() == bc._constraintMap.section);
+
+  // Constraint map is rebuilt for field with different section of the
+  // same size.
+  topology::Field fieldClone(mesh);
+  fieldClone.cloneSection(field);
+  fieldClone.zero();
+  bc.setField(t, fieldClone);
+  CPPUNIT_ASSERT_EQUAL(fieldClone.sectionSize(), bc._constraintMap.storageSize);
+  CPPUNIT_ASSERT(fieldClone.localSection() == bc._constraintMap.section);
+  CPPUNIT_ASSERT(field.localSection() != bc._constraintMap.section);
+
   // Create list of unconstrained DOF at constrained DOF
   const int numFreeDOF = _data->numDOF - _data->numFixedDOF;
   int_array freeDOF(numFreeDOF);
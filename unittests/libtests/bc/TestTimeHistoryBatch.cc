@@ -0,0 +1,134 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestTimeHistoryBatch.hh" // Implementation of class methods
+
+#include "pylith/bc/TimeHistoryBatch.hh" // USES TimeHistoryBatch
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/spatialdb/TimeHistory.hh" // USES TimeHistory
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::bc::TestTimeHistoryBatch );
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace bc {
+    namespace _TestTimeHistoryBatch {
+      const int numPoints = 5;
+      const PylithScalar onsetTimes[numPoints] = { 
+	2.0, 0.0, 2.0, 6.0, 0.0,
+      };
+      const int numGroups = 3;
+      const int groups[numPoints] = {
+	1, 0, 1, 2, 0,
+      };
+    } // _TestTimeHistoryBatch
+  } // bc
+} // pylith
+
+// ----------------------------------------------------------------------
+// Test initialize().
+void
+pylith::bc::TestTimeHistoryBatch::testInitialize(void)
+{ // testInitialize
+  PYLITH_METHOD_BEGIN;
+
+  const int numPoints = _TestTimeHistoryBatch::numPoints;
+
+  TimeHistoryBatch batch;
+  batch.initialize(_TestTimeHistoryBatch::onsetTimes, numPoints);
+
+  CPPUNIT_ASSERT_EQUAL(numPoints, batch.numPoints());
+  CPPUNIT_ASSERT_EQUAL(_TestTimeHistoryBatch::numGroups, batch.numGroups());
+  for (int i=0; i < numPoints; ++i) {
+    CPPUNIT_ASSERT_EQUAL(_TestTimeHistoryBatch::groups[i], batch.group(i));
+  } // for
+
+  batch.deallocate();
+  CPPUNIT_ASSERT_EQUAL(0, batch.numPoints());
+  CPPUNIT_ASSERT_EQUAL(0, batch.numGroups());
+
+  PYLITH_METHOD_END;
+} // testInitialize
+
+// ----------------------------------------------------------------------
+// Test evaluate().
+void
+pylith::bc::TestTimeHistoryBatch::testEvaluate(void)
+{ // testEvaluate
+  PYLITH_METHOD_BEGIN;
+
+  // Time history decreases linearly from 1.0 at 0 s to 0.0 at 10 s.
+  spatialdata::spatialdb::TimeHistory th("time history");
+  th.filename("data/tri3_force.timedb");
+  th.open();
+
+  TimeHistoryBatch batch;
+  batch.initialize(_TestTimeHistoryBatch::onsetTimes, _TestTimeHistoryBatch::numPoints);
+
+  const PylithScalar t = 4.0;
+  const PylithScalar timeScale = 2.0;
+  scalar_array amplitudes;
+  batch.evaluate(&amplitudes, &th, t, timeScale);
+  th.close();
+
+  const int numGroups = _TestTimeHistoryBatch::numGroups;
+  const PylithScalar amplitudesE[numGroups] = {
+    0.2, // tDim = (4-0)*2 = 8
+    0.6, // tDim = (4-2)*2 = 4
+    0.0, // not started
+  };
+  CPPUNIT_ASSERT_EQUAL(size_t(numGroups), amplitudes.size());
+  const PylithScalar tolerance = 1.0e-06;
+  for (int i=0; i < numGroups; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(amplitudesE[i], amplitudes[i], tolerance);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testEvaluate
+
+// ----------------------------------------------------------------------
+// Test evaluate() without time history.
+void
+pylith::bc::TestTimeHistoryBatch::testEvaluateNoHistory(void)
+{ // testEvaluateNoHistory
+  PYLITH_METHOD_BEGIN;
+
+  TimeHistoryBatch batch;
+  batch.initialize(_TestTimeHistoryBatch::onsetTimes, _TestTimeHistoryBatch::numPoints);
+
+  scalar_array amplitudes;
+  batch.evaluate(&amplitudes, 0, 2.0, 1.0);
+
+  const int numGroups = _TestTimeHistoryBatch::numGroups;
+  const PylithScalar amplitudesE[numGroups] = { 1.0, 1.0, 0.0 };
+  CPPUNIT_ASSERT_EQUAL(size_t(numGroups), amplitudes.size());
+  const PylithScalar tolerance = 1.0e-06;
+  for (int i=0; i < numGroups; ++i) {
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(amplitudesE[i], amplitudes[i], tolerance);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testEvaluateNoHistory
+
+
+// End of file 
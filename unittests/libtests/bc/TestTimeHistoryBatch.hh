@@ -0,0 +1,69 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/bc/TestTimeHistoryBatch.hh
+ *
+ * @brief C++ TestTimeHistoryBatch object.
+ *
+ * C++ unit testing for TimeHistoryBatch.
+ */
+
+#if !defined(pylith_bc_testtimehistorybatch_hh)
+#define pylith_bc_testtimehistorybatch_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace bc {
+    class TestTimeHistoryBatch;
+  } // bc
+} // pylith
+
+/// C++ unit testing for TimeHistoryBatch.
+class pylith::bc::TestTimeHistoryBatch : public CppUnit::TestFixture
+{ // class TestTimeHistoryBatch
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestTimeHistoryBatch );
+
+  CPPUNIT_TEST( testInitialize );
+  CPPUNIT_TEST( testEvaluate );
+  CPPUNIT_TEST( testEvaluateNoHistory );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test initialize().
+  void testInitialize(void);
+
+  /// Test evaluate().
+  void testEvaluate(void);
+
+  /// Test evaluate() without time history.
+  void testEvaluateNoHistory(void);
+
+}; // class TestTimeHistoryBatch
+
+#endif // pylith_bc_testtimehistorybatch_hh
+
+
+// End of file 
@@ -42,6 +42,7 @@
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include <stdexcept> // USES runtime_error
+#include <set> // USES std::set
 
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::faults::TestFaultCohesiveKin );
@@ -598,6 +599,205 @@ pylith::faults::TestFaultCohesiveKin::testCalcTractionsChange(void)
   PYLITH_METHOD_END;
 } // testCalcTractionsChange
 
+// ----------------------------------------------------------------------
+// Test _updateSourceStats().
+void
+pylith::faults::TestFaultCohesiveKin::testSourceStats(void)
+{ // testSourceStats
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+
+  topology::Mesh mesh;
+  FaultCohesiveKin fault;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fault, &fields);
+
+  fault.initializeSourceStats(0.0, 0.0);
+  CPPUNIT_ASSERT_EQUAL(0, fault.numSourceStats());
+
+  // Relative displacement is updated by integrateResidual() and source
+  // statistics correspond to the end of the time step.
+  const PylithScalar t = 2.134 / _data->timeScale;
+  const PylithScalar dt = 0.01 / _data->timeScale;
+  fault.timeStep(dt);
+  fault.integrateResidual(fields.get("residual"), t+dt, &fields);
+  fault.updateStateVars(t, &fields);
+  CPPUNIT_ASSERT_EQUAL(1, fault.numSourceStats());
+
+  CPPUNIT_ASSERT(fault._fields);
+  CPPUNIT_ASSERT(fault._sourceStats);
+  topology::VecVisitorMesh dispRelVisitor(fault._fields->get("relative disp"));
+  const PetscScalar* dispRelArray = dispRelVisitor.localArray();CPPUNIT_ASSERT(dispRelArray);
+
+  topology::VecVisitorMesh areaVisitor(fault._fields->get("area"));
+  const PetscScalar* areaArray = areaVisitor.localArray();CPPUNIT_ASSERT(areaArray);
+
+  topology::VecVisitorMesh ruptureTimeVisitor(fault._fields->get("rupture time"));
+  const PetscScalar* ruptureTimeArray = ruptureTimeVisitor.localArray();CPPUNIT_ASSERT(ruptureTimeArray);
+
+  topology::VecVisitorMesh peakSlipRateVisitor(fault._fields->get("peak slip rate"));
+  const PetscScalar* peakSlipRateArray = peakSlipRateVisitor.localArray();CPPUNIT_ASSERT(peakSlipRateArray);
+
+  // Slip starts from zero, so the slip rate over the first time step
+  // is the slip divided by the time step.
+  const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-05;
+  const int spaceDim = _data->spaceDim;
+  PylithScalar ruptureAreaE = 0.0;
+  PylithScalar potencyE = 0.0;
+  PylithScalar maxSlipE = 0.0;
+  int numRuptured = 0;
+  const int numVertices = fault._cohesiveVertices.size();
+  for (int i=0; i < numVertices; ++i) {
+    const PetscInt v_fault = fault._cohesiveVertices[i].fault;
+    const PetscInt e_lagrange = fault._cohesiveVertices[i].lagrange;
+    if (e_lagrange < 0) { // skip clamped edges
+      continue;
+    } // if
+
+    const PetscInt droff = dispRelVisitor.sectionOffset(v_fault);
+    CPPUNIT_ASSERT_EQUAL(spaceDim, dispRelVisitor.sectionDof(v_fault));
+    PylithScalar slipMag = 0.0;
+    for (int d=0; d < spaceDim; ++d) {
+      slipMag += dispRelArray[droff+d]*dispRelArray[droff+d];
+    } // for
+    slipMag = sqrt(slipMag);
+
+    const PylithScalar peakSlipRateE = slipMag / dt;
+    const PetscInt psroff = peakSlipRateVisitor.sectionOffset(v_fault);
+    CPPUNIT_ASSERT_EQUAL(1, peakSlipRateVisitor.sectionDof(v_fault));
+    if (peakSlipRateE > 1.0)
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, peakSlipRateArray[psroff]/peakSlipRateE, tolerance);
+    else
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(peakSlipRateE, peakSlipRateArray[psroff], tolerance);
+
+    const PylithScalar ruptureTimeE = (slipMag > 0.0) ? t+dt : fault._sourceStats->noRuptureTime;
+    const PetscInt rtoff = ruptureTimeVisitor.sectionOffset(v_fault);
+    CPPUNIT_ASSERT_EQUAL(1, ruptureTimeVisitor.sectionDof(v_fault));
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, ruptureTimeArray[rtoff]/ruptureTimeE, tolerance);
+
+    if (slipMag > 0.0) {
+      const PetscInt aoff = areaVisitor.sectionOffset(v_fault);
+      ruptureAreaE += areaArray[aoff];
+      potencyE += slipMag * areaArray[aoff];
+      ++numRuptured;
+    } // if
+    maxSlipE = std::max(maxSlipE, slipMag);
+  } // for
+  CPPUNIT_ASSERT(numRuptured > 0);
+
+  // Records are dimensional. No materials, so the moment is zero.
+  const PylithScalar lengthScale = _data->lengthScale;
+  const PylithScalar areaScale = pow(lengthScale, spaceDim-1);
+  const PylithScalar velocityScale = lengthScale / _data->timeScale;
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, fault.sourceStat(0, "t")/((t+dt)*_data->timeScale), tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, fault.sourceStat(0, "rupture_area")/(ruptureAreaE*areaScale), tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, fault.sourceStat(0, "potency")/(potencyE*lengthScale*areaScale), tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, fault.sourceStat(0, "moment"), tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, fault.sourceStat(0, "max_slip")/(maxSlipE*lengthScale), tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, fault.sourceStat(0, "max_slip_rate")/(maxSlipE/dt*velocityScale), tolerance);
+
+  PYLITH_METHOD_END;
+} // testSourceStats
+
+// ----------------------------------------------------------------------
+// Test projectSolnIncr().
+void
+pylith::faults::TestFaultCohesiveKin::testProjectSolnIncr(void)
+{ // testProjectSolnIncr
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_data);
+  CPPUNIT_ASSERT(_data->fieldT);
+  CPPUNIT_ASSERT(_data->fieldIncr);
+
+  topology::Mesh mesh;
+  FaultCohesiveKin fault;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fault, &fields);
+
+  _fieldSetValues(&fields.get("disp(t)"), _data->fieldT, _data->lengthScale);
+
+  // Compute slip at end of time step.
+  const PylithScalar t = 2.134 / _data->timeScale;
+  const PylithScalar dt = 0.01 / _data->timeScale;
+  fault.timeStep(dt);
+  fault.integrateResidual(fields.get("residual"), t, &fields);
+
+  // Initial guess does not satisfy the prescribed slip.
+  topology::Field& dispIncr = fields.get("dispIncr(t->t+dt)");
+  _fieldSetValues(&dispIncr, _data->fieldIncr, _data->lengthScale);
+  PetscVec dispIncrVec = dispIncr.localVector();CPPUNIT_ASSERT(dispIncrVec);
+  PetscVec dispIncrGuessVec = NULL;
+  PetscErrorCode err = VecDuplicate(dispIncrVec, &dispIncrGuessVec);CPPUNIT_ASSERT(!err);
+  err = VecCopy(dispIncrVec, dispIncrGuessVec);CPPUNIT_ASSERT(!err);
+
+  fault.projectSolnIncr(&fields);
+
+  topology::VecVisitorMesh dispTVisitor(fields.get("disp(t)"));
+  const PetscScalar* dispTArray = dispTVisitor.localArray();CPPUNIT_ASSERT(dispTArray);
+
+  topology::VecVisitorMesh dispIncrVisitor(dispIncr);
+  const PetscScalar* dispIncrArray = dispIncrVisitor.localArray();CPPUNIT_ASSERT(dispIncrArray);
+
+  const PetscScalar* dispIncrGuessArray = NULL;
+  err = VecGetArrayRead(dispIncrGuessVec, &dispIncrGuessArray);CPPUNIT_ASSERT(!err);
+
+  CPPUNIT_ASSERT(fault._fields);
+  topology::VecVisitorMesh dispRelVisitor(fault._fields->get("relative disp"));
+  const PetscScalar* dispRelArray = dispRelVisitor.localArray();CPPUNIT_ASSERT(dispRelArray);
+
+  const PylithScalar tolerance = (sizeof(double) == sizeof(PylithScalar)) ? 1.0e-06 : 1.0e-05;
+  const int spaceDim = _data->spaceDim;
+  std::set<PetscInt> pointsChanged;
+  const int numVertices = fault._cohesiveVertices.size();
+  for (int i=0; i < numVertices; ++i) {
+    const PetscInt e_lagrange = fault._cohesiveVertices[i].lagrange;
+    const PetscInt v_fault = fault._cohesiveVertices[i].fault;
+    const PetscInt v_negative = fault._cohesiveVertices[i].negative;
+    const PetscInt v_positive = fault._cohesiveVertices[i].positive;
+    if (e_lagrange < 0) { // skip clamped edges
+      continue;
+    } // if
+    pointsChanged.insert(v_negative);
+    pointsChanged.insert(v_positive);
+
+    const PetscInt droff = dispRelVisitor.sectionOffset(v_fault);
+    const PetscInt dtnoff = dispTVisitor.sectionOffset(v_negative);
+    const PetscInt dtpoff = dispTVisitor.sectionOffset(v_positive);
+    const PetscInt dinoff = dispIncrVisitor.sectionOffset(v_negative);
+    const PetscInt dipoff = dispIncrVisitor.sectionOffset(v_positive);
+    for (int d=0; d < spaceDim; ++d) {
+      // Relative displacement at end of time step matches slip.
+      const PylithScalar dispRelE = dispRelArray[droff+d];
+      const PylithScalar dispRel = dispTArray[dtpoff+d] + dispIncrArray[dipoff+d] - dispTArray[dtnoff+d] - dispIncrArray[dinoff+d];
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(dispRelE, dispRel, tolerance);
+
+      // Correction is split equally between the two sides.
+      const PylithScalar correctionP = dispIncrArray[dipoff+d] - dispIncrGuessArray[dipoff+d];
+      const PylithScalar correctionN = dispIncrArray[dinoff+d] - dispIncrGuessArray[dinoff+d];
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(correctionP, -correctionN, tolerance);
+    } // for
+  } // for
+
+  // Other points, including the Lagrange multipliers, are unchanged.
+  PetscInt pStart = 0, pEnd = 0;
+  err = PetscSectionGetChart(dispIncr.localSection(), &pStart, &pEnd);CPPUNIT_ASSERT(!err);
+  for (PetscInt p = pStart; p < pEnd; ++p) {
+    if (dispIncrVisitor.sectionDof(p) > 0 && pointsChanged.find(p) == pointsChanged.end()) {
+      const PetscInt off = dispIncrVisitor.sectionOffset(p);
+      for (int d=0; d < spaceDim; ++d) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(dispIncrGuessArray[off+d], dispIncrArray[off+d], tolerance);
+      } // for
+    } // if
+  } // for
+
+  err = VecRestoreArrayRead(dispIncrGuessVec, &dispIncrGuessArray);CPPUNIT_ASSERT(!err);
+  err = VecDestroy(&dispIncrGuessVec);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // testProjectSolnIncr
+
 
 // ----------------------------------------------------------------------
 void
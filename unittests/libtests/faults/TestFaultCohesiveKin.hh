@@ -105,6 +105,12 @@ public :
   /// Test _calcTractionsChange().
   void testCalcTractionsChange(void);
 
+  /// Test _updateSourceStats().
+  void testSourceStats(void);
+
+  /// Test projectSolnIncr().
+  void testProjectSolnIncr(void);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
@@ -57,6 +57,8 @@ class pylith::faults::TestFaultCohesiveKinTri3 : public TestFaultCohesiveKin
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testAdjustSolnLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testSourceStats );
+  CPPUNIT_TEST( testProjectSolnIncr );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -82,6 +84,8 @@ class pylith::faults::TestFaultCohesiveKinTri3d : public TestFaultCohesiveKin
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testSourceStats );
+  CPPUNIT_TEST( testProjectSolnIncr );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -107,6 +111,8 @@ class pylith::faults::TestFaultCohesiveKinTri3g : public TestFaultCohesiveKin
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testSourceStats );
+  CPPUNIT_TEST( testProjectSolnIncr );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -133,6 +139,8 @@ class pylith::faults::TestFaultCohesiveKinQuad4 : public TestFaultCohesiveKin
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testAdjustSolnLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testSourceStats );
+  CPPUNIT_TEST( testProjectSolnIncr );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -158,6 +166,8 @@ class pylith::faults::TestFaultCohesiveKinQuad4e : public TestFaultCohesiveKin
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testSourceStats );
+  CPPUNIT_TEST( testProjectSolnIncr );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -182,6 +192,8 @@ class pylith::faults::TestFaultCohesiveKinQuad4i : public TestFaultCohesiveKin
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testSourceStats );
+  CPPUNIT_TEST( testProjectSolnIncr );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -208,6 +220,8 @@ class pylith::faults::TestFaultCohesiveKinTet4 : public TestFaultCohesiveKin
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testAdjustSolnLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testSourceStats );
+  CPPUNIT_TEST( testProjectSolnIncr );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -233,6 +247,8 @@ class pylith::faults::TestFaultCohesiveKinTet4e : public TestFaultCohesiveKin
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testSourceStats );
+  CPPUNIT_TEST( testProjectSolnIncr );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -258,6 +274,8 @@ class pylith::faults::TestFaultCohesiveKinTet4f : public TestFaultCohesiveKin
   CPPUNIT_TEST( testIntegrateJacobian );
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testSourceStats );
+  CPPUNIT_TEST( testProjectSolnIncr );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -284,6 +302,8 @@ class pylith::faults::TestFaultCohesiveKinHex8 : public TestFaultCohesiveKin
   CPPUNIT_TEST( testIntegrateJacobianLumped );
   CPPUNIT_TEST( testAdjustSolnLumped );
   CPPUNIT_TEST( testCalcTractionsChange );
+  CPPUNIT_TEST( testSourceStats );
+  CPPUNIT_TEST( testProjectSolnIncr );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -0,0 +1,111 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestQuadratureFixed.hh" // Implementation of class methods
+
+#include "pylith/feassemble/QuadratureFixed.hh"
+#include "pylith/feassemble/QuadratureRefCell.hh"
+#include "pylith/feassemble/GeometryTri2D.hh"
+#include "pylith/feassemble/GeometryTet3D.hh"
+
+#include "data/QuadratureData2DLinear.hh"
+#include "data/QuadratureData2DQuadratic.hh"
+#include "data/QuadratureData3DLinear.hh"
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::feassemble::TestQuadratureFixed );
+
+// ----------------------------------------------------------------------
+// Test computeGeometry() w/Tri3 cell.
+void
+pylith::feassemble::TestQuadratureFixed::testLinear2D(void)
+{ // testLinear2D
+  PYLITH_METHOD_BEGIN;
+
+  GeometryTri2D geometry;
+  QuadratureRefCell refCell;
+  refCell.refGeometry(&geometry);
+
+  QuadratureFixed<2,3,1> q(refCell);
+  QuadratureData2DLinear data;
+
+  _testComputeGeometry(&q, &refCell, data);
+
+  PYLITH_METHOD_END;
+} // testLinear2D
+
+// ----------------------------------------------------------------------
+// Test computeGeometry() w/Tet4 cell.
+void
+pylith::feassemble::TestQuadratureFixed::testLinear3D(void)
+{ // testLinear3D
+  PYLITH_METHOD_BEGIN;
+
+  GeometryTet3D geometry;
+  QuadratureRefCell refCell;
+  refCell.refGeometry(&geometry);
+
+  QuadratureFixed<3,4,1> q(refCell);
+  QuadratureData3DLinear data;
+
+  _testComputeGeometry(&q, &refCell, data);
+
+  PYLITH_METHOD_END;
+} // testLinear3D
+
+// ----------------------------------------------------------------------
+// Test QuadratureFixedFactory::create().
+void
+pylith::feassemble::TestQuadratureFixed::testCreate(void)
+{ // testCreate
+  PYLITH_METHOD_BEGIN;
+
+  { // Tri3 w/1 point
+    QuadratureData2DLinear data;
+    QuadratureRefCell refCell;
+    refCell.initialize(data.basis, data.numQuadPts, data.numBasis,
+		       data.basisDerivRef, data.numQuadPts, data.numBasis, data.cellDim,
+		       data.quadPtsRef, data.numQuadPts, data.cellDim,
+		       data.quadWts, data.numQuadPts,
+		       data.spaceDim);
+    QuadratureEngine* engine = QuadratureFixedFactory::create(refCell);
+    CPPUNIT_ASSERT(dynamic_cast<QuadratureFixed<2,3,1>*>(engine));
+    delete engine; engine = 0;
+  } // Tri3
+
+  { // Tri6 is not supported
+    QuadratureData2DQuadratic data;
+    QuadratureRefCell refCell;
+    refCell.initialize(data.basis, data.numQuadPts, data.numBasis,
+		       data.basisDerivRef, data.numQuadPts, data.numBasis, data.cellDim,
+		       data.quadPtsRef, data.numQuadPts, data.cellDim,
+		       data.quadWts, data.numQuadPts,
+		       data.spaceDim);
+    QuadratureEngine* engine = QuadratureFixedFactory::create(refCell);
+    CPPUNIT_ASSERT(!engine);
+  } // Tri6
+
+  PYLITH_METHOD_END;
+} // testCreate
+
+
+// End of file 
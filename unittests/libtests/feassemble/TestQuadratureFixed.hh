@@ -0,0 +1,69 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/feassemble/TestQuadratureFixed.hh
+ *
+ * @brief C++ TestQuadratureFixed object
+ *
+ * C++ unit testing for QuadratureFixed.
+ */
+
+#if !defined(pylith_feassemble_testquadraturefixed_hh)
+#define pylith_feassemble_testquadraturefixed_hh
+
+#include "TestQuadratureEngine.hh"
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace feassemble {
+    class TestQuadratureFixed;
+  } // feassemble
+} // pylith
+
+/// C++ unit testing for QuadratureFixed
+class pylith::feassemble::TestQuadratureFixed : public TestQuadratureEngine
+{ // class TestQuadratureFixed
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestQuadratureFixed );
+
+  CPPUNIT_TEST( testLinear2D );
+  CPPUNIT_TEST( testLinear3D );
+  CPPUNIT_TEST( testCreate );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test initialize() & computeGeometry() w/Tri3 cell.
+  void testLinear2D(void);
+
+  /// Test initialize() & computeGeometry() w/Tet4 cell.
+  void testLinear3D(void);
+
+  /// Test QuadratureFixedFactory::create().
+  void testCreate(void);
+
+}; // class TestQuadratureFixed
+
+#endif // pylith_feassemble_testquadraturefixed_hh
+
+
+// End of file 
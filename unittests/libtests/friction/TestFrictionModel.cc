@@ -428,9 +428,11 @@ pylith::friction::TestFrictionModel::testUpdateStateVars(void)
     
     const PylithScalar tolerance = 1.0e-06;
     CPPUNIT_ASSERT(friction._fieldsPropsStateVars);
+    CPPUNIT_ASSERT(!friction._fieldsCurrent);
     for(PetscInt i = 0; i < numStateVars; ++i) {
       const materials::Metadata::ParamDescription& stateVar = metadata.getStateVar(i);
-      topology::Field& stateVarField = friction._fieldsPropsStateVars->get(stateVar.name.c_str());
+      // Fields are updated from packed array on request.
+      const topology::Field& stateVarField = friction.getField(stateVar.name.c_str());
       topology::VecVisitorMesh stateVarVisitor(stateVarField);
       PetscScalar *fieldsArray = stateVarVisitor.localArray();CPPUNIT_ASSERT(fieldsArray);
 
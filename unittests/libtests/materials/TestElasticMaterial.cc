@@ -31,17 +31,21 @@
 #include "pylith/topology/VisitorMesh.hh" // USES VisitorMesh
 #include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
 #include "pylith/materials/ElasticPlaneStrain.hh" // USES ElasticPlaneStrain
+#include "pylith/materials/PowerLawPlaneStrain.hh" // USES PowerLawPlaneStrain
 #include "pylith/feassemble/Quadrature.hh" // USES Quadrature
 #include "pylith/feassemble/GeometryTri2D.hh" // USES GeometryTri2D
 
 #include "pylith/utils/array.hh" // USES scalar_array
+#include "pylith/utils/constdefs.h" // USES MAXSCALAR
 
 #include "spatialdata/spatialdb/SimpleDB.hh" // USES SimpleDB
 #include "spatialdata/spatialdb/SimpleIOAscii.hh" // USES SimpleIOAscii
+#include "spatialdata/spatialdb/UniformDB.hh" // USES UniformDB
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 #include "spatialdata/units/Nondimensional.hh" // USES Nondimensional
 
 #include <cstring> // USES memcpy()
+#include <algorithm> // USES std::min()
 
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::materials::TestElasticMaterial );
@@ -439,6 +443,113 @@ pylith::materials::TestElasticMaterial::testStableTimeStepImplicit(void)
   PYLITH_METHOD_END;
 } // testStableTimeStepImplicit
 
+// ----------------------------------------------------------------------
+// Test stableTimeStepImplicit() after updateStateVars() for material
+// with stable time step that depends on state variables.
+void
+pylith::materials::TestElasticMaterial::testStableTimeStepImplicitStateVars(void)
+{ // testStableTimeStepImplicitStateVars
+  PYLITH_METHOD_BEGIN;
+
+  spatialdata::spatialdb::UniformDB dbProperties("power-law properties");
+  const int numValues = 6;
+  const char* names[numValues] = {
+    "density",
+    "vs",
+    "vp",
+    "reference-strain-rate",
+    "reference-stress",
+    "power-law-exponent",
+  };
+  const char* units[numValues] = {
+    "kg/m**3",
+    "m/s",
+    "m/s",
+    "1/s",
+    "Pa",
+    "None",
+  };
+  const double values[numValues] = {
+    2500.0,
+    3000.0,
+    5196.15242,
+    1.0e-06,
+    1.0e+06,
+    3.5,
+  };
+  dbProperties.setData(names, units, values, numValues);
+
+  topology::Mesh mesh;
+  PowerLawPlaneStrain material;
+  ElasticPlaneStrainData data;
+  _initialize(&mesh, &material, &data, &dbProperties);
+  material.useElasticBehavior(true);
+
+  // Get cells associated with material
+  const int materialId = 24;
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  topology::StratumIS materialIS(dmMesh, "material-id", materialId);
+  const PetscInt* cells = materialIS.points();
+  const PetscInt numCells = materialIS.size();
+
+  const int tensorSize = material._tensorSize;
+  const int numQuadPts = data.numLocs;
+  const int numPropsQuadPt = material._numPropsQuadPt;
+  const int numVarsQuadPt = material._numVarsQuadPt;
+  ElasticMaterial* elasticMaterial = &material;
+
+  const PylithScalar dtInitial = material.stableTimeStepImplicit(mesh);
+  CPPUNIT_ASSERT(material._dtStableImplicitCurrent);
+
+  // Update state variables with new strain; the stress state
+  // variables change, so the cached stable time steps are stale.
+  scalar_array strain(numQuadPts*tensorSize);
+  for (int i=0; i < numQuadPts*tensorSize; ++i) {
+    strain[i] = 1.0e-4*(1+i);
+  } // for
+  material.createPropsAndVarsVisitors();
+  for (PetscInt c=0; c < numCells; ++c) {
+    material.retrievePropsAndVars(cells[c]);
+    material.updateStateVars(strain, cells[c]);
+  } // for
+  material.destroyPropsAndVarsVisitors();
+  CPPUNIT_ASSERT(!material._dtStableImplicitCurrent);
+
+  // Expected stable time step from updated state variables.
+  PylithScalar dtE = pylith::PYLITH_MAXSCALAR;
+  material.createPropsAndVarsVisitors();
+  for (PetscInt c=0; c < numCells; ++c) {
+    material.retrievePropsAndVars(cells[c]);
+    for (int iQuad=0; iQuad < numQuadPts; ++iQuad) {
+      const PylithScalar dtQuadPt = 
+	elasticMaterial->_stableTimeStepImplicit(&material._propertiesCell[iQuad*numPropsQuadPt], numPropsQuadPt,
+						 &material._stateVarsCell[iQuad*numVarsQuadPt], numVarsQuadPt);
+      dtE = std::min(dtE, dtQuadPt);
+    } // for
+  } // for
+  material.destroyPropsAndVarsVisitors();
+
+  const PylithScalar tolerance = 1.0e-06;
+  const PylithScalar dtUpdated = material.stableTimeStepImplicit(mesh);
+  CPPUNIT_ASSERT(material._dtStableImplicitCurrent);
+  CPPUNIT_ASSERT(dtE < dtInitial);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, dtUpdated/dtE, tolerance);
+
+  // Updating with the same strain leaves the state variables (elastic
+  // behavior) and the cached stable time steps unchanged.
+  material.createPropsAndVarsVisitors();
+  for (PetscInt c=0; c < numCells; ++c) {
+    material.retrievePropsAndVars(cells[c]);
+    material.updateStateVars(strain, cells[c]);
+  } // for
+  material.destroyPropsAndVarsVisitors();
+  CPPUNIT_ASSERT(material._dtStableImplicitCurrent);
+  const PylithScalar dtCached = material.stableTimeStepImplicit(mesh);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, dtCached/dtE, tolerance);
+
+  PYLITH_METHOD_END;
+} // testStableTimeStepImplicitStateVars
+
 // ----------------------------------------------------------------------
 // Test calcStableTimeStepExplicit()
 void
@@ -501,6 +612,12 @@ pylith::materials::TestElasticMaterial::testStableTimeStepExplicit(void)
   const PylithScalar dtE = 2.0*1.757359312880716 / 5196.15242;
   CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, dt/dtE, tolerance);
 
+  // Second call uses cached cell widths and stable time steps.
+  CPPUNIT_ASSERT(material._dtStableExplicitCurrent);
+  CPPUNIT_ASSERT_EQUAL(size_t(numCells), material._minCellWidth.size());
+  const PylithScalar dtCached = material.stableTimeStepExplicit(mesh, &quadrature);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, dtCached/dtE, tolerance);
+
   PYLITH_METHOD_END;
 } // testStableTimeStepExplicit
 
@@ -839,8 +956,9 @@ pylith::materials::TestElasticMaterial::setupNormalizer(void)
 // Setup mesh and material.
 void
 pylith::materials::TestElasticMaterial::_initialize(topology::Mesh* mesh,
-						    ElasticPlaneStrain* material,
-						    const ElasticPlaneStrainData* data)
+						    ElasticMaterial* material,
+						    const ElasticPlaneStrainData* data,
+						    spatialdata::spatialdb::SpatialDB* dbProperties)
 { // _initialize
   PYLITH_METHOD_BEGIN;
 
@@ -935,7 +1053,7 @@ pylith::materials::TestElasticMaterial::_initialize(topology::Mesh* mesh,
   dbStrain.ioHandler(&dbIOStrain);
   dbStrain.queryType(spatialdata::spatialdb::SimpleDB::NEAREST);
   
-  material->dbProperties(&db);
+  material->dbProperties(dbProperties ? dbProperties : &db);
   material->id(materialId);
   material->label("my_material");
   material->normalizer(normalizer);
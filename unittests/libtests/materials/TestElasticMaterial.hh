@@ -30,6 +30,7 @@
 #include "TestMaterial.hh"
 #include "pylith/materials/materialsfwd.hh" // forward declarations
 #include "pylith/topology/topologyfwd.hh" // forward declarations
+#include "spatialdata/spatialdb/spatialdbfwd.hh" // USES SpatialDB
 
 /// Namespace for pylith package
 namespace pylith {
@@ -56,6 +57,7 @@ class pylith::materials::TestElasticMaterial : public TestMaterial
   CPPUNIT_TEST( testCalcDerivElastic );
   CPPUNIT_TEST( testUpdateStateVars );
   CPPUNIT_TEST( testStableTimeStepImplicit );
+  CPPUNIT_TEST( testStableTimeStepImplicitStateVars );
   CPPUNIT_TEST( testStableTimeStepExplicit );
 
   CPPUNIT_TEST_SUITE_END();
@@ -90,6 +92,10 @@ public :
   /// Test stableTimeStepImplicit().
   void testStableTimeStepImplicit(void);
 
+  /// Test stableTimeStepImplicit() after updateStateVars() for
+  /// material with stable time step that depends on state variables.
+  void testStableTimeStepImplicitStateVars(void);
+
   /// Test stableTimeStepExplicit().
   void testStableTimeStepExplicit(void);
 
@@ -144,10 +150,13 @@ private :
    * @param mesh Finite-element mesh.
    * @param material Elastic material.
    * @param data Data with properties for elastic material.
+   * @param dbProperties Spatial database with properties (NULL for
+   *   properties of elastic material).
    */
   void _initialize(topology::Mesh* mesh,
-		   ElasticPlaneStrain* material,
-		   const ElasticPlaneStrainData* data);
+		   ElasticMaterial* material,
+		   const ElasticPlaneStrainData* data,
+		   spatialdata::spatialdb::SpatialDB* dbProperties =0);
 
 }; // class TestElasticMaterial
 
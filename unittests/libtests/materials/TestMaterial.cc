@@ -192,6 +192,23 @@ pylith::materials::TestMaterial::testIsJacobianSymmetric(void)
   PYLITH_METHOD_END;
 } // testIsJacobianSymmetric
 
+// ----------------------------------------------------------------------
+// Test nodeSharedQuery()
+void
+pylith::materials::TestMaterial::testNodeSharedQuery(void)
+{ // testNodeSharedQuery
+  PYLITH_METHOD_BEGIN;
+
+  ElasticPlaneStrain material;
+  CPPUNIT_ASSERT_EQUAL(false, material.nodeSharedQuery());
+  CPPUNIT_ASSERT_EQUAL(0.0, material.nodeSharedMemory());
+
+  material.nodeSharedQuery(true);
+  CPPUNIT_ASSERT_EQUAL(true, material.nodeSharedQuery());
+
+  PYLITH_METHOD_END;
+} // testNodeSharedQuery
+
 // ----------------------------------------------------------------------
 // Test initialize()
 void
@@ -286,10 +303,14 @@ pylith::materials::TestMaterial::testInitialize(void)
   PetscInt cell = cells[0];
   const PylithScalar tolerance = 1.0e-06;
 
+  // With one quadrature point per cell, properties are constant over
+  // each cell and need not be stored at quadrature points.
+  CPPUNIT_ASSERT(Material::PROPS_QUADPTS != material.propsStorage());
+
   CPPUNIT_ASSERT(material._properties);
   topology::VecVisitorMesh propertiesVisitor(*material._properties);
-  const PetscScalar* propertiesArray = propertiesVisitor.localArray();
-  const PetscInt off = propertiesVisitor.sectionOffset(cell);
+  int stride = 0;
+  const PylithScalar* propertiesArray = material._propsCell(&stride, propertiesVisitor.localArray(), propertiesVisitor.sectionOffset(cell));
 
   const int p_density = 0;
   const int p_mu = 1;
@@ -297,20 +318,47 @@ pylith::materials::TestMaterial::testInitialize(void)
 
   // density
   for (int i=0; i < numQuadPts; ++i) {
-    const int index = i*material._numPropsQuadPt + p_density;
-    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, propertiesArray[off+index]/densityE[i]*densityScale, tolerance);
+    const int index = i*stride + p_density;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, propertiesArray[index]/densityE[i]*densityScale, tolerance);
   } // for
   
   // mu
   for (int i=0; i < numQuadPts; ++i) {
-    const int index = i*material._numPropsQuadPt + p_mu;
-    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, propertiesArray[off+index]/muE[i]*pressureScale, tolerance);
+    const int index = i*stride + p_mu;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, propertiesArray[index]/muE[i]*pressureScale, tolerance);
   } // for
   
   // lambda
   for (int i=0; i < numQuadPts; ++i) {
-    const int index = i*material._numPropsQuadPt + p_lambda;
-    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, propertiesArray[off+index]/lambdaE[i]*pressureScale, tolerance);
+    const int index = i*stride + p_lambda;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, propertiesArray[index]/lambdaE[i]*pressureScale, tolerance);
+  } // for
+
+  // Querying the database once per compute node gives the same properties.
+  ElasticPlaneStrain materialShared;
+  materialShared.dbProperties(&db);
+  materialShared.id(materialId);
+  materialShared.label("my_material");
+  materialShared.normalizer(normalizer);
+  materialShared.nodeSharedQuery(true);
+  materialShared.initialize(mesh, &quadrature);
+
+  // With a single process on the node nothing is saved, so the net
+  // memory is minus the shared windows (query points plus the density,
+  // Vs, Vp, and error flag at each point).
+  const int numDBProperties = 3;
+  const double memoryWindowsE = numCells*numQuadPts*(spaceDim+numDBProperties+1)*sizeof(PylithScalar);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(-memoryWindowsE, materialShared.nodeSharedMemory(), tolerance);
+
+  CPPUNIT_ASSERT(materialShared._properties);
+  topology::VecVisitorMesh propertiesSharedVisitor(*materialShared._properties);
+  for (PetscInt c=0; c < numCells; ++c) {
+    int strideE = 0;
+    const PylithScalar* propertiesE = material._propsCell(&strideE, propertiesVisitor.localArray(), propertiesVisitor.sectionOffset(cells[c]));
+    const PylithScalar* propertiesShared = materialShared._propsCell(&stride, propertiesSharedVisitor.localArray(), propertiesSharedVisitor.sectionOffset(cells[c]));
+    for (int i=0; i < 3; ++i) {
+      CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, propertiesShared[i]/propertiesE[i], tolerance);
+    } // for
   } // for
 
   PYLITH_METHOD_END;
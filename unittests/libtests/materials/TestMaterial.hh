@@ -54,6 +54,7 @@ class pylith::materials::TestMaterial : public CppUnit::TestFixture
   CPPUNIT_TEST( testNormalizer );
   CPPUNIT_TEST( testNeedNewJacobian );
   CPPUNIT_TEST( testIsJacobianSymmetric );
+  CPPUNIT_TEST( testNodeSharedQuery );
   CPPUNIT_TEST( testInitialize );
 
   CPPUNIT_TEST_SUITE_END();
@@ -85,6 +86,9 @@ public :
   /// Test isJacobianSymmetric()
   void testIsJacobianSymmetric(void);
 
+  /// Test nodeSharedQuery()
+  void testNodeSharedQuery(void);
+
   /// Test initialize()
   void testInitialize(void);
 
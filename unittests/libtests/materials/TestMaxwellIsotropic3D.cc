@@ -24,8 +24,10 @@
 #include "data/MaxwellIsotropic3DTimeDepData.hh" // USES MaxwellIsotropic3DTimeDepData
 
 #include "pylith/materials/MaxwellIsotropic3D.hh" // USES MaxwellIsotropic3D
+#include "pylith/materials/ViscoelasticMaxwell.hh" // USES ViscoelasticMaxwell
 
 #include <cstring> // USES memcpy()
+#include <cmath> // USES exp()
 
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::materials::TestMaxwellIsotropic3D );
@@ -62,6 +64,38 @@ pylith::materials::TestMaxwellIsotropic3D::testTimeStep(void)
   CPPUNIT_ASSERT_EQUAL(true, material.needNewJacobian());
 } // testTimeStep
 
+// ----------------------------------------------------------------------
+// Test _calcTimeStepCoefs()
+void
+pylith::materials::TestMaxwellIsotropic3D::test_calcTimeStepCoefs(void)
+{ // test_calcTimeStepCoefs
+  MaxwellIsotropic3D material;
+
+  const int numCoefs = 2;
+  CPPUNIT_ASSERT_EQUAL(numCoefs, material._numCoefsQuadPt);
+
+  const PylithScalar dt = 0.4;
+  const PylithScalar maxwellTime = 2.5;
+  const int numProperties = 4;
+  const PylithScalar properties[numProperties] = { 2500.0, 3.0e+10, 3.0e+10, maxwellTime };
+  material.timeStep(dt);
+
+  PylithScalar coefs[numCoefs];
+  material._calcTimeStepCoefs(coefs, numCoefs, properties, numProperties);
+
+  const PylithScalar tolerance = 1.0e-06;
+  const PylithScalar dqE = ViscoelasticMaxwell::viscousStrainParam(dt, maxwellTime);
+  const PylithScalar expFacE = exp(-dt/maxwellTime);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, coefs[0]/dqE, tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, coefs[1]/expFacE, tolerance);
+
+  // Coefficients outside of a cell evaluation are computed on the fly.
+  PylithScalar coefsWork[numCoefs];
+  const PylithScalar* coefsQuadPt = material._timeStepCoefs(coefsWork, properties, numProperties);
+  CPPUNIT_ASSERT(coefsWork == coefsQuadPt);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, coefsQuadPt[0]/dqE, tolerance);
+} // test_calcTimeStepCoefs
+
 // ----------------------------------------------------------------------
 // Test useElasticBehavior()
 void
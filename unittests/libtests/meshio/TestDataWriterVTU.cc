@@ -0,0 +1,156 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestDataWriterVTU.hh" // Implementation of class methods
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include <cmath> // USES fabs()
+#include <cstring> // USES memcpy()
+#include <iostream> // USES std::cerr
+#include <sstream> // USES std::ostringstream
+#include <fstream> // USES std::ifstream
+#include <sys/types.h> // USES int64_t
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace meshio {
+    namespace _TestDataWriterVTU {
+      /** Read entire file into string.
+       *
+       * @param filename Name of file.
+       * @returns Contents of file.
+       */
+      std::string readFile(const char* filename) {
+	std::ifstream fin(filename, std::ios::in | std::ios::binary);
+	if (!fin.is_open()) {
+	  std::cerr << "Could not open file '" << filename << "'." << std::endl;
+	} // if
+	CPPUNIT_ASSERT(fin.is_open());
+	std::ostringstream contents;
+	contents << fin.rdbuf();
+	fin.close();
+	return contents.str();
+      } // readFile
+    } // _TestDataWriterVTU
+  } // meshio
+} // pylith
+
+// ----------------------------------------------------------------------
+// Check that file contains text.
+void
+pylith::meshio::TestDataWriterVTU::checkContains(const char* filename,
+						 const char* text)
+{ // checkContains
+  PYLITH_METHOD_BEGIN;
+
+  const std::string& contents = _TestDataWriterVTU::readFile(filename);
+  if (contents.find(text) == std::string::npos) {
+    std::cerr << "Could not find '" << text << "' in file '" << filename << "'." << std::endl;
+    CPPUNIT_ASSERT(false);
+  } // if
+
+  PYLITH_METHOD_END;
+} // checkContains
+
+// ----------------------------------------------------------------------
+// Check values of data array in VTU file with raw appended data.
+void
+pylith::meshio::TestDataWriterVTU::checkArray(const char* filename,
+					      const char* name,
+					      const PylithScalar* valuesE,
+					      const int numPoints,
+					      const int fiberDim,
+					      const int numComponents,
+					      const PylithScalar scale)
+{ // checkArray
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(valuesE);
+
+  const std::string& contents = _TestDataWriterVTU::readFile(filename);
+
+  // Get offset of data array from XML header.
+  const std::string nameAttr = std::string("Name=\"") + name + "\"";
+  const size_t posName = contents.find(nameAttr);
+  CPPUNIT_ASSERT(posName != std::string::npos);
+  const size_t posEnd = contents.find("/>", posName);
+  CPPUNIT_ASSERT(posEnd != std::string::npos);
+  const std::string element = contents.substr(posName, posEnd-posName);
+
+  std::ostringstream componentsAttr;
+  componentsAttr << "NumberOfComponents=\"" << numComponents << "\"";
+  CPPUNIT_ASSERT(element.find(componentsAttr.str()) != std::string::npos);
+
+  const std::string offsetAttr = "offset=\"";
+  const size_t posOffset = element.find(offsetAttr);
+  CPPUNIT_ASSERT(posOffset != std::string::npos);
+  std::istringstream sin(element.substr(posOffset+offsetAttr.length()));
+  size_t offset = 0;
+  sin >> offset;
+
+  // Appended data starts after '_'.
+  const size_t posAppended = contents.find("<AppendedData encoding=\"raw\">");
+  CPPUNIT_ASSERT(posAppended != std::string::npos);
+  const size_t posData = contents.find('_', posAppended);
+  CPPUNIT_ASSERT(posData != std::string::npos);
+  const size_t start = posData + 1 + offset;
+
+  int64_t nbytes = 0;
+  CPPUNIT_ASSERT(start + sizeof(nbytes) <= contents.size());
+  memcpy(&nbytes, &contents[start], sizeof(nbytes));
+  CPPUNIT_ASSERT_EQUAL(int64_t(numPoints*numComponents*sizeof(PylithScalar)), nbytes);
+  CPPUNIT_ASSERT(start + sizeof(nbytes) + nbytes <= contents.size());
+
+  const PylithScalar tolerance = 1.0e-6;
+  for (int iPoint=0, index=0; iPoint < numPoints; ++iPoint) {
+    for (int iComp=0; iComp < numComponents; ++iComp, ++index) {
+      PylithScalar value = 0.0;
+      memcpy(&value, &contents[start+sizeof(nbytes)+index*sizeof(PylithScalar)], sizeof(PylithScalar));
+      const PylithScalar valueE = (iComp < fiberDim) ? scale*valuesE[iPoint*fiberDim+iComp] : 0.0;
+      if (fabs(valueE) > tolerance) {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, value/valueE, tolerance);
+      } else {
+	CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, value, tolerance);
+      } // if/else
+    } // for
+  } // for
+
+  PYLITH_METHOD_END;
+} // checkArray
+
+// ----------------------------------------------------------------------
+// Generate name of VTU file from name of VTK file.
+std::string
+pylith::meshio::TestDataWriterVTU::vtuFilename(const char* filename)
+{ // vtuFilename
+  std::string vtuFilename(filename);
+  const size_t indexExt = vtuFilename.rfind(".vtk");
+  if (indexExt != std::string::npos) {
+    vtuFilename.replace(indexExt, 4, ".vtu");
+  } // if
+
+  return vtuFilename;
+} // vtuFilename
+
+
+// End of file 
@@ -0,0 +1,89 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/meshio/TestDataWriterVTU.hh
+ *
+ * @brief C++ TestDataWriterVTU object
+ *
+ * C++ unit testing for DataWriterVTU.
+ */
+
+#if !defined(pylith_meshio_testdatawritervtu_hh)
+#define pylith_meshio_testdatawritervtu_hh
+
+#include "pylith/utils/types.hh" // HASA PylithScalar
+
+#include <string> // USES std::string
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace meshio {
+    class TestDataWriterVTU;
+  } // meshio
+} // pylith
+
+/// C++ unit testing for DataWriterVTU
+class pylith::meshio::TestDataWriterVTU
+{ // class TestDataWriterVTU
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /** Check that file contains text.
+   *
+   * @param filename Name of file to check.
+   * @param text Expected text.
+   */
+  static
+  void checkContains(const char* filename,
+		     const char* text);
+
+  /** Check values of data array in VTU file with raw appended data.
+   *
+   * @param filename Name of VTU file.
+   * @param name Name of data array.
+   * @param valuesE Expected values [numPoints*fiberDim].
+   * @param numPoints Number of points.
+   * @param fiberDim Number of values per point in valuesE.
+   * @param numComponents Number of components per point in file.
+   * @param scale Scale applied to expected values.
+   */
+  static
+  void checkArray(const char* filename,
+		  const char* name,
+		  const PylithScalar* valuesE,
+		  const int numPoints,
+		  const int fiberDim,
+		  const int numComponents,
+		  const PylithScalar scale =1.0);
+
+  /** Generate name of VTU file from name of VTK file.
+   *
+   * @param filename Name of VTK file.
+   * @returns Name of VTU file.
+   */
+  static
+  std::string vtuFilename(const char* filename);
+
+}; // class TestDataWriterVTU
+
+#endif // pylith_meshio_testdatawritervtu_hh
+
+
+// End of file 
@@ -0,0 +1,303 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestDataWriterVTUMesh.hh" // Implementation of class methods
+
+#include "data/DataWriterData.hh" // USES DataWriterData
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Fields.hh" // USES Fields
+#include "pylith/meshio/DataWriterVTU.hh" // USES DataWriterVTU
+
+#include <sstream> // USES std::ostringstream
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestDataWriterVTUMesh );
+
+// ----------------------------------------------------------------------
+// Setup testing data.
+void
+pylith::meshio::TestDataWriterVTUMesh::setUp(void)
+{ // setUp
+  PYLITH_METHOD_BEGIN;
+
+  TestDataWriterMesh::setUp();
+
+  PYLITH_METHOD_END;
+} // setUp
+
+// ----------------------------------------------------------------------
+// Tear down testing data.
+void
+pylith::meshio::TestDataWriterVTUMesh::tearDown(void)
+{ // tearDown
+  PYLITH_METHOD_BEGIN;
+
+  TestDataWriterMesh::tearDown();
+
+  PYLITH_METHOD_END;
+} // tearDown
+
+// ----------------------------------------------------------------------
+// Test constructor
+void
+pylith::meshio::TestDataWriterVTUMesh::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterVTU writer;
+
+  CPPUNIT_ASSERT(!writer._dm);
+  CPPUNIT_ASSERT_EQUAL(DataWriterVTU::COMPRESSOR_NONE, writer._compressor);
+  CPPUNIT_ASSERT_EQUAL(false, writer._isOpen);
+  CPPUNIT_ASSERT_EQUAL(false, writer._isOpenTimeStep);
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test filename()
+void
+pylith::meshio::TestDataWriterVTUMesh::testFilename(void)
+{ // testFilename
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterVTU writer;
+
+  const char* filename = "data.vtu";
+  writer.filename(filename);
+  CPPUNIT_ASSERT_EQUAL(std::string(filename), writer._filename);
+
+  PYLITH_METHOD_END;
+} // testFilename
+
+// ----------------------------------------------------------------------
+// Test timeFormat()
+void
+pylith::meshio::TestDataWriterVTUMesh::testTimeFormat(void)
+{ // testTimeFormat
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterVTU writer;
+
+  const char* format = "%4.1f";
+  writer.timeFormat(format);
+  CPPUNIT_ASSERT_EQUAL(std::string(format), writer._timeFormat);
+
+  PYLITH_METHOD_END;
+} // testTimeFormat
+
+// ----------------------------------------------------------------------
+// Test timeConstant()
+void
+pylith::meshio::TestDataWriterVTUMesh::testTimeConstant(void)
+{ // testTimeConstant
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterVTU writer;
+
+  const PylithScalar value = 4.5;
+  writer.timeConstant(value);
+  CPPUNIT_ASSERT_EQUAL(value, writer._timeConstant);
+
+  CPPUNIT_ASSERT_THROW(writer.timeConstant(-1.0), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testTimeConstant
+
+// ----------------------------------------------------------------------
+// Test compressor()
+void
+pylith::meshio::TestDataWriterVTUMesh::testCompressor(void)
+{ // testCompressor
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterVTU writer;
+
+#if defined(PETSC_HAVE_ZLIB)
+  writer.compressor("zlib");
+  CPPUNIT_ASSERT_EQUAL(DataWriterVTU::COMPRESSOR_ZLIB, writer._compressor);
+#else
+  CPPUNIT_ASSERT_THROW(writer.compressor("zlib"), std::runtime_error);
+#endif
+
+  writer.compressor("none");
+  CPPUNIT_ASSERT_EQUAL(DataWriterVTU::COMPRESSOR_NONE, writer._compressor);
+
+  CPPUNIT_ASSERT_THROW(writer.compressor("gzip"), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testCompressor
+
+// ----------------------------------------------------------------------
+// Test writeVertexField.
+void
+pylith::meshio::TestDataWriterVTUMesh::testWriteVertexField(void)
+{ // testWriteVertexField
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_mesh);
+  CPPUNIT_ASSERT(_data);
+
+  DataWriterVTU writer;
+
+  topology::Fields vertexFields(*_mesh);
+  _createVertexFields(&vertexFields);
+
+  const std::string& filename = vtuFilename(_data->vertexFilename);
+  writer.filename(filename.c_str());
+  writer.timeFormat(_data->timeFormat);
+
+  const int nfields = _data->numVertexFields;
+
+  const PylithScalar t = _data->time;
+  const int numTimeSteps = 1;
+  CPPUNIT_ASSERT(!_data->cellsLabel);
+  writer.open(*_mesh, numTimeSteps);
+  writer.openTimeStep(t, *_mesh);
+  const std::string root = writer._vtuFilenameRoot(t);
+  for (int i=0; i < nfields; ++i) {
+    topology::Field& field = vertexFields.get(_data->vertexFieldsInfo[i].name);
+    writer.writeVertexField(t, field, *_mesh);
+
+    // Make sure we can reuse field
+    std::string fieldLabel = std::string(field.label()) + std::string("2");
+    field.label(fieldLabel.c_str());
+    field.dimensionalizeOkay(true);
+    field.scale(2.0);
+    field.dimensionalize();
+    writer.writeVertexField(t, field, *_mesh);
+  } // for
+  writer.closeTimeStep();
+  writer.close();
+
+  const std::string& pieceFilename = DataWriterVTU::_pieceFilename(root, 0);
+  std::ostringstream numPoints;
+  numPoints << "NumberOfPoints=\"" << _data->numVertices << "\"";
+  checkContains(pieceFilename.c_str(), numPoints.str().c_str());
+  for (int i=0; i < nfields; ++i) {
+    const DataWriterData::FieldStruct& info = _data->vertexFieldsInfo[i];
+    const int numComponents = (topology::FieldBase::VECTOR == info.field_type && info.fiber_dim < 3) ? 3 : info.fiber_dim;
+    checkArray(pieceFilename.c_str(), info.name, _data->vertexFields[i], _data->numVertices, info.fiber_dim, numComponents);
+
+    const std::string name2 = std::string(info.name) + std::string("2");
+    checkArray(pieceFilename.c_str(), name2.c_str(), _data->vertexFields[i], _data->numVertices, info.fiber_dim, numComponents, 2.0);
+  } // for
+
+  const std::string pvtuFilename = root + ".pvtu";
+  checkContains(pvtuFilename.c_str(), "<PDataArray type=\"Float64\" Name=\"displacement\" NumberOfComponents=\"3\"/>");
+  checkContains(pvtuFilename.c_str(), (std::string("<Piece Source=\"") + pieceFilename + "\"/>").c_str());
+
+  const std::string pvdFilename = writer._pvdFilename();
+  checkContains(pvdFilename.c_str(), (std::string("file=\"") + pvtuFilename + "\"").c_str());
+
+  PYLITH_METHOD_END;
+} // testWriteVertexField
+
+// ----------------------------------------------------------------------
+// Test writeCellField.
+void
+pylith::meshio::TestDataWriterVTUMesh::testWriteCellField(void)
+{ // testWriteCellField
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(_mesh);
+  CPPUNIT_ASSERT(_data);
+
+  DataWriterVTU writer;
+
+  topology::Fields cellFields(*_mesh);
+  _createCellFields(&cellFields);
+
+  const std::string& filename = vtuFilename(_data->cellFilename);
+  writer.filename(filename.c_str());
+  writer.timeFormat(_data->timeFormat);
+
+  const int nfields = _data->numCellFields;
+
+  const PylithScalar t = _data->time;
+  const int numTimeSteps = 1;
+  CPPUNIT_ASSERT(!_data->cellsLabel);
+  writer.open(*_mesh, numTimeSteps);
+  writer.openTimeStep(t, *_mesh);
+  const std::string root = writer._vtuFilenameRoot(t);
+  for (int i=0; i < nfields; ++i) {
+    topology::Field& field = cellFields.get(_data->cellFieldsInfo[i].name);
+    writer.writeCellField(t, field);
+  } // for
+
+  // Cohesive cells are not included in the output.
+  const int numCells = writer._cells.size();
+  CPPUNIT_ASSERT(numCells > 0);
+  CPPUNIT_ASSERT(numCells <= _data->numCells);
+
+  writer.closeTimeStep();
+  writer.close();
+
+  const std::string& pieceFilename = DataWriterVTU::_pieceFilename(root, 0);
+  std::ostringstream numCellsAttr;
+  numCellsAttr << "NumberOfCells=\"" << numCells << "\"";
+  checkContains(pieceFilename.c_str(), numCellsAttr.str().c_str());
+  for (int i=0; i < nfields; ++i) {
+    const DataWriterData::FieldStruct& info = _data->cellFieldsInfo[i];
+    const int numComponents = (topology::FieldBase::VECTOR == info.field_type && info.fiber_dim < 3) ? 3 : info.fiber_dim;
+    checkArray(pieceFilename.c_str(), info.name, _data->cellFields[i], numCells, info.fiber_dim, numComponents);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testWriteCellField
+
+// ----------------------------------------------------------------------
+// Test _vtuFilenameRoot(), _pieceFilename(), and _pvdFilename().
+void
+pylith::meshio::TestDataWriterVTUMesh::testVtuFilename(void)
+{ // testVtuFilename
+  PYLITH_METHOD_BEGIN;
+
+  DataWriterVTU writer;
+
+  // Append info to filename if number of time steps is 0.
+  writer._numTimeSteps = 0;
+  writer._filename = "output.vtu";
+  CPPUNIT_ASSERT_EQUAL(std::string("output_info"), writer._vtuFilenameRoot(0.0));
+
+  // Use default normalization of 1.0, remove period from time stamp.
+  writer._numTimeSteps = 100;
+  writer._filename = "output.vtu";
+  writer.timeFormat("%05.2f");
+  CPPUNIT_ASSERT_EQUAL(std::string("output_t0230"), writer._vtuFilenameRoot(2.3));
+
+  // Use normalization of 20.0, remove period from time stamp.
+  writer._numTimeSteps = 100;
+  writer._filename = "output.vtu";
+  writer.timeFormat("%05.2f");
+  writer.timeConstant(20.0);
+  CPPUNIT_ASSERT_EQUAL(std::string("output_t0250"), writer._vtuFilenameRoot(50.0));
+
+  CPPUNIT_ASSERT_EQUAL(std::string("output_t0250_p0012.vtu"), DataWriterVTU::_pieceFilename("output_t0250", 12));
+  CPPUNIT_ASSERT_EQUAL(std::string("output.pvd"), writer._pvdFilename());
+
+  PYLITH_METHOD_END;
+} // testVtuFilename
+
+
+// End of file 
@@ -0,0 +1,100 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/meshio/TestDataWriterVTUMesh.hh
+ *
+ * @brief C++ TestDataWriterVTUMesh object
+ *
+ * C++ unit testing for DataWriterVTU with a mesh.
+ */
+
+#if !defined(pylith_meshio_testdatawritervtumesh_hh)
+#define pylith_meshio_testdatawritervtumesh_hh
+
+#include "TestDataWriterVTU.hh" // ISA TestDataWriterVTU
+#include "TestDataWriterMesh.hh" // ISA TestDataWriterMesh
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh, Field
+
+#include <cppunit/extensions/HelperMacros.h>
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace meshio {
+    class TestDataWriterVTUMesh;
+  } // meshio
+} // pylith
+
+/// C++ unit testing for DataWriterVTU
+class pylith::meshio::TestDataWriterVTUMesh : public TestDataWriterVTU,
+					      public TestDataWriterMesh,
+					      public CppUnit::TestFixture
+{ // class TestDataWriterVTUMesh
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestDataWriterVTUMesh );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testFilename );
+  CPPUNIT_TEST( testTimeFormat );
+  CPPUNIT_TEST( testTimeConstant );
+  CPPUNIT_TEST( testCompressor );
+  CPPUNIT_TEST( testVtuFilename );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Setup testing data.
+  void setUp(void);
+
+  /// Tear down testing data.
+  void tearDown(void);
+
+  /// Test constructor
+  void testConstructor(void);
+
+  /// Test filename()
+  void testFilename(void);
+
+  /// Test timeFormat()
+  void testTimeFormat(void);
+
+  /// Test timeConstant()
+  void testTimeConstant(void);
+
+  /// Test compressor()
+  void testCompressor(void);
+
+  /// Test writeVertexField.
+  void testWriteVertexField(void);
+
+  /// Test writeCellField.
+  void testWriteCellField(void);
+
+  /// Test _vtuFilenameRoot(), _pieceFilename(), and _pvdFilename().
+  void testVtuFilename(void);
+
+}; // class TestDataWriterVTUMesh
+
+#endif // pylith_meshio_testdatawritervtumesh_hh
+
+
+// End of file 
@@ -0,0 +1,260 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestMeshIOBinary.hh" // Implementation of class methods
+
+#include "pylith/meshio/MeshIOBinary.hh"
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include "data/MeshData1D.hh"
+#include "data/MeshData1Din2D.hh"
+#include "data/MeshData1Din3D.hh"
+#include "data/MeshData2D.hh"
+#include "data/MeshData2Din3D.hh"
+#include "data/MeshData3D.hh"
+#include "data/MeshData3DIndexOne.hh"
+
+#include <strings.h> // USES strcasecmp()
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestMeshIOBinary );
+
+// ----------------------------------------------------------------------
+// Test constructor
+void
+pylith::meshio::TestMeshIOBinary::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOBinary iohandler;
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test debug()
+void
+pylith::meshio::TestMeshIOBinary::testDebug(void)
+{ // testDebug
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOBinary iohandler;
+  _testDebug(iohandler);
+
+  PYLITH_METHOD_END;
+} // testDebug
+
+// ----------------------------------------------------------------------
+// Test interpolate()
+void
+pylith::meshio::TestMeshIOBinary::testInterpolate(void)
+{ // testInterpolate
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOBinary iohandler;
+  _testInterpolate(iohandler);
+
+  PYLITH_METHOD_END;
+} // testInterpolate
+
+// ----------------------------------------------------------------------
+// Test filename()
+void
+pylith::meshio::TestMeshIOBinary::testFilename(void)
+{ // testFilename
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOBinary iohandler;
+
+  const char* filename = "hi.pbm";
+  iohandler.filename(filename);
+  CPPUNIT_ASSERT(0 == strcasecmp(filename, iohandler.filename()));
+
+  PYLITH_METHOD_END;
+} // testFilename
+
+// ----------------------------------------------------------------------
+// Test write() and read() for 1D mesh.
+void
+pylith::meshio::TestMeshIOBinary::testWriteRead1D(void)
+{ // testWriteRead1D
+  PYLITH_METHOD_BEGIN;
+
+  MeshData1D data;
+  const char* filename = "mesh1D.pbm";
+  _testWriteRead(data, filename);
+
+  PYLITH_METHOD_END;
+} // testWriteRead1D
+
+// ----------------------------------------------------------------------
+// Test write() and read() for 1D mesh in 2D space.
+void
+pylith::meshio::TestMeshIOBinary::testWriteRead1Din2D(void)
+{ // testWriteRead1Din2D
+  PYLITH_METHOD_BEGIN;
+
+  MeshData1Din2D data;
+  const char* filename = "mesh1Din2D.pbm";
+  _testWriteRead(data, filename);
+
+  PYLITH_METHOD_END;
+} // testWriteRead1Din2D
+
+// ----------------------------------------------------------------------
+// Test write() and read() for 1D mesh in 3D space.
+void
+pylith::meshio::TestMeshIOBinary::testWriteRead1Din3D(void)
+{ // testWriteRead1Din3D
+  PYLITH_METHOD_BEGIN;
+
+  MeshData1Din3D data;
+  const char* filename = "mesh1Din3D.pbm";
+  _testWriteRead(data, filename);
+
+  PYLITH_METHOD_END;
+} // testWriteRead1Din3D
+
+// ----------------------------------------------------------------------
+// Test write() and read() for 2D mesh in 2D space.
+void
+pylith::meshio::TestMeshIOBinary::testWriteRead2D(void)
+{ // testWriteRead2D
+  PYLITH_METHOD_BEGIN;
+
+  MeshData2D data;
+  const char* filename = "mesh2D.pbm";
+  _testWriteRead(data, filename);
+
+  PYLITH_METHOD_END;
+} // testWriteRead2D
+
+// ----------------------------------------------------------------------
+// Test write() and read() for 2D mesh in 3D space.
+void
+pylith::meshio::TestMeshIOBinary::testWriteRead2Din3D(void)
+{ // testWriteRead2Din3D
+  PYLITH_METHOD_BEGIN;
+
+  MeshData2Din3D data;
+  const char* filename = "mesh2Din3D.pbm";
+  _testWriteRead(data, filename);
+
+  PYLITH_METHOD_END;
+} // testWriteRead2Din3D
+
+// ----------------------------------------------------------------------
+// Test write() and read() for 3D mesh.
+void
+pylith::meshio::TestMeshIOBinary::testWriteRead3D(void)
+{ // testWriteRead3D
+  PYLITH_METHOD_BEGIN;
+
+  MeshData3D data;
+  const char* filename = "mesh3D.pbm";
+  _testWriteRead(data, filename);
+
+  PYLITH_METHOD_END;
+} // testWriteRead3D
+
+// ----------------------------------------------------------------------
+// Test write() and read() for 3D mesh read from ASCII file.
+void
+pylith::meshio::TestMeshIOBinary::testConvertAscii(void)
+{ // testConvertAscii
+  PYLITH_METHOD_BEGIN;
+
+  MeshData3DIndexOne data;
+
+  // Read ASCII mesh
+  MeshIOAscii iohandlerAscii;
+  iohandlerAscii.filename("data/mesh3DIndexOne.txt");
+  delete _mesh; _mesh = new topology::Mesh;
+  iohandlerAscii.read(_mesh);
+
+  spatialdata::geocoords::CSCart cs;
+  cs.setSpaceDim(data.spaceDim);
+  cs.initialize();
+  _mesh->coordsys(&cs);
+
+  // Write and read binary mesh
+  MeshIOBinary iohandler;
+  iohandler.filename("mesh3DIndexOne.pbm");
+  iohandler.write(_mesh);
+  delete _mesh; _mesh = new topology::Mesh;
+  iohandler.read(_mesh);
+
+  // Make sure mesh matches data
+  _checkVals(data);
+
+  PYLITH_METHOD_END;
+} // testConvertAscii
+
+// ----------------------------------------------------------------------
+// Test read() for file that is not a binary mesh file.
+void
+pylith::meshio::TestMeshIOBinary::testReadBadFile(void)
+{ // testReadBadFile
+  PYLITH_METHOD_BEGIN;
+
+  MeshIOBinary iohandler;
+  iohandler.filename("data/mesh2D_comments.txt");
+  delete _mesh; _mesh = new topology::Mesh;
+  CPPUNIT_ASSERT_THROW(iohandler.read(_mesh), std::runtime_error);
+
+  iohandler.filename("data/nonexistent.pbm");
+  delete _mesh; _mesh = new topology::Mesh;
+  CPPUNIT_ASSERT_THROW(iohandler.read(_mesh), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testReadBadFile
+
+// ----------------------------------------------------------------------
+// Build mesh, perform write() and read(), and then check values.
+void
+pylith::meshio::TestMeshIOBinary::_testWriteRead(const MeshData& data,
+						 const char* filename)
+{ // _testWriteRead
+  PYLITH_METHOD_BEGIN;
+
+  _createMesh(data);
+
+  // Write mesh
+  MeshIOBinary iohandler;
+  iohandler.filename(filename);
+  iohandler.write(_mesh);
+
+  // Read mesh
+  delete _mesh; _mesh = new topology::Mesh;
+  iohandler.read(_mesh);
+
+  // Make sure meshIn matches data
+  _checkVals(data);
+
+  PYLITH_METHOD_END;
+} // _testWriteRead
+
+
+// End of file 
@@ -0,0 +1,117 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/meshio/TestMeshIOBinary.hh
+ *
+ * @brief C++ TestMeshIOBinary object
+ *
+ * C++ unit testing for MeshIOBinary.
+ */
+
+#if !defined(pylith_meshio_testmeshiobinary_hh)
+#define pylith_meshio_testmeshiobinary_hh
+
+// Include directives ---------------------------------------------------
+#include "TestMeshIO.hh"
+
+// Forward declarations -------------------------------------------------
+namespace pylith {
+  namespace meshio {
+    class TestMeshIOBinary;
+    class MeshData;
+  } // meshio
+} // pylith
+
+// TestMeshIOBinary -----------------------------------------------------
+class pylith::meshio::TestMeshIOBinary : public TestMeshIO
+{ // class TestMeshIOBinary
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestMeshIOBinary );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testDebug );
+  CPPUNIT_TEST( testInterpolate );
+  CPPUNIT_TEST( testFilename );
+  CPPUNIT_TEST( testWriteRead1D );
+  CPPUNIT_TEST( testWriteRead1Din2D );
+  CPPUNIT_TEST( testWriteRead1Din3D );
+  CPPUNIT_TEST( testWriteRead2D );
+  CPPUNIT_TEST( testWriteRead2Din3D );
+  CPPUNIT_TEST( testWriteRead3D );
+  CPPUNIT_TEST( testConvertAscii );
+  CPPUNIT_TEST( testReadBadFile );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test constructor
+  void testConstructor(void);
+
+  /// Test debug()
+  void testDebug(void);
+
+  /// Test interpolate()
+  void testInterpolate(void);
+
+  /// Test filename()
+  void testFilename(void);
+
+  /// Test write() and read() for 1D mesh in 1D space.
+  void testWriteRead1D(void);
+
+  /// Test write() and read() for 1D mesh in 2D space.
+  void testWriteRead1Din2D(void);
+
+  /// Test write() and read() for 1D mesh in 3D space.
+  void testWriteRead1Din3D(void);
+
+  /// Test write() and read() for 2D mesh in 2D space.
+  void testWriteRead2D(void);
+
+  /// Test write() and read() for 2D mesh in 3D space.
+  void testWriteRead2Din3D(void);
+
+  /// Test write() and read() for 3D mesh in 3D space.
+  void testWriteRead3D(void);
+
+  /// Test write() and read() for 3D mesh read from ASCII file.
+  void testConvertAscii(void);
+
+  /// Test read() for file that is not a binary mesh file.
+  void testReadBadFile(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Build mesh, perform write() and read(), and then check values.
+   *
+   * @param data Mesh data
+   * @param filename Name of mesh file to write/read
+   */
+  void _testWriteRead(const MeshData& data,
+		      const char* filename);
+
+}; // class TestMeshIOBinary
+
+#endif // pylith_meshio_testmeshiobinary_hh
+
+// End of file 
@@ -38,6 +38,7 @@
 #include "spatialdata/geocoords/CSCart.hh" // USES CSCart
 
 #include <math.h> // USES sqrt()
+#include <algorithm> // USES std::max()
 
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestOutputManager );
@@ -400,5 +401,70 @@ pylith::meshio::TestOutputManager::testAppendCellField(void)
   PYLITH_METHOD_END;
 } // testAppendCellField
 
+// ----------------------------------------------------------------------
+// Test fieldMaxMagnitude() and fieldNorm().
+void
+pylith::meshio::TestOutputManager::testFieldMetrics(void)
+{ // testFieldMetrics
+  PYLITH_METHOD_BEGIN;
+
+  const char* meshFilename = "data/tri3.mesh";
+  const int fiberDim = 2;
+  const int nvertices = 4;
+  const PylithScalar fieldValues[] = {
+    1.1, 1.2,
+    2.1, 2.2,
+    3.1, -3.2,
+    -4.1, 4.2
+  };
+  const PylithScalar scale = 2.0;
+
+  topology::Mesh mesh;
+  MeshIOAscii iohandler;
+  iohandler.filename(meshFilename);
+  iohandler.read(&mesh);
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);  
+  topology::Stratum verticesStratum(dmMesh, topology::Stratum::DEPTH, 0);
+  const PetscInt vStart = verticesStratum.begin();
+  const PetscInt vEnd = verticesStratum.end();
+  CPPUNIT_ASSERT_EQUAL(nvertices, vEnd-vStart);
+
+  topology::Field field(mesh);
+  field.newSection(topology::FieldBase::VERTICES_FIELD, fiberDim);
+  field.allocate();
+  field.label("field data");
+  field.vectorFieldType(topology::FieldBase::VECTOR);
+  field.scale(scale);
+
+  topology::VecVisitorMesh fieldVisitor(field);
+  PetscScalar* fieldArray = fieldVisitor.localArray();CPPUNIT_ASSERT(fieldArray);
+  for(PetscInt v = vStart, index=0; v < vEnd; ++v) {
+    const PetscInt off = fieldVisitor.sectionOffset(v);
+    for(PetscInt d = 0; d < fiberDim; ++d, ++index) {
+      fieldArray[off+d] = fieldValues[index]/scale;
+    } // for
+  } // for
+
+  PylithScalar maxMagE = 0.0;
+  PylithScalar normE = 0.0;
+  for (int i=0; i < nvertices; ++i) {
+    PylithScalar magSq = 0.0;
+    for (int d=0; d < fiberDim; ++d) {
+      magSq += fieldValues[i*fiberDim+d]*fieldValues[i*fiberDim+d];
+    } // for
+    maxMagE = std::max(maxMagE, sqrt(magSq));
+    normE += magSq;
+  } // for
+  normE = sqrt(normE);
+
+  OutputManager manager;
+  const PylithScalar tolerance = 1.0e-6;
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, manager.fieldMaxMagnitude(field)/maxMagE, tolerance);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(1.0, manager.fieldNorm(field)/normE, tolerance);
+
+  PYLITH_METHOD_END;
+} // testFieldMetrics
+
 
 // End of file 
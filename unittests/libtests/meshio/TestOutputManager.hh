@@ -52,6 +52,7 @@ class pylith::meshio::TestOutputManager : public CppUnit::TestFixture
   CPPUNIT_TEST( testOpenCloseTimeStep );
   CPPUNIT_TEST( testAppendVertexField );
   CPPUNIT_TEST( testAppendCellField );
+  CPPUNIT_TEST( testFieldMetrics );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -85,6 +86,9 @@ public :
   /// Test appendCellField().
   void testAppendCellField(void);
 
+  /// Test fieldMaxMagnitude() and fieldNorm().
+  void testFieldMetrics(void);
+
 }; // class TestOutputManager
 
 #endif // pylith_meshio_testoutputmanager_hh
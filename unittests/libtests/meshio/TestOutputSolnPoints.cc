@@ -38,6 +38,7 @@
 #include "data/OutputSolnPointsDataHex8.hh"
 
 #include <string.h> // USES strcmp()
+#include <stdexcept> // USES std::runtime_error
 
 // ----------------------------------------------------------------------
 CPPUNIT_TEST_SUITE_REGISTRATION( pylith::meshio::TestOutputSolnPoints );
@@ -55,6 +56,27 @@ pylith::meshio::TestOutputSolnPoints::testConstructor(void)
 } // testConstructor
 
 
+// ----------------------------------------------------------------------
+// Test bufferSteps().
+void
+pylith::meshio::TestOutputSolnPoints::testBufferSteps(void)
+{ // testBufferSteps
+    PYLITH_METHOD_BEGIN;
+
+    OutputSolnPoints output;
+    CPPUNIT_ASSERT_EQUAL(1, output.bufferSteps());
+
+    const int value = 20;
+    output.bufferSteps(value);
+    CPPUNIT_ASSERT_EQUAL(value, output.bufferSteps());
+
+    CPPUNIT_ASSERT_THROW(output.bufferSteps(0), std::runtime_error);
+    CPPUNIT_ASSERT_EQUAL(value, output.bufferSteps());
+
+    PYLITH_METHOD_END;
+} // testBufferSteps
+
+
 // ----------------------------------------------------------------------
 // Test setupInterpolator for tri3 mesh.
 void
@@ -48,6 +48,7 @@ class pylith::meshio::TestOutputSolnPoints : public CppUnit::TestFixture
     CPPUNIT_TEST_SUITE( TestOutputSolnPoints );
     
     CPPUNIT_TEST( testConstructor );
+    CPPUNIT_TEST( testBufferSteps );
     
     CPPUNIT_TEST( testSetupInterpolatorTri3 );
     CPPUNIT_TEST( testInterpolateTri3 );
@@ -69,6 +70,9 @@ public :
   /// Test constructor
   void testConstructor(void);
 
+  /// Test bufferSteps().
+  void testBufferSteps(void);
+
   /// Test setupInterpolator for tri3 mesh.
   void testSetupInterpolatorTri3(void);
 
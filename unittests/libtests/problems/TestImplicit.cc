@@ -0,0 +1,324 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestImplicit.hh" // Implementation of class methods
+
+#include "pylith/problems/Implicit.hh" // USES Implicit
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/SolutionFields.hh" // USES SolutionFields
+#include "pylith/topology/VisitorMesh.hh" // USES VecVisitorMesh
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include "spatialdata/geocoords/CSCart.hh" // USES CSCart
+
+#include <stdexcept> // USES std::runtime_error
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::problems::TestImplicit );
+
+// ----------------------------------------------------------------------
+namespace pylith {
+  namespace problems {
+    namespace _TestImplicit {
+      // Mesh with two triangular cells.
+      const int cellDim = 2;
+      const int numCells = 2;
+      const int numVertices = 4;
+      const int numCorners = 3;
+      const int cells[numCells*numCorners] = {
+	0, 1, 2,
+	1, 3, 2,
+      };
+      const int spaceDim = 2;
+      const double vertices[numVertices*spaceDim] = {
+	-1.0,  0.0,
+	 0.0, -1.0,
+	 0.0,  1.0,
+	 1.0,  0.0,
+      };
+
+      // Constrained DOF (index of vertex, component) and value of
+      // displacement increment prescribed in it.
+      const int vertexBC = 1;
+      const PetscInt dofBC = 1;
+      const PylithScalar valueBC = 4.0;
+
+      // Coefficients of u(t) = a*t + b*t**2 in local DOF i.
+      PylithScalar coefA(const int i) {
+	return 1.0 + 0.1*i;
+      } // coefA
+      PylithScalar coefB(const int i) {
+	return 0.5 - 0.2*i;
+      } // coefB
+    } // _TestImplicit
+  } // problems
+} // pylith
+
+// ----------------------------------------------------------------------
+// Test predictorOrder().
+void
+pylith::problems::TestImplicit::testPredictorOrder(void)
+{ // testPredictorOrder
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fields);
+
+  Implicit formulation;
+  formulation._fields = &fields;
+
+  CPPUNIT_ASSERT_THROW(formulation.predictorOrder(-1), std::runtime_error);
+  CPPUNIT_ASSERT_THROW(formulation.predictorOrder(3), std::runtime_error);
+
+  // Zero initial guess without predictor.
+  formulation.predictorOrder(0);
+  _setDispIncr(&fields, 0.0, 0.2, false);
+  formulation.saveDispIncr(0.2);
+  _setDispIncrBC(&fields);
+  formulation.predictDispIncr(0.3);
+  CPPUNIT_ASSERT(!formulation.nonzeroInitialGuess());
+
+  // No prediction until an increment has been saved.
+  formulation.predictorOrder(1);
+  formulation.predictDispIncr(0.3);
+  CPPUNIT_ASSERT(!formulation.nonzeroInitialGuess());
+
+  PYLITH_METHOD_END;
+} // testPredictorOrder
+
+// ----------------------------------------------------------------------
+// Test predictDispIncr() and saveDispIncr() with first order predictor.
+void
+pylith::problems::TestImplicit::testPredictDispIncrFirstOrder(void)
+{ // testPredictDispIncrFirstOrder
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fields);
+
+  Implicit formulation;
+  formulation._fields = &fields;
+  formulation.predictorOrder(1);
+
+  // Previous increment scaled by ratio of time steps is exact for
+  // linear variation in time.
+  _setDispIncr(&fields, 0.0, 0.2, false);
+  formulation.saveDispIncr(0.2);
+  _setDispIncrBC(&fields);
+  formulation.predictDispIncr(0.3);
+  CPPUNIT_ASSERT(formulation.nonzeroInitialGuess());
+  _checkPrediction(&fields, 0.2, 0.5, false);
+
+  // Second order predictor falls back to first order with only one
+  // saved increment.
+  formulation.predictorOrder(2);
+  _setDispIncrBC(&fields);
+  formulation.predictDispIncr(0.1);
+  CPPUNIT_ASSERT(formulation.nonzeroInitialGuess());
+  _checkPrediction(&fields, 0.2, 0.3, false);
+
+  // Saving the increment resets the flag for the initial guess.
+  _setDispIncr(&fields, 0.2, 0.3, false);
+  formulation.saveDispIncr(0.1);
+  CPPUNIT_ASSERT(!formulation.nonzeroInitialGuess());
+
+  PYLITH_METHOD_END;
+} // testPredictDispIncrFirstOrder
+
+// ----------------------------------------------------------------------
+// Test predictDispIncr() and saveDispIncr() with second order predictor.
+void
+pylith::problems::TestImplicit::testPredictDispIncrSecondOrder(void)
+{ // testPredictDispIncrSecondOrder
+  PYLITH_METHOD_BEGIN;
+
+  topology::Mesh mesh;
+  topology::SolutionFields fields(mesh);
+  _initialize(&mesh, &fields);
+
+  Implicit formulation;
+  formulation._fields = &fields;
+  formulation.predictorOrder(2);
+
+  // Linear extrapolation of the rate is exact for quadratic variation
+  // in time, including when the time step changes every step.
+  _setDispIncr(&fields, 0.0, 0.2, true);
+  formulation.saveDispIncr(0.2);
+  _setDispIncr(&fields, 0.2, 0.5, true);
+  formulation.saveDispIncr(0.3);
+  _setDispIncrBC(&fields);
+  formulation.predictDispIncr(0.1);
+  CPPUNIT_ASSERT(formulation.nonzeroInitialGuess());
+  _checkPrediction(&fields, 0.5, 0.6, true);
+
+  // Oldest increment is dropped.
+  _setDispIncr(&fields, 0.5, 0.6, true);
+  formulation.saveDispIncr(0.1);
+  _setDispIncrBC(&fields);
+  formulation.predictDispIncr(0.4);
+  CPPUNIT_ASSERT(formulation.nonzeroInitialGuess());
+  _checkPrediction(&fields, 0.6, 1.0, true);
+
+  PYLITH_METHOD_END;
+} // testPredictDispIncrSecondOrder
+
+// ----------------------------------------------------------------------
+// Setup mesh and displacement increment field with one constrained DOF.
+void
+pylith::problems::TestImplicit::_initialize(topology::Mesh* mesh,
+					    topology::SolutionFields* fields) const
+{ // _initialize
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(mesh);
+  CPPUNIT_ASSERT(fields);
+
+  PetscDM dmMesh = NULL;
+  const PetscBool interpolate = PETSC_FALSE;
+  PetscErrorCode err = 0;
+  err = DMPlexCreateFromCellList(PETSC_COMM_WORLD, _TestImplicit::cellDim, _TestImplicit::numCells, _TestImplicit::numVertices, _TestImplicit::numCorners, interpolate, _TestImplicit::cells, _TestImplicit::spaceDim, _TestImplicit::vertices, &dmMesh);CPPUNIT_ASSERT(!err);
+  mesh->dmMesh(dmMesh);
+
+  spatialdata::geocoords::CSCart cs;
+  cs.setSpaceDim(_TestImplicit::spaceDim);
+  cs.initialize();
+  mesh->coordsys(&cs);
+
+  PetscInt vStart = 0, vEnd = 0;
+  err = DMPlexGetDepthStratum(dmMesh, 0, &vStart, &vEnd);CPPUNIT_ASSERT(!err);
+  const PetscInt vertexBC = vStart + _TestImplicit::vertexBC;
+
+  fields->add("dispIncr(t->t+dt)", "displacement_increment");
+  fields->solutionName("dispIncr(t->t+dt)");
+  topology::Field& dispIncr = fields->get("dispIncr(t->t+dt)");
+  dispIncr.newSection(topology::FieldBase::VERTICES_FIELD, _TestImplicit::spaceDim);
+  err = PetscSectionAddConstraintDof(dispIncr.localSection(), vertexBC, 1);CPPUNIT_ASSERT(!err);
+  dispIncr.allocate();
+  err = PetscSectionSetConstraintIndices(dispIncr.localSection(), vertexBC, &_TestImplicit::dofBC);CPPUNIT_ASSERT(!err);
+  dispIncr.zeroAll();
+  dispIncr.createScatter(*mesh);
+
+  PYLITH_METHOD_END;
+} // _initialize
+
+// ----------------------------------------------------------------------
+// Set displacement increment for u(t) = a*t + b*t**2 over time step.
+void
+pylith::problems::TestImplicit::_setDispIncr(topology::SolutionFields* fields,
+					     const PylithScalar t0,
+					     const PylithScalar t1,
+					     const bool quadratic) const
+{ // _setDispIncr
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(fields);
+
+  PetscVec dispIncrVec = fields->get("dispIncr(t->t+dt)").localVector();CPPUNIT_ASSERT(dispIncrVec);
+  PetscInt size = 0;
+  PetscErrorCode err = VecGetLocalSize(dispIncrVec, &size);CPPUNIT_ASSERT(!err);
+  PetscScalar* dispIncrArray = NULL;
+  err = VecGetArray(dispIncrVec, &dispIncrArray);CPPUNIT_ASSERT(!err);
+  for (PetscInt i=0; i < size; ++i) {
+    const PylithScalar b = (quadratic) ? _TestImplicit::coefB(i) : 0.0;
+    dispIncrArray[i] = _TestImplicit::coefA(i)*(t1-t0) + b*(t1*t1-t0*t0);
+  } // for
+  err = VecRestoreArray(dispIncrVec, &dispIncrArray);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // _setDispIncr
+
+// ----------------------------------------------------------------------
+// Set displacement increment to zero except for constrained DOF.
+void
+pylith::problems::TestImplicit::_setDispIncrBC(topology::SolutionFields* fields) const
+{ // _setDispIncrBC
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(fields);
+
+  topology::Field& dispIncr = fields->get("dispIncr(t->t+dt)");
+  dispIncr.zeroAll();
+
+  PetscInt vStart = 0, vEnd = 0;
+  PetscErrorCode err = DMPlexGetDepthStratum(dispIncr.dmMesh(), 0, &vStart, &vEnd);CPPUNIT_ASSERT(!err);
+  topology::VecVisitorMesh dispIncrVisitor(dispIncr);
+  PetscScalar* dispIncrArray = dispIncrVisitor.localArray();CPPUNIT_ASSERT(dispIncrArray);
+  const PetscInt off = dispIncrVisitor.sectionOffset(vStart + _TestImplicit::vertexBC);
+  dispIncrArray[off+_TestImplicit::dofBC] = _TestImplicit::valueBC;
+
+  PYLITH_METHOD_END;
+} // _setDispIncrBC
+
+// ----------------------------------------------------------------------
+// Check prediction against displacement increment for u(t) = a*t + b*t**2.
+void
+pylith::problems::TestImplicit::_checkPrediction(topology::SolutionFields* fields,
+						 const PylithScalar t0,
+						 const PylithScalar t1,
+						 const bool quadratic) const
+{ // _checkPrediction
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(fields);
+
+  topology::Field& dispIncr = fields->get("dispIncr(t->t+dt)");
+  PetscInt vStart = 0, vEnd = 0;
+  PetscErrorCode err = DMPlexGetDepthStratum(dispIncr.dmMesh(), 0, &vStart, &vEnd);CPPUNIT_ASSERT(!err);
+  PetscInt offBC = 0;
+  err = PetscSectionGetOffset(dispIncr.localSection(), vStart + _TestImplicit::vertexBC, &offBC);CPPUNIT_ASSERT(!err);
+  offBC += _TestImplicit::dofBC;
+
+  PetscVec dispIncrVec = dispIncr.localVector();CPPUNIT_ASSERT(dispIncrVec);
+  PetscInt size = 0;
+  err = VecGetLocalSize(dispIncrVec, &size);CPPUNIT_ASSERT(!err);
+
+  const PylithScalar tolerance = 1.0e-06;
+
+  // Local values still hold only the Dirichlet increment.
+  const PetscScalar* dispIncrArray = NULL;
+  err = VecGetArrayRead(dispIncrVec, &dispIncrArray);CPPUNIT_ASSERT(!err);
+  for (PetscInt i=0; i < size; ++i) {
+    const PylithScalar valueE = (i == offBC) ? _TestImplicit::valueBC : 0.0;
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, dispIncrArray[i], tolerance);
+  } // for
+  err = VecRestoreArrayRead(dispIncrVec, &dispIncrArray);CPPUNIT_ASSERT(!err);
+
+  // Initial guess for solver (global vector) combined with constrained
+  // DOF keeps the Dirichlet increment and holds the exact increment in
+  // the other DOF.
+  dispIncr.scatterGlobalToLocal();
+  err = VecGetArrayRead(dispIncrVec, &dispIncrArray);CPPUNIT_ASSERT(!err);
+  for (PetscInt i=0; i < size; ++i) {
+    const PylithScalar b = (quadratic) ? _TestImplicit::coefB(i) : 0.0;
+    const PylithScalar valueE = (i == offBC) ? _TestImplicit::valueBC : _TestImplicit::coefA(i)*(t1-t0) + b*(t1*t1-t0*t0);
+    CPPUNIT_ASSERT_DOUBLES_EQUAL(valueE, dispIncrArray[i], tolerance);
+  } // for
+  err = VecRestoreArrayRead(dispIncrVec, &dispIncrArray);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // _checkPrediction
+
+
+// End of file 
@@ -0,0 +1,118 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/problems/TestImplicit.hh
+ *
+ * @brief C++ TestImplicit object
+ *
+ * C++ unit testing for Implicit.
+ */
+
+#if !defined(pylith_problems_testimplicit_hh)
+#define pylith_problems_testimplicit_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh" // USES Mesh, SolutionFields
+#include "pylith/utils/types.hh" // USES PylithScalar
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace problems {
+    class TestImplicit;
+  } // problems
+} // pylith
+
+/// C++ unit testing for Implicit
+class pylith::problems::TestImplicit : public CppUnit::TestFixture
+{ // class TestImplicit
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestImplicit );
+
+  CPPUNIT_TEST( testPredictorOrder );
+  CPPUNIT_TEST( testPredictDispIncrFirstOrder );
+  CPPUNIT_TEST( testPredictDispIncrSecondOrder );
+
+  CPPUNIT_TEST_SUITE_END();
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Test predictorOrder().
+  void testPredictorOrder(void);
+
+  /// Test predictDispIncr() and saveDispIncr() with first order predictor.
+  void testPredictDispIncrFirstOrder(void);
+
+  /// Test predictDispIncr() and saveDispIncr() with second order predictor.
+  void testPredictDispIncrSecondOrder(void);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Setup mesh and displacement increment field with one constrained
+   * DOF.
+   *
+   * @param mesh Finite-element mesh (output).
+   * @param fields Solution fields (output).
+   */
+  void _initialize(topology::Mesh* mesh,
+		   topology::SolutionFields* fields) const;
+
+  /** Set displacement increment for u(t) = a*t + b*t**2 over time
+   * step from t0 to t1 in all DOF.
+   *
+   * @param fields Solution fields.
+   * @param t0 Time at beginning of time step.
+   * @param t1 Time at end of time step.
+   * @param quadratic True if b is nonzero, false otherwise.
+   */
+  void _setDispIncr(topology::SolutionFields* fields,
+		    const PylithScalar t0,
+		    const PylithScalar t1,
+		    const bool quadratic) const;
+
+  /** Set displacement increment to zero except for value in
+   * constrained DOF, as done when prescribing Dirichlet boundary
+   * conditions.
+   *
+   * @param fields Solution fields.
+   */
+  void _setDispIncrBC(topology::SolutionFields* fields) const;
+
+  /** Check prediction against displacement increment for u(t) = a*t +
+   * b*t**2.
+   *
+   * @param fields Solution fields.
+   * @param t0 Time at beginning of time step.
+   * @param t1 Time at end of time step.
+   * @param quadratic True if b is nonzero, false otherwise.
+   */
+  void _checkPrediction(topology::SolutionFields* fields,
+			const PylithScalar t0,
+			const PylithScalar t1,
+			const bool quadratic) const;
+
+}; // class TestImplicit
+
+#endif // pylith_problems_testimplicit_hh
+
+
+// End of file 
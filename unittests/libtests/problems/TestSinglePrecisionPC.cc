@@ -0,0 +1,294 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestSinglePrecisionPC.hh" // Implementation of class methods
+
+#include "pylith/problems/SinglePrecisionPC.hh" // USES SinglePrecisionPC
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <petscpc.h> // USES PetscPC
+
+#include <cmath> // USES sin()
+#include <algorithm> // USES std::min(), std::max()
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::problems::TestSinglePrecisionPC );
+
+// ----------------------------------------------------------------------
+// Test constructor.
+void
+pylith::problems::TestSinglePrecisionPC::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  SinglePrecisionPC pc;
+  CPPUNIT_ASSERT_EQUAL(PetscInt(0), pc.numNonzeros());
+  CPPUNIT_ASSERT_EQUAL(size_t(0), pc.memoryUsed());
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test initialize().
+void
+pylith::problems::TestSinglePrecisionPC::testInitialize(void)
+{ // testInitialize
+  PYLITH_METHOD_BEGIN;
+
+  PetscErrorCode err = 0;
+  PetscPC pc = NULL;
+  err = PCCreate(PETSC_COMM_SELF, &pc);CPPUNIT_ASSERT(!err);
+
+  SinglePrecisionPC spc;
+  spc.initialize(pc);
+  CPPUNIT_ASSERT(pc == spc._pc);
+
+  PetscBool isShell = PETSC_FALSE;
+  err = PetscObjectTypeCompare((PetscObject) pc, PCSHELL, &isShell);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT(isShell);
+
+  void* context = NULL;
+  err = PCShellGetContext(pc, &context);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT(context == (void*) &spc);
+
+  err = PCDestroy(&pc);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // testInitialize
+
+// ----------------------------------------------------------------------
+// Test _factor() and _apply() with AIJ matrix against PCILU.
+void
+pylith::problems::TestSinglePrecisionPC::testApplyAIJ(void)
+{ // testApplyAIJ
+  PYLITH_METHOD_BEGIN;
+
+  PetscMat mat = NULL;
+  _createMatrix(&mat, 1, false);
+  _checkApply(mat, mat);
+
+  PetscErrorCode err = MatDestroy(&mat);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // testApplyAIJ
+
+// ----------------------------------------------------------------------
+// Test _factor() and _apply() with BAIJ matrix against PCILU.
+void
+pylith::problems::TestSinglePrecisionPC::testApplyBAIJ(void)
+{ // testApplyBAIJ
+  PYLITH_METHOD_BEGIN;
+
+  const int blockSize = 3;
+  PetscMat matAIJ = NULL;
+  _createMatrix(&matAIJ, blockSize, false);
+
+  PetscErrorCode err = 0;
+  PetscMat mat = NULL;
+  err = MatConvert(matAIJ, MATSEQBAIJ, MAT_INITIAL_MATRIX, &mat);CPPUNIT_ASSERT(!err);
+
+  // ILU(0) of the point and block factorizations are the same, since
+  // the blocks are dense.
+  _checkApply(mat, mat);
+  _checkApply(mat, matAIJ);
+
+  err = MatDestroy(&mat);CPPUNIT_ASSERT(!err);
+  err = MatDestroy(&matAIJ);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // testApplyBAIJ
+
+// ----------------------------------------------------------------------
+// Test _factor() and _apply() with SBAIJ matrix against PCILU.
+void
+pylith::problems::TestSinglePrecisionPC::testApplySBAIJ(void)
+{ // testApplySBAIJ
+  PYLITH_METHOD_BEGIN;
+
+  const int blockSize = 3;
+  PetscMat matAIJ = NULL;
+  _createMatrix(&matAIJ, blockSize, true);
+
+  PetscErrorCode err = 0;
+  PetscMat mat = NULL;
+  err = MatConvert(matAIJ, MATSEQSBAIJ, MAT_INITIAL_MATRIX, &mat);CPPUNIT_ASSERT(!err);
+
+  // PCILU does not support SBAIJ, so compare against the AIJ matrix.
+  _checkApply(mat, matAIJ);
+
+  err = MatDestroy(&mat);CPPUNIT_ASSERT(!err);
+  err = MatDestroy(&matAIJ);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // testApplySBAIJ
+
+// ----------------------------------------------------------------------
+// Test _factor() with zero diagonal entry.
+void
+pylith::problems::TestSinglePrecisionPC::testZeroPivot(void)
+{ // testZeroPivot
+  PYLITH_METHOD_BEGIN;
+
+  // Saddle point system like a Lagrange multiplier constraint, with
+  // no diagonal entry in the second row.
+  const PetscInt n = 2;
+
+  PetscErrorCode err = 0;
+  PetscMat mat = NULL;
+  err = MatCreateSeqAIJ(PETSC_COMM_SELF, n, n, n, NULL, &mat);CPPUNIT_ASSERT(!err);
+  err = MatSetValue(mat, 0, 0, 1.0, INSERT_VALUES);CPPUNIT_ASSERT(!err);
+  err = MatSetValue(mat, 0, 1, 1.0, INSERT_VALUES);CPPUNIT_ASSERT(!err);
+  err = MatSetValue(mat, 1, 0, 1.0, INSERT_VALUES);CPPUNIT_ASSERT(!err);
+  err = MatAssemblyBegin(mat, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+  err = MatAssemblyEnd(mat, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+
+  SinglePrecisionPC spc;
+  err = PetscPushErrorHandler(PetscIgnoreErrorHandler, NULL);CPPUNIT_ASSERT(!err);
+  const PetscErrorCode errFactor = spc._factor(mat);
+  err = PetscPopErrorHandler();CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT_EQUAL(PetscErrorCode(PETSC_ERR_MAT_LU_ZRPVT), errFactor);
+
+  err = MatDestroy(&mat);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // testZeroPivot
+
+// ----------------------------------------------------------------------
+// Create matrix with 5-point stencil of dense blocks on a square grid.
+void
+pylith::problems::TestSinglePrecisionPC::_createMatrix(PetscMat* mat,
+						       const int blockSize,
+						       const bool symmetric)
+{ // _createMatrix
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(mat);
+
+  const int nx = 6;
+  const int numBlocks = nx*nx;
+  const int n = numBlocks*blockSize;
+
+  PetscErrorCode err = 0;
+  err = MatCreate(PETSC_COMM_SELF, mat);CPPUNIT_ASSERT(!err);
+  err = MatSetSizes(*mat, n, n, n, n);CPPUNIT_ASSERT(!err);
+  err = MatSetBlockSize(*mat, blockSize);CPPUNIT_ASSERT(!err);
+  err = MatSetType(*mat, MATSEQAIJ);CPPUNIT_ASSERT(!err);
+  err = MatSeqAIJSetPreallocation(*mat, 5*blockSize, NULL);CPPUNIT_ASSERT(!err);
+
+  // Diagonally dominant, with off-diagonal values that vary so that
+  // the factors differ from the matrix.
+  for (int bi=0; bi < numBlocks; ++bi) {
+    const int x = bi % nx;
+    const int y = bi / nx;
+    const int neighbors[5] = {
+      (y > 0) ? bi-nx : -1,
+      (x > 0) ? bi-1 : -1,
+      bi,
+      (x < nx-1) ? bi+1 : -1,
+      (y < nx-1) ? bi+nx : -1,
+    };
+    for (int iN=0; iN < 5; ++iN) {
+      const int bj = neighbors[iN];
+      if (bj < 0) {
+	continue;
+      } // if
+      for (int r=0; r < blockSize; ++r) {
+	for (int c=0; c < blockSize; ++c) {
+	  const PetscInt row = bi*blockSize + r;
+	  const PetscInt col = bj*blockSize + c;
+	  const PetscInt seed = symmetric ? std::min(row, col) + 3*std::max(row, col) : row + 3*col;
+	  const PetscScalar value = (row == col) ? 4.5 : (-1.0 + 0.3*sin(0.7*seed)) / blockSize;
+	  err = MatSetValue(*mat, row, col, value, INSERT_VALUES);CPPUNIT_ASSERT(!err);
+	} // for
+      } // for
+    } // for
+  } // for
+  err = MatAssemblyBegin(*mat, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+  err = MatAssemblyEnd(*mat, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+  if (symmetric) {
+    err = MatSetOption(*mat, MAT_SYMMETRIC, PETSC_TRUE);CPPUNIT_ASSERT(!err);
+  } // if
+
+  PYLITH_METHOD_END;
+} // _createMatrix
+
+// ----------------------------------------------------------------------
+// Check single precision preconditioner against PCILU.
+void
+pylith::problems::TestSinglePrecisionPC::_checkApply(PetscMat mat,
+						     PetscMat matILU)
+{ // _checkApply
+  PYLITH_METHOD_BEGIN;
+
+  PetscErrorCode err = 0;
+
+  PetscVec b = NULL, y = NULL, yE = NULL;
+  err = MatCreateVecs(matILU, &b, &y);CPPUNIT_ASSERT(!err);
+  err = VecDuplicate(y, &yE);CPPUNIT_ASSERT(!err);
+  PetscInt n = 0;
+  PetscScalar* bArray = NULL;
+  err = VecGetLocalSize(b, &n);CPPUNIT_ASSERT(!err);
+  err = VecGetArray(b, &bArray);CPPUNIT_ASSERT(!err);
+  for (PetscInt i=0; i < n; ++i) {
+    bArray[i] = sin(0.3*i);
+  } // for
+  err = VecRestoreArray(b, &bArray);CPPUNIT_ASSERT(!err);
+
+  PetscPC pc = NULL;
+  SinglePrecisionPC spc;
+  err = PCCreate(PETSC_COMM_SELF, &pc);CPPUNIT_ASSERT(!err);
+  err = PCSetOperators(pc, mat, mat);CPPUNIT_ASSERT(!err);
+  spc.initialize(pc);
+  err = PCSetUp(pc);CPPUNIT_ASSERT(!err);
+  err = PCApply(pc, b, y);CPPUNIT_ASSERT(!err);
+
+  PetscPC pcE = NULL;
+  err = PCCreate(PETSC_COMM_SELF, &pcE);CPPUNIT_ASSERT(!err);
+  err = PCSetType(pcE, PCILU);CPPUNIT_ASSERT(!err);
+  err = PCSetOperators(pcE, matILU, matILU);CPPUNIT_ASSERT(!err);
+  err = PCSetUp(pcE);CPPUNIT_ASSERT(!err);
+  err = PCApply(pcE, b, yE);CPPUNIT_ASSERT(!err);
+
+  // Factors have the structure of the full matrix.
+  MatInfo info;
+  err = MatGetInfo(matILU, MAT_LOCAL, &info);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT_EQUAL(PetscInt(info.nz_used), spc.numNonzeros());
+
+  // Factors are rounded to single precision.
+  const PylithScalar tolerance = 1.0e-5;
+  PylithScalar norm = 0.0, diff = 0.0;
+  err = VecNorm(yE, NORM_INFINITY, &norm);CPPUNIT_ASSERT(!err);
+  err = VecAXPY(y, -1.0, yE);CPPUNIT_ASSERT(!err);
+  err = VecNorm(y, NORM_INFINITY, &diff);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT(norm > 0.0);
+  CPPUNIT_ASSERT_DOUBLES_EQUAL(0.0, diff/norm, tolerance);
+
+  err = PCDestroy(&pcE);CPPUNIT_ASSERT(!err);
+  err = PCDestroy(&pc);CPPUNIT_ASSERT(!err);
+  err = VecDestroy(&yE);CPPUNIT_ASSERT(!err);
+  err = VecDestroy(&y);CPPUNIT_ASSERT(!err);
+  err = VecDestroy(&b);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // _checkApply
+
+
+// End of file
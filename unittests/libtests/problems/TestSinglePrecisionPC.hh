@@ -0,0 +1,105 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/problems/TestSinglePrecisionPC.hh
+ *
+ * @brief C++ TestSinglePrecisionPC object
+ *
+ * C++ unit testing for SinglePrecisionPC.
+ */
+
+#if !defined(pylith_problems_testsingleprecisionpc_hh)
+#define pylith_problems_testsingleprecisionpc_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/utils/petscfwd.h" // USES PetscMat
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace problems {
+    class TestSinglePrecisionPC;
+  } // problems
+} // pylith
+
+/// C++ unit testing for SinglePrecisionPC
+class pylith::problems::TestSinglePrecisionPC : public CppUnit::TestFixture
+{ // class TestSinglePrecisionPC
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestSinglePrecisionPC );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testInitialize );
+  CPPUNIT_TEST( testApplyAIJ );
+  CPPUNIT_TEST( testApplyBAIJ );
+  CPPUNIT_TEST( testApplySBAIJ );
+  CPPUNIT_TEST( testZeroPivot );
+
+  CPPUNIT_TEST_SUITE_END();
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Test constructor.
+  void testConstructor(void);
+
+  /// Test initialize().
+  void testInitialize(void);
+
+  /// Test _factor() and _apply() with AIJ matrix against PCILU.
+  void testApplyAIJ(void);
+
+  /// Test _factor() and _apply() with BAIJ matrix against PCILU.
+  void testApplyBAIJ(void);
+
+  /// Test _factor() and _apply() with SBAIJ matrix against PCILU.
+  void testApplySBAIJ(void);
+
+  /// Test _factor() with zero diagonal entry.
+  void testZeroPivot(void);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Create matrix with 5-point stencil of dense blocks on a square
+   * grid.
+   *
+   * @param mat Matrix (output).
+   * @param blockSize Size of blocks.
+   * @param symmetric True if matrix is symmetric.
+   */
+  void _createMatrix(PetscMat* mat,
+		     const int blockSize,
+		     const bool symmetric);
+
+  /** Check single precision preconditioner against PCILU.
+   *
+   * @param mat Matrix for single precision preconditioner.
+   * @param matILU Matrix for PCILU with same values.
+   */
+  void _checkApply(PetscMat mat,
+		   PetscMat matILU);
+
+}; // class TestSinglePrecisionPC
+
+#endif // pylith_problems_testsingleprecisionpc_hh
+
+
+// End of file
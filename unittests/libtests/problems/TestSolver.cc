@@ -0,0 +1,182 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+#include <portinfo>
+
+#include "TestSolver.hh" // Implementation of class methods
+
+#include "pylith/problems/Solver.hh" // USES Solver
+
+#include "pylith/utils/error.h" // USES PYLITH_METHOD_BEGIN/END
+
+#include <petscksp.h> // USES PetscPC
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::problems::TestSolver );
+
+// ----------------------------------------------------------------------
+// Test _setReuseInterpolation() with GAMG and reformed matrix.
+void
+pylith::problems::TestSolver::testSetReuseInterpolationGAMG(void)
+{ // testSetReuseInterpolationGAMG
+  PYLITH_METHOD_BEGIN;
+
+  PetscMat mat = NULL;
+  _createMatrix(&mat, 400);
+
+  PetscErrorCode err = 0;
+  PetscPC pc = NULL;
+  err = PCCreate(PETSC_COMM_SELF, &pc);CPPUNIT_ASSERT(!err);
+  err = PCSetType(pc, PCGAMG);CPPUNIT_ASSERT(!err);
+  err = PCSetOperators(pc, mat, mat);CPPUNIT_ASSERT(!err);
+  err = PCSetUp(pc);CPPUNIT_ASSERT(!err);
+
+  CPPUNIT_ASSERT(Solver::_setReuseInterpolation(pc));
+
+  PetscInt numLevels = 0;
+  err = PCMGGetLevels(pc, &numLevels);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT(numLevels > 1);
+  PetscMat interp = NULL;
+  PetscObjectState interpState = 0;
+  err = PCMGGetInterpolation(pc, numLevels-1, &interp);CPPUNIT_ASSERT(!err);
+  err = PetscObjectStateGet((PetscObject) interp, &interpState);CPPUNIT_ASSERT(!err);
+
+  // Reform matrix with same nonzero pattern; only the numeric part of
+  // the setup is redone, so the interpolation is not rebuilt.
+  err = MatScale(mat, 2.0);CPPUNIT_ASSERT(!err);
+  err = PCSetOperators(pc, mat, mat);CPPUNIT_ASSERT(!err);
+  err = PCSetUp(pc);CPPUNIT_ASSERT(!err);
+
+  PetscMat interpReform = NULL;
+  PetscObjectState interpStateReform = 0;
+  err = PCMGGetInterpolation(pc, numLevels-1, &interpReform);CPPUNIT_ASSERT(!err);
+  err = PetscObjectStateGet((PetscObject) interpReform, &interpStateReform);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT(interp == interpReform);
+  CPPUNIT_ASSERT_EQUAL(interpState, interpStateReform);
+
+  // Hierarchy is not rebuilt.
+  PetscInt numLevelsReform = 0;
+  err = PCMGGetLevels(pc, &numLevelsReform);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT_EQUAL(numLevels, numLevelsReform);
+
+  err = PCDestroy(&pc);CPPUNIT_ASSERT(!err);
+  err = MatDestroy(&mat);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // testSetReuseInterpolationGAMG
+
+// ----------------------------------------------------------------------
+// Test _setReuseInterpolation() with GAMG nested in field split.
+void
+pylith::problems::TestSolver::testSetReuseInterpolationFieldSplit(void)
+{ // testSetReuseInterpolationFieldSplit
+  PYLITH_METHOD_BEGIN;
+
+  const int size = 40;
+  PetscMat mat = NULL;
+  _createMatrix(&mat, size);
+
+  PetscErrorCode err = 0;
+  PetscIS isFirst = NULL, isSecond = NULL;
+  err = ISCreateStride(PETSC_COMM_SELF, size/2, 0, 1, &isFirst);CPPUNIT_ASSERT(!err);
+  err = ISCreateStride(PETSC_COMM_SELF, size/2, size/2, 1, &isSecond);CPPUNIT_ASSERT(!err);
+
+  PetscPC pc = NULL;
+  err = PCCreate(PETSC_COMM_SELF, &pc);CPPUNIT_ASSERT(!err);
+  err = PCSetType(pc, PCFIELDSPLIT);CPPUNIT_ASSERT(!err);
+  err = PCSetOperators(pc, mat, mat);CPPUNIT_ASSERT(!err);
+  err = PCFieldSplitSetIS(pc, "first", isFirst);CPPUNIT_ASSERT(!err);
+  err = PCFieldSplitSetIS(pc, "second", isSecond);CPPUNIT_ASSERT(!err);
+  err = PCSetUp(pc);CPPUNIT_ASSERT(!err);
+
+  // Default preconditioners for splits are not GAMG.
+  CPPUNIT_ASSERT(!Solver::_setReuseInterpolation(pc));
+
+  PetscKSP* subksps = NULL;
+  PetscInt numSplits = 0;
+  err = PCFieldSplitGetSubKSP(pc, &numSplits, &subksps);CPPUNIT_ASSERT(!err);
+  CPPUNIT_ASSERT_EQUAL(PetscInt(2), numSplits);
+  PetscPC subpc = NULL;
+  err = KSPGetPC(subksps[1], &subpc);CPPUNIT_ASSERT(!err);
+  err = PCSetType(subpc, PCGAMG);CPPUNIT_ASSERT(!err);
+  err = PetscFree(subksps);CPPUNIT_ASSERT(!err);
+
+  CPPUNIT_ASSERT(Solver::_setReuseInterpolation(pc));
+
+  err = PCDestroy(&pc);CPPUNIT_ASSERT(!err);
+  err = ISDestroy(&isFirst);CPPUNIT_ASSERT(!err);
+  err = ISDestroy(&isSecond);CPPUNIT_ASSERT(!err);
+  err = MatDestroy(&mat);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // testSetReuseInterpolationFieldSplit
+
+// ----------------------------------------------------------------------
+// Test _setReuseInterpolation() without GAMG.
+void
+pylith::problems::TestSolver::testSetReuseInterpolationOther(void)
+{ // testSetReuseInterpolationOther
+  PYLITH_METHOD_BEGIN;
+
+  PetscMat mat = NULL;
+  _createMatrix(&mat, 10);
+
+  PetscErrorCode err = 0;
+  PetscPC pc = NULL;
+  err = PCCreate(PETSC_COMM_SELF, &pc);CPPUNIT_ASSERT(!err);
+  err = PCSetType(pc, PCJACOBI);CPPUNIT_ASSERT(!err);
+  err = PCSetOperators(pc, mat, mat);CPPUNIT_ASSERT(!err);
+  err = PCSetUp(pc);CPPUNIT_ASSERT(!err);
+
+  CPPUNIT_ASSERT(!Solver::_setReuseInterpolation(pc));
+
+  err = PCDestroy(&pc);CPPUNIT_ASSERT(!err);
+  err = MatDestroy(&mat);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // testSetReuseInterpolationOther
+
+// ----------------------------------------------------------------------
+// Create matrix for 1-D Laplacian.
+void
+pylith::problems::TestSolver::_createMatrix(PetscMat* mat,
+					    const int size)
+{ // _createMatrix
+  PYLITH_METHOD_BEGIN;
+
+  CPPUNIT_ASSERT(mat);
+
+  PetscErrorCode err = 0;
+  err = MatCreateSeqAIJ(PETSC_COMM_SELF, size, size, 3, NULL, mat);CPPUNIT_ASSERT(!err);
+  for (PetscInt i=0; i < size; ++i) {
+    if (i > 0) {
+      err = MatSetValue(*mat, i, i-1, -1.0, INSERT_VALUES);CPPUNIT_ASSERT(!err);
+    } // if
+    err = MatSetValue(*mat, i, i, 2.0, INSERT_VALUES);CPPUNIT_ASSERT(!err);
+    if (i < size-1) {
+      err = MatSetValue(*mat, i, i+1, -1.0, INSERT_VALUES);CPPUNIT_ASSERT(!err);
+    } // if
+  } // for
+  err = MatAssemblyBegin(*mat, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+  err = MatAssemblyEnd(*mat, MAT_FINAL_ASSEMBLY);CPPUNIT_ASSERT(!err);
+
+  PYLITH_METHOD_END;
+} // _createMatrix
+
+
+// End of file
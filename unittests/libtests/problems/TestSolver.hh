@@ -0,0 +1,82 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/problems/TestSolver.hh
+ *
+ * @brief C++ TestSolver object
+ *
+ * C++ unit testing for Solver.
+ */
+
+#if !defined(pylith_problems_testsolver_hh)
+#define pylith_problems_testsolver_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/utils/petscfwd.h" // USES PetscMat
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace problems {
+    class TestSolver;
+  } // problems
+} // pylith
+
+/// C++ unit testing for Solver
+class pylith::problems::TestSolver : public CppUnit::TestFixture
+{ // class TestSolver
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestSolver );
+
+  CPPUNIT_TEST( testSetReuseInterpolationGAMG );
+  CPPUNIT_TEST( testSetReuseInterpolationFieldSplit );
+  CPPUNIT_TEST( testSetReuseInterpolationOther );
+
+  CPPUNIT_TEST_SUITE_END();
+
+// PUBLIC METHODS ///////////////////////////////////////////////////////
+public :
+
+  /// Test _setReuseInterpolation() with GAMG and reformed matrix.
+  void testSetReuseInterpolationGAMG(void);
+
+  /// Test _setReuseInterpolation() with GAMG nested in field split.
+  void testSetReuseInterpolationFieldSplit(void);
+
+  /// Test _setReuseInterpolation() without GAMG.
+  void testSetReuseInterpolationOther(void);
+
+// PRIVATE METHODS //////////////////////////////////////////////////////
+private :
+
+  /** Create matrix for 1-D Laplacian.
+   *
+   * @param mat Matrix (output).
+   * @param size Number of rows.
+   */
+  void _createMatrix(PetscMat* mat,
+		     const int size);
+
+}; // class TestSolver
+
+#endif // pylith_problems_testsolver_hh
+
+
+// End of file
@@ -0,0 +1,202 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+
+#include <portinfo>
+
+#include "TestMatAssemblyPlan.hh" // Implementation of class methods
+
+#include "pylith/topology/MatAssemblyPlan.hh" // USES MatAssemblyPlan
+
+#include "pylith/topology/Mesh.hh" // USES Mesh
+#include "pylith/topology/Field.hh" // USES Field
+#include "pylith/topology/Jacobian.hh" // USES Jacobian
+#include "pylith/topology/Stratum.hh" // USES Stratum
+#include "pylith/topology/VisitorMesh.hh" // USES MatVisitorMesh
+
+#include "pylith/meshio/MeshIOAscii.hh" // USES MeshIOAscii
+
+#include "pylith/utils/array.hh" // USES scalar_array
+
+#include <vector> // USES std::vector
+
+// ----------------------------------------------------------------------
+CPPUNIT_TEST_SUITE_REGISTRATION( pylith::topology::TestMatAssemblyPlan );
+
+// ----------------------------------------------------------------------
+// Test constructor.
+void
+pylith::topology::TestMatAssemblyPlan::testConstructor(void)
+{ // testConstructor
+  PYLITH_METHOD_BEGIN;
+
+  MatAssemblyPlan plan;
+  CPPUNIT_ASSERT(!plan.isDirect());
+
+  PYLITH_METHOD_END;
+} // testConstructor
+
+// ----------------------------------------------------------------------
+// Test begin(), addClosure(), and end().
+void
+pylith::topology::TestMatAssemblyPlan::testAddClosure(void)
+{ // testAddClosure
+  PYLITH_METHOD_BEGIN;
+
+  _testAssemble(MATSEQAIJ, true);
+
+  PYLITH_METHOD_END;
+} // testAddClosure
+
+// ----------------------------------------------------------------------
+// Test begin(), addClosure(), and end() with block matrix.
+void
+pylith::topology::TestMatAssemblyPlan::testAddClosureBAIJ(void)
+{ // testAddClosureBAIJ
+  PYLITH_METHOD_BEGIN;
+
+  _testAssemble(MATSEQBAIJ, false);
+
+  PYLITH_METHOD_END;
+} // testAddClosureBAIJ
+
+// ----------------------------------------------------------------------
+// Test addClosureSymmetric().
+void
+pylith::topology::TestMatAssemblyPlan::testAddClosureSymmetric(void)
+{ // testAddClosureSymmetric
+  PYLITH_METHOD_BEGIN;
+
+  _testAssemble(MATSEQAIJ, true, true);
+
+  PYLITH_METHOD_END;
+} // testAddClosureSymmetric
+
+// ----------------------------------------------------------------------
+// Test addClosureSymmetric() with symmetric block matrix.
+void
+pylith::topology::TestMatAssemblyPlan::testAddClosureSymmetricSBAIJ(void)
+{ // testAddClosureSymmetricSBAIJ
+  PYLITH_METHOD_BEGIN;
+
+  _testAssemble(MATSEQSBAIJ, false, true);
+
+  PYLITH_METHOD_END;
+} // testAddClosureSymmetricSBAIJ
+
+// ----------------------------------------------------------------------
+// Assemble matrix using plan and MatVisitorMesh and compare.
+void
+pylith::topology::TestMatAssemblyPlan::_testAssemble(const char* matrixType,
+						     const bool isDirect,
+						     const bool isSymmetric) const
+{ // _testAssemble
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  meshio::MeshIOAscii iohandler;
+  iohandler.filename("data/tri3.mesh");
+  iohandler.read(&mesh);
+
+  Field field(mesh);
+  field.newSection(FieldBase::VERTICES_FIELD, mesh.dimension());
+  field.allocate();
+  field.zero();
+
+  Jacobian jacobian(field);
+  jacobian.assemble("final_assembly");
+
+  PetscErrorCode err;
+  PetscMat matPlan = NULL;
+  PetscMat matVisitor = NULL;
+  err = MatConvert(jacobian.matrix(), matrixType, MAT_INITIAL_MATRIX, &matPlan);PYLITH_CHECK_ERROR(err);
+  err = MatConvert(jacobian.matrix(), matrixType, MAT_INITIAL_MATRIX, &matVisitor);PYLITH_CHECK_ERROR(err);
+  if (isSymmetric) {
+    err = MatSetOption(matVisitor, MAT_IGNORE_LOWER_TRIANGULAR, PETSC_TRUE);PYLITH_CHECK_ERROR(err);
+  } // if
+
+  PetscDM dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  Stratum cellsStratum(dmMesh, Stratum::HEIGHT, 0);
+  const PetscInt cStart = cellsStratum.begin();
+  const PetscInt numCells = cellsStratum.size();
+  std::vector<PetscInt> cells(numCells);
+  for (PetscInt c=0; c < numCells; ++c) {
+    cells[c] = cStart + c;
+  } // for
+
+  const int numCorners = 3;
+  const int blockSize = mesh.dimension();
+  const int cellSize = numCorners*blockSize;
+  scalar_array cellMatrix(cellSize*cellSize);
+  scalar_array cellMatrixUpper(cellSize*cellSize);
+
+  MatAssemblyPlan plan;
+  // Second assembly reuses the plan.
+  for (int iAssembly=0; iAssembly < 2; ++iAssembly) {
+    err = MatZeroEntries(matPlan);PYLITH_CHECK_ERROR(err);
+    err = MatZeroEntries(matVisitor);PYLITH_CHECK_ERROR(err);
+
+    MatVisitorMesh visitor(matVisitor, field);
+    plan.begin(matPlan, field, &cells[0], numCells);
+    for (PetscInt c=0; c < numCells; ++c) {
+      for (int i=0; i < cellSize*cellSize; ++i) {
+	cellMatrix[i] = 1.0 + 0.1*i + 0.01*c*(iAssembly+1);
+      } // for
+      if (isSymmetric) {
+	// Symmetric cell matrix; plan only gets blocks on and above
+	// the diagonal (garbage below the diagonal).
+	for (int i=0; i < cellSize; ++i) {
+	  for (int j=0; j < i; ++j) {
+	    cellMatrix[i*cellSize+j] = cellMatrix[j*cellSize+i];
+	  } // for
+	} // for
+	for (int i=0; i < cellSize; ++i) {
+	  for (int j=0; j < cellSize; ++j) {
+	    cellMatrixUpper[i*cellSize+j] = (i/blockSize > j/blockSize) ? 1.0e+20 : cellMatrix[i*cellSize+j];
+	  } // for
+	} // for
+	plan.addClosureSymmetric(&cellMatrixUpper[0], cellMatrixUpper.size(), blockSize, c);
+      } else {
+	plan.addClosure(&cellMatrix[0], cellMatrix.size(), c);
+      } // if/else
+      visitor.setClosure(&cellMatrix[0], cellMatrix.size(), cells[c], ADD_VALUES);
+    } // for
+    plan.end();
+    CPPUNIT_ASSERT_EQUAL(isDirect, plan.isDirect());
+    PetscBool isSBAIJ = PETSC_FALSE;
+    err = PetscObjectTypeCompare((PetscObject) matPlan, MATSEQSBAIJ, &isSBAIJ);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT_EQUAL(bool(isSBAIJ), plan.isSymmetricStorage());
+
+    err = MatAssemblyBegin(matPlan, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(matPlan, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyBegin(matVisitor, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+    err = MatAssemblyEnd(matVisitor, MAT_FINAL_ASSEMBLY);PYLITH_CHECK_ERROR(err);
+
+    PetscBool isEqual = PETSC_FALSE;
+    err = MatEqual(matPlan, matVisitor, &isEqual);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT(isEqual);
+  } // for
+
+  err = MatDestroy(&matPlan);PYLITH_CHECK_ERROR(err);
+  err = MatDestroy(&matVisitor);PYLITH_CHECK_ERROR(err);
+
+  PYLITH_METHOD_END;
+} // _testAssemble
+
+
+// End of file 
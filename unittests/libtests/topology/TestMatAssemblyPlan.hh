@@ -0,0 +1,93 @@
+// -*- C++ -*-
+//
+// ----------------------------------------------------------------------
+//
+// Brad T. Aagaard, U.S. Geological Survey
+// Charles A. Williams, GNS Science
+// Matthew G. Knepley, University of Chicago
+//
+// This code was developed as part of the Computational Infrastructure
+// for Geodynamics (http://geodynamics.org).
+//
+// Copyright (c) 2010-2017 University of California, Davis
+//
+// See COPYING for license information.
+//
+// ----------------------------------------------------------------------
+//
+
+/**
+ * @file unittests/libtests/topology/TestMatAssemblyPlan.hh
+ *
+ * @brief C++ TestMatAssemblyPlan object.
+ * 
+ * C++ unit testing for MatAssemblyPlan.
+ */
+
+#if !defined(pylith_topology_testmatassemblyplan_hh)
+#define pylith_topology_testmatassemblyplan_hh
+
+#include <cppunit/extensions/HelperMacros.h>
+
+#include "pylith/topology/topologyfwd.hh"
+
+/// Namespace for pylith package
+namespace pylith {
+  namespace topology {
+    class TestMatAssemblyPlan;
+  } // topology
+} // pylith
+
+/// C++ unit testing for MatAssemblyPlan.
+class pylith::topology::TestMatAssemblyPlan : public CppUnit::TestFixture
+{ // class TestMatAssemblyPlan
+
+  // CPPUNIT TEST SUITE /////////////////////////////////////////////////
+  CPPUNIT_TEST_SUITE( TestMatAssemblyPlan );
+
+  CPPUNIT_TEST( testConstructor );
+  CPPUNIT_TEST( testAddClosure );
+  CPPUNIT_TEST( testAddClosureBAIJ );
+  CPPUNIT_TEST( testAddClosureSymmetric );
+  CPPUNIT_TEST( testAddClosureSymmetricSBAIJ );
+
+  CPPUNIT_TEST_SUITE_END();
+
+  // PUBLIC METHODS /////////////////////////////////////////////////////
+public :
+
+  /// Test constructor.
+  void testConstructor(void);
+
+  /// Test begin(), addClosure(), and end().
+  void testAddClosure(void);
+
+  /// Test begin(), addClosure(), and end() with block matrix.
+  void testAddClosureBAIJ(void);
+
+  /// Test addClosureSymmetric().
+  void testAddClosureSymmetric(void);
+
+  /// Test addClosureSymmetric() with symmetric block matrix.
+  void testAddClosureSymmetricSBAIJ(void);
+
+  // PRIVATE METHODS ////////////////////////////////////////////////////
+private :
+
+  /** Assemble matrix using plan and MatVisitorMesh and check that
+   * the two matrices match.
+   *
+   * @param matrixType Type of PETSc sparse matrix.
+   * @param isDirect Expected value of isDirect() after first assembly.
+   * @param isSymmetric Use symmetric cell matrices with addClosureSymmetric().
+   */
+  void _testAssemble(const char* matrixType,
+		     const bool isDirect,
+		     const bool isSymmetric =false) const;
+
+}; // class TestMatAssemblyPlan
+
+#endif // pylith_topology_testmatassemblyplan_hh
+
+
+// End of file 
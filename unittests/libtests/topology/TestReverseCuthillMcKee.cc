@@ -130,6 +130,66 @@ pylith::topology::TestReverseCuthillMcKee::testReorderHex8Fault(void)
   PYLITH_METHOD_END;
 } // testReorderHex8Fault
 
+// ----------------------------------------------------------------------
+// Test reorderLocal() with tri3 cells and no fault.
+void
+pylith::topology::TestReverseCuthillMcKee::testReorderLocalTri3(void)
+{ // testReorderLocalTri3
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_tri3.mesh", 0, true);
+
+  PYLITH_METHOD_END;
+} // testReorderLocalTri3
+
+// ----------------------------------------------------------------------
+// Test reorderLocal() with tri3 cells and one fault.
+void
+pylith::topology::TestReverseCuthillMcKee::testReorderLocalTri3Fault(void)
+{ // testReorderLocalTri3Fault
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_tri3.mesh", "fault", true);
+
+  PYLITH_METHOD_END;
+} // testReorderLocalTri3Fault
+
+// ----------------------------------------------------------------------
+// Test reorderLocal() with quad4 cells and one fault.
+void
+pylith::topology::TestReverseCuthillMcKee::testReorderLocalQuad4Fault(void)
+{ // testReorderLocalQuad4Fault
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_quad4.mesh", "fault", true);
+
+  PYLITH_METHOD_END;
+} // testReorderLocalQuad4Fault
+
+// ----------------------------------------------------------------------
+// Test reorderLocal() with tet4 cells and one fault.
+void
+pylith::topology::TestReverseCuthillMcKee::testReorderLocalTet4Fault(void)
+{ // testReorderLocalTet4Fault
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_tet4.mesh", "fault", true);
+
+  PYLITH_METHOD_END;
+} // testReorderLocalTet4Fault
+
+// ----------------------------------------------------------------------
+// Test reorderLocal() with hex8 cells and one fault.
+void
+pylith::topology::TestReverseCuthillMcKee::testReorderLocalHex8Fault(void)
+{ // testReorderLocalHex8Fault
+  PYLITH_METHOD_BEGIN;
+
+  _testReorder("data/reorder_hex8.mesh", "fault", true);
+
+  PYLITH_METHOD_END;
+} // testReorderLocalHex8Fault
+
 // ----------------------------------------------------------------------
 void
 pylith::topology::TestReverseCuthillMcKee::_setupMesh(Mesh* const mesh,
@@ -168,10 +228,11 @@ pylith::topology::TestReverseCuthillMcKee::_setupMesh(Mesh* const mesh,
 } // _setupMesh
 
 // ----------------------------------------------------------------------
-// Test reorder().
+// Test reorder() or reorderLocal().
 void
 pylith::topology::TestReverseCuthillMcKee::_testReorder(const char* filename,
-							const char* faultGroup)
+							const char* faultGroup,
+							const bool local)
 { // _testReorder
   PYLITH_METHOD_BEGIN;
 
@@ -184,9 +245,26 @@ pylith::topology::TestReverseCuthillMcKee::_testReorder(const char* filename,
   Mesh meshOrig;
   meshOrig.dmMesh(dmOrig);
 
-  ReverseCuthillMcKee::reorder(&mesh);
+  if (local) {
+    ReverseCuthillMcKee::reorderLocal(&mesh);
+  } else {
+    ReverseCuthillMcKee::reorder(&mesh);
+  } // if/else
   
   const PetscDM& dmMesh = mesh.dmMesh();CPPUNIT_ASSERT(dmMesh);
+  PetscErrorCode err;
+
+  if (local) {
+    // Check hybrid bounds are unchanged.
+    PetscInt cMaxE, fMaxE, eMaxE, vMaxE;
+    PetscInt cMax, fMax, eMax, vMax;
+    err = DMPlexGetHybridBounds(dmOrig, &cMaxE, &fMaxE, &eMaxE, &vMaxE);PYLITH_CHECK_ERROR(err);
+    err = DMPlexGetHybridBounds(dmMesh, &cMax, &fMax, &eMax, &vMax);PYLITH_CHECK_ERROR(err);
+    CPPUNIT_ASSERT_EQUAL(cMaxE, cMax);
+    CPPUNIT_ASSERT_EQUAL(fMaxE, fMax);
+    CPPUNIT_ASSERT_EQUAL(eMaxE, eMax);
+    CPPUNIT_ASSERT_EQUAL(vMaxE, vMax);
+  } // if
 
   // Check vertices (size only)
   topology::Stratum verticesStratumE(dmOrig, topology::Stratum::DEPTH, 0);
@@ -203,7 +281,6 @@ pylith::topology::TestReverseCuthillMcKee::_testReorder(const char* filename,
 
   // Check groups
   PetscInt numGroupsE, numGroups, pStart, pEnd;
-  PetscErrorCode err;
   err = DMGetNumLabels(dmOrig, &numGroupsE);PYLITH_CHECK_ERROR(err);
   err = DMGetNumLabels(dmMesh, &numGroups);PYLITH_CHECK_ERROR(err);
   CPPUNIT_ASSERT_EQUAL(numGroupsE, numGroups);
@@ -59,6 +59,12 @@ class pylith::topology::TestReverseCuthillMcKee : public CppUnit::TestFixture
   CPPUNIT_TEST( testReorderHex8 );
   CPPUNIT_TEST( testReorderHex8Fault );
 
+  CPPUNIT_TEST( testReorderLocalTri3 );
+  CPPUNIT_TEST( testReorderLocalTri3Fault );
+  CPPUNIT_TEST( testReorderLocalQuad4Fault );
+  CPPUNIT_TEST( testReorderLocalTet4Fault );
+  CPPUNIT_TEST( testReorderLocalHex8Fault );
+
   CPPUNIT_TEST_SUITE_END();
 
   // PUBLIC METHODS /////////////////////////////////////////////////////
@@ -88,6 +94,21 @@ public :
   /// Test reorder() with hex8 cells and one fault.
   void testReorderHex8Fault(void);
 
+  /// Test reorderLocal() with tri3 cells and no fault.
+  void testReorderLocalTri3(void);
+
+  /// Test reorderLocal() with tri3 cells and one fault.
+  void testReorderLocalTri3Fault(void);
+
+  /// Test reorderLocal() with quad4 cells and one fault.
+  void testReorderLocalQuad4Fault(void);
+
+  /// Test reorderLocal() with tet4 cells and one fault.
+  void testReorderLocalTet4Fault(void);
+
+  /// Test reorderLocal() with hex8 cells and one fault.
+  void testReorderLocalHex8Fault(void);
+
 // PRIVATE METHODS //////////////////////////////////////////////////////
 private :
 
@@ -101,13 +122,15 @@ private :
 		  const char* filename,
 		  const char* faultGroup =0);
 
-  /** Test reorder().
+  /** Test reorder() or reorderLocal().
    *
    * @param filename Mesh filename.
    * @param faultGroup Name of fault group.
+   * @param local True to test reorderLocal(), false to test reorder().
    */
   void _testReorder(const char* filename,
-		    const char* faultGroup =0);
+		    const char* faultGroup =0,
+		    const bool local =false);
 
 }; // class TestReverseCuthillMcKee
 
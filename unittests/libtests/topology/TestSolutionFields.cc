@@ -105,6 +105,83 @@ pylith::topology::TestSolutionFields::testSolution(void)
   PYLITH_METHOD_END;
 } // testSolution
 
+// ----------------------------------------------------------------------
+// Test createHistory().
+void
+pylith::topology::TestSolutionFields::testCreateHistory(void)
+{ // testCreateHistory
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _initialize(&mesh);
+  SolutionFields manager(mesh);
+
+  const char* names[] = { "field A", "field B", "field C" };
+  const char* labels[] = { "label A", "label B", "label C" };
+  const int size = 3;
+  for (int i=0; i < size; ++i)
+    manager.add(names[i], labels[i]);
+
+  manager.createHistory(names, size);
+  CPPUNIT_ASSERT_EQUAL(size, int(manager._history.size()));
+  for (int i=0; i < size; ++i) {
+    CPPUNIT_ASSERT_EQUAL(std::string(names[i]), manager._history[i]);
+    CPPUNIT_ASSERT_EQUAL(std::string(labels[i]), manager._historyLabels[i]);
+  } // for
+
+  const char* badNames[] = { "field A", "field D" };
+  CPPUNIT_ASSERT_THROW(manager.createHistory(badNames, 2), std::runtime_error);
+
+  PYLITH_METHOD_END;
+} // testCreateHistory
+
+// ----------------------------------------------------------------------
+// Test shiftHistory().
+void
+pylith::topology::TestSolutionFields::testShiftHistory(void)
+{ // testShiftHistory
+  PYLITH_METHOD_BEGIN;
+
+  Mesh mesh;
+  _initialize(&mesh);
+  SolutionFields manager(mesh);
+
+  const char* names[] = { "field A", "field B", "field C" };
+  const char* labels[] = { "label A", "label B", "label C" };
+  const int size = 3;
+  const int fiberDim = 2;
+  for (int i=0; i < size; ++i)
+    manager.add(names[i], labels[i]);
+  Field& fieldA = manager.get(names[0]);
+  fieldA.newSection(FieldBase::VERTICES_FIELD, fiberDim);
+  fieldA.allocate();
+  manager.copyLayout(names[0]);
+
+  const Field* fieldsOrig[size];
+  for (int i=0; i < size; ++i) {
+    Field& field = manager.get(names[i]);
+    fieldsOrig[i] = &field;
+    PetscErrorCode err = VecSet(field.localVector(), PylithScalar(i+1));CPPUNIT_ASSERT(!err);
+  } // for
+
+  manager.createHistory(names, size);
+  manager.shiftHistory();
+
+  // Storage of oldest field is reused for most recent field.
+  const int orderE[size] = { 2, 0, 1 };
+  for (int i=0; i < size; ++i) {
+    const Field& field = manager.get(names[i]);
+    CPPUNIT_ASSERT(fieldsOrig[orderE[i]] == &field);
+    CPPUNIT_ASSERT_EQUAL(std::string(labels[i]), std::string(field.label()));
+
+    PylithScalar value = 0.0;
+    PetscErrorCode err = VecMax(field.localVector(), NULL, &value);CPPUNIT_ASSERT(!err);
+    CPPUNIT_ASSERT_EQUAL(PylithScalar(orderE[i]+1), value);
+  } // for
+
+  PYLITH_METHOD_END;
+} // testShiftHistory
+
 // ----------------------------------------------------------------------
 void
 pylith::topology::TestSolutionFields::_initialize(Mesh* mesh) const
@@ -48,6 +48,8 @@ class pylith::topology::TestSolutionFields : public CppUnit::TestFixture
   CPPUNIT_TEST( testConstructor );
   CPPUNIT_TEST( testSolutionName );
   CPPUNIT_TEST( testSolution );
+  CPPUNIT_TEST( testCreateHistory );
+  CPPUNIT_TEST( testShiftHistory );
 
   CPPUNIT_TEST_SUITE_END();
 
@@ -63,6 +65,12 @@ public :
   /// Test solution().
   void testSolution(void);
 
+  /// Test createHistory().
+  void testCreateHistory(void);
+
+  /// Test shiftHistory().
+  void testShiftHistory(void);
+
   // PRIVATE METHODS ////////////////////////////////////////////////////
 private :
 
@@ -223,6 +223,53 @@ class TestFaultCohesiveKin(unittest.TestCase):
     return
   
 
+  def test_sourceStats(self):
+    """
+    Test source statistics.
+    """
+    (mesh, fault, fields) = self._initialize()
+
+    self.assertRaises(RuntimeError, fault.initializeSourceStats, -1.0, 0.0)
+    self.assertRaises(RuntimeError, fault.initializeSourceStats, 0.0, -1.0)
+
+    from pylith.faults.SourceStats import SourceStats
+    stats = SourceStats()
+    stats.inventory.filename = "source_stats_%s.txt"
+    stats._configure()
+    stats.initialize(fault, [])
+    self.assertEqual(0, fault.numSourceStats())
+
+    # Step slip at origin time 1.23 s plus slip time: (2.3, 0.1) m at
+    # y=+1 m starting at 2.43 s and (2.4, 0.2) m at y=-1 m starting at
+    # 2.53 s. Each fault vertex has an area of 1.0 m.
+    import math
+    slipA = math.sqrt(2.3**2 + 0.1**2)
+    slipB = math.sqrt(2.4**2 + 0.2**2)
+    dt = 0.1
+    residual = fields.get("residual")
+    for t in [2.4, 2.5]:
+      fault.timeStep(dt)
+      fault.integrateResidual(residual, t+dt, fields)
+      fault.poststep(t, dt, fields)
+
+    # Values are [t, rupture_area, potency, moment, max_slip, max_slip_rate].
+    # No materials, so shear modulus and moment are zero.
+    valuesE = [[2.5, 1.0, slipA, 0.0, slipA, slipA/dt],
+               [2.6, 2.0, slipA+slipB, 0.0, slipB, slipB/dt]]
+    names = ["t", "rupture_area", "potency", "moment", "max_slip", "max_slip_rate"]
+    self.assertEqual(len(valuesE), fault.numSourceStats())
+    for (index, recordE) in enumerate(valuesE):
+      for (name, valueE) in zip(names, recordE):
+        self.assertAlmostEqual(valueE, fault.sourceStat(index, name), 6)
+    self.assertRaises(RuntimeError, fault.sourceStat, 2, "t")
+    self.assertRaises(RuntimeError, fault.sourceStat, 0, "bogus")
+
+    stats.write(fault)
+    self.assertEqual(0, fault.numSourceStats())
+    stats.close()
+    return
+
+
   def test_finalize(self):
     """
     Test finalize().
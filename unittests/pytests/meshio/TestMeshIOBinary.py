@@ -0,0 +1,105 @@
+#!/usr/bin/env python
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ======================================================================
+#
+
+## @file unittests/pytests/meshio/TestMeshIOBinary.py
+
+## @brief Unit testing of Python MeshIOBinary object.
+
+import unittest
+
+from pylith.meshio.MeshIOBinary import MeshIOBinary
+
+# ----------------------------------------------------------------------
+class TestMeshIOBinary(unittest.TestCase):
+  """
+  Unit testing of Python MeshIOBinary object.
+  """
+
+  def test_constructor(self):
+    """
+    Test constructor.
+    """
+    io = MeshIOBinary()
+    return
+
+
+  def test_filename(self):
+    """
+    Test filename().
+    """
+    value = "hi.pbm"
+
+    io = MeshIOBinary()
+    io.filename(value)
+    self.assertEqual(value, io.filename())
+    return
+
+
+  def test_readwrite(self):
+    """
+    Test write() and read() by converting ASCII mesh to binary mesh and
+    back.
+    """
+    filenameIn = "data/mesh2Din3D.txt"
+    filenameBinary = "data/mesh2Din3D_test.pbm"
+    filenameOut = "data/mesh2Din3D_testbinary.txt"
+
+    from spatialdata.geocoords.CSCart import CSCart
+    cs = CSCart()
+    cs._configure()
+
+    from pylith.meshio.MeshIOAscii import MeshIOAscii
+    ioAscii = MeshIOAscii()
+    ioAscii.inventory.filename = filenameIn
+    ioAscii.inventory.coordsys = cs
+    ioAscii._configure()
+    mesh = ioAscii.read(debug=False, interpolate=True)
+
+    io = MeshIOBinary()
+    io.inventory.filename = filenameBinary
+    io.inventory.coordsys = cs
+    io._configure()
+    io.write(mesh)
+    mesh = io.read(debug=False, interpolate=True)
+
+    ioAscii.filename(filenameOut)
+    ioAscii.write(mesh)
+
+    fileE = open(filenameIn, "r")
+    linesE = fileE.readlines()
+    fileE.close()
+    fileT = open(filenameOut, "r")
+    linesT = fileT.readlines()
+    fileT.close()
+
+    self.assertEqual(len(linesE), len(linesT))
+    for (lineE, lineT) in zip(linesE, linesT):
+      self.assertEqual(lineE, lineT)
+    return
+
+
+  def test_factory(self):
+    """
+    Test factory method.
+    """
+    from pylith.meshio.MeshIOBinary import mesh_io
+    io = mesh_io()
+    return
+
+
+# End of file 
@@ -370,6 +370,184 @@ class TestOutputManagerMesh(unittest.TestCase):
     return
 
 
+  def test_checkWriteAdaptive(self):
+    """
+    Test _checkWrite() with adaptive output.
+    """
+    from pyre.units.time import second
+    dataProvider = TestProvider()
+
+    # Check minimum and maximum intervals without triggers.
+    output = OutputManager()
+    output.inventory.writer._configure()
+    output.inventory.outputFreq = "adaptive"
+    output.inventory.minInterval = 1.0*second
+    output.inventory.maxInterval = 3.0*second
+    output._configure()
+    output.preinitialize(dataProvider)
+    output.initialize(self.normalizer)
+    output.vertexDataFields = ["displacement"]
+    t = 0.0
+    dt = 0.5
+    self.assertEqual(True, output._checkWrite(t))
+    self.assertEqual(1, output.numStepsNoWrite(t, dt))
+    t += dt
+    self.assertEqual(False, output._checkWrite(t))
+    t += 2*dt
+    self.assertEqual(False, output._checkWrite(t))
+    t = 3.0
+    self.assertEqual(True, output._checkWrite(t))
+    t += dt
+    self.assertEqual(False, output._checkWrite(t))
+
+    # Check wall clock trigger.
+    output = OutputManager()
+    output.inventory.writer._configure()
+    output.inventory.outputFreq = "adaptive"
+    output.inventory.minInterval = 1.0*second
+    output.inventory.triggerWallTime = 1.0e-9*second
+    output._configure()
+    output.preinitialize(dataProvider)
+    output.initialize(self.normalizer)
+    t = 0.0
+    self.assertEqual(True, output._checkWrite(t))
+    self.assertEqual(False, output._checkWrite(t + 0.5))
+    import time
+    time.sleep(0.01)
+    self.assertEqual(True, output._checkWrite(t + 1.0))
+    return
+
+
+  def test_verifyConfigurationAdaptive(self):
+    """
+    Test verifyConfiguration() with adaptive output.
+    """
+    dataProvider = TestProvider()
+
+    output = OutputManager()
+    output.inventory.writer._configure()
+    output.inventory.outputFreq = "adaptive"
+    output.inventory.triggerNormChange = 0.1
+    output._configure()
+    output.preinitialize(dataProvider)
+    self.assertRaises(ValueError, output.verifyConfiguration, dataProvider.mesh)
+
+    output.inventory.triggerField = "vertex data 1"
+    output.verifyConfiguration(dataProvider.mesh)
+
+    output.inventory.triggerField = "cell data"
+    self.assertRaises(ValueError, output.verifyConfiguration, dataProvider.mesh)
+    return
+
+
+  def test_numStepsNoWrite(self):
+    """
+    Test numStepsNoWrite() and skipSteps().
+    """
+    import sys
+    dataProvider = TestProvider()
+
+    # Without data fields, nothing is written.
+    output = OutputManager()
+    output.inventory.writer._configure()
+    output._configure()
+    output.preinitialize(dataProvider)
+    output.initialize(self.normalizer)
+    self.assertEqual(sys.maxint, output.numStepsNoWrite(0.0, 1.0))
+
+    # Check writing based on number of steps
+    output = OutputManager()
+    output.inventory.writer._configure()
+    output.inventory.outputFreq = "skip"
+    output.inventory.skip = 3
+    output._configure()
+    output.preinitialize(dataProvider)
+    output.initialize(self.normalizer)
+    output.vertexDataFields = ["displacement"]
+    t = 0.0
+    dt = 1.0
+    self.assertEqual(0, output.numStepsNoWrite(t, dt))
+    self.assertEqual(True, output._checkWrite(t))
+    self.assertEqual(3, output.numStepsNoWrite(t, dt))
+    output.skipSteps(3)
+    t += 3*dt
+    self.assertEqual(0, output.numStepsNoWrite(t, dt))
+    self.assertEqual(True, output._checkWrite(t+dt))
+
+    # Check writing based on time
+    output = OutputManager()
+    output.inventory.writer._configure()
+    output._configure()
+    output.preinitialize(dataProvider)
+    output.initialize(self.normalizer)
+    output.vertexDataFields = ["displacement"]
+
+    output.inventory.outputFreq = "time_step"
+    t = 0.0
+    dt = 0.25*output.dtN
+    self.assertEqual(True, output._checkWrite(t))
+    self.assertEqual(3, output.numStepsNoWrite(t, dt))
+    for i in xrange(3):
+      self.assertEqual(False, output._checkWrite(t+(i+1)*dt))
+    self.assertEqual(True, output._checkWrite(t+4*dt))
+    return
+
+
+  def test_mayWrite(self):
+    """
+    Test mayWrite().
+    """
+    dataProvider = TestProvider()
+
+    # Without data fields, nothing is written.
+    output = OutputManager()
+    output.inventory.writer._configure()
+    output._configure()
+    output.preinitialize(dataProvider)
+    output.initialize(self.normalizer)
+    self.assertEqual(False, output.mayWrite(0.0))
+
+    # Check writing based on number of steps
+    output = OutputManager()
+    output.inventory.writer._configure()
+    output.inventory.outputFreq = "skip"
+    output.inventory.skip = 1
+    output._configure()
+    output.preinitialize(dataProvider)
+    output.initialize(self.normalizer)
+    output.vertexDataFields = ["displacement"]
+    t = 0.0
+    dt = 1.0
+    self.assertEqual(True, output.mayWrite(t))
+    self.assertEqual(True, output._checkWrite(t))
+    t += dt
+    self.assertEqual(False, output.mayWrite(t))
+    self.assertEqual(False, output._checkWrite(t))
+    t += dt
+    self.assertEqual(True, output.mayWrite(t))
+    self.assertEqual(True, output.mayWrite(t))
+    self.assertEqual(True, output._checkWrite(t))
+
+    # Check writing based on time
+    output = OutputManager()
+    output.inventory.writer._configure()
+    output._configure()
+    output.preinitialize(dataProvider)
+    output.initialize(self.normalizer)
+    output.vertexDataFields = ["displacement"]
+
+    output.inventory.outputFreq = "time_step"
+    t = 0.0
+    dt = 0.5*output.dtN
+    self.assertEqual(True, output.mayWrite(t))
+    self.assertEqual(True, output._checkWrite(t))
+    self.assertEqual(False, output.mayWrite(t+dt))
+    self.assertEqual(False, output._checkWrite(t+dt))
+    self.assertEqual(True, output.mayWrite(t+2*dt))
+    self.assertEqual(True, output._checkWrite(t+2*dt))
+    return
+
+
   def test_factory(self):
     """
     Test factory method.
@@ -0,0 +1,106 @@
+#!/usr/bin/env python
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ======================================================================
+#
+
+## @file unittests/pytests/meshio/TestOutputSolnPointsHDF5.py
+
+## @brief Unit testing of Python OutputSolnPoints object with HDF5 output.
+
+import unittest
+
+from pylith.meshio.OutputSolnPoints import OutputSolnPoints
+
+# ----------------------------------------------------------------------
+class TestOutputSolnPointsHDF5(unittest.TestCase):
+  """
+  Unit testing of Python OutputSolnPoints object with HDF5 output.
+  """
+
+  def setUp(self):
+    from pylith.meshio.MeshIOAscii import MeshIOAscii
+    iohandler = MeshIOAscii()
+    filename = "data/twohex8.txt"
+    
+    from spatialdata.units.Nondimensional import Nondimensional
+    normalizer = Nondimensional()
+    normalizer._configure()
+
+    from spatialdata.geocoords.CSCart import CSCart
+    iohandler.inventory.filename = filename
+    iohandler.inventory.coordsys = CSCart()
+    iohandler._configure()
+    mesh = iohandler.read(debug=False, interpolate=False)
+
+    from pylith.topology.SolutionFields import SolutionFields
+    fields = SolutionFields(mesh)
+
+    name = "disp(t)"
+    fields.add(name, "displacement")
+    fields.solutionName(name)
+    field = fields.get(name)
+    field.newSection(field.VERTICES_FIELD, mesh.dimension())
+    field.allocate()
+
+    self.mesh = mesh
+    self.fields = fields
+    self.normalizer = normalizer
+    return
+
+
+  def test_writeDataBuffered(self):
+    """
+    Test writeData() with buffered time steps.
+    """
+    from pylith.meshio.DataWriterHDF5 import DataWriterHDF5
+    output = OutputSolnPoints()
+    output.inventory.reader.inventory.filename = "data/points.txt"
+    output.inventory.reader._configure()
+    output.inventory.writer = DataWriterHDF5()
+    output.inventory.writer.inventory.filename = "output_points_buffered.h5"
+    output.inventory.writer._configure()
+    output.inventory.vertexDataFields = ["displacement"]
+    output.inventory.bufferSteps = 3
+    output._configure()
+
+    output.preinitialize()
+    output.initialize(self.mesh, self.normalizer)
+
+    # Number of time steps is not a multiple of the buffer size, so the
+    # last time step is only written when the output is closed.
+    times = [1.0, 2.0, 3.0, 4.0]
+    output.open(totalTime=5.0, numTimeSteps=len(times))
+    for t in times:
+      output.writeData(t, self.fields)
+    output.close()
+
+    from pylith.tests import has_h5py
+    if not has_h5py():
+      return
+    import h5py
+    h5 = h5py.File("output_points_buffered.h5", "r", driver="sec2")
+    timesFile = h5['time'][:].ravel()
+    numStepsDisp = h5['vertex_fields/displacement'].shape[0]
+    h5.close()
+
+    self.assertEqual(len(times), timesFile.shape[0])
+    self.assertEqual(len(times), numStepsDisp)
+    for (tE, t) in zip(times, timesFile):
+      self.assertAlmostEqual(tE, t, 6)
+    return
+
+
+# End of file 
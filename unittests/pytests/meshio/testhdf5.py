@@ -50,6 +50,9 @@ class TestApp(UnitTestApp):
     from TestDataWriterHDF5Ext import TestDataWriterHDF5Ext
     suite.addTest(unittest.makeSuite(TestDataWriterHDF5Ext))
 
+    from TestOutputSolnPointsHDF5 import TestOutputSolnPointsHDF5
+    suite.addTest(unittest.makeSuite(TestOutputSolnPointsHDF5))
+
     from TestXdmf import TestXdmf
     suite.addTest(unittest.makeSuite(TestXdmf))
 
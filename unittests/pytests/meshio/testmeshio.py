@@ -47,6 +47,9 @@ class TestApp(UnitTestApp):
     from TestMeshIOAscii import TestMeshIOAscii
     suite.addTest(unittest.makeSuite(TestMeshIOAscii))
 
+    from TestMeshIOBinary import TestMeshIOBinary
+    suite.addTest(unittest.makeSuite(TestMeshIOBinary))
+
     from TestMeshIOLagrit import TestMeshIOLagrit
     suite.addTest(unittest.makeSuite(TestMeshIOLagrit))
 
@@ -59,6 +62,9 @@ class TestApp(UnitTestApp):
     from TestDataWriterVTK import TestDataWriterVTK
     suite.addTest(unittest.makeSuite(TestDataWriterVTK))
 
+    from TestDataWriterVTU import TestDataWriterVTU
+    suite.addTest(unittest.makeSuite(TestDataWriterVTU))
+
     from TestOutputManagerMesh import TestOutputManagerMesh
     suite.addTest(unittest.makeSuite(TestOutputManagerMesh))
 
@@ -0,0 +1,167 @@
+#!/usr/bin/env python
+#
+# ======================================================================
+#
+# Brad T. Aagaard, U.S. Geological Survey
+# Charles A. Williams, GNS Science
+# Matthew G. Knepley, University of Chicago
+#
+# This code was developed as part of the Computational Infrastructure
+# for Geodynamics (http://geodynamics.org).
+#
+# Copyright (c) 2010-2017 University of California, Davis
+#
+# See COPYING for license information.
+#
+# ======================================================================
+#
+
+## @file unittests/pytests/problems/TestStepTelemetry.py
+
+## @brief Unit testing of StepTelemetry object.
+
+import unittest
+from pylith.problems.StepTelemetry import StepTelemetry
+
+from pyre.units.time import year
+
+# ----------------------------------------------------------------------
+class FakeSolver(object):
+  """
+  Solver with fixed iteration counts.
+  """
+
+  def __init__(self):
+    self.numLinear = 0
+    self.numNonlinear = 0
+    return
+
+  def numLinearIterationsTotal(self):
+    return self.numLinear
+
+  def numNonlinearIterationsTotal(self):
+    return self.numNonlinear
+
+
+# ----------------------------------------------------------------------
+class FakeFormulation(object):
+  """
+  Formulation with fixed number of Jacobian reforms.
+  """
+
+  def __init__(self):
+    self.solver = FakeSolver()
+    self.numReforms = 0
+    return
+
+  def numJacobianReforms(self):
+    return self.numReforms
+
+
+# ----------------------------------------------------------------------
+class TestStepTelemetry(unittest.TestCase):
+  """
+  Unit testing of StepTelemetry object.
+  """
+
+  def setUp(self):
+    self.telemetry = StepTelemetry()
+    self.telemetry._configure()
+    self.telemetry.filename = "data/telemetry.jsonl"
+    return
+  
+
+  def test_constructor(self):
+    """
+    Test constructor.
+    """
+    telemetry = StepTelemetry()
+    telemetry._configure()
+    return
+
+
+  def test_update(self):
+    """
+    Test open(), update(), and close().
+    """
+    import os
+    if os.path.exists(self.telemetry.filename):
+        os.remove(self.telemetry.filename)
+
+    formulation = FakeFormulation()
+    self.telemetry.open(formulation)
+
+    formulation.solver.numLinear = 12
+    formulation.numReforms = 1
+    self.telemetry.update(0.0*year, 0.5*year)
+
+    formulation.solver.numLinear = 30
+    formulation.solver.numNonlinear = 2
+    self.telemetry.update(0.5*year, 0.5*year, nsteps=3)
+
+    self.telemetry.close()
+
+    import json
+    fin = open(self.telemetry.filename, "r")
+    records = [json.loads(line) for line in fin.readlines()]
+    fin.close()
+    self.assertEqual(2, len(records))
+
+    self.assertEqual(1, records[0]["step"])
+    self.assertEqual(1, records[0]["nsteps"])
+    self.assertEqual(12, records[0]["ksp_iterations"])
+    self.assertEqual(0, records[0]["snes_iterations"])
+    self.assertEqual(1, records[0]["jacobian_reforms"])
+
+    self.assertEqual(4, records[1]["step"])
+    self.assertEqual(3, records[1]["nsteps"])
+    self.assertAlmostEqual((0.5*year).value, records[1]["t"])
+    self.assertAlmostEqual((0.5*year).value, records[1]["dt"])
+    self.assertEqual(18, records[1]["ksp_iterations"])
+    self.assertEqual(2, records[1]["snes_iterations"])
+    self.assertEqual(0, records[1]["jacobian_reforms"])
+
+    for record in records:
+      for name in ["wall", "residual", "jacobian", "pc_setup", "solve", "fault", "output"]:
+        self.assertTrue(record[name] >= 0.0)
+    return
+
+
+  def test_nestedEvents(self):
+    """
+    Test subtracting assembly in SNES callbacks from solve time.
+    """
+    eventTimes = {"SoNl solve": 5.0,
+                  "SNESFunctionEval": 1.5,
+                  "SNESJacobianEval": 1.0,
+                  "ElIR compute": 1.25,
+                  "ElIJ compute": 0.75,
+                  "FaPr compute": 0.25,
+                  }
+    self.telemetry._eventTime = lambda name: eventTimes.get(name, 0.0)
+    self.telemetry.formulation = FakeFormulation()
+    counters = self.telemetry._counters()
+
+    from pylith.problems.StepTelemetry import EVENTS
+    timesE = {"residual": 1.25,
+              "jacobian": 0.75,
+              "pc_setup": 0.0,
+              "solve": 2.5,
+              "fault": 0.25,
+              "output": 0.0,
+              }
+    for (name, events, nested),value in zip(EVENTS, counters[1:]):
+      self.assertAlmostEqual(timesE[name], value)
+    return
+
+
+  def test_factory(self):
+    """
+    Test factory method.
+    """
+    from pylith.problems.StepTelemetry import step_telemetry
+    t = step_telemetry()
+    return
+
+
+# End of file 
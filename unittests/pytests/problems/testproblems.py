@@ -65,6 +65,9 @@ class TestApp(UnitTestApp):
     from TestProgressMonitorStep import TestProgressMonitorStep
     suite.addTest(unittest.makeSuite(TestProgressMonitorStep))
 
+    from TestStepTelemetry import TestStepTelemetry
+    suite.addTest(unittest.makeSuite(TestStepTelemetry))
+
     return suite
 
 